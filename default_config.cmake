@@ -180,6 +180,19 @@ set(OSAL_CONFIG_DEBUG_PRINTF                    FALSE
     CACHE BOOL "Controls inclusion of OS_DEBUG statements in the code"
 )
 
+#
+# OSAL_CONFIG_DEBUG_LEVEL
+# ----------------------------------
+#
+# The highest level of OS_DEBUG statement to compile in, when
+# OSAL_CONFIG_DEBUG_PRINTF is set.  OS_DEBUG() statements are level 1, and
+# OS_DEBUG_LEV() statements with a higher (more verbose) level than this are
+# compiled out.
+#
+set(OSAL_CONFIG_DEBUG_LEVEL                     1
+    CACHE STRING "Highest level of OS_DEBUG statements to compile in"
+)
+
 #
 # OS_CONFIG_CONSOLE_ASYNC
 # ----------------------------------
@@ -206,6 +219,99 @@ set(OSAL_CONFIG_CONSOLE_ASYNC                   TRUE
     CACHE BOOL "Controls spawning of a separate utility task for OS_printf"
 )
 
+#
+# OSAL_CONFIG_PRINTF_DEFERRED
+# ----------------------------------
+#
+# Controls whether OS_printf() formats its output in the calling task.
+#
+# If set FALSE (default), the calling task formats the message with vsnprintf()
+# and the resulting text is queued for output.
+#
+# If set TRUE, the calling task only records the format string pointer and the
+# argument values, and the utility task does the formatting before output.  This
+# reduces the time spent in OS_printf() by the calling task.  It only has an
+# effect when OSAL_CONFIG_CONSOLE_ASYNC is also TRUE.
+#
+# In this mode the format string passed to OS_printf() must remain valid until
+# the message is output, which is always the case for string literals.  Strings
+# passed via "%s" are copied at the time of the call, and "%n" is ignored.
+#
+set(OSAL_CONFIG_PRINTF_DEFERRED                 FALSE
+    CACHE BOOL "Controls deferring OS_printf formatting to the utility task"
+)
+
+#
+# OSAL_CONFIG_NAME_INDEX
+# ----------------------------------
+#
+# Controls whether object names are tracked in a hash index.
+#
+# If set FALSE, looking up an object by name (e.g. OS_TaskGetIdByName) and
+# checking for a duplicate name when creating an object both perform a linear
+# search of the object table for that type.
+#
+# If set TRUE (default), a hash index of object names is maintained for each
+# object type, so these operations take constant time regardless of the
+# configured number of objects.  This is most useful when the OSAL_CONFIG_MAX_*
+# limits are large.  The index requires an additional 12 bytes of memory per
+# object table entry.
+#
+# Note that file and directory objects are never indexed, as their names are
+# not required to be unique.
+#
+set(OSAL_CONFIG_NAME_INDEX                      TRUE
+    CACHE BOOL "Controls use of a hash index for object name lookups"
+)
+
+#
+# OSAL_CONFIG_QUEUE_RING
+# ----------------------------------
+#
+# Controls whether all message queues use an in-process ring buffer.
+#
+# If set FALSE (default), a message queue only uses the in-process ring
+# buffer if OS_QUEUE_FLAG_RING is passed to OS_QueueCreate().  Otherwise the
+# operating system message queue facility is used.
+#
+# If set TRUE, all message queues use the in-process ring buffer, as if
+# OS_QUEUE_FLAG_RING was always passed.  This avoids a system call for every
+# message sent and received, and the queue depth is not subject to the system
+# limit on message queue depth.
+#
+# This option currently only applies to the POSIX implementation on Linux,
+# other implementations always use the operating system message queues.
+#
+set(OSAL_CONFIG_QUEUE_RING                      FALSE
+    CACHE BOOL "Controls use of an in-process ring buffer for all message queues"
+)
+
+#
+# OSAL_CONFIG_TIMEBASE_TIMERFD
+# ----------------------------------
+#
+# Controls how simulated time bases are serviced.
+#
+# A time base created without an external sync function uses a host timer
+# to simulate the timer tick.  If set FALSE (default), each such time base
+# uses its own real-time signal and its own handler thread.  The number of
+# time bases is then limited by the number of real-time signals available.
+#
+# If set TRUE, each such time base instead uses a timerfd, and a single
+# dispatcher thread services all of them through epoll.  No signals are
+# used, and no thread is created per time base.  All simulated time bases
+# then share the same thread and priority, so a slow callback on one time
+# base delays the callbacks on the others.  Time bases created with an
+# external sync function still get their own handler thread, which can be
+# used where this isolation is needed.
+#
+# This option currently only applies to the POSIX implementation on Linux,
+# other implementations ignore it.
+#
+set(OSAL_CONFIG_TIMEBASE_TIMERFD                FALSE
+    CACHE BOOL "Controls use of timerfd and a single dispatcher thread for simulated time bases"
+)
+
 #############################################
 # Resource Limits for the OS API
 #############################################
@@ -243,6 +349,11 @@ set(OSAL_CONFIG_MAX_CONDVARS             4
     CACHE STRING "Maximum Number of Condition Variables to support"
 )
 
+# The maximum number of select groups to support
+set(OSAL_CONFIG_MAX_SELECT_GROUPS        4
+    CACHE STRING "Maximum Number of Select Groups to support"
+)
+
 # The maximum number of loadable modules to support
 # Note that emulating module loading for statically-linked objects also
 # requires a slot in this table, as it still assigns an OSAL ID.
@@ -303,6 +414,20 @@ set(OSAL_CONFIG_SOCKADDR_MAX_LEN        28
     CACHE STRING "Maximum Size of network socket addresses"
 )
 
+# Maximum number of datagrams transferred by a single call to
+# OS_SocketRecvFromMulti() or OS_SocketSendToMulti()
+# This is only relevant if network support is included.  Each call
+# uses stack space proportional to this value.
+set(OSAL_CONFIG_SOCKET_MSG_MAX          32
+    CACHE STRING "Maximum Number of datagrams per batched socket call"
+)
+
+# Maximum number of memory mappings that may be active on one file handle
+# Each file handle record holds a table of this many entries.
+set(OSAL_CONFIG_FILE_MAX_MAPPINGS       4
+    CACHE STRING "Maximum Number of memory mappings per file handle"
+)
+
 # Maximum length of a single message produced by OS_printf()
 set(OSAL_CONFIG_PRINTF_BUFFER_SIZE      172
     CACHE STRING "Maximum Length of single printf message"
@@ -313,6 +438,13 @@ set(OSAL_CONFIG_PRINTF_BUFFER_DEPTH     100
     CACHE STRING "Maximum Number of printf messages to buffer"
 )
 
+# Size in bytes of the per-task OS_printf() staging buffer
+# Only used when OSAL_CONFIG_CONSOLE_ASYNC is set, and must be a power of two.
+# Each task stages its messages here until the console task merges them.
+set(OSAL_CONFIG_PRINTF_STAGING_SIZE     1024
+    CACHE STRING "Size of the per-task printf staging buffer"
+)
+
 # Priority level of a console output helper task
 #
 # Set logically low (high number) to maximize performance.
@@ -348,6 +480,17 @@ set(OSAL_CONFIG_QUEUE_MAX_DEPTH         50
     CACHE STRING "Maximum depth of message queue"
 )
 
+# The number and size of the buffers for zero-copy queue operations, used
+# where the queue storage cannot be accessed directly.  Each queue has its own
+# buffers, so these affect the overall OSAL memory footprint.  A queue whose
+# data size is larger than the buffer size cannot use these operations.
+set(OSAL_CONFIG_QUEUE_ZEROCOPY_SLOTS    2
+    CACHE STRING "Number of zero-copy buffers per message queue"
+)
+set(OSAL_CONFIG_QUEUE_ZEROCOPY_SLOT_SIZE 128
+    CACHE STRING "Size of each zero-copy buffer of a message queue"
+)
+
 # Flags added to all tasks on creation
 #
 # Some OS's use floating point under the hood, this supports
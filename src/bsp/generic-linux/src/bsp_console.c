@@ -28,6 +28,7 @@
 #include <string.h>
 #include <unistd.h>
 #include <sys/types.h>
+#include <sys/uio.h>
 #include <sys/wait.h>
 
 #include "generic_linux_bsp_internal.h"
@@ -90,6 +91,56 @@ void OS_BSP_ConsoleOutput_Impl(const char *Str, size_t DataLen)
     }
 }
 
+/*----------------------------------------------------------------
+   OS_BSP_ConsoleOutputPair_Impl
+   See full description in header
+ ------------------------------------------------------------------*/
+void OS_BSP_ConsoleOutputPair_Impl(const char *Str1, size_t DataLen1, const char *Str2, size_t DataLen2)
+{
+    struct iovec  iov[2];
+    struct iovec *next;
+    int           count;
+    ssize_t       WriteLen;
+
+    iov[0].iov_base = (void *)Str1;
+    iov[0].iov_len  = DataLen1;
+    iov[1].iov_base = (void *)Str2;
+    iov[1].iov_len  = DataLen2;
+    next            = iov;
+    count           = 2;
+
+    while (count > 0)
+    {
+        if (next->iov_len == 0)
+        {
+            ++next;
+            --count;
+            continue;
+        }
+
+        /* writes both segments directly to STDOUT_FILENO (unbuffered) */
+        WriteLen = writev(STDOUT_FILENO, next, count);
+        if (WriteLen <= 0)
+        {
+            /* no recourse if this fails, just stop. */
+            break;
+        }
+
+        /* skip over whatever was written, which may end partway through a segment */
+        while (count > 0 && (size_t)WriteLen >= next->iov_len)
+        {
+            WriteLen -= next->iov_len;
+            ++next;
+            --count;
+        }
+        if (count > 0)
+        {
+            next->iov_base = (char *)next->iov_base + WriteLen;
+            next->iov_len -= WriteLen;
+        }
+    }
+}
+
 /*----------------------------------------------------------------
    OS_BSP_ConsoleSetMode_Impl() definition
    See full description in header
@@ -216,6 +216,9 @@ int main(int argc, char *argv[])
     OS_BSP_Global.ArgC = argc;
     OS_BSP_Global.ArgV = argv;
 
+    /* Console output is a single write() to STDOUT_FILENO */
+    OS_BSP_Global.ConsoleAtomicWrite = true;
+
     /*
      * Only attempt terminal control if the stdout is a TTY
      * and the TERM environment variable is set
@@ -48,6 +48,17 @@ void OS_BSP_ConsoleOutput_Impl(const char *Str, size_t DataLen)
     }
 }
 
+/*----------------------------------------------------------------
+   OS_BSP_ConsoleOutputPair_Impl
+   See full description in header
+ ------------------------------------------------------------------*/
+void OS_BSP_ConsoleOutputPair_Impl(const char *Str1, size_t DataLen1, const char *Str2, size_t DataLen2)
+{
+    /* the output is written a character at a time, so there is nothing to combine */
+    OS_BSP_ConsoleOutput_Impl(Str1, DataLen1);
+    OS_BSP_ConsoleOutput_Impl(Str2, DataLen2);
+}
+
 /*----------------------------------------------------------------
    OS_BSP_ConsoleSetMode_Impl() definition
    See full description in header
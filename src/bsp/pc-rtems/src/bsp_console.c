@@ -26,6 +26,7 @@
 #include <string.h>
 #include <unistd.h>
 #include <sys/types.h>
+#include <sys/uio.h>
 #include <sys/wait.h>
 
 #include "pcrtems_bsp_internal.h"
@@ -45,6 +46,23 @@ void OS_BSP_ConsoleOutput_Impl(const char *Str, size_t DataLen)
     write(STDOUT_FILENO, Str, DataLen);
 }
 
+/*----------------------------------------------------------------
+   OS_BSP_ConsoleOutputPair_Impl
+   See full description in header
+ ------------------------------------------------------------------*/
+void OS_BSP_ConsoleOutputPair_Impl(const char *Str1, size_t DataLen1, const char *Str2, size_t DataLen2)
+{
+    struct iovec iov[2];
+
+    iov[0].iov_base = (void *)Str1;
+    iov[0].iov_len  = DataLen1;
+    iov[1].iov_base = (void *)Str2;
+    iov[1].iov_len  = DataLen2;
+
+    /* writes both segments directly to STDOUT_FILENO (unbuffered) */
+    writev(STDOUT_FILENO, iov, 2);
+}
+
 /*----------------------------------------------------------------
    OS_BSP_ConsoleSetMode_Impl() definition
    See full description in header
@@ -356,6 +356,9 @@ rtems_task Init(rtems_task_argument ignored)
     memset(&OS_BSP_Global, 0, sizeof(OS_BSP_Global));
     memset(&OS_BSP_PcRtemsGlobal, 0, sizeof(OS_BSP_PcRtemsGlobal));
 
+    /* Console output is a single write() to STDOUT_FILENO */
+    OS_BSP_Global.ConsoleAtomicWrite = true;
+
     /*
      * Perform BSP setup -
      * Initialize the root file system, create mount points, etc.
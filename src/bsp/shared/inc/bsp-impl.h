@@ -97,6 +97,13 @@ typedef struct
     int32             AppStatus;     /* value which can be returned to the OS (0=nominal) */
     osal_blockcount_t MaxQueueDepth; /* Queue depth limit supported by BSP (0=no limit) */
 
+    /*
+     * Set if each call to OS_BSP_ConsoleOutput_Impl() is written in one piece,
+     * such that output from concurrent calls is not interleaved.  Otherwise
+     * callers must hold OS_BSP_Lock_Impl() to keep their output together.
+     */
+    bool ConsoleAtomicWrite;
+
     /*
      * Configuration registry - abstract integer flags to select platform-specific options
      * for each resource type.  Flags are all platform-defined, and not every platform uses this
@@ -148,6 +155,20 @@ void OS_BSP_Unlock_Impl(void);
  ------------------------------------------------------------------*/
 void OS_BSP_ConsoleOutput_Impl(const char *Str, size_t DataLen);
 
+/*----------------------------------------------------------------
+
+    Purpose: Low level raw console data output of two segments.
+
+             Writes Str1 followed by Str2, as OS_BSP_ConsoleOutput_Impl()
+             would if called for each of them.  Where the device allows it,
+             both are written in a single operation.  Either length may be
+             zero.
+
+             This allows the data in a ring buffer to be written out
+             in one operation when it wraps around the end of the buffer.
+ ------------------------------------------------------------------*/
+void OS_BSP_ConsoleOutputPair_Impl(const char *Str1, size_t DataLen1, const char *Str2, size_t DataLen2);
+
 /*----------------------------------------------------------------
 
     Purpose: Set the console output mode, if supported by the BSP.
@@ -115,6 +115,13 @@ typedef uint32 osal_id_t;
      */
     typedef size_t osal_blockcount_t;
 
+    /**
+     * A type used to represent a position or offset within a file
+     *
+     * This is always 64 bits, so files larger than 2GB may be addressed.
+     */
+    typedef int64 osal_offset_t;
+
     /**
      * A type used to represent an index into a table structure
      *
@@ -125,6 +125,81 @@ int32 OS_GetLocalTime(OS_time_t *time_struct);
  */
 int32 OS_SetLocalTime(const OS_time_t *time_struct);
 
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Get the monotonic time
+ *
+ * This function gets the time from a clock that is never set or adjusted,
+ * such as CLOCK_MONOTONIC on POSIX systems.  The epoch is not defined
+ * (typically it is the system boot), so this is only meaningful for
+ * measuring intervals.
+ *
+ * @param[out]  time_struct An OS_time_t that will be set to the current monotonic time @nonnull
+ *
+ * @return Get monotonic time status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_INVALID_POINTER if time_struct is null
+ */
+int32 OS_GetMonotonicTime(OS_time_t *time_struct);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Get the monotonic time, at reduced resolution
+ *
+ * This is the same clock as OS_GetMonotonicTime(), but it may be read from a
+ * value that the OS updates on each system tick (such as CLOCK_MONOTONIC_COARSE
+ * on Linux).  This is faster to read, and intended for frequent timestamps
+ * that only need resolution of about a millisecond.  Where the OS does not
+ * provide such a clock, this is identical to OS_GetMonotonicTime().
+ *
+ * @param[out]  time_struct An OS_time_t that will be set to the current monotonic time @nonnull
+ *
+ * @return Get coarse time status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_INVALID_POINTER if time_struct is null
+ */
+int32 OS_GetCoarseTime(OS_time_t *time_struct);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Read the raw hardware counter
+ *
+ * This returns a free-running counter that is read directly from the CPU
+ * where possible (the TSC on x86, or the virtual counter on AArch64), so it is
+ * the fastest way to take a timestamp.  Where no such counter is available,
+ * this is the monotonic time in nanoseconds.
+ *
+ * The rate of the counter is platform-specific.  Use OS_RawCounterToTime()
+ * to convert a difference between two values into a time interval.
+ *
+ * @note The counter is only comparable between CPUs if the hardware keeps
+ *       them synchronized, as is the case on most current systems.
+ *
+ * @return The counter value
+ */
+uint64 OS_GetRawCounter(void);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Convert a raw counter interval to time
+ *
+ * Converts a number of counts from OS_GetRawCounter() into an OS_time_t.  This
+ * is intended for the difference between two counter values.
+ *
+ * If the rate of the counter is not known, it is measured against the monotonic
+ * clock from the time OSAL was initialized.  The first call may wait for up to
+ * a millisecond for this, and the measurement becomes fixed after a second.
+ *
+ * @param[in]   count       The number of counts to convert
+ * @param[out]  time_struct An OS_time_t that will be set to the interval @nonnull
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_INVALID_POINTER if time_struct is null
+ * @retval #OS_ERROR if the rate of the counter could not be determined
+ */
+int32 OS_RawCounterToTime(uint64 count, OS_time_t *time_struct);
+
 /*-------------------------------------------------------------------------------------*/
 /**
  * @brief Gets an absolute time value relative to the current time
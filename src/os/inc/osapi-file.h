@@ -45,6 +45,24 @@
 #define OS_SEEK_END 2 /**< Seek offset end */
 /**@}*/
 
+/**
+ * @brief Maximum number of segments in a single vectored read or write
+ *
+ * This is the minimum that POSIX requires every implementation to support.
+ */
+#define OS_IOV_MAX 16
+
+/**
+ * @brief Describes one segment of a vectored (scatter/gather) read or write
+ *
+ * For write operations the data at Buffer is only read, never modified.
+ */
+typedef struct
+{
+    void * Buffer; /**< Start of the segment */
+    size_t Length; /**< Size of the segment in bytes */
+} OS_iovec_t;
+
 /** @brief OSAL file properties */
 typedef struct
 {
@@ -109,6 +127,79 @@ typedef enum
     OS_FILE_FLAG_TRUNCATE = 0x02
 } OS_file_flag_t;
 
+/**
+ * @brief Flags that can be used with memory mapping of a file (bitmask)
+ *
+ * At least one of the access flags (READ/WRITE) must be given to OS_FileMap().
+ * The advice flags are only hints, and may be ignored by the OS.
+ */
+typedef enum
+{
+    OS_FILE_MAP_READ       = 0x01,  /**< Mapped data may be read */
+    OS_FILE_MAP_WRITE      = 0x02,  /**< Mapped data may be written, changes are stored to the file */
+    OS_FILE_MAP_SEQUENTIAL = 0x10,  /**< Advice: data will be accessed in order, so read ahead */
+    OS_FILE_MAP_RANDOM     = 0x20,  /**< Advice: data will be accessed in random order, so do not read ahead */
+    OS_FILE_MAP_WILLNEED   = 0x40,  /**< Advice: all of the data will be needed soon, so start reading it in */
+    OS_FILE_MAP_SYNC       = 0x100, /**< On unmap: store all changes to the file before returning */
+} OS_file_map_flag_t;
+
+/**
+ * @brief Maximum number of memory mappings that may be active on one file handle
+ *
+ * This is normally set through the OSAL_CONFIG_FILE_MAX_MAPPINGS configuration option
+ */
+#ifndef OS_FILE_MAX_MAPPINGS
+#define OS_FILE_MAX_MAPPINGS 4
+#endif
+
+/**
+ * @brief Operations that can be requested with OS_FileAsyncSubmit()
+ */
+typedef enum
+{
+    OS_FILE_ASYNC_READ  = 1, /**< Read into the request buffer, see OS_pread() */
+    OS_FILE_ASYNC_WRITE = 2, /**< Write from the request buffer, see OS_pwrite() */
+    OS_FILE_ASYNC_SYNC  = 3  /**< Store all written data of the file to the device */
+} OS_file_async_op_t;
+
+typedef struct OS_FileAsyncReq OS_FileAsyncReq_t;
+
+/**
+ * @brief Function called when an asynchronous file request completes
+ *
+ * @param[in] Req  The completed request, with the Result field set
+ */
+typedef void (*OS_FileAsyncCallback_t)(OS_FileAsyncReq_t *Req);
+
+/**
+ * @brief An asynchronous file request
+ *
+ * This is filled in by the caller, and must remain valid (along with the
+ * buffer) until the request has completed.  Fields that are not used may
+ * be left as zero.
+ */
+struct OS_FileAsyncReq
+{
+    osal_id_t              FileId;          /**< The file handle to operate on */
+    uint32                 Operation;       /**< The operation, see @ref OS_file_async_op_t */
+    void *                 Buffer;          /**< Data buffer for read/write */
+    size_t                 Length;          /**< Size of the data buffer for read/write */
+    osal_offset_t          Offset;          /**< Position within the file for read/write */
+    OS_FileAsyncCallback_t Callback;        /**< Optional function to call on completion */
+    void *                 CallbackArg;     /**< Not used by OSAL, may be used by the callback */
+    osal_id_t              CompletionQueue; /**< Optional queue to put the request pointer on, on completion */
+    int32                  Result;          /**< On completion: byte count or status code, as for OS_pread() */
+};
+
+/**
+ * @brief Maximum number of asynchronous file requests that may be in progress at once
+ *
+ * The user may also provide a tuned value through osconfig.h
+ */
+#ifndef OS_FILE_ASYNC_MAX_REQUESTS
+#define OS_FILE_ASYNC_MAX_REQUESTS 32
+#endif
+
 /*
  * Exported Functions
  */
@@ -149,11 +240,15 @@ int32 OS_OpenCreate(osal_id_t *filedes, const char *path, int32 flags, int32 acc
  * This closes regular file handles and any other file-like resource, such as
  * network streams or pipes.
  *
+ * A file handle which still has memory mappings from OS_FileMap() cannot be
+ * closed, these must be removed with OS_FileUnmap() first.
+ *
  * @param[in] filedes   The handle ID to operate on
  *
  * @return Execution status, see @ref OSReturnCodes
  * @retval #OS_SUCCESS @copybrief OS_SUCCESS
  * @retval #OS_ERR_INVALID_ID if the file descriptor passed in is invalid
+ * @retval #OS_ERR_OBJECT_IN_USE if the file handle still has active memory mappings
  * @retval #OS_ERROR if an unexpected/unhandled error occurs @covtest
  */
 int32 OS_close(osal_id_t filedes);
@@ -360,6 +455,241 @@ int32 OS_TimedWriteAbs(osal_id_t filedes, const void *buffer, size_t nbytes, OS_
  */
 int32 OS_TimedWrite(osal_id_t filedes, const void *buffer, size_t nbytes, int32 timeout);
 
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief File/Stream scatter input with a timeout
+ *
+ * Same as OS_TimedReadAbs(), but the data is stored into a list of separate
+ * buffers, filling each segment completely before moving to the next one.
+ *
+ * As with OS_TimedReadAbs(), this returns as soon as at least 1 byte of actual
+ * data is available.  It will not attempt to fill all of the segments.
+ *
+ * @param[in]  filedes   The handle ID to operate on
+ * @param[in]  iov       List of segments to store data into @nonnull
+ * @param[in]  iovcnt    Number of entries in the iov list (1 to #OS_IOV_MAX)
+ * @param[in]  abstime   Absolute time at which this function should return, if no data is readable
+ *
+ * @returns Byte count on success or appropriate error code, see @ref OSReturnCodes
+ * @retval #OS_ERROR_TIMEOUT if no data became available during timeout period
+ * @retval #OS_ERR_INVALID_ID if the file descriptor passed in is invalid
+ * @retval #OS_ERR_INVALID_SIZE if the segment count or total size is not valid
+ * @retval #OS_INVALID_POINTER if the segment list or a segment buffer is not valid
+ * @retval 0 if at end of file/stream data
+ */
+int32 OS_TimedReadvAbs(osal_id_t filedes, const OS_iovec_t *iov, uint32 iovcnt, OS_time_t abstime);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief File/Stream scatter input with a timeout
+ *
+ * Same as OS_TimedReadvAbs(), but the timeout is relative to the current time.
+ *
+ * @param[in]  filedes   The handle ID to operate on
+ * @param[in]  iov       List of segments to store data into @nonnull
+ * @param[in]  iovcnt    Number of entries in the iov list (1 to #OS_IOV_MAX)
+ * @param[in]  timeout   Maximum time to wait, in milliseconds, relative to current time (OS_PEND = forever)
+ *
+ * @returns Byte count on success or appropriate error code, see @ref OSReturnCodes
+ * @retval #OS_ERROR_TIMEOUT if no data became available during timeout period
+ * @retval #OS_ERR_INVALID_ID if the file descriptor passed in is invalid
+ * @retval #OS_ERR_INVALID_SIZE if the segment count or total size is not valid
+ * @retval #OS_INVALID_POINTER if the segment list or a segment buffer is not valid
+ * @retval 0 if at end of file/stream data
+ */
+int32 OS_TimedReadv(osal_id_t filedes, const OS_iovec_t *iov, uint32 iovcnt, int32 timeout);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Read from a file handle into multiple buffers
+ *
+ * Same as OS_read(), but the data is stored into a list of separate buffers.
+ *
+ * @param[in]  filedes  The handle ID to operate on
+ * @param[in]  iov      List of segments to store data into @nonnull
+ * @param[in]  iovcnt   Number of entries in the iov list (1 to #OS_IOV_MAX)
+ *
+ * @return A non-negative byte count or appropriate error code, see @ref OSReturnCodes
+ * @retval #OS_INVALID_POINTER if the segment list or a segment buffer is not valid
+ * @retval #OS_ERR_INVALID_SIZE if the segment count or total size is not valid
+ * @retval #OS_ERROR if OS call failed @covtest
+ * @retval #OS_ERR_INVALID_ID if the file descriptor passed in is invalid
+ * @retval 0 if at end of file/stream data
+ */
+int32 OS_readv(osal_id_t filedes, const OS_iovec_t *iov, uint32 iovcnt);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief File/Stream gather output with a timeout
+ *
+ * Same as OS_TimedWriteAbs(), but the data is taken from a list of separate
+ * buffers in order.  This avoids copying a header and payload into a single
+ * buffer before writing them.
+ *
+ * As with OS_TimedWriteAbs(), this returns as soon as at least 1 byte of actual
+ * data is output.  It will _not_ attempt to write all of the segments.
+ *
+ * @param[in] filedes   The handle ID to operate on
+ * @param[in] iov       List of segments to write @nonnull
+ * @param[in] iovcnt    Number of entries in the iov list (1 to #OS_IOV_MAX)
+ * @param[in] abstime   Absolute time at which this function should return, if no data is writable
+ *
+ * @return A non-negative byte count or appropriate error code, see @ref OSReturnCodes
+ * @retval #OS_ERROR_TIMEOUT if no space became available during timeout period
+ * @retval #OS_ERR_INVALID_ID if the file descriptor passed in is invalid
+ * @retval #OS_ERR_INVALID_SIZE if the segment count or total size is not valid
+ * @retval #OS_INVALID_POINTER if the segment list or a segment buffer is not valid
+ * @retval 0 if file/stream cannot accept any more data
+ */
+int32 OS_TimedWritevAbs(osal_id_t filedes, const OS_iovec_t *iov, uint32 iovcnt, OS_time_t abstime);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief File/Stream gather output with a timeout
+ *
+ * Same as OS_TimedWritevAbs(), but the timeout is relative to the current time.
+ *
+ * @param[in] filedes   The handle ID to operate on
+ * @param[in] iov       List of segments to write @nonnull
+ * @param[in] iovcnt    Number of entries in the iov list (1 to #OS_IOV_MAX)
+ * @param[in] timeout   Maximum time to wait, in milliseconds, relative to current time (OS_PEND = forever)
+ *
+ * @return A non-negative byte count or appropriate error code, see @ref OSReturnCodes
+ * @retval #OS_ERROR_TIMEOUT if no space became available during timeout period
+ * @retval #OS_ERR_INVALID_ID if the file descriptor passed in is invalid
+ * @retval #OS_ERR_INVALID_SIZE if the segment count or total size is not valid
+ * @retval #OS_INVALID_POINTER if the segment list or a segment buffer is not valid
+ * @retval 0 if file/stream cannot accept any more data
+ */
+int32 OS_TimedWritev(osal_id_t filedes, const OS_iovec_t *iov, uint32 iovcnt, int32 timeout);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Write to a file handle from multiple buffers
+ *
+ * Same as OS_write(), but the data is taken from a list of separate buffers.
+ *
+ * @param[in] filedes   The handle ID to operate on
+ * @param[in] iov       List of segments to write @nonnull
+ * @param[in] iovcnt    Number of entries in the iov list (1 to #OS_IOV_MAX)
+ *
+ * @return A non-negative byte count or appropriate error code, see @ref OSReturnCodes
+ * @retval #OS_INVALID_POINTER if the segment list or a segment buffer is not valid
+ * @retval #OS_ERR_INVALID_SIZE if the segment count or total size is not valid
+ * @retval #OS_ERROR if OS call failed @covtest
+ * @retval #OS_ERR_INVALID_ID if the file descriptor passed in is invalid
+ * @retval 0 if file/stream cannot accept any more data
+ */
+int32 OS_writev(osal_id_t filedes, const OS_iovec_t *iov, uint32 iovcnt);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Read from a file handle at a given offset
+ *
+ * Reads from the given offset within the file, without using or changing
+ * the file position of the handle.  As the offset is part of the same call,
+ * several tasks may read from a shared file handle without the race between
+ * a separate OS_lseek() and OS_read().
+ *
+ * This is only usable with regular files and other handles that support seeking.
+ * Unlike OS_read(), this does not wait for data to become available.
+ *
+ * @param[in]  filedes   The handle ID to operate on
+ * @param[out] buffer    Storage location for file data @nonnull
+ * @param[in]  nbytes    Maximum number of bytes to read @nonzero
+ * @param[in]  offset    Position within the file to read from, in bytes (non-negative)
+ *
+ * @return A non-negative byte count or appropriate error code, see @ref OSReturnCodes
+ * @retval #OS_INVALID_POINTER if buffer is a null pointer
+ * @retval #OS_ERR_INVALID_SIZE if the passed-in size is not valid
+ * @retval #OS_ERR_INVALID_ARGUMENT if the offset is negative or not supported by the OS
+ * @retval #OS_ERR_OPERATION_NOT_SUPPORTED if the handle does not support seeking
+ * @retval #OS_ERROR if OS call failed @covtest
+ * @retval #OS_ERR_INVALID_ID if the file descriptor passed in is invalid
+ * @retval 0 if at end of file
+ */
+int32 OS_pread(osal_id_t filedes, void *buffer, size_t nbytes, osal_offset_t offset);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Write to a file handle at a given offset
+ *
+ * Writes to the given offset within the file, without using or changing
+ * the file position of the handle.  As the offset is part of the same call,
+ * several tasks may write to a shared file handle without the race between
+ * a separate OS_lseek() and OS_write().
+ *
+ * This is only usable with regular files and other handles that support seeking.
+ *
+ * @param[in] filedes   The handle ID to operate on
+ * @param[in] buffer    Source location for file data @nonnull
+ * @param[in] nbytes    Maximum number of bytes to write @nonzero
+ * @param[in] offset    Position within the file to write to, in bytes (non-negative)
+ *
+ * @return A non-negative byte count or appropriate error code, see @ref OSReturnCodes
+ * @retval #OS_INVALID_POINTER if buffer is NULL
+ * @retval #OS_ERR_INVALID_SIZE if the passed-in size is not valid
+ * @retval #OS_ERR_INVALID_ARGUMENT if the offset is negative or not supported by the OS
+ * @retval #OS_ERR_OPERATION_NOT_SUPPORTED if the handle does not support seeking
+ * @retval #OS_ERROR if OS call failed @covtest
+ * @retval #OS_ERR_INVALID_ID if the file descriptor passed in is invalid
+ * @retval 0 if file/stream cannot accept any more data
+ */
+int32 OS_pwrite(osal_id_t filedes, const void *buffer, size_t nbytes, osal_offset_t offset);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Maps part of an open file into memory
+ *
+ * Gives direct access to the file data at the returned address, without copying
+ * it into a separate buffer.  The file must have been opened with an access mode
+ * that permits the requested mapping access.  Changes made through a writable
+ * mapping are stored to the file.
+ *
+ * The mapping is tracked with the file handle, and remains valid until it is
+ * removed with OS_FileUnmap().  The file handle cannot be closed while it has
+ * any active mappings.
+ *
+ * @param[in]  filedes  The handle ID to operate on
+ * @param[in]  offset   Offset in the file of the data to map (need not be aligned, must not be negative)
+ * @param[in]  length   Number of bytes to map @nonzero
+ * @param[in]  flags    Access and advice flags, see #OS_file_map_flag_t
+ * @param[out] addr     Set to the address of the mapped data @nonnull
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_INVALID_POINTER if the addr argument is NULL
+ * @retval #OS_ERR_INVALID_SIZE if the length is zero
+ * @retval #OS_ERR_INVALID_ARGUMENT if the offset or flags are not valid
+ * @retval #OS_ERR_INVALID_ID if the file descriptor passed in is invalid
+ * @retval #OS_ERR_NO_FREE_IDS if the file handle already has #OS_FILE_MAX_MAPPINGS mappings
+ * @retval #OS_ERR_NOT_IMPLEMENTED if the OS does not support mapping files
+ * @retval #OS_ERROR if the OS call failed
+ */
+int32 OS_FileMap(osal_id_t filedes, osal_offset_t offset, size_t length, uint32 flags, void **addr);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Removes a memory mapping of a file
+ *
+ * Removes a mapping previously created with OS_FileMap() on the same file handle.
+ * If the #OS_FILE_MAP_SYNC flag is given, all changes made through the mapping are
+ * stored to the file before returning.  Otherwise the changes are stored later by
+ * the OS.
+ *
+ * @param[in] filedes  The handle ID to operate on
+ * @param[in] addr     The address returned from OS_FileMap() @nonnull
+ * @param[in] flags    #OS_FILE_MAP_SYNC or 0
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_INVALID_POINTER if the addr argument is NULL
+ * @retval #OS_ERR_INVALID_ARGUMENT if addr is not an active mapping of this file handle
+ * @retval #OS_ERR_INVALID_ID if the file descriptor passed in is invalid
+ * @retval #OS_ERROR if the OS call failed
+ */
+int32 OS_FileUnmap(osal_id_t filedes, void *addr, uint32 flags);
+
 /*-------------------------------------------------------------------------------------*/
 /**
  * @brief Changes the permissions of a file
@@ -413,6 +743,29 @@ int32 OS_stat(const char *path, os_fstat_t *filestats);
  */
 int32 OS_lseek(osal_id_t filedes, int32 offset, uint32 whence);
 
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Seeks to the specified position of an open file, using 64-bit offsets
+ *
+ * Same as OS_lseek(), but the offset and resulting position are 64 bits, so
+ * this may be used with files larger than 2GB.  As the position does not fit
+ * into the return code, it is stored to the position output instead.
+ *
+ * @param[in]  filedes   The handle ID to operate on
+ * @param[in]  offset    The file offset to seek to
+ * @param[in]  whence    The reference point for offset, see @ref OSFileOffset
+ * @param[out] position  Byte offset from the beginning of the file after the seek @nonnull
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_INVALID_POINTER if position is NULL
+ * @retval #OS_ERR_INVALID_ID if the file descriptor passed in is invalid
+ * @retval #OS_ERR_INVALID_ARGUMENT if the offset is not supported by the OS
+ * @retval #OS_ERR_OPERATION_NOT_SUPPORTED if the handle does not support seeking
+ * @retval #OS_ERROR if OS call failed @covtest
+ */
+int32 OS_lseek64(osal_id_t filedes, osal_offset_t offset, uint32 whence, osal_offset_t *position);
+
 /*-------------------------------------------------------------------------------------*/
 /**
  * @brief Removes a file from the file system
@@ -574,4 +927,82 @@ int32 OS_CloseAllFiles(void);
 int32 OS_CloseFileByName(const char *Filename);
 /**@}*/
 
+/** @defgroup OSAPIFileAsync OSAL Asynchronous File APIs
+ *
+ * These allow a task to start file operations that complete in the background,
+ * so it is not blocked by slow storage, and to keep several operations in
+ * progress at once.
+ *
+ * Completed requests are handed back to the application from OS_FileAsyncWait().
+ * For each completed request, this sets the Result field, calls the Callback
+ * if one is set, and then puts a pointer to the request on the CompletionQueue
+ * if one is set.  All of this is done in the task calling OS_FileAsyncWait(),
+ * so an application may use a dedicated task to dispatch completions, or may
+ * poll for completions from its own main loop.
+ *
+ * Requests on the same file may complete in any order.
+ *
+ * @{
+ */
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Starts an asynchronous file operation
+ *
+ * Checks the request and starts it in the background, without waiting for it
+ * to complete.  The request and its buffer must not be changed or released until
+ * the request has completed, see OS_FileAsyncWait().
+ *
+ * The file handle is only used to start the request.  If it is closed while the
+ * request is in progress, the request still completes on the original file.
+ *
+ * @param[in] Req  The request to start @nonnull
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS if the request was started
+ * @retval #OS_INVALID_POINTER if the request or the buffer for a read/write is NULL
+ * @retval #OS_ERR_INVALID_SIZE if the length for a read/write is not valid
+ * @retval #OS_ERR_INVALID_ARGUMENT if the operation is not valid, or the offset is negative
+ * @retval #OS_ERR_INVALID_ID if the file handle is not valid
+ * @retval #OS_ERR_NO_FREE_IDS if #OS_FILE_ASYNC_MAX_REQUESTS requests are already in progress
+ * @retval #OS_ERR_NOT_IMPLEMENTED if not supported by the OS
+ * @retval #OS_ERROR if OS call failed @covtest
+ */
+int32 OS_FileAsyncSubmit(OS_FileAsyncReq_t *Req);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Waits for asynchronous file operations to complete, with an absolute timeout
+ *
+ * Hands back all requests that have completed, as described in @ref OSAPIFileAsync.
+ * If none have completed, waits until at least one completes or the timeout expires.
+ *
+ * @param[in] abstime  Absolute time at which this function should return, if nothing completes.
+ *                     A time in the past (such as OS_TIME_ZERO) only checks for completions.
+ *
+ * @return The number of completed requests (positive) or appropriate error code,
+ *         see @ref OSReturnCodes
+ * @retval #OS_ERROR_TIMEOUT if no requests completed before the timeout
+ * @retval #OS_ERR_NOT_IMPLEMENTED if not supported by the OS
+ * @retval #OS_ERROR if OS call failed @covtest
+ */
+int32 OS_FileAsyncWaitAbs(OS_time_t abstime);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Waits for asynchronous file operations to complete, with a relative timeout
+ *
+ * Same as OS_FileAsyncWaitAbs(), but the timeout is relative to the current time.
+ *
+ * @param[in] msecs  Maximum time to wait, in milliseconds (OS_CHECK = poll only, OS_PEND = forever)
+ *
+ * @return The number of completed requests (positive) or appropriate error code,
+ *         see @ref OSReturnCodes
+ * @retval #OS_ERROR_TIMEOUT if no requests completed before the timeout
+ * @retval #OS_ERR_NOT_IMPLEMENTED if not supported by the OS
+ * @retval #OS_ERROR if OS call failed @covtest
+ */
+int32 OS_FileAsyncWait(int32 msecs);
+/**@}*/
+
 #endif /* OSAPI_FILE_H */
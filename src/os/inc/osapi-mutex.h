@@ -27,12 +27,58 @@
 
 #include "osconfig.h"
 #include "common_types.h"
+#include "osapi-clock.h"
+
+/*
+** Defines
+*/
+
+/**
+ * @brief Requests OS_MutSemCreate() to create an adaptive mutex
+ *
+ * When supplied in the "options" argument to OS_MutSemCreate(), this indicates
+ * that a task which finds the mutex locked should spin briefly, retrying the
+ * lock, before it blocks.  This avoids a trip through the kernel when the
+ * mutex only protects very short critical sections.
+ *
+ * An adaptive mutex does not use priority inheritance, unless
+ * #OS_MUTEX_FLAG_PRIO_INHERIT is also supplied.
+ *
+ * @note This is only a request.  Implementations which do not support it
+ * ignore this flag and create a regular mutex.
+ */
+#define OS_MUTEX_FLAG_ADAPTIVE 0x01
+
+/**
+ * @brief Requests OS_MutSemCreate() to create a non-recursive mutex
+ *
+ * By default a task which already holds a mutex may take it again, and must
+ * give it the same number of times to release it.  With this flag, taking a
+ * mutex which is already held by the calling task fails instead.  This makes
+ * each take and give slightly cheaper.
+ *
+ * @note This is only a request.  Implementations which do not support it
+ * ignore this flag and create a regular mutex.
+ */
+#define OS_MUTEX_FLAG_NONRECURSIVE 0x02
+
+/**
+ * @brief Requests OS_MutSemCreate() to keep priority inheritance
+ *
+ * Mutexes use priority inheritance by default.  This flag only has an effect
+ * together with #OS_MUTEX_FLAG_ADAPTIVE, where it retains priority inheritance
+ * for an adaptive mutex.
+ */
+#define OS_MUTEX_FLAG_PRIO_INHERIT 0x04
 
 /** @brief OSAL mutex properties */
 typedef struct
 {
     char      name[OS_MAX_API_NAME];
     osal_id_t creator;
+    uint32    take_count;      /**< @brief Number of times the mutex was taken */
+    uint32    contended_count; /**< @brief Number of takes which found the mutex already locked */
+    OS_time_t wait_time;       /**< @brief Total time spent waiting in contended takes */
 } OS_mut_sem_prop_t;
 
 /** @defgroup OSAPIMutex OSAL Mutex APIs
@@ -47,7 +93,9 @@ typedef struct
  *
  * @param[out]  sem_id will be set to the non-zero ID of the newly-created resource @nonnull
  * @param[in]   sem_name the name of the new resource to create @nonnull
- * @param[in]   options reserved for future use.  Should be passed as 0.
+ * @param[in]   options Set of option flags, may be a combination of
+ *                      #OS_MUTEX_FLAG_ADAPTIVE, #OS_MUTEX_FLAG_NONRECURSIVE
+ *                      and #OS_MUTEX_FLAG_PRIO_INHERIT, or 0 for a regular mutex.
  *
  * @return Execution status, see @ref OSReturnCodes
  * @retval #OS_SUCCESS @copybrief OS_SUCCESS
@@ -137,6 +185,13 @@ int32 OS_MutSemGetIdByName(osal_id_t *sem_id, const char *sem_name);
  * all of the relevant info( name and creator) about the specified mutex
  * semaphore.
  *
+ * The number of takes, contended takes and the total time spent waiting are
+ * only maintained where the implementation supports it (currently POSIX), and
+ * are zero otherwise.  The contended takes and time spent waiting are only
+ * measured for mutexes created with #OS_MUTEX_FLAG_ADAPTIVE.  These statistics are only updated by the task holding
+ * the mutex, so while other tasks are using it they are only a snapshot.  The
+ * counts wrap around at the maximum value of a uint32.
+ *
  * @param[in]  sem_id The object ID to operate on
  * @param[out] mut_prop The property object buffer to fill @nonnull
  *
@@ -27,6 +27,21 @@
 
 #include "osconfig.h"
 #include "common_types.h"
+#include "osapi-clock.h"
+
+/**
+ * @brief Console output statistics
+ *
+ * @sa OS_ConsoleGetStats()
+ */
+typedef struct
+{
+    uint32    OverflowEvents;   /**< Number of messages dropped because a buffer was full */
+    uint32    DrainCount;       /**< Number of times the utility task collected staged output */
+    uint64    BytesWritten;     /**< Total number of bytes written to the console device */
+    OS_time_t LastDrainLatency; /**< Age of the oldest message at the most recent collection */
+    OS_time_t MaxDrainLatency;  /**< Largest value of LastDrainLatency observed */
+} OS_console_stats_t;
 
 /** @defgroup OSAPIPrintf OSAL Printf APIs
  * @{
@@ -47,6 +62,10 @@
  *
  * Strings (including terminator) longer than #OS_BUFFER_SIZE will be truncated.
  *
+ * If OSAL is configured with OSAL_CONFIG_PRINTF_DEFERRED, the formatting is done
+ * later by the console utility task.  In that case the format string must remain
+ * valid after this call returns, such as a string literal.
+ *
  * The output of this routine also may be dynamically enabled or disabled by
  * the OS_printf_enable() and OS_printf_disable() calls, respectively.
  *
@@ -66,6 +85,22 @@ void OS_printf_disable(void);
  *
  */
 void OS_printf_enable(void);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Get the statistics of the console used by OS_printf
+ *
+ * The drain count and latency are only updated if the console output is
+ * written by the utility task.  The values are sampled while output may be
+ * in progress, so they are not necessarily consistent with each other.
+ *
+ * @param[out] stats Buffer to hold the console statistics @nonnull
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_INVALID_POINTER if the stats pointer is NULL
+ */
+int32 OS_ConsoleGetStats(OS_console_stats_t *stats);
 /**@}*/
 
 #endif /* OSAPI_PRINTF_H */
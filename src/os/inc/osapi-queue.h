@@ -28,11 +28,41 @@
 #include "osconfig.h"
 #include "common_types.h"
 
+/*
+** Defines
+*/
+
+/**
+ * @brief Requests OS_QueueCreate() to use an in-process ring buffer
+ *
+ * When supplied in the "flags" argument to OS_QueueCreate(), this indicates
+ * that the queue should be implemented as a ring buffer of fixed-size message
+ * slots in process memory, rather than using the operating system message
+ * queue facility.  Messages are then passed without a system call, and the
+ * OS is only involved when a reader needs to block on an empty queue.
+ *
+ * The semantics of OS_QueuePut() and OS_QueueGet() are unchanged.
+ *
+ * @note This is only a request.  Implementations which do not provide an
+ * in-process ring buffer ignore this flag and create a regular queue.  The
+ * POSIX implementation may also be configured to use the ring buffer for all
+ * queues, via the OSAL_CONFIG_QUEUE_RING build option.
+ */
+#define OS_QUEUE_FLAG_RING 0x01
+
 /** @brief OSAL queue properties */
 typedef struct
 {
-    char      name[OS_MAX_API_NAME];
-    osal_id_t creator;
+    char              name[OS_MAX_API_NAME];
+    osal_id_t         creator;
+    osal_blockcount_t depth;         /**< @brief Number of messages currently on the queue */
+    osal_blockcount_t max_depth;     /**< @brief Maximum number of messages, as configured at creation */
+    size_t            max_size;      /**< @brief Maximum size of a message, as configured at creation */
+    osal_blockcount_t high_water;    /**< @brief Greatest number of messages on the queue at any one time */
+    uint32            put_count;     /**< @brief Total number of messages put on the queue */
+    uint32            get_count;     /**< @brief Total number of messages received from the queue */
+    uint32            full_count;    /**< @brief Number of puts which failed because the queue was full */
+    uint32            timeout_count; /**< @brief Number of gets which timed out with no message */
 } OS_queue_prop_t;
 
 /** @defgroup OSAPIMsgQueue OSAL Message Queue APIs
@@ -52,7 +82,7 @@ typedef struct
  * @param[in]   queue_name the name of the new resource to create @nonnull
  * @param[in]   queue_depth the maximum depth of the queue
  * @param[in]   data_size the size of each entry in the queue @nonzero
- * @param[in]   flags options for the queue (reserved for future use, pass as 0)
+ * @param[in]   flags options for the queue, 0 or #OS_QUEUE_FLAG_RING
  *
  * @return Execution status, see @ref OSReturnCodes
  * @retval #OS_SUCCESS @copybrief OS_SUCCESS
@@ -129,6 +159,186 @@ int32 OS_QueueGet(osal_id_t queue_id, void *data, size_t size, size_t *size_copi
  */
 int32 OS_QueuePut(osal_id_t queue_id, const void *data, size_t size, uint32 flags);
 
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Reserve space for a message on a message queue
+ *
+ * This is the first half of a zero-copy put operation.  On success, the buffer pointer
+ * is set to storage for one message, which is at least the data_size of the queue.
+ * The message can be built directly in this buffer, and is then made available to
+ * readers by calling OS_QueueCommit().
+ *
+ * Where supported (such as a queue created with #OS_QUEUE_FLAG_RING on POSIX) the
+ * buffer is a slot within the queue itself, so the message is never copied.  On other
+ * implementations the buffer is one of #OS_QUEUE_ZEROCOPY_SLOTS buffers which are
+ * preallocated for each queue, and the message is copied into the queue by
+ * OS_QueueCommit(), as OS_QueuePut() would do.  In that case the data_size of the
+ * queue must not exceed #OS_QUEUE_ZEROCOPY_SLOT_SIZE.
+ *
+ * @note Every successful reservation must be completed by calling OS_QueueCommit()
+ * exactly once.  Messages which are reserved later will not be received by any reader
+ * until this happens.
+ *
+ * @param[in]   queue_id The object ID to operate on
+ * @param[out]  buffer Set to the address of the reserved message buffer @nonnull
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_ERR_INVALID_ID if the queue id passed in is not a valid queue
+ * @retval #OS_INVALID_POINTER if the buffer pointer is NULL
+ * @retval #OS_QUEUE_FULL if the queue cannot accept another message, or all of its buffers are in use
+ * @retval #OS_QUEUE_INVALID_SIZE if the data_size of the queue is too large for its buffers
+ * @retval #OS_ERROR if the OS call returns an unexpected error @covtest
+ */
+int32 OS_QueueReserve(osal_id_t queue_id, void **buffer);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Commit a message previously reserved on a message queue
+ *
+ * This is the second half of a zero-copy put operation.  The message in the buffer
+ * obtained from OS_QueueReserve() is made available to readers, and the buffer must
+ * not be accessed by the caller afterwards.
+ *
+ * @note Unless the arguments are rejected as invalid, the reservation is completed even
+ * if an error is returned.  On implementations which copy the message, OS_QUEUE_FULL
+ * may be returned here if the queue filled up after the reservation was made, in which
+ * case the message is lost.
+ *
+ * @param[in]  queue_id The object ID to operate on
+ * @param[in]  buffer The buffer returned by OS_QueueReserve() @nonnull
+ * @param[in]  size The actual size of the message in the buffer @nonzero
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_ERR_INVALID_ID if the queue id passed in is not a valid queue
+ * @retval #OS_INVALID_POINTER if the buffer is NULL, not reserved from this queue, or already committed
+ * @retval #OS_QUEUE_INVALID_SIZE if the message is too large for the queue
+ * @retval #OS_QUEUE_FULL if the message could not be copied into the queue
+ * @retval #OS_ERROR if the OS call returns an unexpected error @covtest
+ */
+int32 OS_QueueCommit(osal_id_t queue_id, void *buffer, size_t size);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Borrow the next message on a message queue
+ *
+ * This is the first half of a zero-copy get operation.  If a message is pending, the
+ * buffer pointer is set to the message immediately.  Otherwise the calling task will
+ * block until a message arrives or the timeout expires, as in OS_QueueGet().  When the
+ * caller is done with the message, it must be returned by calling OS_QueueRelease().
+ *
+ * Where supported the buffer is a slot within the queue itself, so the message is
+ * never copied.  On other implementations the message is copied into one of the
+ * preallocated buffers of the queue, as described for OS_QueueReserve().
+ *
+ * @note Every successfully borrowed message must be returned by calling OS_QueueRelease()
+ * exactly once.  The queue space used by the message is not available to writers until
+ * this happens.
+ *
+ * @param[in]   queue_id The object ID to operate on
+ * @param[out]  buffer Set to the address of the received message @nonnull
+ * @param[out]  size_copied Set to the actual size of the message @nonnull
+ * @param[in]   timeout The maximum amount of time to block, or OS_PEND to wait forever
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_ERR_INVALID_ID if the given ID does not exist
+ * @retval #OS_INVALID_POINTER if a pointer passed in is NULL
+ * @retval #OS_QUEUE_EMPTY if the Queue has no messages on it to be received
+ * @retval #OS_QUEUE_TIMEOUT if the timeout was OS_PEND and the time expired
+ * @retval #OS_QUEUE_INVALID_SIZE if the data_size of the queue is too large for its buffers
+ * @retval #OS_ERROR if all of the buffers of the queue are in use, or the OS call returns an unexpected error
+ */
+int32 OS_QueueBorrow(osal_id_t queue_id, const void **buffer, size_t *size_copied, int32 timeout);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Release a message previously borrowed from a message queue
+ *
+ * This is the second half of a zero-copy get operation.  The buffer obtained from
+ * OS_QueueBorrow() is returned to the queue, and must not be accessed by the caller
+ * afterwards.
+ *
+ * @param[in]  queue_id The object ID to operate on
+ * @param[in]  buffer The buffer returned by OS_QueueBorrow() @nonnull
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_ERR_INVALID_ID if the queue id passed in is not a valid queue
+ * @retval #OS_INVALID_POINTER if the buffer is NULL, not borrowed from this queue, or already released
+ * @retval #OS_ERROR if the OS call returns an unexpected error @covtest
+ */
+int32 OS_QueueRelease(osal_id_t queue_id, const void *buffer);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Receive several messages on a message queue
+ *
+ * Receives up to count messages in a single call.  If no message is pending, the
+ * calling task will block until a message arrives or the timeout expires, as in
+ * OS_QueueGet().  Once a message has been received, any other messages which are
+ * already pending are also received, up to the given count, but the call does not
+ * wait for further messages to arrive.
+ *
+ * The queue ID is only resolved once for the whole call, and where supported (such
+ * as a queue created with #OS_QUEUE_FLAG_RING on POSIX) the messages are taken from
+ * the queue in a single operation.  On other implementations this is equivalent to
+ * calling OS_QueueGet() repeatedly.
+ *
+ * @param[in]   queue_id The object ID to operate on
+ * @param[in]   data Array of count buffers to store the received messages @nonnull
+ * @param[in]   size The size of each data buffer @nonzero
+ * @param[out]  size_copied Array of count entries, set to the actual size of each message @nonnull
+ * @param[in]   count The maximum number of messages to receive @nonzero
+ * @param[out]  count_copied Set to the number of messages received @nonnull
+ * @param[in]   timeout The maximum amount of time to block, or OS_PEND to wait forever
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS if at least one message was received
+ * @retval #OS_ERR_INVALID_ID if the given ID does not exist
+ * @retval #OS_INVALID_POINTER if a pointer passed in is NULL
+ * @retval #OS_ERR_INVALID_SIZE if the size or count is not valid
+ * @retval #OS_QUEUE_EMPTY if the Queue has no messages on it to be received
+ * @retval #OS_QUEUE_TIMEOUT if the timeout was OS_PEND and the time expired
+ * @retval #OS_QUEUE_INVALID_SIZE if the size of the buffers is less than the queue data size
+ * @retval #OS_ERROR if the OS call returns an unexpected error @covtest
+ */
+int32 OS_QueueGetMulti(osal_id_t queue_id, void *const *data, size_t size, size_t *size_copied, uint32 count,
+                       uint32 *count_copied, int32 timeout);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Put several messages on a message queue.
+ *
+ * Puts up to count messages in a single call, in order, stopping at the first message
+ * which does not fit in the queue.  The caller should check count_put to determine how
+ * many of the messages were actually put.
+ *
+ * The queue ID is only resolved once for the whole call, and where supported (such as
+ * a queue created with #OS_QUEUE_FLAG_RING on POSIX) a task waiting on the queue is
+ * only woken once for the whole batch.  On other implementations this is equivalent
+ * to calling OS_QueuePut() repeatedly.
+ *
+ * @param[in]  queue_id The object ID to operate on
+ * @param[in]  data Array of count buffers containing the messages to put @nonnull
+ * @param[in]  size Array of count entries, the size of each message @nonnull
+ * @param[in]  count The number of messages to put @nonzero
+ * @param[out] count_put Set to the number of messages put @nonnull
+ * @param[in]  flags Currently reserved/unused, should be passed as 0
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS if at least one message was put
+ * @retval #OS_ERR_INVALID_ID if the queue id passed in is not a valid queue
+ * @retval #OS_INVALID_POINTER if a pointer passed in is NULL
+ * @retval #OS_ERR_INVALID_SIZE if the count or the size of any message is not valid
+ * @retval #OS_QUEUE_INVALID_SIZE if any message is too large for the queue
+ * @retval #OS_QUEUE_FULL if the queue cannot accept another message
+ * @retval #OS_ERROR if the OS call returns an unexpected error @covtest
+ */
+int32 OS_QueuePutMulti(osal_id_t queue_id, const void *const *data, const size_t *size, uint32 count,
+                       uint32 *count_put, uint32 flags);
+
 /*-------------------------------------------------------------------------------------*/
 /**
  * @brief Find an existing queue ID by name
@@ -154,6 +364,13 @@ int32 OS_QueueGetIdByName(osal_id_t *queue_id, const char *queue_name);
  * This function will pass back a pointer to structure that contains
  * all of the relevant info (name and creator) about the specified queue.
  *
+ * The configured depth and message size are always provided.  The current
+ * depth, high-water mark and message counts are only maintained where the
+ * implementation supports it (currently POSIX), and are zero otherwise.
+ * These statistics are updated without locking, so while other tasks are
+ * using the queue they are only a snapshot and may not be consistent with
+ * each other.  The counts wrap around at the maximum value of a uint32.
+ *
  * @param[in]   queue_id The object ID to operate on
  * @param[out]  queue_prop The property object buffer to fill @nonnull
  *
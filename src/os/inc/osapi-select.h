@@ -62,6 +62,20 @@ typedef enum
     OS_STREAM_STATE_LISTENING = 0x10  /**< @brief whether the stream is listening */
 } OS_StreamState_t;
 
+/**
+ * @brief An event reported by OS_SelectGroupWait()
+ *
+ * Identifies a handle in a select group which is ready, and the
+ * state(s) it is ready for.
+ *
+ * @sa OS_SelectGroupWait()
+ */
+typedef struct
+{
+    osal_id_t objid;      /**< @brief The handle which is ready */
+    uint32    StateFlags; /**< @brief OS_STREAM_STATE_READABLE and/or OS_STREAM_STATE_WRITABLE */
+} OS_SelectGroupEvent_t;
+
 /** @defgroup OSAPISelect OSAL Select APIs
  * @{
  */
@@ -288,6 +302,134 @@ int32 OS_SelectFdClear(OS_FdSet *Set, osal_id_t objid);
  * @retval false FDSet structure does not contain ID
  */
 bool OS_SelectFdIsSet(const OS_FdSet *Set, osal_id_t objid);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Create a select group
+ *
+ * A select group is a persistent set of file handles to wait on.  Handles
+ * are added to and removed from the group individually, and remain in the
+ * group across calls to OS_SelectGroupWait().
+ *
+ * Unlike OS_SelectMultiple(), the cost of waiting on a select group depends on
+ * the number of handles that are ready rather than the number of handles that
+ * may be open, and the range of the underlying file descriptors is not limited.
+ *
+ * @param[out] group_id   Will be set to the non-zero ID of the newly-created resource @nonnull
+ * @param[in]  group_name The name of the new resource to create @nonnull
+ * @param[in]  options    Reserved for future use.  Should be passed as 0.
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_INVALID_POINTER if group_id or group_name are NULL
+ * @retval #OS_ERR_NAME_TOO_LONG name length including null terminator greater than #OS_MAX_API_NAME
+ * @retval #OS_ERR_NO_FREE_IDS if there are no more free select group IDs
+ * @retval #OS_ERR_NAME_TAKEN if there is already a select group with the same name
+ * @retval #OS_ERR_NOT_IMPLEMENTED if select groups are not supported by this implementation
+ * @retval #OS_ERROR if an unspecified error occurs
+ */
+int32 OS_SelectGroupCreate(osal_id_t *group_id, const char *group_name, uint32 options);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Delete a select group
+ *
+ * The handles in the group are not affected.
+ *
+ * @param[in] group_id The object ID to delete
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_ERR_INVALID_ID if the id passed in is not a valid select group
+ * @retval #OS_ERROR if an unspecified error occurs
+ */
+int32 OS_SelectGroupDelete(osal_id_t group_id);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Add a file handle to a select group
+ *
+ * After this call, OS_SelectGroupWait() on the group will report the handle
+ * when it is in any of the states given in StateFlags.  If the handle is
+ * already in the group, its StateFlags are replaced.
+ *
+ * A handle is removed from all select groups automatically when it is closed.
+ *
+ * @param[in] group_id   The select group to add the handle to
+ * @param[in] objid      The handle ID to add to the group
+ * @param[in] StateFlags State flag(s) to wait for, OS_STREAM_STATE_READABLE and/or OS_STREAM_STATE_WRITABLE
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_ERR_INVALID_ID if group_id is not a valid select group or objid is not a valid handle
+ * @retval #OS_ERR_INVALID_ARGUMENT if StateFlags does not contain a state to wait for
+ * @retval #OS_ERR_OPERATION_NOT_SUPPORTED if the handle does not support select
+ * @retval #OS_ERROR if an unspecified error occurs
+ */
+int32 OS_SelectGroupAdd(osal_id_t group_id, osal_id_t objid, uint32 StateFlags);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Remove a file handle from a select group
+ *
+ * @param[in] group_id The select group to remove the handle from
+ * @param[in] objid    The handle ID to remove from the group
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_ERR_INVALID_ID if group_id is not a valid select group or objid is not a valid handle
+ * @retval #OS_ERROR if the handle is not in the group, or an unspecified error occurs
+ */
+int32 OS_SelectGroupRemove(osal_id_t group_id, osal_id_t objid);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Wait for events on the handles in a select group
+ *
+ * This function will block until at least one handle in the group is in one
+ * of the states it was added with, or the timeout has elapsed.  The ready
+ * handles are then stored in the Events array, up to MaxEvents of them.  If
+ * more handles are ready, the remainder are reported by subsequent calls.
+ *
+ * The handles are not locked or otherwise protected by this call.  If a
+ * handle in the group is closed by another task while this call is in
+ * progress, it is no longer reported.
+ *
+ * @param[in]  group_id   The select group to wait on
+ * @param[out] Events     Array to store the ready handles in @nonnull
+ * @param[in]  MaxEvents  Number of entries in the Events array @nonzero
+ * @param[out] EventCount Set to the number of entries stored in Events @nonnull
+ * @param[in]  msecs      Indicates the timeout. Positive values will wait up to that many milliseconds.
+ *                        Zero will not wait (poll). Negative values will wait forever (pend)
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS If any handle in the group is ready
+ * @retval #OS_ERROR_TIMEOUT If no handle in the group became ready within the timeout
+ * @retval #OS_INVALID_POINTER if Events or EventCount are NULL
+ * @retval #OS_ERR_INVALID_SIZE if MaxEvents is zero
+ * @retval #OS_ERR_INVALID_ID if group_id is not a valid select group
+ * @retval #OS_ERROR if an unspecified error occurs
+ */
+int32 OS_SelectGroupWait(osal_id_t group_id, OS_SelectGroupEvent_t *Events, uint32 MaxEvents, uint32 *EventCount,
+                         int32 msecs);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Find an existing select group ID by name
+ *
+ * This function tries to find a select group ID given the name.
+ * The id is returned through group_id
+ *
+ * @param[out] group_id   will be set to the ID of the existing resource
+ * @param[in]  group_name the name of the existing resource to find @nonnull
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_INVALID_POINTER is group_id or group_name are NULL pointers
+ * @retval #OS_ERR_NAME_TOO_LONG name length including null terminator greater than #OS_MAX_API_NAME
+ * @retval #OS_ERR_NAME_NOT_FOUND if the name was not found in the table
+ */
+int32 OS_SelectGroupGetIdByName(osal_id_t *group_id, const char *group_name);
 /**@}*/
 
 #endif /* OSAPI_SELECT_H */
@@ -29,6 +29,7 @@
 #include "osconfig.h"
 #include "common_types.h"
 #include "osapi-clock.h"
+#include "osapi-file.h"
 
 /*
  * The absolute maximum size of a network address
@@ -46,6 +47,17 @@
 #define OS_SOCKADDR_MAX_LEN 28
 #endif
 
+/*
+ * The maximum number of datagrams transferred by a single call to
+ * OS_SocketRecvFromMulti() or OS_SocketSendToMulti().  Larger requests are
+ * not an error, but only this many messages are transferred per call.
+ *
+ * The user may also provide a tuned value through osconfig.h
+ */
+#ifndef OS_SOCKET_MSG_MAX
+#define OS_SOCKET_MSG_MAX 32
+#endif
+
 /*
  * --------------------------------------------------------------------------------------
  * Sockets API Data Types
@@ -113,6 +125,20 @@ typedef struct
     OS_SockAddrData_t AddrData;     /**< @brief Abstract Address data */
 } OS_SockAddr_t;
 
+/**
+ * @brief Describes one datagram in a batch transfer
+ *
+ * Used with OS_SocketRecvFromMulti() and OS_SocketSendToMulti() to move
+ * several datagrams in a single call.
+ */
+typedef struct
+{
+    void *        Buffer;     /**< @brief Message data buffer */
+    size_t        BufSize;    /**< @brief Size of the buffer (receive), or length of the message (send) */
+    size_t        ActualSize; /**< @brief Output: Number of bytes actually transferred */
+    OS_SockAddr_t Addr;       /**< @brief Remote address: source on receive, destination on send */
+} OS_SockMsg_t;
+
 /**
  * @brief Encapsulates socket properties
  *
@@ -547,6 +573,102 @@ int32 OS_SocketRecvFrom(osal_id_t sock_id, void *buffer, size_t buflen, OS_SockA
  */
 int32 OS_SocketSendTo(osal_id_t sock_id, const void *buffer, size_t buflen, const OS_SockAddr_t *RemoteAddr);
 
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Sends a datagram gathered from multiple buffers
+ *
+ * Same as OS_SocketSendTo(), but the message data is taken from a list of
+ * separate buffers, in order, and sent as a single datagram.  This allows
+ * a header and payload to be sent without first copying them together.
+ *
+ * @param[in]   sock_id      The socket ID, which must be of the datagram type
+ * @param[in]   iov          List of segments that make up the message @nonnull
+ * @param[in]   iovcnt       Number of entries in the iov list (1 to #OS_IOV_MAX)
+ * @param[in]   RemoteAddr   Buffer containing the remote network address to send to
+ *
+ * @return Count of actual bytes sent or error status, see @ref OSReturnCodes
+ * @retval #OS_INVALID_POINTER if argument is NULL
+ * @retval #OS_ERR_INVALID_SIZE if the segment count or total size is not valid
+ * @retval #OS_ERR_INVALID_ID if the sock_id parameter is not valid
+ * @retval #OS_ERR_INCORRECT_OBJ_TYPE if the handle is not a socket
+ */
+int32 OS_SocketSendToV(osal_id_t sock_id, const OS_iovec_t *iov, uint32 iovcnt, const OS_SockAddr_t *RemoteAddr);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Reads a batch of datagrams from a message-oriented (datagram) socket
+ *
+ * Waits up to the given timeout for the first message, as OS_SocketRecvFromAbs()
+ * does.  Once a message is available, any further messages that are already
+ * queued on the socket are also received, up to MsgCount (and at most
+ * #OS_SOCKET_MSG_MAX), without blocking again.  This drains a burst of
+ * datagrams in a single call.
+ *
+ * For each message received, the ActualSize and Addr fields of the
+ * corresponding entry in Msgs are filled in.  Entries beyond the returned
+ * count are not modified.
+ *
+ * @param[in]     sock_id      The socket ID, previously bound using OS_SocketBind()
+ * @param[in,out] Msgs         Array of message descriptors, each with a buffer and size set @nonnull
+ * @param[in]     MsgCount     Number of entries in the Msgs array @nonzero
+ * @param[in]     abs_timeout  The absolute time at which the call should return if nothing received
+ *
+ * @return Count of messages received or error status, see @ref OSReturnCodes
+ * @retval #OS_INVALID_POINTER if argument is NULL
+ * @retval #OS_ERR_INVALID_SIZE if MsgCount or a buffer size is not valid
+ * @retval #OS_ERR_INVALID_ID if the sock_id parameter is not valid
+ * @retval #OS_ERR_INCORRECT_OBJ_TYPE if the handle is not a datagram socket
+ * @retval #OS_ERROR_TIMEOUT if no message was received before the timeout
+ */
+int32 OS_SocketRecvFromMultiAbs(osal_id_t sock_id, OS_SockMsg_t *Msgs, uint32 MsgCount, OS_time_t abs_timeout);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Reads a batch of datagrams from a message-oriented (datagram) socket
+ *
+ * Same as OS_SocketRecvFromMultiAbs(), but the timeout is expressed in
+ * milliseconds, relative to the time that the API was invoked.
+ *
+ * @param[in]     sock_id      The socket ID, previously bound using OS_SocketBind()
+ * @param[in,out] Msgs         Array of message descriptors, each with a buffer and size set @nonnull
+ * @param[in]     MsgCount     Number of entries in the Msgs array @nonzero
+ * @param[in]     timeout      The maximum amount of time to wait or OS_PEND to wait forever
+ *
+ * @sa OS_SocketRecvFromMultiAbs()
+ *
+ * @return Count of messages received or error status, see @ref OSReturnCodes
+ * @retval #OS_INVALID_POINTER if argument is NULL
+ * @retval #OS_ERR_INVALID_SIZE if MsgCount or a buffer size is not valid
+ * @retval #OS_ERR_INVALID_ID if the sock_id parameter is not valid
+ * @retval #OS_ERR_INCORRECT_OBJ_TYPE if the handle is not a datagram socket
+ * @retval #OS_ERROR_TIMEOUT if no message was received before the timeout
+ */
+int32 OS_SocketRecvFromMulti(osal_id_t sock_id, OS_SockMsg_t *Msgs, uint32 MsgCount, int32 timeout);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Sends a batch of datagrams on a message-oriented (datagram) socket
+ *
+ * Each entry in Msgs is sent as a separate datagram, of BufSize bytes, to
+ * the address in its Addr field.  As with OS_SocketSendTo(), this does not
+ * block.  If the socket cannot queue all of the messages, fewer than MsgCount
+ * may be sent; the caller should retry the remainder as needed.  At most
+ * #OS_SOCKET_MSG_MAX messages are sent per call.
+ *
+ * The ActualSize field of each message sent is filled in.
+ *
+ * @param[in]     sock_id      The socket ID, which must be of the datagram type
+ * @param[in,out] Msgs         Array of message descriptors @nonnull
+ * @param[in]     MsgCount     Number of entries in the Msgs array @nonzero
+ *
+ * @return Count of messages sent or error status, see @ref OSReturnCodes
+ * @retval #OS_INVALID_POINTER if argument is NULL
+ * @retval #OS_ERR_INVALID_SIZE if MsgCount or a message size is not valid
+ * @retval #OS_ERR_INVALID_ID if the sock_id parameter is not valid
+ * @retval #OS_ERR_INCORRECT_OBJ_TYPE if the handle is not a datagram socket
+ */
+int32 OS_SocketSendToMulti(osal_id_t sock_id, OS_SockMsg_t *Msgs, uint32 MsgCount);
+
 /*-------------------------------------------------------------------------------------*/
 /**
  * @brief Gets an OSAL ID from a given name
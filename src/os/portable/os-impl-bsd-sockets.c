@@ -43,11 +43,22 @@
  *  connect()
  *  recvfrom()
  *  sendto()
+ *  sendmsg()
+ *  recvmmsg()/sendmmsg() (only if OS_IMPL_SOCKET_HAVE_MMSG is defined)
  *  inet_pton()
  *  ntohl()/ntohs()
  *
  * As well as any headers for the struct sockaddr type and any address families in use
  */
+
+/*
+ * The batched recvmmsg()/sendmmsg() calls are GNU extensions on Linux,
+ * which must be enabled before any system header is included.
+ */
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE
+#endif
+
 #include <string.h>
 #include <errno.h>
 
@@ -472,34 +483,19 @@ int32 OS_SocketAccept_Impl(const OS_object_token_t *sock_token, const OS_object_
 
 /*----------------------------------------------------------------
  *
- *  Purpose: Implemented per internal OSAL API
- *           See prototype for argument/return detail
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Waits until the socket is readable or the timeout expires,
+ *           and gets the flags to use for the subsequent receive call.
  *
  *-----------------------------------------------------------------*/
-int32 OS_SocketRecvFrom_Impl(const OS_object_token_t *token, void *buffer, size_t buflen, OS_SockAddr_t *RemoteAddr,
-                             OS_time_t abs_timeout)
+static int32 OS_SocketRecvWait(const OS_object_token_t *token, OS_time_t abs_timeout, int *waitflags)
 {
     int32                           return_code;
-    int                             os_result;
-    int                             waitflags;
     uint32                          operation;
-    struct sockaddr *               sa;
-    socklen_t                       addrlen;
     OS_impl_file_internal_record_t *impl;
 
     impl = OS_OBJECT_TABLE_GET(OS_impl_filehandle_table, *token);
 
-    if (RemoteAddr == NULL)
-    {
-        sa      = NULL;
-        addrlen = 0;
-    }
-    else
-    {
-        addrlen = OS_SOCKADDR_MAX_LEN;
-        sa      = (struct sockaddr *)&RemoteAddr->AddrData;
-    }
-
     operation = OS_STREAM_STATE_READABLE;
     /*
      * If "O_NONBLOCK" flag is set then use select()
@@ -507,7 +503,7 @@ int32 OS_SocketRecvFrom_Impl(const OS_object_token_t *token, void *buffer, size_
      */
     if (impl->selectable)
     {
-        waitflags   = MSG_DONTWAIT;
+        *waitflags  = MSG_DONTWAIT;
         return_code = OS_SelectSingle_Impl(token, &operation, abs_timeout);
     }
     else
@@ -515,45 +511,76 @@ int32 OS_SocketRecvFrom_Impl(const OS_object_token_t *token, void *buffer, size_
         /* This is a backup option - check if the abs timeout would be a poll/check op */
         if (OS_TimeToRelativeMilliseconds(abs_timeout) == OS_CHECK)
         {
-            waitflags = MSG_DONTWAIT;
+            *waitflags = MSG_DONTWAIT;
         }
         else
         {
             /* note timeout will not be honored if >0 */
-            waitflags = 0;
+            *waitflags = 0;
         }
         return_code = OS_SUCCESS;
     }
 
+    if (return_code == OS_SUCCESS && (operation & OS_STREAM_STATE_READABLE) == 0)
+    {
+        return_code = OS_ERROR_TIMEOUT;
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_SocketRecvFrom_Impl(const OS_object_token_t *token, void *buffer, size_t buflen, OS_SockAddr_t *RemoteAddr,
+                             OS_time_t abs_timeout)
+{
+    int32                           return_code;
+    int                             os_result;
+    int                             waitflags;
+    struct sockaddr *               sa;
+    socklen_t                       addrlen;
+    OS_impl_file_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_filehandle_table, *token);
+
+    if (RemoteAddr == NULL)
+    {
+        sa      = NULL;
+        addrlen = 0;
+    }
+    else
+    {
+        addrlen = OS_SOCKADDR_MAX_LEN;
+        sa      = (struct sockaddr *)&RemoteAddr->AddrData;
+    }
+
+    return_code = OS_SocketRecvWait(token, abs_timeout, &waitflags);
     if (return_code == OS_SUCCESS)
     {
-        if ((operation & OS_STREAM_STATE_READABLE) == 0)
-        {
-            return_code = OS_ERROR_TIMEOUT;
-        }
-        else
+        os_result = recvfrom(impl->fd, buffer, buflen, waitflags, sa, &addrlen);
+        if (os_result < 0)
         {
-            os_result = recvfrom(impl->fd, buffer, buflen, waitflags, sa, &addrlen);
-            if (os_result < 0)
+            if (errno == EAGAIN || errno == EWOULDBLOCK)
             {
-                if (errno == EAGAIN || errno == EWOULDBLOCK)
-                {
-                    return_code = OS_QUEUE_EMPTY;
-                }
-                else
-                {
-                    OS_DEBUG("recvfrom: %s\n", strerror(errno));
-                    return_code = OS_ERROR;
-                }
+                return_code = OS_QUEUE_EMPTY;
             }
             else
             {
-                return_code = os_result;
+                OS_DEBUG("recvfrom: %s\n", strerror(errno));
+                return_code = OS_ERROR;
+            }
+        }
+        else
+        {
+            return_code = os_result;
 
-                if (RemoteAddr != NULL)
-                {
-                    RemoteAddr->ActualLength = addrlen;
-                }
+            if (RemoteAddr != NULL)
+            {
+                RemoteAddr->ActualLength = addrlen;
             }
         }
     }
@@ -563,21 +590,15 @@ int32 OS_SocketRecvFrom_Impl(const OS_object_token_t *token, void *buffer, size_
 
 /*----------------------------------------------------------------
  *
- *  Purpose: Implemented per internal OSAL API
- *           See prototype for argument/return detail
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Gets the length of the address structure for the given address family,
+ *           or 0 if the family is not supported.
  *
  *-----------------------------------------------------------------*/
-int32 OS_SocketSendTo_Impl(const OS_object_token_t *token, const void *buffer, size_t buflen,
-                           const OS_SockAddr_t *RemoteAddr)
+static socklen_t OS_SocketAddrLength(const struct sockaddr *sa)
 {
-    int                             os_result;
-    socklen_t                       addrlen;
-    const struct sockaddr *         sa;
-    OS_impl_file_internal_record_t *impl;
-
-    impl = OS_OBJECT_TABLE_GET(OS_impl_filehandle_table, *token);
+    socklen_t addrlen;
 
-    sa = (const struct sockaddr *)&RemoteAddr->AddrData;
     switch (sa->sa_family)
     {
         case AF_INET:
@@ -593,6 +614,28 @@ int32 OS_SocketSendTo_Impl(const OS_object_token_t *token, const void *buffer, s
             break;
     }
 
+    return addrlen;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_SocketSendTo_Impl(const OS_object_token_t *token, const void *buffer, size_t buflen,
+                           const OS_SockAddr_t *RemoteAddr)
+{
+    int                             os_result;
+    socklen_t                       addrlen;
+    const struct sockaddr *         sa;
+    OS_impl_file_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_filehandle_table, *token);
+
+    sa      = (const struct sockaddr *)&RemoteAddr->AddrData;
+    addrlen = OS_SocketAddrLength(sa);
+
     if (addrlen != RemoteAddr->ActualLength)
     {
         return OS_ERR_BAD_ADDRESS;
@@ -608,6 +651,239 @@ int32 OS_SocketSendTo_Impl(const OS_object_token_t *token, const void *buffer, s
     return os_result;
 }
 
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_SocketSendToV_Impl(const OS_object_token_t *token, const OS_iovec_t *iov, uint32 iovcnt,
+                            const OS_SockAddr_t *RemoteAddr)
+{
+    int                             os_result;
+    uint32                          i;
+    struct iovec                    os_iov[OS_IOV_MAX];
+    struct msghdr                   msg;
+    OS_impl_file_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_filehandle_table, *token);
+
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_name    = (void *)&RemoteAddr->AddrData;
+    msg.msg_namelen = OS_SocketAddrLength(msg.msg_name);
+
+    if (msg.msg_namelen != RemoteAddr->ActualLength)
+    {
+        return OS_ERR_BAD_ADDRESS;
+    }
+
+    /* Only the segment descriptors are copied here, not the data they refer to */
+    for (i = 0; i < iovcnt; ++i)
+    {
+        os_iov[i].iov_base = iov[i].Buffer;
+        os_iov[i].iov_len  = iov[i].Length;
+    }
+
+    msg.msg_iov    = os_iov;
+    msg.msg_iovlen = iovcnt;
+
+    os_result = sendmsg(impl->fd, &msg, MSG_DONTWAIT);
+    if (os_result < 0)
+    {
+        OS_DEBUG("sendmsg: %s\n", strerror(errno));
+        return OS_ERROR;
+    }
+
+    return os_result;
+}
+
+#ifdef OS_IMPL_SOCKET_HAVE_MMSG
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_SocketRecvFromMulti_Impl(const OS_object_token_t *token, OS_SockMsg_t *Msgs, uint32 MsgCount,
+                                  OS_time_t abs_timeout)
+{
+    int32                           return_code;
+    int                             os_result;
+    int                             waitflags;
+    uint32                          i;
+    struct mmsghdr                  os_msgs[OS_SOCKET_MSG_MAX];
+    struct iovec                    os_iov[OS_SOCKET_MSG_MAX];
+    OS_impl_file_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_filehandle_table, *token);
+
+    return_code = OS_SocketRecvWait(token, abs_timeout, &waitflags);
+    if (return_code != OS_SUCCESS)
+    {
+        return return_code;
+    }
+
+    /* If blocking, only block for the first message, then take whatever else is queued */
+    if (waitflags == 0)
+    {
+        waitflags = MSG_WAITFORONE;
+    }
+
+    memset(os_msgs, 0, sizeof(os_msgs[0]) * MsgCount);
+    for (i = 0; i < MsgCount; ++i)
+    {
+        os_iov[i].iov_base             = Msgs[i].Buffer;
+        os_iov[i].iov_len              = Msgs[i].BufSize;
+        os_msgs[i].msg_hdr.msg_iov     = &os_iov[i];
+        os_msgs[i].msg_hdr.msg_iovlen  = 1;
+        os_msgs[i].msg_hdr.msg_name    = &Msgs[i].Addr.AddrData;
+        os_msgs[i].msg_hdr.msg_namelen = OS_SOCKADDR_MAX_LEN;
+    }
+
+    os_result = recvmmsg(impl->fd, os_msgs, MsgCount, waitflags, NULL);
+    if (os_result < 0)
+    {
+        if (errno == EAGAIN || errno == EWOULDBLOCK)
+        {
+            return OS_QUEUE_EMPTY;
+        }
+
+        OS_DEBUG("recvmmsg: %s\n", strerror(errno));
+        return OS_ERROR;
+    }
+
+    for (i = 0; i < (uint32)os_result; ++i)
+    {
+        Msgs[i].ActualSize        = os_msgs[i].msg_len;
+        Msgs[i].Addr.ActualLength = os_msgs[i].msg_hdr.msg_namelen;
+    }
+
+    return os_result;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_SocketSendToMulti_Impl(const OS_object_token_t *token, OS_SockMsg_t *Msgs, uint32 MsgCount)
+{
+    int                             os_result;
+    uint32                          i;
+    struct mmsghdr                  os_msgs[OS_SOCKET_MSG_MAX];
+    struct iovec                    os_iov[OS_SOCKET_MSG_MAX];
+    OS_impl_file_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_filehandle_table, *token);
+
+    memset(os_msgs, 0, sizeof(os_msgs[0]) * MsgCount);
+    for (i = 0; i < MsgCount; ++i)
+    {
+        os_msgs[i].msg_hdr.msg_name    = &Msgs[i].Addr.AddrData;
+        os_msgs[i].msg_hdr.msg_namelen = OS_SocketAddrLength(os_msgs[i].msg_hdr.msg_name);
+
+        /* Nothing is sent if any address is invalid */
+        if (os_msgs[i].msg_hdr.msg_namelen != Msgs[i].Addr.ActualLength)
+        {
+            return OS_ERR_BAD_ADDRESS;
+        }
+
+        os_iov[i].iov_base            = Msgs[i].Buffer;
+        os_iov[i].iov_len             = Msgs[i].BufSize;
+        os_msgs[i].msg_hdr.msg_iov    = &os_iov[i];
+        os_msgs[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    os_result = sendmmsg(impl->fd, os_msgs, MsgCount, MSG_DONTWAIT);
+    if (os_result < 0)
+    {
+        OS_DEBUG("sendmmsg: %s\n", strerror(errno));
+        return OS_ERROR;
+    }
+
+    for (i = 0; i < (uint32)os_result; ++i)
+    {
+        Msgs[i].ActualSize = os_msgs[i].msg_len;
+    }
+
+    return os_result;
+}
+
+#else
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *  Without a batched receive call, this receives one message at a time.
+ *  Only the first message waits for the timeout, the rest are polled.
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_SocketRecvFromMulti_Impl(const OS_object_token_t *token, OS_SockMsg_t *Msgs, uint32 MsgCount,
+                                  OS_time_t abs_timeout)
+{
+    int32  return_code;
+    uint32 i;
+
+    return_code = OS_SUCCESS;
+    for (i = 0; i < MsgCount; ++i)
+    {
+        return_code = OS_SocketRecvFrom_Impl(token, Msgs[i].Buffer, Msgs[i].BufSize, &Msgs[i].Addr, abs_timeout);
+        if (return_code < 0)
+        {
+            break;
+        }
+
+        Msgs[i].ActualSize = return_code;
+        abs_timeout        = OS_TIME_ZERO;
+    }
+
+    if (i == 0)
+    {
+        return return_code;
+    }
+
+    return i;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *  Without a batched send call, this sends one message at a time.
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_SocketSendToMulti_Impl(const OS_object_token_t *token, OS_SockMsg_t *Msgs, uint32 MsgCount)
+{
+    int32  return_code;
+    uint32 i;
+
+    return_code = OS_SUCCESS;
+    for (i = 0; i < MsgCount; ++i)
+    {
+        return_code = OS_SocketSendTo_Impl(token, Msgs[i].Buffer, Msgs[i].BufSize, &Msgs[i].Addr);
+        if (return_code < 0)
+        {
+            break;
+        }
+
+        Msgs[i].ActualSize = return_code;
+    }
+
+    if (i == 0)
+    {
+        return return_code;
+    }
+
+    return i;
+}
+
+#endif /* OS_IMPL_SOCKET_HAVE_MMSG */
+
 /*----------------------------------------------------------------
  *
  *  Purpose: Implemented per internal OSAL API
@@ -56,38 +56,37 @@ void OS_ConsoleOutput_Impl(const OS_object_token_t *token)
     size_t                        StartPos;
     size_t                        EndPos;
     size_t                        WriteSize;
+    size_t                        WrapSize;
     OS_console_internal_record_t *console;
 
     console  = OS_OBJECT_TABLE_GET(OS_console_table, *token);
     StartPos = console->ReadPos;
     EndPos   = console->WritePos;
 
-    OS_BSP_Lock_Impl();
+    if (StartPos > EndPos)
+    {
+        /* handle wrap - the data continues from the start of the buffer */
+        WriteSize = console->BufSize - StartPos;
+        WrapSize  = EndPos;
+    }
+    else
+    {
+        WriteSize = EndPos - StartPos;
+        WrapSize  = 0;
+    }
 
-    while (StartPos != EndPos)
+    if (WriteSize != 0)
     {
-        if (StartPos > EndPos)
-        {
-            /* handle wrap */
-            WriteSize = console->BufSize - StartPos;
-        }
-        else
-        {
-            WriteSize = EndPos - StartPos;
-        }
+        OS_BSP_Lock_Impl();
 
-        OS_BSP_ConsoleOutput_Impl(&console->BufBase[StartPos], WriteSize);
+        /* both segments are written together, so a wrap does not cost an extra write */
+        OS_BSP_ConsoleOutputPair_Impl(&console->BufBase[StartPos], WriteSize, console->BufBase, WrapSize);
 
-        StartPos += WriteSize;
-        if (StartPos >= console->BufSize)
-        {
-            /* handle wrap */
-            StartPos = 0;
-        }
-    }
+        OS_BSP_Unlock_Impl();
 
-    OS_BSP_Unlock_Impl();
+        __atomic_add_fetch(&console->BytesWritten, WriteSize + WrapSize, __ATOMIC_RELAXED);
+    }
 
     /* Update the global with the new read location */
-    console->ReadPos = StartPos;
+    console->ReadPos = EndPos;
 }
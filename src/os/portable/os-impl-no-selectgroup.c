@@ -0,0 +1,58 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *
+ * Purpose: All functions return OS_ERR_NOT_IMPLEMENTED.
+ * This is used when select groups are not supported by the platform.
+ */
+
+/****************************************************************************************
+                                    INCLUDE FILES
+ ***************************************************************************************/
+
+#include <osapi.h>
+#include "os-shared-select.h"
+
+int32 OS_SelectGroupCreate_Impl(const OS_object_token_t *token, uint32 options)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
+int32 OS_SelectGroupDelete_Impl(const OS_object_token_t *token)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
+int32 OS_SelectGroupAdd_Impl(const OS_object_token_t *token, const OS_object_token_t *stream_token,
+                             uint32 StateFlags)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
+int32 OS_SelectGroupRemove_Impl(const OS_object_token_t *token, const OS_object_token_t *stream_token)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
+int32 OS_SelectGroupWait_Impl(const OS_object_token_t *token, OS_SelectGroupEvent_t *Events, uint32 MaxEvents,
+                              uint32 *EventCount, OS_time_t abs_timeout)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
@@ -122,6 +122,38 @@ int32 OS_SocketSendTo_Impl(const OS_object_token_t *token, const void *buffer, s
     return OS_ERR_NOT_IMPLEMENTED;
 }
 
+/*----------------------------------------------------------------
+ * Implementation for no network configuration
+ *
+ * See prototype for argument/return detail
+ *-----------------------------------------------------------------*/
+int32 OS_SocketSendToV_Impl(const OS_object_token_t *token, const OS_iovec_t *iov, uint32 iovcnt,
+                            const OS_SockAddr_t *RemoteAddr)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
+/*----------------------------------------------------------------
+ * Implementation for no network configuration
+ *
+ * See prototype for argument/return detail
+ *-----------------------------------------------------------------*/
+int32 OS_SocketRecvFromMulti_Impl(const OS_object_token_t *token, OS_SockMsg_t *Msgs, uint32 MsgCount,
+                                  OS_time_t abs_timeout)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
+/*----------------------------------------------------------------
+ * Implementation for no network configuration
+ *
+ * See prototype for argument/return detail
+ *-----------------------------------------------------------------*/
+int32 OS_SocketSendToMulti_Impl(const OS_object_token_t *token, OS_SockMsg_t *Msgs, uint32 MsgCount)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
 /*----------------------------------------------------------------
  * Implementation for no network configuration
  *
@@ -32,6 +32,11 @@
  * so the application will also see any manual/administrative clock changes.
  *
  * The clock ID is selected by defining the #OSAL_GETTIME_SOURCE_CLOCK macro.
+ * Likewise the monotonic and coarse clocks are selected by defining the
+ * #OSAL_GETTIME_MONOTONIC_CLOCK and #OSAL_GETTIME_COARSE_CLOCK macros.
+ *
+ * The raw counter is read directly from the CPU when compiled for a CPU
+ * that has a suitable counter, otherwise it is the monotonic clock.
  */
 
 /****************************************************************************************
@@ -55,23 +60,37 @@
 #include "os-impl-gettime.h"
 #include "os-shared-clock.h"
 
+/****************************************************************************************
+                                     DEFINES
+ ***************************************************************************************/
+
+/*
+ * CPU counters that can be read directly.  The TSC rate is not
+ * reported by the CPU, so it is measured by the shared layer.
+ */
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+#define OS_GETTIME_HAVE_TSC
+#elif defined(__GNUC__) && defined(__aarch64__)
+#define OS_GETTIME_HAVE_CNTVCT
+#endif
+
 /****************************************************************************************
                                 FUNCTIONS
  ***************************************************************************************/
 
 /*----------------------------------------------------------------
  *
- *  Purpose: Implemented per internal OSAL API
- *           See prototype for argument/return detail
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Reads the given clock into an OS_time_t
  *
  *-----------------------------------------------------------------*/
-int32 OS_GetLocalTime_Impl(OS_time_t *time_struct)
+static int32 OS_GetClockTime_Impl(clockid_t ClockId, OS_time_t *time_struct)
 {
     int             Status;
     int32           ReturnCode;
     struct timespec TimeSp;
 
-    Status = clock_gettime(OSAL_GETTIME_SOURCE_CLOCK, &TimeSp);
+    Status = clock_gettime(ClockId, &TimeSp);
 
     if (Status == 0)
     {
@@ -87,6 +106,17 @@ int32 OS_GetLocalTime_Impl(OS_time_t *time_struct)
     return ReturnCode;
 }
 
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_GetLocalTime_Impl(OS_time_t *time_struct)
+{
+    return OS_GetClockTime_Impl(OSAL_GETTIME_SOURCE_CLOCK, time_struct);
+}
+
 /*----------------------------------------------------------------
  *
  *  Purpose: Implemented per internal OSAL API
@@ -115,3 +145,74 @@ int32 OS_SetLocalTime_Impl(const OS_time_t *time_struct)
 
     return ReturnCode;
 }
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_GetMonotonicTime_Impl(OS_time_t *time_struct)
+{
+    return OS_GetClockTime_Impl(OSAL_GETTIME_MONOTONIC_CLOCK, time_struct);
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_GetCoarseTime_Impl(OS_time_t *time_struct)
+{
+    return OS_GetClockTime_Impl(OSAL_GETTIME_COARSE_CLOCK, time_struct);
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint64 OS_GetRawCounter_Impl(void)
+{
+#if defined(OS_GETTIME_HAVE_TSC)
+    return __builtin_ia32_rdtsc();
+#elif defined(OS_GETTIME_HAVE_CNTVCT)
+    uint64 Count;
+
+    /* the isb keeps the counter from being read ahead of earlier instructions */
+    __asm__ __volatile__("isb; mrs %0, cntvct_el0" : "=r"(Count) : : "memory");
+    return Count;
+#else
+    struct timespec TimeSp;
+
+    /* no counter, so use the monotonic clock in nanoseconds */
+    if (clock_gettime(OSAL_GETTIME_MONOTONIC_CLOCK, &TimeSp) != 0)
+    {
+        return 0;
+    }
+    return ((uint64)TimeSp.tv_sec * 1000000000) + TimeSp.tv_nsec;
+#endif
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint64 OS_GetRawCounterFreq_Impl(void)
+{
+#if defined(OS_GETTIME_HAVE_TSC)
+    /* not reported by the CPU, so it will be measured */
+    return 0;
+#elif defined(OS_GETTIME_HAVE_CNTVCT)
+    uint64 Freq;
+
+    __asm__ __volatile__("mrs %0, cntfrq_el0" : "=r"(Freq));
+    return Freq;
+#else
+    return 1000000000;
+#endif
+}
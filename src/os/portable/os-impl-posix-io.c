@@ -38,6 +38,11 @@
  *
  *   read()
  *   write()
+ *   pread()
+ *   pwrite()
+ *   lseek()
+ *   readv()
+ *   writev()
  *   close()
  */
 #include <string.h>
@@ -97,6 +102,32 @@ int32 OS_GenericClose_Impl(const OS_object_token_t *token)
  *
  *-----------------------------------------------------------------*/
 int32 OS_GenericSeek_Impl(const OS_object_token_t *token, int32 offset, uint32 whence)
+{
+    osal_offset_t position;
+    int32         retval;
+
+    retval = OS_GenericSeek64_Impl(token, offset, whence, &position);
+    if (retval == OS_SUCCESS)
+    {
+        /*
+         * convert value to int32 type for returning to caller.
+         * Note that this could potentially overflow an int32
+         * for a large file seek.
+         */
+        retval = (int32)position;
+    }
+
+    return retval;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_GenericSeek64_Impl(const OS_object_token_t *token, osal_offset_t offset, uint32 whence,
+                            osal_offset_t *position)
 {
     int                             where;
     off_t                           os_result;
@@ -120,6 +151,12 @@ int32 OS_GenericSeek_Impl(const OS_object_token_t *token, int32 offset, uint32 w
             return OS_ERROR;
     }
 
+    /* off_t may still be 32 bits, if the system was not built for large files */
+    if ((off_t)offset != offset)
+    {
+        return OS_ERR_INVALID_ARGUMENT;
+    }
+
     os_result = lseek(impl->fd, (off_t)offset, where);
     if (os_result == (off_t)-1)
     {
@@ -145,12 +182,8 @@ int32 OS_GenericSeek_Impl(const OS_object_token_t *token, int32 offset, uint32 w
     }
     else
     {
-        /*
-         * convert value to int32 type for returning to caller.
-         * Note that this could potentially overflow an int32
-         * for a large file seek.
-         */
-        retval = (int32)os_result;
+        *position = os_result;
+        retval    = OS_SUCCESS;
     }
 
     return retval;
@@ -263,3 +296,186 @@ int32 OS_GenericWrite_Impl(const OS_object_token_t *token, const void *buffer, s
 
     return return_code;
 }
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Converts the OSAL segment list to the C library form.
+ *           Only the segment descriptors are copied, not the data.
+ *
+ *-----------------------------------------------------------------*/
+static void OS_GenericIoVecConvert(struct iovec *os_iov, const OS_iovec_t *iov, uint32 iovcnt)
+{
+    uint32 i;
+
+    for (i = 0; i < iovcnt; ++i)
+    {
+        os_iov[i].iov_base = iov[i].Buffer;
+        os_iov[i].iov_len  = iov[i].Length;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_GenericPread_Impl(const OS_object_token_t *token, void *buffer, size_t nbytes, osal_offset_t offset)
+{
+    ssize_t                         os_result;
+    OS_impl_file_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_filehandle_table, *token);
+
+    if ((off_t)offset != offset)
+    {
+        return OS_ERR_INVALID_ARGUMENT;
+    }
+
+    /*
+     * No select() here - this only applies to seekable handles, which
+     * do not block waiting for data to appear.
+     */
+    os_result = pread(impl->fd, buffer, nbytes, (off_t)offset);
+    if (os_result < 0)
+    {
+        if (errno == ESPIPE)
+        {
+            return OS_ERR_OPERATION_NOT_SUPPORTED;
+        }
+
+        OS_DEBUG("pread: %s\n", strerror(errno));
+        return OS_ERROR;
+    }
+
+    /* type conversion from ssize_t to int32 for return */
+    return (int32)os_result;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_GenericPwrite_Impl(const OS_object_token_t *token, const void *buffer, size_t nbytes,
+                            osal_offset_t offset)
+{
+    ssize_t                         os_result;
+    OS_impl_file_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_filehandle_table, *token);
+
+    if ((off_t)offset != offset)
+    {
+        return OS_ERR_INVALID_ARGUMENT;
+    }
+
+    os_result = pwrite(impl->fd, GENERIC_IO_CONST_DATA_CAST buffer, nbytes, (off_t)offset);
+    if (os_result < 0)
+    {
+        if (errno == ESPIPE)
+        {
+            return OS_ERR_OPERATION_NOT_SUPPORTED;
+        }
+
+        OS_DEBUG("pwrite: %s\n", strerror(errno));
+        return OS_ERROR;
+    }
+
+    /* type conversion from ssize_t to int32 for return */
+    return (int32)os_result;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_GenericReadv_Impl(const OS_object_token_t *token, const OS_iovec_t *iov, uint32 iovcnt,
+                           OS_time_t abs_timeout)
+{
+    int32                           return_code;
+    ssize_t                         os_result;
+    uint32                          operation;
+    struct iovec                    os_iov[OS_IOV_MAX];
+    OS_impl_file_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_filehandle_table, *token);
+
+    return_code = OS_SUCCESS;
+    operation   = OS_STREAM_STATE_READABLE;
+
+    /* Same as OS_GenericRead_Impl() - select() is the only way to get a timeout */
+    if (impl->selectable)
+    {
+        return_code = OS_SelectSingle_Impl(token, &operation, abs_timeout);
+    }
+
+    if (return_code == OS_SUCCESS && (operation & OS_STREAM_STATE_READABLE) != 0)
+    {
+        OS_GenericIoVecConvert(os_iov, iov, iovcnt);
+
+        os_result = readv(impl->fd, os_iov, iovcnt);
+        if (os_result < 0)
+        {
+            OS_DEBUG("readv: %s\n", strerror(errno));
+            return_code = OS_ERROR;
+        }
+        else
+        {
+            /* type conversion from ssize_t to int32 for return */
+            return_code = (int32)os_result;
+        }
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_GenericWritev_Impl(const OS_object_token_t *token, const OS_iovec_t *iov, uint32 iovcnt,
+                            OS_time_t abs_timeout)
+{
+    int32                           return_code;
+    ssize_t                         os_result;
+    uint32                          operation;
+    struct iovec                    os_iov[OS_IOV_MAX];
+    OS_impl_file_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_filehandle_table, *token);
+
+    return_code = OS_SUCCESS;
+    operation   = OS_STREAM_STATE_WRITABLE;
+
+    /* Same as OS_GenericWrite_Impl() - select() is the only way to get a timeout */
+    if (impl->selectable)
+    {
+        return_code = OS_SelectSingle_Impl(token, &operation, abs_timeout);
+    }
+
+    if (return_code == OS_SUCCESS && (operation & OS_STREAM_STATE_WRITABLE) != 0)
+    {
+        OS_GenericIoVecConvert(os_iov, iov, iovcnt);
+
+        os_result = writev(impl->fd, os_iov, iovcnt);
+        if (os_result < 0)
+        {
+            OS_DEBUG("writev: %s\n", strerror(errno));
+            return_code = OS_ERROR;
+        }
+        else
+        {
+            /* type conversion from ssize_t to int32 for return */
+            return_code = (int32)os_result;
+        }
+    }
+
+    return return_code;
+}
@@ -33,10 +33,15 @@
 /* Binary Semaphores */
 typedef struct
 {
+#ifdef OS_POSIX_HAVE_FUTEX
+    uint32 state;   /**< futex word, bit 0 is the value and the remaining bits are the flush generation */
+    uint32 waiters; /**< number of tasks blocked on state */
+#else
     pthread_mutex_t       id;
     pthread_cond_t        cv;
     volatile sig_atomic_t flush_request;
     volatile sig_atomic_t current_value;
+#endif
 } OS_impl_binsem_internal_record_t;
 
 /* Tables where the OS object information is stored */
@@ -37,4 +37,24 @@
  */
 #define OSAL_GETTIME_SOURCE_CLOCK CLOCK_REALTIME
 
+/**
+ * \brief Identifies the clock ID for monotonic time
+ *
+ * This is the clock ID that will be used to implement
+ * OS_GetMonotonicTime().
+ */
+#define OSAL_GETTIME_MONOTONIC_CLOCK CLOCK_MONOTONIC
+
+/**
+ * \brief Identifies the clock ID for coarse monotonic time
+ *
+ * This is the clock ID that will be used to implement OS_GetCoarseTime().
+ * Linux provides a clock that is read from the value updated on each tick.
+ */
+#ifdef CLOCK_MONOTONIC_COARSE
+#define OSAL_GETTIME_COARSE_CLOCK CLOCK_MONOTONIC_COARSE
+#else
+#define OSAL_GETTIME_COARSE_CLOCK CLOCK_MONOTONIC
+#endif
+
 #endif /* OS_IMPL_GETTIME_H */
@@ -34,6 +34,7 @@ typedef struct
 {
     pthread_mutex_t mutex;
     pthread_cond_t  cond;
+    uint32          waiters; /**< Number of tasks blocked on "cond", protected by "mutex" */
 } OS_impl_objtype_lock_t;
 
 /* Tables where the lock state information is stored */
@@ -33,6 +33,15 @@
 typedef struct
 {
     pthread_mutex_t id;
+    bool            adaptive;   /**< set if created with OS_MUTEX_FLAG_ADAPTIVE */
+    uint32          spin_limit; /**< number of lock retries before blocking, 0 if not adaptive */
+
+    /*
+     * Statistics, these are only updated while holding the mutex
+     */
+    uint32 take_count;
+    uint32 contended_count;
+    uint64 wait_time_ns;
 } OS_impl_mutex_internal_record_t;
 
 /* Tables where the OS object information is stored */
@@ -29,10 +29,79 @@
 #include "osconfig.h"
 #include <mqueue.h>
 
+/*
+ * Alignment of the separately-updated parts of an in-process ring queue.
+ * Keeping these on different cache lines avoids false sharing between
+ * producers and consumers.
+ */
+#define OS_POSIX_QUEUE_RING_ALIGN 64
+
+/* a ring index or counter, padded to occupy a full cache line */
+typedef union
+{
+    uint32 value;
+    uint8  pad[OS_POSIX_QUEUE_RING_ALIGN];
+} OS_impl_queue_ring_word_t;
+
+/* owner of a message slot which was handed out by a zero-copy operation */
+enum
+{
+    OS_POSIX_QUEUE_SLOT_NONE,     /**< not handed out, or handed out and already returned */
+    OS_POSIX_QUEUE_SLOT_RESERVED, /**< handed out by OS_QueueReserve(), until OS_QueueCommit() */
+    OS_POSIX_QUEUE_SLOT_BORROWED  /**< handed out by OS_QueueBorrow(), until OS_QueueRelease() */
+};
+
+/* header of each message slot in an in-process ring queue */
+typedef struct
+{
+    uint32 seq;   /**< sequence number, indicates whether the slot is ready for a put or a get */
+    uint32 size;  /**< actual size of the message in this slot */
+    uint32 owner; /**< one of the OS_POSIX_QUEUE_SLOT_* values */
+} OS_impl_queue_ring_slot_t;
+
+/*
+ * In-process ring queue
+ *
+ * This is a bounded multi-producer/multi-consumer ring of fixed size
+ * message slots.  Messages are passed without entering the kernel, and a
+ * futex is only used when a reader needs to block on an empty queue.
+ */
+typedef struct
+{
+    OS_impl_queue_ring_word_t put_pos;    /**< position of the next slot to be written */
+    OS_impl_queue_ring_word_t get_pos;    /**< position of the next slot to be read */
+    OS_impl_queue_ring_word_t put_signal; /**< futex word, incremented after every put */
+    OS_impl_queue_ring_word_t waiters;    /**< number of readers blocked on put_signal */
+    uint32                    depth;      /**< maximum number of messages in the queue */
+    uint32                    slot_mask;  /**< number of slots minus one (slot count is a power of two) */
+    size_t                    slot_size;  /**< size of each slot including header, multiple of the alignment */
+    uint8 *                   slots;      /**< start of slot memory */
+} OS_impl_queue_ring_t;
+
+/*
+ * Queue statistics, reported via OS_QueueGetInfo()
+ *
+ * These are only ever updated with relaxed atomic operations, so keeping them
+ * costs no locking on the put/get paths.
+ */
+typedef struct
+{
+    uint32 depth;         /**< number of messages on the queue */
+    uint32 high_water;    /**< greatest value of depth */
+    uint32 put_count;     /**< number of messages put on the queue */
+    uint32 get_count;     /**< number of messages taken from the queue */
+    uint32 full_count;    /**< number of puts which failed because the queue was full */
+    uint32 timeout_count; /**< number of gets which timed out */
+} OS_impl_queue_stats_t;
+
 /* queues */
 typedef struct
 {
-    mqd_t id;
+    mqd_t                 id;
+    OS_impl_queue_ring_t *ring;    /**< set if this queue uses the in-process ring, NULL if it uses mq */
+    uint32                users;   /**< number of operations currently using the ring */
+    uint32                closing; /**< set when the queue is being deleted, no new operations may use the ring */
+    OS_impl_queue_stats_t stats;
 } OS_impl_queue_internal_record_t;
 
 /* Tables where the OS object information is stored */
@@ -47,4 +47,12 @@
  */
 #define OS_IMPL_SOCKET_FLAGS O_NONBLOCK
 
+/*
+ * Linux can transfer a batch of datagrams in a single system call,
+ * via recvmmsg() and sendmmsg()
+ */
+#ifdef __linux__
+#define OS_IMPL_SOCKET_HAVE_MMSG
+#endif
+
 #endif /* OS_IMPL_SOCKETS_H */
@@ -30,12 +30,22 @@
 #include <pthread.h>
 #include <signal.h>
 
+/*
+ * If enabled, simulated time bases use a timerfd that is serviced by a
+ * single dispatcher thread for all time bases, instead of a dedicated
+ * RT signal and handler thread per time base.
+ */
+#if defined(OSAL_CONFIG_TIMEBASE_TIMERFD) && defined(OS_POSIX_HAVE_TIMERFD)
+#define OS_POSIX_TIMEBASE_TIMERFD
+#endif
+
 typedef struct
 {
     pthread_t       handler_thread;
     pthread_mutex_t handler_mutex;
     timer_t         host_timerid;
     int             assigned_signal;
+    int             timer_fd; /* timerfd serviced by the dispatcher thread, or -1 if not used */
     sigset_t        sigset;
     sig_atomic_t    reset_flag;
 } OS_impl_timebase_internal_record_t;
@@ -56,6 +56,43 @@
                                      DEFINES
  ***************************************************************************************/
 
+/*
+ * Futexes are used for blocking by some of the in-process object implementations.
+ * These are specific to Linux, and also require compiler support for atomic operations.
+ */
+#if defined(__linux__) && defined(__ATOMIC_SEQ_CST)
+#define OS_POSIX_HAVE_FUTEX
+#endif
+
+/*
+ * The timerfd and epoll facilities are also specific to Linux.
+ */
+#ifdef __linux__
+#define OS_POSIX_HAVE_TIMERFD
+#define OS_POSIX_HAVE_EPOLL
+#endif
+
+/*
+ * Linux can copy file data within the kernel, via sendfile() and,
+ * with glibc 2.27 or later, copy_file_range().
+ */
+#ifdef __linux__
+#define OS_POSIX_HAVE_SENDFILE
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 27))
+#define OS_POSIX_HAVE_COPY_FILE_RANGE
+#endif
+#endif
+
+/*
+ * Linux 5.1 and later provide io_uring, which is used for asynchronous file I/O
+ * when the running kernel permits it.  This needs kernel headers that define it.
+ */
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#define OS_POSIX_HAVE_IO_URING
+#endif
+#endif
+
 /****************************************************************************************
                                     TYPEDEFS
  ***************************************************************************************/
@@ -97,9 +134,11 @@ int32 OS_Posix_BinSemAPI_Impl_Init(void);
 int32 OS_Posix_CountSemAPI_Impl_Init(void);
 int32 OS_Posix_MutexAPI_Impl_Init(void);
 int32 OS_Posix_CondVarAPI_Impl_Init(void);
+int32 OS_Posix_SelectGroupAPI_Impl_Init(void);
 int32 OS_Posix_ModuleAPI_Impl_Init(void);
 int32 OS_Posix_TimeBaseAPI_Impl_Init(void);
 int32 OS_Posix_StreamAPI_Impl_Init(void);
+int32 OS_Posix_FileAsyncAPI_Impl_Init(void);
 int32 OS_Posix_DirAPI_Impl_Init(void);
 int32 OS_Posix_FileSysAPI_Impl_Init(void);
 
@@ -107,4 +146,9 @@ int32 OS_Posix_TableMutex_Init(osal_objtype_t idtype);
 
 void OS_Posix_CompAbsDelayTime(uint32 msecs, struct timespec *tm);
 
+#ifdef OS_POSIX_HAVE_FUTEX
+int32 OS_Posix_FutexWait(uint32 *addr, uint32 expected, const struct timespec *abs_timeout);
+void  OS_Posix_FutexWake(uint32 *addr, int count);
+#endif
+
 #endif /* OS_POSIX_H */
@@ -21,8 +21,11 @@
  * \ingroup  posix
  * \author   joseph.p.hickey@nasa.gov
  *
- * Purpose: This file contains some of the OS APIs abstraction layer
- *    implementation for POSIX
+ * Purpose: This file contains the binary semaphore implementation for POSIX
+ *
+ * On Linux, each binary semaphore is a single atomic word holding its value
+ * and flush generation, and tasks block on that word using futexes.  Elsewhere,
+ * binary semaphores are simulated with a pthread mutex and condition variable.
  */
 
 /****************************************************************************************
@@ -34,6 +37,229 @@
 #include "os-shared-binsem.h"
 #include "os-impl-binsem.h"
 
+/* Tables where the OS object information is stored */
+OS_impl_binsem_internal_record_t OS_impl_bin_sem_table[OS_MAX_BIN_SEMAPHORES];
+
+/****************************************************************************************
+                               BINARY SEMAPHORE API
+ ***************************************************************************************/
+
+/*
+ * Note that the pthreads world does not provide VxWorks-style binary semaphores that the OSAL API is modeled after.
+ * Instead, semaphores are built from futexes where the platform has them (see OS_POSIX_HAVE_FUTEX), or are
+ * otherwise simulated using pthreads mutexes, condition variables, and a bit of internal state.
+ *
+ * IMPORTANT: the side effect of the simulation is that Binary Semaphores are not usable from signal handlers / ISRs.
+ * Use Counting Semaphores instead.
+ */
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_Posix_BinSemAPI_Impl_Init
+
+   Purpose: Initialize the Binary Semaphore data structures
+
+ ----------------------------------------------------------------------------------------*/
+int32 OS_Posix_BinSemAPI_Impl_Init(void)
+{
+    memset(OS_impl_bin_sem_table, 0, sizeof(OS_impl_bin_sem_table));
+    return OS_SUCCESS;
+}
+
+#ifdef OS_POSIX_HAVE_FUTEX
+
+/*
+ * With futex support, the value and the flush generation of each binary semaphore
+ * are kept in a single atomic word.  Give, take and flush are then just atomic
+ * operations on that word, and the kernel is only entered to block a taking task
+ * or to wake one up, if there is a task actually waiting.
+ */
+#define OS_POSIX_BINSEM_VALUE     0x1 /* semaphore is available */
+#define OS_POSIX_BINSEM_FLUSH_INC 0x2 /* increment of the flush generation */
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_BinSemCreate_Impl(const OS_object_token_t *token, uint32 initial_value, uint32 options)
+{
+    OS_impl_binsem_internal_record_t *sem;
+
+    sem = OS_OBJECT_TABLE_GET(OS_impl_bin_sem_table, *token);
+    memset(sem, 0, sizeof(*sem));
+
+    /*
+     * This preserves a bit of pre-existing functionality that was particular to binary sems:
+     * if the initial value is greater than 1 it just silently used 1 without error.
+     */
+    if (initial_value > 0)
+    {
+        sem->state = OS_POSIX_BINSEM_VALUE;
+    }
+
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_BinSemDelete_Impl(const OS_object_token_t *token)
+{
+    OS_impl_binsem_internal_record_t *sem;
+
+    sem = OS_OBJECT_TABLE_GET(OS_impl_bin_sem_table, *token);
+
+    /* sem is busy, i.e. some task is pending on it already.
+     * that means it cannot be deleted at this time. */
+    if (__atomic_load_n(&sem->waiters, __ATOMIC_SEQ_CST) != 0)
+    {
+        return OS_SEM_FAILURE;
+    }
+
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_BinSemGive_Impl(const OS_object_token_t *token)
+{
+    OS_impl_binsem_internal_record_t *sem;
+
+    sem = OS_OBJECT_TABLE_GET(OS_impl_bin_sem_table, *token);
+
+    /*
+     * Binary semaphores are always set as "1" when given.
+     *
+     * Setting the value before checking for waiters ensures a task that is
+     * about to block either sees the value, or is counted here and woken up.
+     */
+    __atomic_or_fetch(&sem->state, OS_POSIX_BINSEM_VALUE, __ATOMIC_SEQ_CST);
+    if (__atomic_load_n(&sem->waiters, __ATOMIC_SEQ_CST) != 0)
+    {
+        /* unblock one thread that is waiting on this sem */
+        OS_Posix_FutexWake(&sem->state, 1);
+    }
+
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_BinSemFlush_Impl(const OS_object_token_t *token)
+{
+    OS_impl_binsem_internal_record_t *sem;
+
+    sem = OS_OBJECT_TABLE_GET(OS_impl_bin_sem_table, *token);
+
+    /* increment the flush generation.  Any other threads that are
+     * currently pending in SemTake() will see the generation change and
+     * return _without_ modifying the semaphore value.
+     */
+    __atomic_add_fetch(&sem->state, OS_POSIX_BINSEM_FLUSH_INC, __ATOMIC_SEQ_CST);
+    if (__atomic_load_n(&sem->waiters, __ATOMIC_SEQ_CST) != 0)
+    {
+        /* unblock all threads that are be waiting on this sem */
+        OS_Posix_FutexWake(&sem->state, INT_MAX);
+    }
+
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Removes a blocked task from the waiter count of a binary semaphore.
+ *           Also used as a cleanup handler in case the task is canceled.
+ *
+ *-----------------------------------------------------------------*/
+static void OS_Posix_BinSemEndWait(void *arg)
+{
+    OS_impl_binsem_internal_record_t *sem = arg;
+
+    __atomic_sub_fetch(&sem->waiters, 1, __ATOMIC_SEQ_CST);
+}
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_GenericBinSemTake_Impl
+
+   Purpose: Helper function that takes a simulated binary semaphore with a "timespec" timeout
+            If the value is zero this will block until either the value
+            becomes nonzero (via SemGive) or the semaphore gets flushed.
+
+---------------------------------------------------------------------------------------*/
+static int32 OS_GenericBinSemTake_Impl(const OS_object_token_t *token, const struct timespec *timeout)
+{
+    uint32                            state;
+    uint32                            generation;
+    int32                             return_code;
+    OS_impl_binsem_internal_record_t *sem;
+
+    sem = OS_OBJECT_TABLE_GET(OS_impl_bin_sem_table, *token);
+
+    /*
+     * first take a local snapshot of the flush generation,
+     * if it changes, we know that someone else called SemFlush.
+     */
+    state       = __atomic_load_n(&sem->state, __ATOMIC_SEQ_CST);
+    generation  = state & ~OS_POSIX_BINSEM_VALUE;
+    return_code = OS_SUCCESS;
+
+    while ((state & ~OS_POSIX_BINSEM_VALUE) == generation)
+    {
+        if ((state & OS_POSIX_BINSEM_VALUE) != 0)
+        {
+            /* available - set the value to zero, unless the word changed in the meantime */
+            if (__atomic_compare_exchange_n(&sem->state, &state, state & ~OS_POSIX_BINSEM_VALUE, false,
+                                            __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST))
+            {
+                break;
+            }
+
+            /* state now holds the updated word, check it again */
+            continue;
+        }
+
+        /*
+         * Must pend until something changes.  If the word was changed by a give or
+         * flush after it was read above, the wait returns immediately.
+         */
+        __atomic_add_fetch(&sem->waiters, 1, __ATOMIC_SEQ_CST);
+        pthread_cleanup_push(OS_Posix_BinSemEndWait, sem);
+        return_code = OS_Posix_FutexWait(&sem->state, state, timeout);
+        pthread_cleanup_pop(true);
+
+        if (return_code == OS_ERROR_TIMEOUT)
+        {
+            return_code = OS_SEM_TIMEOUT;
+            break;
+        }
+
+        if (return_code != OS_SUCCESS)
+        {
+            return_code = OS_SEM_FAILURE;
+            break;
+        }
+
+        state = __atomic_load_n(&sem->state, __ATOMIC_SEQ_CST);
+    }
+
+    return return_code;
+}
+
+#else /* mutex and condition variable implementation */
+
 /*
  * This controls the maximum time that the calling thread will wait to
  * acquire the condition mutex before returning an error.
@@ -49,9 +275,6 @@
  */
 #define OS_POSIX_BINSEM_MAX_WAIT_SECONDS 2
 
-/* Tables where the OS object information is stored */
-OS_impl_binsem_internal_record_t OS_impl_bin_sem_table[OS_MAX_BIN_SEMAPHORES];
-
 /*---------------------------------------------------------------------------------------
  * Helper function for acquiring the mutex when beginning a binary sem operation
  * This uses timedlock to avoid waiting forever, and is put into a wrapper function
@@ -85,30 +308,6 @@ void OS_Posix_BinSemReleaseMutex(void *mut)
     pthread_mutex_unlock(mut);
 }
 
-/****************************************************************************************
-                               BINARY SEMAPHORE API
- ***************************************************************************************/
-
-/*
- * Note that the pthreads world does not provide VxWorks-style binary semaphores that the OSAL API is modeled after.
- * Instead, semaphores are simulated using pthreads mutexes, condition variables, and a bit of internal state.
- *
- * IMPORTANT: the side effect of this is that Binary Semaphores are not usable from signal handlers / ISRs.
- * Use Counting Semaphores instead.
- */
-
-/*---------------------------------------------------------------------------------------
-   Name: OS_Posix_BinSemAPI_Impl_Init
-
-   Purpose: Initialize the Binary Semaphore data structures
-
- ----------------------------------------------------------------------------------------*/
-int32 OS_Posix_BinSemAPI_Impl_Init(void)
-{
-    memset(OS_impl_bin_sem_table, 0, sizeof(OS_impl_bin_sem_table));
-    return OS_SUCCESS;
-}
-
 /*----------------------------------------------------------------
  *
  *  Purpose: Implemented per internal OSAL API
@@ -437,6 +636,8 @@ static int32 OS_GenericBinSemTake_Impl(const OS_object_token_t *token, const str
     return return_code;
 }
 
+#endif /* OS_POSIX_HAVE_FUTEX */
+
 /*----------------------------------------------------------------
  *
  *  Purpose: Implemented per internal OSAL API
@@ -479,6 +680,10 @@ int32 OS_BinSemGetInfo_Impl(const OS_object_token_t *token, OS_bin_sem_prop_t *s
     sem = OS_OBJECT_TABLE_GET(OS_impl_bin_sem_table, *token);
 
     /* put the info into the structure */
+#ifdef OS_POSIX_HAVE_FUTEX
+    sem_prop->value = __atomic_load_n(&sem->state, __ATOMIC_RELAXED) & OS_POSIX_BINSEM_VALUE;
+#else
     sem_prop->value = sem->current_value;
+#endif
     return OS_SUCCESS;
 }
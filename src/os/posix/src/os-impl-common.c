@@ -27,6 +27,9 @@
                                     INCLUDE FILES
  ***************************************************************************************/
 
+/* required for syscall(), which is used for futex operations */
+#define _GNU_SOURCE
+
 #include "os-posix.h"
 #include "bsp-impl.h"
 
@@ -39,6 +42,11 @@
 #include "os-shared-common.h"
 #include "os-shared-idmap.h"
 
+#ifdef OS_POSIX_HAVE_FUTEX
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#endif
+
 POSIX_GlobalVars_t POSIX_GlobalVars = {0};
 
 /*---------------------------------------------------------------------------------------
@@ -94,6 +102,9 @@ int32 OS_API_Impl_Init(osal_objtype_t idtype)
         case OS_OBJECT_TYPE_OS_CONDVAR:
             return_code = OS_Posix_CondVarAPI_Impl_Init();
             break;
+        case OS_OBJECT_TYPE_OS_SELGROUP:
+            return_code = OS_Posix_SelectGroupAPI_Impl_Init();
+            break;
         default:
             break;
     }
@@ -159,3 +170,99 @@ void OS_Posix_CompAbsDelayTime(uint32 msecs, struct timespec *tm)
         tm->tv_sec++;
     }
 }
+
+#ifdef OS_POSIX_HAVE_FUTEX
+
+/*
+ * A raw futex wait is not a cancellation point, and the system call is not safe
+ * to use with asynchronous cancellation.  So long waits are done in slices of at
+ * most this many nanoseconds, and pending cancellation requests are acted upon
+ * between them.  This bounds the time OS_TaskDelete() takes for a blocked task.
+ */
+#define OS_POSIX_FUTEX_CANCEL_INTERVAL_NS 100000000
+
+/*----------------------------------------------------------------
+ *
+ * Purpose:  Local helper function
+ *
+ * Blocks the calling thread while the value at addr is equal to expected,
+ * until woken by OS_Posix_FutexWake() or until the absolute time (based on
+ * CLOCK_REALTIME, as computed by OS_Posix_CompAbsDelayTime) is reached.
+ * If abs_timeout is NULL the wait is indefinite.
+ *
+ * Returns OS_SUCCESS if woken, interrupted, or if the value was already different,
+ * and also at the end of each slice of a long wait.  The caller must re-check its
+ * condition in all these cases, and wait again with the same abs_timeout.
+ *
+ * Like other blocking calls, this is a cancellation point, so a task which is
+ * blocked here can be deleted.  Callers should use pthread_cleanup_push() to
+ * undo any state they changed before waiting.
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_Posix_FutexWait(uint32 *addr, uint32 expected, const struct timespec *abs_timeout)
+{
+    int32                  return_code;
+    long                   result;
+    int                    wait_errno;
+    int                    old_type;
+    struct timespec        slice_end;
+    const struct timespec *wait_end;
+
+    clock_gettime(CLOCK_REALTIME, &slice_end);
+    slice_end.tv_nsec += OS_POSIX_FUTEX_CANCEL_INTERVAL_NS;
+    if (slice_end.tv_nsec >= 1000000000)
+    {
+        slice_end.tv_nsec -= 1000000000;
+        slice_end.tv_sec++;
+    }
+
+    if (abs_timeout != NULL && (abs_timeout->tv_sec < slice_end.tv_sec ||
+                                (abs_timeout->tv_sec == slice_end.tv_sec && abs_timeout->tv_nsec <= slice_end.tv_nsec)))
+    {
+        wait_end = abs_timeout;
+    }
+    else
+    {
+        wait_end = &slice_end;
+    }
+
+    pthread_testcancel();
+
+    pthread_setcanceltype(PTHREAD_CANCEL_DEFERRED, &old_type);
+    result     = syscall(SYS_futex, addr, FUTEX_WAIT_BITSET_PRIVATE | FUTEX_CLOCK_REALTIME, expected, wait_end, NULL,
+                     FUTEX_BITSET_MATCH_ANY);
+    wait_errno = errno;
+    pthread_setcanceltype(old_type, NULL);
+
+    pthread_testcancel();
+
+    if (result == 0 || wait_errno == EAGAIN || wait_errno == EINTR ||
+        (wait_errno == ETIMEDOUT && wait_end == &slice_end))
+    {
+        return_code = OS_SUCCESS;
+    }
+    else if (wait_errno == ETIMEDOUT)
+    {
+        return_code = OS_ERROR_TIMEOUT;
+    }
+    else
+    {
+        return_code = OS_ERROR;
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Purpose:  Local helper function
+ *
+ * Wakes up to "count" threads blocked in OS_Posix_FutexWait() on addr
+ *
+ *-----------------------------------------------------------------*/
+void OS_Posix_FutexWake(uint32 *addr, int count)
+{
+    syscall(SYS_futex, addr, FUTEX_WAKE_PRIVATE, count, NULL, NULL, 0);
+}
+
+#endif /* OS_POSIX_HAVE_FUTEX */
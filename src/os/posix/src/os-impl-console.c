@@ -79,6 +79,7 @@ static void *OS_ConsoleTask_Entry(void *arg)
     OS_VoidPtrValueWrapper_t           local_arg;
     OS_impl_console_internal_record_t *local;
     OS_object_token_t                  token;
+    int32                              status;
 
     /* cppcheck-suppress unreadVariable // intentional use of other union member */
     local_arg.opaque_arg = arg;
@@ -89,7 +90,13 @@ static void *OS_ConsoleTask_Entry(void *arg)
         /* Loop forever (unless shutdown is set) */
         while (OS_SharedGlobalVars.GlobalState != OS_SHUTDOWN_MAGIC_NUMBER)
         {
-            OS_ConsoleOutput_Impl(&token);
+            /* staged records remain if the console buffer filled, so write it out and continue */
+            do
+            {
+                status = OS_ConsoleDrainStaging(&token);
+                OS_ConsoleOutput_Impl(&token);
+            } while (status == OS_QUEUE_FULL);
+
             sem_wait(&local->data_sem);
         }
         OS_ObjectIdRelease(&token);
@@ -0,0 +1,739 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ * \ingroup  posix
+ *
+ * Purpose: This file contains the asynchronous file I/O implementation
+ *
+ * On Linux, requests are passed to the kernel through an io_uring instance,
+ * and completions are collected from it by OS_FileAsyncWait_Impl().  Where
+ * io_uring is not available (older kernels, or not permitted), a small pool of
+ * worker threads performs the requests with ordinary blocking calls instead.
+ *
+ * Either way, each request in progress occupies one entry in a fixed table,
+ * so no memory is allocated while submitting or completing requests.
+ */
+
+/****************************************************************************************
+                                    INCLUDE FILES
+ ***************************************************************************************/
+
+/* required for syscall(), which is used for io_uring */
+#define _GNU_SOURCE
+
+#include <poll.h>
+#include <sys/uio.h>
+
+#include "os-posix.h"
+#include "os-impl-io.h"
+#include "os-shared-clock.h"
+#include "os-shared-file.h"
+#include "os-shared-idmap.h"
+
+#ifdef OS_POSIX_HAVE_IO_URING
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <linux/io_uring.h>
+#endif
+
+/****************************************************************************************
+                                     DEFINES
+ ***************************************************************************************/
+
+/*
+ * Number of worker threads that perform requests, when io_uring is not available.
+ * These are only started when the first request is submitted.
+ */
+#define OS_POSIX_FILE_ASYNC_WORKERS 2
+
+typedef enum
+{
+    OS_POSIX_FILE_ASYNC_FREE,    /**< Entry is not in use */
+    OS_POSIX_FILE_ASYNC_QUEUED,  /**< Waiting for a worker thread */
+    OS_POSIX_FILE_ASYNC_ACTIVE,  /**< In progress */
+    OS_POSIX_FILE_ASYNC_COMPLETE /**< Done, waiting to be handed back by OS_FileAsyncWait_Impl() */
+} OS_Posix_FileAsyncState_t;
+
+typedef struct
+{
+    OS_FileAsyncReq_t *req;
+    int                fd;     /**< Own copy of the descriptor, for worker threads */
+    struct iovec       iov;    /**< Segment for io_uring read/write */
+    int32              result; /**< Completion status, for worker threads */
+    uint8              state;
+} OS_Posix_FileAsyncEntry_t;
+
+typedef struct
+{
+    pthread_mutex_t lock;
+    pthread_cond_t  work_cond; /**< Signalled when a request is queued for the workers */
+    pthread_cond_t  done_cond; /**< Signalled when a worker completes a request */
+    bool            initialized;
+    bool            workers_started;
+
+    /* FIFO of entries waiting for a worker thread */
+    uint32 queue[OS_FILE_ASYNC_MAX_REQUESTS];
+    uint32 queue_head;
+    uint32 queue_count;
+
+    OS_Posix_FileAsyncEntry_t entries[OS_FILE_ASYNC_MAX_REQUESTS];
+
+#ifdef OS_POSIX_HAVE_IO_URING
+    int                  ring_fd; /**< io_uring instance, or -1 to use the worker threads */
+    uint32 *             sq_tail;
+    uint32               sq_mask;
+    uint32 *             sq_array;
+    struct io_uring_sqe *sqes;
+    uint32 *             cq_head;
+    uint32 *             cq_tail;
+    uint32               cq_mask;
+    struct io_uring_cqe *cqes;
+#endif
+} OS_Posix_FileAsyncGlobal_t;
+
+static OS_Posix_FileAsyncGlobal_t OS_Posix_FileAsync;
+
+/****************************************************************************************
+                                   LOCAL FUNCTIONS
+ ***************************************************************************************/
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Converts the result of a system call (or negative errno) to an OSAL status
+ *
+ *-----------------------------------------------------------------*/
+static int32 OS_Posix_FileAsyncResult(ssize_t os_result)
+{
+    if (os_result >= 0)
+    {
+        /* type conversion from ssize_t to int32 for return */
+        return (int32)os_result;
+    }
+
+    if (os_result == -ESPIPE)
+    {
+        return OS_ERR_OPERATION_NOT_SUPPORTED;
+    }
+
+    OS_DEBUG("async file request: %s\n", strerror((int)-os_result));
+    return OS_ERROR;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Gets a free table entry, must be called with the lock held
+ *
+ *-----------------------------------------------------------------*/
+static OS_Posix_FileAsyncEntry_t *OS_Posix_FileAsyncGetEntry(OS_FileAsyncReq_t *req)
+{
+    uint32 idx;
+
+    for (idx = 0; idx < OS_FILE_ASYNC_MAX_REQUESTS; ++idx)
+    {
+        if (OS_Posix_FileAsync.entries[idx].state == OS_POSIX_FILE_ASYNC_FREE)
+        {
+            OS_Posix_FileAsync.entries[idx].req = req;
+            return &OS_Posix_FileAsync.entries[idx];
+        }
+    }
+
+    return NULL;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Entry point for the worker threads, used when io_uring is not available
+ *
+ *-----------------------------------------------------------------*/
+static void *OS_Posix_FileAsyncWorker(void *arg)
+{
+    OS_Posix_FileAsyncEntry_t *entry;
+    OS_FileAsyncReq_t *        req;
+    ssize_t                    os_result;
+
+    pthread_mutex_lock(&OS_Posix_FileAsync.lock);
+
+    while (true)
+    {
+        while (OS_Posix_FileAsync.queue_count == 0)
+        {
+            pthread_cond_wait(&OS_Posix_FileAsync.work_cond, &OS_Posix_FileAsync.lock);
+        }
+
+        entry = &OS_Posix_FileAsync.entries[OS_Posix_FileAsync.queue[OS_Posix_FileAsync.queue_head]];
+        OS_Posix_FileAsync.queue_head = (OS_Posix_FileAsync.queue_head + 1) % OS_FILE_ASYNC_MAX_REQUESTS;
+        --OS_Posix_FileAsync.queue_count;
+        entry->state = OS_POSIX_FILE_ASYNC_ACTIVE;
+
+        pthread_mutex_unlock(&OS_Posix_FileAsync.lock);
+
+        req = entry->req;
+        switch (req->Operation)
+        {
+            case OS_FILE_ASYNC_READ:
+                os_result = pread(entry->fd, req->Buffer, req->Length, (off_t)req->Offset);
+                break;
+            case OS_FILE_ASYNC_WRITE:
+                os_result = pwrite(entry->fd, req->Buffer, req->Length, (off_t)req->Offset);
+                break;
+            default:
+                os_result = fsync(entry->fd);
+                break;
+        }
+
+        if (os_result < 0)
+        {
+            os_result = -errno;
+        }
+
+        close(entry->fd);
+        entry->fd = -1;
+
+        pthread_mutex_lock(&OS_Posix_FileAsync.lock);
+
+        entry->result = OS_Posix_FileAsyncResult(os_result);
+        entry->state  = OS_POSIX_FILE_ASYNC_COMPLETE;
+        pthread_cond_broadcast(&OS_Posix_FileAsync.done_cond);
+    }
+
+    return NULL;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Starts a request on a worker thread, used when io_uring is not available
+ *
+ *-----------------------------------------------------------------*/
+static int32 OS_Posix_FileAsyncSubmitWorker(int fd, OS_FileAsyncReq_t *req)
+{
+    OS_Posix_FileAsyncEntry_t *entry;
+    pthread_attr_t             attr;
+    pthread_t                  thread;
+    uint32                     i;
+    int32                      return_code;
+
+    /* off_t may still be 32 bits, if the system was not built for large files */
+    if ((off_t)req->Offset != req->Offset)
+    {
+        return OS_ERR_INVALID_ARGUMENT;
+    }
+
+    /*
+     * The worker uses its own descriptor, so the request still completes on
+     * the same file if the OSAL handle is closed (and the descriptor reused)
+     * while it is queued.
+     */
+    fd = dup(fd);
+    if (fd < 0)
+    {
+        OS_DEBUG("dup(): %s\n", strerror(errno));
+        return OS_ERROR;
+    }
+
+    return_code = OS_SUCCESS;
+
+    pthread_mutex_lock(&OS_Posix_FileAsync.lock);
+
+    if (!OS_Posix_FileAsync.workers_started)
+    {
+        pthread_attr_init(&attr);
+        pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+        for (i = 0; i < OS_POSIX_FILE_ASYNC_WORKERS; ++i)
+        {
+            if (pthread_create(&thread, &attr, OS_Posix_FileAsyncWorker, NULL) != 0)
+            {
+                /* any workers already started remain usable */
+                OS_DEBUG("pthread_create() for async file worker failed\n");
+                break;
+            }
+            OS_Posix_FileAsync.workers_started = true;
+        }
+        pthread_attr_destroy(&attr);
+
+        if (!OS_Posix_FileAsync.workers_started)
+        {
+            return_code = OS_ERROR;
+        }
+    }
+
+    entry = NULL;
+    if (return_code == OS_SUCCESS)
+    {
+        entry = OS_Posix_FileAsyncGetEntry(req);
+        if (entry == NULL)
+        {
+            return_code = OS_ERR_NO_FREE_IDS;
+        }
+    }
+
+    if (entry != NULL)
+    {
+        entry->fd    = fd;
+        entry->state = OS_POSIX_FILE_ASYNC_QUEUED;
+
+        OS_Posix_FileAsync.queue[(OS_Posix_FileAsync.queue_head + OS_Posix_FileAsync.queue_count) %
+                                 OS_FILE_ASYNC_MAX_REQUESTS] = entry - OS_Posix_FileAsync.entries;
+        ++OS_Posix_FileAsync.queue_count;
+        pthread_cond_signal(&OS_Posix_FileAsync.work_cond);
+    }
+
+    pthread_mutex_unlock(&OS_Posix_FileAsync.lock);
+
+    if (return_code != OS_SUCCESS)
+    {
+        close(fd);
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Collects requests completed by the worker threads, must be called with the lock held
+ *
+ *-----------------------------------------------------------------*/
+static uint32 OS_Posix_FileAsyncCollectWorker(OS_FileAsyncReq_t **reqs, int32 *results)
+{
+    OS_Posix_FileAsyncEntry_t *entry;
+    uint32                     idx;
+    uint32                     count;
+
+    count = 0;
+    for (idx = 0; idx < OS_FILE_ASYNC_MAX_REQUESTS; ++idx)
+    {
+        entry = &OS_Posix_FileAsync.entries[idx];
+        if (entry->state == OS_POSIX_FILE_ASYNC_COMPLETE)
+        {
+            reqs[count]    = entry->req;
+            results[count] = entry->result;
+            ++count;
+
+            entry->req   = NULL;
+            entry->state = OS_POSIX_FILE_ASYNC_FREE;
+        }
+    }
+
+    return count;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Waits for requests completed by the worker threads
+ *
+ *-----------------------------------------------------------------*/
+static uint32 OS_Posix_FileAsyncWaitWorker(OS_FileAsyncReq_t **reqs, int32 *results, OS_time_t abs_timeout)
+{
+    struct timespec limit;
+    uint32          count;
+    int             status;
+
+    limit.tv_sec  = OS_TimeGetTotalSeconds(abs_timeout);
+    limit.tv_nsec = OS_TimeGetNanosecondsPart(abs_timeout);
+
+    pthread_mutex_lock(&OS_Posix_FileAsync.lock);
+
+    status = 0;
+    count  = OS_Posix_FileAsyncCollectWorker(reqs, results);
+    while (count == 0 && status == 0)
+    {
+        if (OS_TimeEqual(abs_timeout, OS_TIME_MAX))
+        {
+            status = pthread_cond_wait(&OS_Posix_FileAsync.done_cond, &OS_Posix_FileAsync.lock);
+        }
+        else
+        {
+            status = pthread_cond_timedwait(&OS_Posix_FileAsync.done_cond, &OS_Posix_FileAsync.lock, &limit);
+        }
+
+        count = OS_Posix_FileAsyncCollectWorker(reqs, results);
+    }
+
+    pthread_mutex_unlock(&OS_Posix_FileAsync.lock);
+
+    return count;
+}
+
+#ifdef OS_POSIX_HAVE_IO_URING
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Creates the io_uring instance and maps its rings
+ *
+ *-----------------------------------------------------------------*/
+static int32 OS_Posix_FileAsyncRingInit(void)
+{
+    struct io_uring_params params;
+    size_t                 sq_size;
+    size_t                 cq_size;
+    void *                 sq_ring;
+    void *                 cq_ring;
+    void *                 sqes;
+    int                    fd;
+
+    memset(&params, 0, sizeof(params));
+    fd = syscall(__NR_io_uring_setup, OS_FILE_ASYNC_MAX_REQUESTS, &params);
+    if (fd < 0)
+    {
+        OS_DEBUG("io_uring_setup(): %s, using worker threads\n", strerror(errno));
+        return OS_ERROR;
+    }
+
+    /* the rings are mapped separately, which also works on kernels that could share one mapping */
+    sq_size = params.sq_off.array + params.sq_entries * sizeof(uint32);
+    cq_size = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+
+    sq_ring = mmap(NULL, sq_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, IORING_OFF_SQ_RING);
+    cq_ring = mmap(NULL, cq_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, IORING_OFF_CQ_RING);
+    sqes    = mmap(NULL, params.sq_entries * sizeof(struct io_uring_sqe), PROT_READ | PROT_WRITE, MAP_SHARED, fd,
+                IORING_OFF_SQES);
+
+    if (sq_ring == MAP_FAILED || cq_ring == MAP_FAILED || sqes == MAP_FAILED)
+    {
+        OS_DEBUG("mmap() of io_uring failed, using worker threads\n");
+        if (sq_ring != MAP_FAILED)
+        {
+            munmap(sq_ring, sq_size);
+        }
+        if (cq_ring != MAP_FAILED)
+        {
+            munmap(cq_ring, cq_size);
+        }
+        if (sqes != MAP_FAILED)
+        {
+            munmap(sqes, params.sq_entries * sizeof(struct io_uring_sqe));
+        }
+        close(fd);
+        return OS_ERROR;
+    }
+
+    OS_Posix_FileAsync.sq_tail  = (uint32 *)((uint8 *)sq_ring + params.sq_off.tail);
+    OS_Posix_FileAsync.sq_mask  = *(uint32 *)((uint8 *)sq_ring + params.sq_off.ring_mask);
+    OS_Posix_FileAsync.sq_array = (uint32 *)((uint8 *)sq_ring + params.sq_off.array);
+    OS_Posix_FileAsync.sqes     = sqes;
+    OS_Posix_FileAsync.cq_head  = (uint32 *)((uint8 *)cq_ring + params.cq_off.head);
+    OS_Posix_FileAsync.cq_tail  = (uint32 *)((uint8 *)cq_ring + params.cq_off.tail);
+    OS_Posix_FileAsync.cq_mask  = *(uint32 *)((uint8 *)cq_ring + params.cq_off.ring_mask);
+    OS_Posix_FileAsync.cqes     = (struct io_uring_cqe *)((uint8 *)cq_ring + params.cq_off.cqes);
+    OS_Posix_FileAsync.ring_fd  = fd;
+
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Passes a request to the kernel through the io_uring instance
+ *
+ *-----------------------------------------------------------------*/
+static int32 OS_Posix_FileAsyncSubmitRing(int fd, OS_FileAsyncReq_t *req)
+{
+    OS_Posix_FileAsyncEntry_t *entry;
+    struct io_uring_sqe *      sqe;
+    uint32                     tail;
+    uint32                     index;
+    int32                      return_code;
+
+    pthread_mutex_lock(&OS_Posix_FileAsync.lock);
+
+    entry = OS_Posix_FileAsyncGetEntry(req);
+    if (entry == NULL)
+    {
+        return_code = OS_ERR_NO_FREE_IDS;
+    }
+    else
+    {
+        /*
+         * Submissions are serialized by the lock, and the kernel only reads the
+         * tail during io_uring_enter(), so the tail can be read directly here.
+         * The number of requests in progress is limited by the table size, which
+         * is also the ring size, so the submission ring can not be full.
+         */
+        tail  = *OS_Posix_FileAsync.sq_tail;
+        index = tail & OS_Posix_FileAsync.sq_mask;
+        sqe   = &OS_Posix_FileAsync.sqes[index];
+
+        memset(sqe, 0, sizeof(*sqe));
+        switch (req->Operation)
+        {
+            case OS_FILE_ASYNC_READ:
+                sqe->opcode = IORING_OP_READV;
+                break;
+            case OS_FILE_ASYNC_WRITE:
+                sqe->opcode = IORING_OP_WRITEV;
+                break;
+            default:
+                sqe->opcode = IORING_OP_FSYNC;
+                break;
+        }
+
+        if (sqe->opcode != IORING_OP_FSYNC)
+        {
+            entry->iov.iov_base = req->Buffer;
+            entry->iov.iov_len  = req->Length;
+            sqe->addr           = (uintptr_t)&entry->iov;
+            sqe->len            = 1;
+            sqe->off            = req->Offset;
+        }
+
+        sqe->fd        = fd;
+        sqe->user_data = entry - OS_Posix_FileAsync.entries;
+
+        OS_Posix_FileAsync.sq_array[index] = index;
+        __atomic_store_n(OS_Posix_FileAsync.sq_tail, tail + 1, __ATOMIC_RELEASE);
+
+        /* the kernel gets its own reference to the file here */
+        if (syscall(__NR_io_uring_enter, OS_Posix_FileAsync.ring_fd, 1, 0, 0, NULL, 0) == 1)
+        {
+            entry->state = OS_POSIX_FILE_ASYNC_ACTIVE;
+            return_code  = OS_SUCCESS;
+        }
+        else
+        {
+            /* not consumed by the kernel, so take it back out of the ring */
+            OS_DEBUG("io_uring_enter(): %s\n", strerror(errno));
+            __atomic_store_n(OS_Posix_FileAsync.sq_tail, tail, __ATOMIC_RELEASE);
+            entry->req  = NULL;
+            return_code = OS_ERROR;
+        }
+    }
+
+    pthread_mutex_unlock(&OS_Posix_FileAsync.lock);
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Gets the poll timeout, in milliseconds, until abs_timeout.
+ *           Partial milliseconds are rounded up, so the wait does not end early.
+ *
+ *-----------------------------------------------------------------*/
+static int OS_Posix_FileAsyncRingTimeout(OS_time_t abs_timeout)
+{
+    OS_time_t curr_time;
+    int64     msecs;
+
+    if (OS_TimeEqual(abs_timeout, OS_TIME_MAX))
+    {
+        return -1;
+    }
+
+    OS_GetLocalTime_Impl(&curr_time);
+    curr_time = OS_TimeSubtract(abs_timeout, curr_time);
+    if (OS_TimeGetSign(curr_time) <= 0)
+    {
+        return 0;
+    }
+
+    msecs = OS_TimeGetTotalMilliseconds(OS_TimeAdd(curr_time, OS_TimeFromTotalMicroseconds(999)));
+    if (msecs > INT_MAX)
+    {
+        msecs = INT_MAX;
+    }
+
+    return (int)msecs;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Collects requests completed by the kernel
+ *
+ *-----------------------------------------------------------------*/
+static uint32 OS_Posix_FileAsyncCollectRing(OS_FileAsyncReq_t **reqs, int32 *results)
+{
+    OS_Posix_FileAsyncEntry_t *entry;
+    struct io_uring_cqe *      cqe;
+    uint32                     head;
+    uint32                     tail;
+    uint32                     count;
+
+    pthread_mutex_lock(&OS_Posix_FileAsync.lock);
+
+    count = 0;
+    head  = *OS_Posix_FileAsync.cq_head;
+    tail  = __atomic_load_n(OS_Posix_FileAsync.cq_tail, __ATOMIC_ACQUIRE);
+    while (head != tail)
+    {
+        cqe   = &OS_Posix_FileAsync.cqes[head & OS_Posix_FileAsync.cq_mask];
+        entry = &OS_Posix_FileAsync.entries[cqe->user_data];
+
+        reqs[count]    = entry->req;
+        results[count] = OS_Posix_FileAsyncResult(cqe->res);
+        ++count;
+
+        entry->req   = NULL;
+        entry->state = OS_POSIX_FILE_ASYNC_FREE;
+        ++head;
+    }
+    __atomic_store_n(OS_Posix_FileAsync.cq_head, head, __ATOMIC_RELEASE);
+
+    pthread_mutex_unlock(&OS_Posix_FileAsync.lock);
+
+    return count;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Waits for requests completed by the kernel
+ *
+ *-----------------------------------------------------------------*/
+static int32 OS_Posix_FileAsyncWaitRing(OS_FileAsyncReq_t **reqs, int32 *results, OS_time_t abs_timeout,
+                                        uint32 *count)
+{
+    struct pollfd pfd;
+    int           status;
+
+    pfd.fd     = OS_Posix_FileAsync.ring_fd;
+    pfd.events = POLLIN;
+
+    /* the instance is readable while there are completions - another task may collect them first */
+    while (true)
+    {
+        *count = OS_Posix_FileAsyncCollectRing(reqs, results);
+        if (*count > 0)
+        {
+            break;
+        }
+
+        status = poll(&pfd, 1, OS_Posix_FileAsyncRingTimeout(abs_timeout));
+        if (status == 0)
+        {
+            break;
+        }
+        if (status < 0 && errno != EINTR)
+        {
+            OS_DEBUG("poll() on io_uring: %s\n", strerror(errno));
+            return OS_ERROR;
+        }
+    }
+
+    return OS_SUCCESS;
+}
+
+#endif /* OS_POSIX_HAVE_IO_URING */
+
+/****************************************************************************************
+                                  ASYNC FILE API
+ ***************************************************************************************/
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_Posix_FileAsyncAPI_Impl_Init(void)
+{
+    /* requests and worker threads from an earlier init remain usable */
+    if (OS_Posix_FileAsync.initialized)
+    {
+        return OS_SUCCESS;
+    }
+
+    if (pthread_mutex_init(&OS_Posix_FileAsync.lock, NULL) != 0 ||
+        pthread_cond_init(&OS_Posix_FileAsync.work_cond, NULL) != 0 ||
+        pthread_cond_init(&OS_Posix_FileAsync.done_cond, NULL) != 0)
+    {
+        return OS_ERROR;
+    }
+
+#ifdef OS_POSIX_HAVE_IO_URING
+    if (OS_Posix_FileAsyncRingInit() != OS_SUCCESS)
+    {
+        OS_Posix_FileAsync.ring_fd = -1;
+    }
+#endif
+
+    OS_Posix_FileAsync.initialized = true;
+
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_FileAsyncSubmit_Impl(const OS_object_token_t *token, OS_FileAsyncReq_t *req)
+{
+    OS_impl_file_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_filehandle_table, *token);
+
+#ifdef OS_POSIX_HAVE_IO_URING
+    if (OS_Posix_FileAsync.ring_fd >= 0)
+    {
+        return OS_Posix_FileAsyncSubmitRing(impl->fd, req);
+    }
+#endif
+
+    return OS_Posix_FileAsyncSubmitWorker(impl->fd, req);
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_FileAsyncWait_Impl(OS_time_t abs_timeout)
+{
+    OS_FileAsyncReq_t *reqs[OS_FILE_ASYNC_MAX_REQUESTS];
+    int32              results[OS_FILE_ASYNC_MAX_REQUESTS];
+    uint32             count;
+    uint32             i;
+
+#ifdef OS_POSIX_HAVE_IO_URING
+    if (OS_Posix_FileAsync.ring_fd >= 0)
+    {
+        if (OS_Posix_FileAsyncWaitRing(reqs, results, abs_timeout, &count) != OS_SUCCESS)
+        {
+            return OS_ERROR;
+        }
+    }
+    else
+#endif
+    {
+        count = OS_Posix_FileAsyncWaitWorker(reqs, results, abs_timeout);
+    }
+
+    if (count == 0)
+    {
+        return OS_ERROR_TIMEOUT;
+    }
+
+    /* the entries are already free again, so callbacks may submit new requests */
+    for (i = 0; i < count; ++i)
+    {
+        OS_FileAsyncComplete(reqs[i], results[i]);
+    }
+
+    return (int32)count;
+}
@@ -27,15 +27,34 @@
                                     INCLUDE FILES
  ***************************************************************************************/
 
+/* required for copy_file_range(), which is used for OS_cp() */
+#define _GNU_SOURCE
+
 #include <fcntl.h>
 #include <dirent.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <sys/wait.h>
+#include <sys/mman.h>
 
 #include "os-posix.h"
 #include "os-impl-files.h"
 #include "os-shared-file.h"
+#include "os-shared-idmap.h"
+
+#ifdef OS_POSIX_HAVE_SENDFILE
+#include <sys/sendfile.h>
+#endif
+
+/****************************************************************************************
+                                     DEFINES
+ ***************************************************************************************/
+
+/*
+ * The maximum amount of data copied by each kernel call in OS_FileCopy_Impl().
+ * This just bounds the duration of each call, the copy continues until done.
+ */
+#define OS_POSIX_FILECOPY_CHUNK (8 * 1024 * 1024)
 
 /****************************************************************************************
                                      GLOBALS
@@ -97,5 +116,168 @@ int32 OS_Posix_StreamAPI_Impl_Init(void)
     OS_IMPL_SELF_EUID = geteuid();
     OS_IMPL_SELF_EGID = getegid();
 
+    return OS_Posix_FileAsyncAPI_Impl_Init();
+}
+
+/****************************************************************************************
+                                    FILE COPY API
+ ***************************************************************************************/
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_FileCopy_Impl(const OS_object_token_t *src_token, const OS_object_token_t *dest_token)
+{
+#ifdef OS_POSIX_HAVE_SENDFILE
+    OS_impl_file_internal_record_t *src_impl;
+    OS_impl_file_internal_record_t *dest_impl;
+    ssize_t                         os_result;
+#ifdef OS_POSIX_HAVE_COPY_FILE_RANGE
+    bool use_copy_range = true;
+#endif
+
+    src_impl  = OS_OBJECT_TABLE_GET(OS_impl_filehandle_table, *src_token);
+    dest_impl = OS_OBJECT_TABLE_GET(OS_impl_filehandle_table, *dest_token);
+
+    /*
+     * Both calls copy from the current file positions and advance them, so
+     * if either one fails, the caller can continue from where it stopped.
+     */
+    while (true)
+    {
+#ifdef OS_POSIX_HAVE_COPY_FILE_RANGE
+        if (use_copy_range)
+        {
+            os_result = copy_file_range(src_impl->fd, NULL, dest_impl->fd, NULL, OS_POSIX_FILECOPY_CHUNK, 0);
+            if (os_result < 0 && errno != EINTR)
+            {
+                /* not supported for all file system combinations, so try sendfile() instead */
+                use_copy_range = false;
+                continue;
+            }
+        }
+        else
+#endif
+        {
+            os_result = sendfile(dest_impl->fd, src_impl->fd, NULL, OS_POSIX_FILECOPY_CHUNK);
+        }
+
+        if (os_result == 0)
+        {
+            /* end of the source file */
+            break;
+        }
+
+        if (os_result < 0 && errno != EINTR)
+        {
+            OS_DEBUG("sendfile: %s\n", strerror(errno));
+            return OS_ERROR;
+        }
+    }
+
+    return OS_SUCCESS;
+#else
+    return OS_ERR_NOT_IMPLEMENTED;
+#endif
+}
+
+/****************************************************************************************
+                                    FILE MAPPING API
+ ***************************************************************************************/
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_FileMap_Impl(const OS_object_token_t *token, OS_file_mapping_t *map, uint32 flags)
+{
+    OS_impl_file_internal_record_t *impl;
+    size_t                          page_offset;
+    int                             prot;
+    int                             advice;
+    void *                          base;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_filehandle_table, *token);
+
+    prot = PROT_NONE;
+    if (flags & OS_FILE_MAP_READ)
+    {
+        prot |= PROT_READ;
+    }
+    if (flags & OS_FILE_MAP_WRITE)
+    {
+        prot |= PROT_WRITE;
+    }
+
+    /* The mapping must start on a page boundary, so map from the start of the page */
+    page_offset = (size_t)(map->offset % (osal_offset_t)POSIX_GlobalVars.PageSize);
+
+    base = mmap(NULL, map->length + page_offset, prot, MAP_SHARED, impl->fd,
+                (off_t)(map->offset - (osal_offset_t)page_offset));
+    if (base == MAP_FAILED)
+    {
+        OS_DEBUG("mmap: %s\n", strerror(errno));
+        return OS_ERROR;
+    }
+
+    if (flags & OS_FILE_MAP_SEQUENTIAL)
+    {
+        advice = POSIX_MADV_SEQUENTIAL;
+    }
+    else if (flags & OS_FILE_MAP_RANDOM)
+    {
+        advice = POSIX_MADV_RANDOM;
+    }
+    else
+    {
+        advice = POSIX_MADV_NORMAL;
+    }
+
+    /* Advice is only a hint, so failures here are not errors */
+    if (advice != POSIX_MADV_NORMAL)
+    {
+        posix_madvise(base, map->length + page_offset, advice);
+    }
+    if (flags & OS_FILE_MAP_WILLNEED)
+    {
+        posix_madvise(base, map->length + page_offset, POSIX_MADV_WILLNEED);
+    }
+
+    map->addr = (uint8 *)base + page_offset;
+
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_FileUnmap_Impl(const OS_object_token_t *token, const OS_file_mapping_t *map, uint32 flags)
+{
+    size_t page_offset;
+    void * base;
+
+    page_offset = (size_t)(map->offset % (osal_offset_t)POSIX_GlobalVars.PageSize);
+    base        = (uint8 *)map->addr - page_offset;
+
+    if ((flags & OS_FILE_MAP_SYNC) != 0 && msync(base, map->length + page_offset, MS_SYNC) < 0)
+    {
+        OS_DEBUG("msync: %s\n", strerror(errno));
+        return OS_ERROR;
+    }
+
+    if (munmap(base, map->length + page_offset) < 0)
+    {
+        OS_DEBUG("munmap: %s\n", strerror(errno));
+        return OS_ERROR;
+    }
+
     return OS_SUCCESS;
 }
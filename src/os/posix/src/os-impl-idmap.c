@@ -47,6 +47,7 @@ static OS_impl_objtype_lock_t OS_module_table_lock;
 static OS_impl_objtype_lock_t OS_filesys_table_lock;
 static OS_impl_objtype_lock_t OS_console_lock;
 static OS_impl_objtype_lock_t OS_condvar_lock;
+static OS_impl_objtype_lock_t OS_selgroup_lock;
 
 OS_impl_objtype_lock_t *const OS_impl_objtype_lock_table[OS_OBJECT_TYPE_USER] = {
     [OS_OBJECT_TYPE_UNDEFINED]   = NULL,
@@ -63,15 +64,30 @@ OS_impl_objtype_lock_t *const OS_impl_objtype_lock_table[OS_OBJECT_TYPE_USER] =
     [OS_OBJECT_TYPE_OS_FILESYS]  = &OS_filesys_table_lock,
     [OS_OBJECT_TYPE_OS_CONSOLE]  = &OS_console_lock,
     [OS_OBJECT_TYPE_OS_CONDVAR]  = &OS_condvar_lock,
+    [OS_OBJECT_TYPE_OS_SELGROUP] = &OS_selgroup_lock,
 };
 
+/*
+ * Upper limit on the time that OS_WaitForStateChange_Impl() will block,
+ * per attempt, up to OS_POSIX_STATE_CHANGE_MAX_ATTEMPTS.
+ *
+ * Tasks waiting for a state change are normally woken up as soon as the table
+ * is unlocked, so this is only a safety net in case the task holding
+ * the object never releases it (e.g. it was deleted while holding a refcount).
+ */
+#define OS_POSIX_STATE_CHANGE_TIMEOUT_NS   100000000
+#define OS_POSIX_STATE_CHANGE_MAX_ATTEMPTS 10
+
 /*---------------------------------------------------------------------------------------
  * Helper function for releasing the mutex in case the thread
  * executing pthread_condwait() is canceled.
  ----------------------------------------------------------------------------------------*/
-void OS_Posix_ReleaseTableMutex(void *mut)
+void OS_Posix_ReleaseTableMutex(void *arg)
 {
-    pthread_mutex_unlock(mut);
+    OS_impl_objtype_lock_t *impl = arg;
+
+    --impl->waiters;
+    pthread_mutex_unlock(&impl->mutex);
 }
 
 /*----------------------------------------------------------------
@@ -112,12 +128,19 @@ void OS_Unlock_Global_Impl(osal_objtype_t idtype)
 
     if (impl != NULL)
     {
-        /* Notify any waiting threads that the state _may_ have changed */
-        ret = pthread_cond_broadcast(&impl->cond);
-        if (ret != 0)
+        /*
+         * Notify any waiting threads that the state _may_ have changed.
+         * The waiter count is protected by the mutex, which is still held here,
+         * so the broadcast is skipped entirely in the common case of no waiters.
+         */
+        if (impl->waiters > 0)
         {
-            OS_DEBUG("pthread_cond_broadcast(&impl->cond): %s", strerror(ret));
-            /* unexpected but keep going (not critical) */
+            ret = pthread_cond_broadcast(&impl->cond);
+            if (ret != 0)
+            {
+                OS_DEBUG("pthread_cond_broadcast(&impl->cond): %s", strerror(ret));
+                /* unexpected but keep going (not critical) */
+            }
         }
 
         ret = pthread_mutex_unlock(&impl->mutex);
@@ -141,34 +164,47 @@ void OS_WaitForStateChange_Impl(osal_objtype_t objtype, uint32 attempts)
 
     impl = OS_impl_objtype_lock_table[objtype];
 
+    /*
+     * Register as a waiter so the next unlock of this table will
+     * broadcast the condition.  This is done while holding the mutex,
+     * so a change cannot be missed between here and the wait.
+     */
+    ++impl->waiters;
+
     /*
      * because pthread_cond_timedwait() is also a cancellation point,
      * this pushes a cleanup handler to ensure that if canceled during this call,
      * the mutex will be released.
      */
-    pthread_cleanup_push(OS_Posix_ReleaseTableMutex, &impl->mutex);
-
-    clock_gettime(CLOCK_REALTIME, &ts);
+    pthread_cleanup_push(OS_Posix_ReleaseTableMutex, impl);
 
-    if (attempts <= 10)
+    /*
+     * The safety net grows with the number of attempts, so a holder that
+     * never releases the object is polled less often, up to once per second.
+     */
+    if (attempts == 0)
     {
-        /* Wait an increasing amount of time, starting at 10ms */
-        ts.tv_nsec += attempts * attempts * 10000000;
-        if (ts.tv_nsec >= 1000000000)
-        {
-            ts.tv_nsec -= 1000000000;
-            ++ts.tv_sec;
-        }
+        attempts = 1;
     }
-    else
+    else if (attempts > OS_POSIX_STATE_CHANGE_MAX_ATTEMPTS)
     {
-        /* wait 1 second (max for polling) */
+        attempts = OS_POSIX_STATE_CHANGE_MAX_ATTEMPTS;
+    }
+
+    clock_gettime(CLOCK_REALTIME, &ts);
+
+    ts.tv_nsec += (long)attempts * OS_POSIX_STATE_CHANGE_TIMEOUT_NS;
+    while (ts.tv_nsec >= 1000000000)
+    {
+        ts.tv_nsec -= 1000000000;
         ++ts.tv_sec;
     }
 
     pthread_cond_timedwait(&impl->cond, &impl->mutex, &ts);
 
     pthread_cleanup_pop(false);
+
+    --impl->waiters;
 }
 
 /*---------------------------------------------------------------------------------------
@@ -236,7 +272,7 @@ int32 OS_Posix_TableMutex_Init(osal_objtype_t idtype)
         }
 
         /* create a condition variable with default attributes.
-         * This will be broadcast every time the object table changes */
+         * This will be broadcast when the object table changes, if there are waiters */
         ret = pthread_cond_init(&impl->cond, NULL);
         if (ret != 0)
         {
@@ -244,6 +280,8 @@ int32 OS_Posix_TableMutex_Init(osal_objtype_t idtype)
             return_code = OS_ERROR;
             break;
         }
+
+        impl->waiters = 0;
     } while (0);
 
     return return_code;
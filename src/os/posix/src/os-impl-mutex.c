@@ -32,9 +32,22 @@
 #include "os-shared-idmap.h"
 #include "os-impl-mutex.h"
 
+/*
+ * The number of times an adaptive mutex is retried before the calling task
+ * blocks.  This should cover a short critical section on another CPU, but
+ * not much more, as the spinning task does no useful work.
+ */
+#define OS_POSIX_MUTEX_SPIN_LIMIT 100
+
 /* Tables where the OS object information is stored */
 OS_impl_mutex_internal_record_t OS_impl_mutex_table[OS_MAX_MUTEXES];
 
+/*
+ * The spin limit to use for adaptive mutexes, which is 0 on a uniprocessor
+ * as spinning cannot help there
+ */
+static uint32 OS_Posix_MutexSpinLimit;
+
 /****************************************************************************************
                                   MUTEX API
  ***************************************************************************************/
@@ -47,9 +60,46 @@ OS_impl_mutex_internal_record_t OS_impl_mutex_table[OS_MAX_MUTEXES];
 int32 OS_Posix_MutexAPI_Impl_Init(void)
 {
     memset(OS_impl_mutex_table, 0, sizeof(OS_impl_mutex_table));
+
+    OS_Posix_MutexSpinLimit = 0;
+    if (sysconf(_SC_NPROCESSORS_ONLN) > 1)
+    {
+        OS_Posix_MutexSpinLimit = OS_POSIX_MUTEX_SPIN_LIMIT;
+    }
+
     return OS_SUCCESS;
 }
 
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Hints to the CPU that the caller is in a spin loop
+ *
+ *-----------------------------------------------------------------*/
+static inline void OS_Posix_MutexSpinPause(void)
+{
+#if defined(__i386__) || defined(__x86_64__)
+    __asm__ __volatile__("pause");
+#elif defined(__arm__) || defined(__aarch64__)
+    __asm__ __volatile__("yield");
+#endif
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Gets the nanoseconds elapsed on the monotonic clock since "start"
+ *
+ *-----------------------------------------------------------------*/
+static uint64 OS_Posix_MutexElapsedNs(const struct timespec *start)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((uint64)(now.tv_sec - start->tv_sec) * 1000000000) + now.tv_nsec - start->tv_nsec;
+}
+
 /*----------------------------------------------------------------
  *
  *  Purpose: Implemented per internal OSAL API
@@ -59,10 +109,35 @@ int32 OS_Posix_MutexAPI_Impl_Init(void)
 int32 OS_MutSemCreate_Impl(const OS_object_token_t *token, uint32 options)
 {
     int                              return_code;
+    int                              protocol;
+    int                              type;
     pthread_mutexattr_t              mutex_attr;
     OS_impl_mutex_internal_record_t *impl;
 
     impl = OS_OBJECT_TABLE_GET(OS_impl_mutex_table, *token);
+    memset(impl, 0, sizeof(*impl));
+
+    /*
+    ** Mutexes use priority inheritance and are recursive unless
+    ** the caller requests otherwise.  Adaptive mutexes do not
+    ** use priority inheritance by default, because a contended
+    ** priority inheritance mutex is always handed over by the kernel.
+    */
+    protocol = PTHREAD_PRIO_INHERIT;
+    type     = PTHREAD_MUTEX_RECURSIVE;
+    if ((options & OS_MUTEX_FLAG_ADAPTIVE) != 0)
+    {
+        impl->adaptive   = true;
+        impl->spin_limit = OS_Posix_MutexSpinLimit;
+        if ((options & OS_MUTEX_FLAG_PRIO_INHERIT) == 0)
+        {
+            protocol = PTHREAD_PRIO_NONE;
+        }
+    }
+    if ((options & OS_MUTEX_FLAG_NONRECURSIVE) != 0)
+    {
+        type = PTHREAD_MUTEX_ERRORCHECK;
+    }
 
     /*
     ** initialize the attribute with default values
@@ -78,7 +153,7 @@ int32 OS_MutSemCreate_Impl(const OS_object_token_t *token, uint32 options)
     /*
     ** Allow the mutex to use priority inheritance
     */
-    return_code = pthread_mutexattr_setprotocol(&mutex_attr, PTHREAD_PRIO_INHERIT);
+    return_code = pthread_mutexattr_setprotocol(&mutex_attr, protocol);
     if (return_code != 0)
     {
         OS_DEBUG("Error: Mutex could not be created. pthread_mutexattr_setprotocol failed ID = %lu: %s\n",
@@ -87,9 +162,10 @@ int32 OS_MutSemCreate_Impl(const OS_object_token_t *token, uint32 options)
     }
 
     /*
-    **  Set the mutex type to RECURSIVE so a thread can do nested locks
+    **  Set the mutex type to RECURSIVE so a thread can do nested locks,
+    **  or to ERRORCHECK so a nested lock fails rather than deadlocks
     */
-    return_code = pthread_mutexattr_settype(&mutex_attr, PTHREAD_MUTEX_RECURSIVE);
+    return_code = pthread_mutexattr_settype(&mutex_attr, type);
     if (return_code != 0)
     {
         OS_DEBUG("Error: Mutex could not be created. pthread_mutexattr_settype failed ID = %lu: %s\n",
@@ -169,19 +245,70 @@ int32 OS_MutSemGive_Impl(const OS_object_token_t *token)
 int32 OS_MutSemTake_Impl(const OS_object_token_t *token)
 {
     int                              status;
+    bool                             contended;
+    uint32                           spin;
+    uint64                           wait_time_ns;
+    struct timespec                  start_time;
     OS_impl_mutex_internal_record_t *impl;
 
     impl = OS_OBJECT_TABLE_GET(OS_impl_mutex_table, *token);
 
     /*
-    ** Lock the mutex
+    ** A regular mutex is simply locked, so its takes do not pay
+    ** for the contention statistics kept for adaptive mutexes
+    */
+    if (!impl->adaptive)
+    {
+        if (pthread_mutex_lock(&(impl->id)) != 0)
+        {
+            return OS_SEM_FAILURE;
+        }
+
+        ++impl->take_count;
+        return OS_SUCCESS;
+    }
+
+    /*
+    ** Lock the mutex, if it is not contended
     */
-    status = pthread_mutex_lock(&(impl->id));
+    status       = pthread_mutex_trylock(&(impl->id));
+    contended    = (status == EBUSY);
+    wait_time_ns = 0;
+    if (contended)
+    {
+        clock_gettime(CLOCK_MONOTONIC, &start_time);
+
+        /*
+        ** An adaptive mutex is retried for a while, as the
+        ** owner may be about to give it on another CPU
+        */
+        for (spin = impl->spin_limit; spin > 0 && status == EBUSY; --spin)
+        {
+            OS_Posix_MutexSpinPause();
+            status = pthread_mutex_trylock(&(impl->id));
+        }
+
+        if (status == EBUSY)
+        {
+            status = pthread_mutex_lock(&(impl->id));
+        }
+
+        wait_time_ns = OS_Posix_MutexElapsedNs(&start_time);
+    }
+
     if (status != 0)
     {
         return OS_SEM_FAILURE;
     }
 
+    /* The statistics are protected by the mutex itself */
+    ++impl->take_count;
+    if (contended)
+    {
+        ++impl->contended_count;
+        impl->wait_time_ns += wait_time_ns;
+    }
+
     return OS_SUCCESS;
 }
 
@@ -193,5 +320,16 @@ int32 OS_MutSemTake_Impl(const OS_object_token_t *token)
  *-----------------------------------------------------------------*/
 int32 OS_MutSemGetInfo_Impl(const OS_object_token_t *token, OS_mut_sem_prop_t *mut_prop)
 {
+    OS_impl_mutex_internal_record_t *impl;
+    uint64                           wait_time_ns;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_mutex_table, *token);
+
+    mut_prop->take_count      = impl->take_count;
+    mut_prop->contended_count = impl->contended_count;
+
+    wait_time_ns        = impl->wait_time_ns;
+    mut_prop->wait_time = OS_TimeAssembleFromNanoseconds(wait_time_ns / 1000000000, wait_time_ns % 1000000000);
+
     return OS_SUCCESS;
 }
@@ -37,6 +37,526 @@
 /* Tables where the OS object information is stored */
 OS_impl_queue_internal_record_t OS_impl_queue_table[OS_MAX_QUEUES];
 
+/****************************************************************************************
+                                QUEUE STATISTICS
+ ***************************************************************************************/
+
+/*
+ * The statistics are updated with relaxed atomic operations where the compiler
+ * provides them, so they never need a lock.  Otherwise plain accesses are used,
+ * in which case an update may occasionally be lost if two tasks race.
+ */
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Adds to a queue statistic, returning the new value
+ *
+ *-----------------------------------------------------------------*/
+static inline uint32 OS_Posix_QueueStatAdd(uint32 *stat, uint32 count)
+{
+#ifdef __ATOMIC_RELAXED
+    return __atomic_add_fetch(stat, count, __ATOMIC_RELAXED);
+#else
+    *stat += count;
+    return *stat;
+#endif
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Subtracts from a queue statistic
+ *
+ *-----------------------------------------------------------------*/
+static inline void OS_Posix_QueueStatSub(uint32 *stat, uint32 count)
+{
+#ifdef __ATOMIC_RELAXED
+    __atomic_sub_fetch(stat, count, __ATOMIC_RELAXED);
+#else
+    *stat -= count;
+#endif
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Reads a queue statistic
+ *
+ *-----------------------------------------------------------------*/
+static inline uint32 OS_Posix_QueueStatGet(uint32 *stat)
+{
+#ifdef __ATOMIC_RELAXED
+    return __atomic_load_n(stat, __ATOMIC_RELAXED);
+#else
+    return *stat;
+#endif
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Raises a queue statistic to the given value, if it is lower
+ *
+ *-----------------------------------------------------------------*/
+static inline void OS_Posix_QueueStatMax(uint32 *stat, uint32 value)
+{
+#ifdef __ATOMIC_RELAXED
+    uint32 current;
+
+    current = __atomic_load_n(stat, __ATOMIC_RELAXED);
+    while (value > current)
+    {
+        if (__atomic_compare_exchange_n(stat, &current, value, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+        {
+            break;
+        }
+    }
+#else
+    if (value > *stat)
+    {
+        *stat = value;
+    }
+#endif
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Updates the statistics of a queue after a put operation
+ *
+ *  "count" is the number of messages which were put, and
+ *  "status" is the result of the operation.
+ *
+ *-----------------------------------------------------------------*/
+static void OS_Posix_QueueStatsPut(OS_impl_queue_stats_t *stats, uint32 count, int32 status)
+{
+    uint32 depth;
+
+    if (count > 0)
+    {
+        OS_Posix_QueueStatAdd(&stats->put_count, count);
+        depth = OS_Posix_QueueStatAdd(&stats->depth, count);
+
+        /*
+         * A reader may take a message and count it before the writer has
+         * counted it here, so the depth can briefly go below zero.
+         */
+        if ((int32)depth > 0)
+        {
+            OS_Posix_QueueStatMax(&stats->high_water, depth);
+        }
+    }
+
+    if (status == OS_QUEUE_FULL)
+    {
+        OS_Posix_QueueStatAdd(&stats->full_count, 1);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Updates the statistics of a queue after a get operation
+ *
+ *  "count" is the number of messages which were received, and
+ *  "status" is the result of the operation.
+ *
+ *-----------------------------------------------------------------*/
+static void OS_Posix_QueueStatsGet(OS_impl_queue_stats_t *stats, uint32 count, int32 status)
+{
+    if (count > 0)
+    {
+        OS_Posix_QueueStatAdd(&stats->get_count, count);
+        OS_Posix_QueueStatSub(&stats->depth, count);
+    }
+
+    if (status == OS_QUEUE_TIMEOUT)
+    {
+        OS_Posix_QueueStatAdd(&stats->timeout_count, 1);
+    }
+}
+
+/****************************************************************************************
+                                IN-PROCESS RING QUEUE
+ ***************************************************************************************/
+
+#ifdef OS_POSIX_HAVE_FUTEX
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Gets the slot of an in-process ring corresponding to a position
+ *
+ *-----------------------------------------------------------------*/
+static inline OS_impl_queue_ring_slot_t *OS_Posix_QueueRingSlot(OS_impl_queue_ring_t *ring, uint32 pos)
+{
+    return (OS_impl_queue_ring_slot_t *)(void *)(ring->slots + ((pos & ring->slot_mask) * ring->slot_size));
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Ends an operation on the in-process ring of a queue.
+ *           Also used as a cleanup handler in case a blocked reader is canceled.
+ *
+ *-----------------------------------------------------------------*/
+static void OS_Posix_QueueRingExit(void *arg)
+{
+    OS_impl_queue_internal_record_t *impl = arg;
+
+    /* the last user out wakes the task deleting the queue, if any */
+    if (__atomic_sub_fetch(&impl->users, 1, __ATOMIC_SEQ_CST) == 0 &&
+        __atomic_load_n(&impl->closing, __ATOMIC_SEQ_CST) != 0)
+    {
+        OS_Posix_FutexWake(&impl->users, 1);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Starts an operation on the in-process ring of a queue
+ *
+ *  Operations on a queue are not serialized with its deletion, so every
+ *  use of the ring is counted and OS_QueueDelete_Impl() waits for the
+ *  count to drop to zero before freeing it.  Returns NULL if the queue
+ *  is being deleted, in which case the operation must not proceed.
+ *
+ *-----------------------------------------------------------------*/
+static OS_impl_queue_ring_t *OS_Posix_QueueRingEnter(OS_impl_queue_internal_record_t *impl)
+{
+    __atomic_add_fetch(&impl->users, 1, __ATOMIC_SEQ_CST);
+    if (__atomic_load_n(&impl->closing, __ATOMIC_SEQ_CST) != 0)
+    {
+        OS_Posix_QueueRingExit(impl);
+        return NULL;
+    }
+
+    return impl->ring;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Allocates and initializes an in-process ring for a queue
+ *
+ *  The number of slots is rounded up to a power of two, so the positions
+ *  can simply wrap around, but the configured depth is still enforced.
+ *
+ *-----------------------------------------------------------------*/
+static int32 OS_Posix_QueueRingCreate(OS_impl_queue_internal_record_t *impl, const OS_queue_internal_record_t *queue)
+{
+    OS_impl_queue_ring_t *ring;
+    void *                mem;
+    size_t                header_size;
+    size_t                slot_size;
+    uint32                slot_count;
+    uint32                i;
+
+    if (queue->max_depth == 0)
+    {
+        OS_DEBUG("OS_QueueCreate Error. Ring queue depth must be nonzero\n");
+        return OS_ERROR;
+    }
+
+    slot_count = 1;
+    while (slot_count < queue->max_depth)
+    {
+        slot_count <<= 1;
+    }
+
+    header_size = (sizeof(OS_impl_queue_ring_t) + OS_POSIX_QUEUE_RING_ALIGN - 1) & ~(OS_POSIX_QUEUE_RING_ALIGN - 1);
+    if (queue->max_size > ((SIZE_MAX - header_size) / slot_count) - sizeof(OS_impl_queue_ring_slot_t) -
+                              OS_POSIX_QUEUE_RING_ALIGN)
+    {
+        OS_DEBUG("OS_QueueCreate Error. Ring queue size is too large\n");
+        return OS_ERROR;
+    }
+
+    slot_size = (sizeof(OS_impl_queue_ring_slot_t) + queue->max_size + OS_POSIX_QUEUE_RING_ALIGN - 1) &
+                ~(OS_POSIX_QUEUE_RING_ALIGN - 1);
+
+    if (posix_memalign(&mem, OS_POSIX_QUEUE_RING_ALIGN, header_size + (slot_count * slot_size)) != 0)
+    {
+        OS_DEBUG("OS_QueueCreate Error. Unable to allocate ring queue memory\n");
+        return OS_ERROR;
+    }
+
+    ring = mem;
+    memset(ring, 0, header_size);
+    ring->depth     = queue->max_depth;
+    ring->slot_mask = slot_count - 1;
+    ring->slot_size = slot_size;
+    ring->slots     = (uint8 *)mem + header_size;
+
+    /* a slot is ready for a put when its sequence number is equal to the put position */
+    for (i = 0; i < slot_count; ++i)
+    {
+        OS_Posix_QueueRingSlot(ring, i)->seq   = i;
+        OS_Posix_QueueRingSlot(ring, i)->owner = OS_POSIX_QUEUE_SLOT_NONE;
+    }
+
+    impl->ring = ring;
+
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Gets the slot of an in-process ring which holds the given message buffer
+ *
+ *  Returns NULL if the buffer is not the message area of a slot in this ring, or
+ *  if the slot is not currently handed out to "owner".  On success the slot is
+ *  taken back from the owner, so a second commit or release of the same buffer
+ *  is rejected (unless the slot has been handed out again in the meantime).
+ *
+ *-----------------------------------------------------------------*/
+static OS_impl_queue_ring_slot_t *OS_Posix_QueueRingSlotFromBuffer(OS_impl_queue_ring_t *ring, const void *buffer,
+                                                                   uint32 owner)
+{
+    OS_impl_queue_ring_slot_t *slot;
+    cpuaddr                    offset;
+
+    offset = (cpuaddr)buffer - (cpuaddr)ring->slots - sizeof(OS_impl_queue_ring_slot_t);
+    if ((cpuaddr)buffer < ((cpuaddr)ring->slots + sizeof(OS_impl_queue_ring_slot_t)) ||
+        (offset % ring->slot_size) != 0 || (offset / ring->slot_size) > ring->slot_mask)
+    {
+        return NULL;
+    }
+
+    slot = (OS_impl_queue_ring_slot_t *)(void *)(ring->slots + offset);
+    if (!__atomic_compare_exchange_n(&slot->owner, &owner, OS_POSIX_QUEUE_SLOT_NONE, false, __ATOMIC_RELAXED,
+                                     __ATOMIC_RELAXED))
+    {
+        return NULL;
+    }
+
+    return slot;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Reserves the next slot of an in-process ring for writing, without blocking
+ *
+ *-----------------------------------------------------------------*/
+static int32 OS_Posix_QueueRingReserve(OS_impl_queue_ring_t *ring, OS_impl_queue_ring_slot_t **slot_out)
+{
+    OS_impl_queue_ring_slot_t *slot;
+    uint32                     pos;
+    int32                      diff;
+
+    pos = __atomic_load_n(&ring->put_pos.value, __ATOMIC_RELAXED);
+    while (true)
+    {
+        slot = OS_Posix_QueueRingSlot(ring, pos);
+        diff = (int32)(__atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE) - pos);
+
+        if (diff < 0)
+        {
+            /* the slot still holds a message which has not been read */
+            return OS_QUEUE_FULL;
+        }
+
+        if (diff > 0)
+        {
+            /* another producer already took this position */
+            pos = __atomic_load_n(&ring->put_pos.value, __ATOMIC_RELAXED);
+        }
+        else if ((pos - __atomic_load_n(&ring->get_pos.value, __ATOMIC_ACQUIRE)) >= ring->depth)
+        {
+            /* all slots within the configured depth are in use */
+            return OS_QUEUE_FULL;
+        }
+        else if (__atomic_compare_exchange_n(&ring->put_pos.value, &pos, pos + 1, true, __ATOMIC_RELAXED,
+                                             __ATOMIC_RELAXED))
+        {
+            break;
+        }
+    }
+
+    *slot_out = slot;
+
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Makes a reserved slot of an in-process ring available for reading
+ *
+ *-----------------------------------------------------------------*/
+static void OS_Posix_QueueRingCommit(OS_impl_queue_ring_t *ring, OS_impl_queue_ring_slot_t *slot, size_t size)
+{
+    /* while reserved, the sequence number of the slot is still equal to its position */
+    slot->size = size;
+    __atomic_store_n(&slot->seq, slot->seq + 1, __ATOMIC_RELEASE);
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Wakes readers of an in-process ring after messages have been committed
+ *
+ *  Several commits may share one signal, so a batch of messages costs
+ *  at most a single wakeup.
+ *
+ *-----------------------------------------------------------------*/
+static void OS_Posix_QueueRingSignal(OS_impl_queue_ring_t *ring, uint32 count)
+{
+    /*
+     * Only enter the kernel if there is a reader blocked waiting for a message.
+     * Incrementing the signal before checking for waiters ensures a reader that
+     * is about to wait will see the change and not block.
+     */
+    __atomic_add_fetch(&ring->put_signal.value, 1, __ATOMIC_SEQ_CST);
+    if (__atomic_load_n(&ring->waiters.value, __ATOMIC_SEQ_CST) != 0)
+    {
+        OS_Posix_FutexWake(&ring->put_signal.value, (count < INT_MAX) ? (int)count : INT_MAX);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Takes the next message slot of an in-process ring for reading, without blocking
+ *
+ *-----------------------------------------------------------------*/
+static int32 OS_Posix_QueueRingTryBorrow(OS_impl_queue_ring_t *ring, OS_impl_queue_ring_slot_t **slot_out)
+{
+    OS_impl_queue_ring_slot_t *slot;
+    uint32                     pos;
+    int32                      diff;
+
+    pos = __atomic_load_n(&ring->get_pos.value, __ATOMIC_RELAXED);
+    while (true)
+    {
+        slot = OS_Posix_QueueRingSlot(ring, pos);
+        diff = (int32)(__atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE) - (pos + 1));
+
+        if (diff < 0)
+        {
+            /* the slot has not been written yet */
+            return OS_QUEUE_EMPTY;
+        }
+
+        if (diff > 0)
+        {
+            /* another consumer already took this position */
+            pos = __atomic_load_n(&ring->get_pos.value, __ATOMIC_RELAXED);
+        }
+        else if (__atomic_compare_exchange_n(&ring->get_pos.value, &pos, pos + 1, true, __ATOMIC_RELAXED,
+                                             __ATOMIC_RELAXED))
+        {
+            break;
+        }
+    }
+
+    *slot_out = slot;
+
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Returns a slot of an in-process ring, after its message has been read
+ *
+ *-----------------------------------------------------------------*/
+static void OS_Posix_QueueRingRelease(OS_impl_queue_ring_t *ring, OS_impl_queue_ring_slot_t *slot)
+{
+    /*
+     * while borrowed, the sequence number of the slot is one more than its position,
+     * and it is ready for a put again once the ring has gone all the way around.
+     */
+    __atomic_store_n(&slot->seq, slot->seq + ring->slot_mask, __ATOMIC_RELEASE);
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Removes a blocked reader from the waiter count of an in-process ring.
+ *           Also used as a cleanup handler in case the reader is canceled.
+ *
+ *-----------------------------------------------------------------*/
+static void OS_Posix_QueueRingEndWait(void *arg)
+{
+    OS_impl_queue_ring_t *ring = arg;
+
+    __atomic_sub_fetch(&ring->waiters.value, 1, __ATOMIC_SEQ_CST);
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Takes the next message slot of an in-process ring for reading,
+ *           blocking according to timeout
+ *
+ *  A blocked reader is woken when the queue is deleted, and then returns
+ *  OS_ERR_INVALID_ID.
+ *
+ *-----------------------------------------------------------------*/
+static int32 OS_Posix_QueueRingBorrow(OS_impl_queue_internal_record_t *impl, OS_impl_queue_ring_t *ring,
+                                      OS_impl_queue_ring_slot_t **slot_out, int32 timeout)
+{
+    int32            return_code;
+    uint32           signal;
+    struct timespec  ts;
+    struct timespec *abs_timeout;
+
+    if (timeout > 0)
+    {
+        OS_Posix_CompAbsDelayTime(timeout, &ts);
+        abs_timeout = &ts;
+    }
+    else
+    {
+        abs_timeout = NULL;
+    }
+
+    while (true)
+    {
+        /* the signal must be read before checking the ring, so a put in between is not missed */
+        signal = __atomic_load_n(&ring->put_signal.value, __ATOMIC_SEQ_CST);
+        if (__atomic_load_n(&impl->closing, __ATOMIC_SEQ_CST) != 0)
+        {
+            return_code = OS_ERR_INVALID_ID;
+            break;
+        }
+
+        return_code = OS_Posix_QueueRingTryBorrow(ring, slot_out);
+        if (return_code != OS_QUEUE_EMPTY || timeout == OS_CHECK)
+        {
+            break;
+        }
+
+        /* if canceled while waiting, the reader must also stop using the ring */
+        __atomic_add_fetch(&ring->waiters.value, 1, __ATOMIC_SEQ_CST);
+        pthread_cleanup_push(OS_Posix_QueueRingExit, impl);
+        pthread_cleanup_push(OS_Posix_QueueRingEndWait, ring);
+        return_code = OS_Posix_FutexWait(&ring->put_signal.value, signal, abs_timeout);
+        pthread_cleanup_pop(true);
+        pthread_cleanup_pop(false);
+
+        if (return_code == OS_ERROR_TIMEOUT)
+        {
+            return_code = OS_QUEUE_TIMEOUT;
+            break;
+        }
+
+        if (return_code != OS_SUCCESS)
+        {
+            break;
+        }
+    }
+
+    return return_code;
+}
+
+#endif /* OS_POSIX_HAVE_FUTEX */
+
 /****************************************************************************************
                                 MESSAGE QUEUE API
  ***************************************************************************************/
@@ -89,6 +609,21 @@ int32 OS_QueueCreate_Impl(const OS_object_token_t *token, uint32 flags)
     impl  = OS_OBJECT_TABLE_GET(OS_impl_queue_table, *token);
     queue = OS_OBJECT_TABLE_GET(OS_queue_table, *token);
 
+    impl->ring    = NULL;
+    impl->users   = 0;
+    impl->closing = 0;
+    memset(&impl->stats, 0, sizeof(impl->stats));
+
+#ifdef OS_POSIX_HAVE_FUTEX
+#ifdef OSAL_CONFIG_QUEUE_RING
+    flags |= OS_QUEUE_FLAG_RING;
+#endif
+    if ((flags & OS_QUEUE_FLAG_RING) != 0)
+    {
+        return OS_Posix_QueueRingCreate(impl, queue);
+    }
+#endif
+
     /* set queue attributes */
     memset(&queueAttr, 0, sizeof(queueAttr));
     queueAttr.mq_maxmsg  = queue->max_depth;
@@ -162,9 +697,32 @@ int32 OS_QueueDelete_Impl(const OS_object_token_t *token)
 {
     int32                            return_code;
     OS_impl_queue_internal_record_t *impl;
+#ifdef OS_POSIX_HAVE_FUTEX
+    uint32                           users;
+#endif
 
     impl = OS_OBJECT_TABLE_GET(OS_impl_queue_table, *token);
 
+#ifdef OS_POSIX_HAVE_FUTEX
+    if (impl->ring != NULL)
+    {
+        /* turn away new operations, and wake any readers blocked on the ring */
+        __atomic_store_n(&impl->closing, 1, __ATOMIC_SEQ_CST);
+        __atomic_add_fetch(&impl->ring->put_signal.value, 1, __ATOMIC_SEQ_CST);
+        OS_Posix_FutexWake(&impl->ring->put_signal.value, INT_MAX);
+
+        /* wait for the operations already in progress, which do not block anymore */
+        while ((users = __atomic_load_n(&impl->users, __ATOMIC_SEQ_CST)) != 0)
+        {
+            OS_Posix_FutexWait(&impl->users, users, NULL);
+        }
+
+        free(impl->ring);
+        impl->ring = NULL;
+        return OS_SUCCESS;
+    }
+#endif
+
     /* Try to delete and unlink the queue */
     if (mq_close(impl->id) != 0)
     {
@@ -191,9 +749,42 @@ int32 OS_QueueGet_Impl(const OS_object_token_t *token, void *data, size_t size,
     ssize_t                          sizeCopied;
     struct timespec                  ts;
     OS_impl_queue_internal_record_t *impl;
+#ifdef OS_POSIX_HAVE_FUTEX
+    OS_impl_queue_ring_t *           ring;
+    OS_impl_queue_ring_slot_t *      slot;
+#endif
 
     impl = OS_OBJECT_TABLE_GET(OS_impl_queue_table, *token);
 
+#ifdef OS_POSIX_HAVE_FUTEX
+    if (impl->ring != NULL)
+    {
+        ring = OS_Posix_QueueRingEnter(impl);
+        if (ring == NULL)
+        {
+            return OS_ERR_INVALID_ID;
+        }
+
+        return_code = OS_Posix_QueueRingBorrow(impl, ring, &slot, timeout);
+        if (return_code == OS_SUCCESS)
+        {
+            *size_copied = slot->size;
+            memcpy(data, slot + 1, slot->size);
+            OS_Posix_QueueRingRelease(ring, slot);
+            OS_Posix_QueueStatsGet(&impl->stats, 1, return_code);
+        }
+        else
+        {
+            *size_copied = OSAL_SIZE_C(0);
+            OS_Posix_QueueStatsGet(&impl->stats, 0, return_code);
+        }
+
+        OS_Posix_QueueRingExit(impl);
+
+        return return_code;
+    }
+#endif
+
     /*
      ** Read the message queue for data
      */
@@ -273,6 +864,8 @@ int32 OS_QueueGet_Impl(const OS_object_token_t *token, void *data, size_t size,
         return_code  = OS_SUCCESS;
     }
 
+    OS_Posix_QueueStatsGet(&impl->stats, (return_code == OS_SUCCESS) ? 1 : 0, return_code);
+
     return return_code;
 }
 
@@ -288,9 +881,41 @@ int32 OS_QueuePut_Impl(const OS_object_token_t *token, const void *data, size_t
     int                              result;
     struct timespec                  ts;
     OS_impl_queue_internal_record_t *impl;
+#ifdef OS_POSIX_HAVE_FUTEX
+    OS_impl_queue_ring_t *           ring;
+    OS_impl_queue_ring_slot_t *      slot;
+#endif
 
     impl = OS_OBJECT_TABLE_GET(OS_impl_queue_table, *token);
 
+#ifdef OS_POSIX_HAVE_FUTEX
+    if (impl->ring != NULL)
+    {
+        ring = OS_Posix_QueueRingEnter(impl);
+        if (ring == NULL)
+        {
+            return OS_ERR_INVALID_ID;
+        }
+
+        return_code = OS_Posix_QueueRingReserve(ring, &slot);
+        if (return_code == OS_SUCCESS)
+        {
+            memcpy(slot + 1, data, size);
+            OS_Posix_QueueRingCommit(ring, slot, size);
+            OS_Posix_QueueStatsPut(&impl->stats, 1, return_code);
+            OS_Posix_QueueRingSignal(ring, 1);
+        }
+        else
+        {
+            OS_Posix_QueueStatsPut(&impl->stats, 0, return_code);
+        }
+
+        OS_Posix_QueueRingExit(impl);
+
+        return return_code;
+    }
+#endif
+
     /*
      * NOTE - using a zero timeout here for the same reason that QueueGet does ---
      * checking the attributes and doing the actual send is non-atomic, and if
@@ -319,5 +944,350 @@ int32 OS_QueuePut_Impl(const OS_object_token_t *token, const void *data, size_t
         return_code = OS_ERROR;
     }
 
+    OS_Posix_QueueStatsPut(&impl->stats, (return_code == OS_SUCCESS) ? 1 : 0, return_code);
+
     return return_code;
 }
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueueReserve_Impl(const OS_object_token_t *token, void **buffer)
+{
+#ifdef OS_POSIX_HAVE_FUTEX
+    OS_impl_queue_internal_record_t *impl;
+    OS_impl_queue_ring_t *           ring;
+    OS_impl_queue_ring_slot_t *      slot;
+    int32                            return_code;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_queue_table, *token);
+    if (impl->ring != NULL)
+    {
+        ring = OS_Posix_QueueRingEnter(impl);
+        if (ring == NULL)
+        {
+            return OS_ERR_INVALID_ID;
+        }
+
+        return_code = OS_Posix_QueueRingReserve(ring, &slot);
+        if (return_code == OS_SUCCESS)
+        {
+            __atomic_store_n(&slot->owner, OS_POSIX_QUEUE_SLOT_RESERVED, __ATOMIC_RELAXED);
+            *buffer = slot + 1;
+        }
+        else
+        {
+            /* the message is counted when it is committed */
+            OS_Posix_QueueStatsPut(&impl->stats, 0, return_code);
+        }
+
+        OS_Posix_QueueRingExit(impl);
+
+        return return_code;
+    }
+#endif
+
+    /* mq does not allow direct access to the queue storage */
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueueCommit_Impl(const OS_object_token_t *token, void *buffer, size_t size)
+{
+#ifdef OS_POSIX_HAVE_FUTEX
+    OS_impl_queue_internal_record_t *impl;
+    OS_impl_queue_ring_t *           ring;
+    OS_impl_queue_ring_slot_t *      slot;
+    int32                            return_code;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_queue_table, *token);
+    if (impl->ring != NULL)
+    {
+        ring = OS_Posix_QueueRingEnter(impl);
+        if (ring == NULL)
+        {
+            return OS_ERR_INVALID_ID;
+        }
+
+        slot = OS_Posix_QueueRingSlotFromBuffer(ring, buffer, OS_POSIX_QUEUE_SLOT_RESERVED);
+        if (slot == NULL)
+        {
+            return_code = OS_INVALID_POINTER;
+        }
+        else
+        {
+            OS_Posix_QueueRingCommit(ring, slot, size);
+            OS_Posix_QueueStatsPut(&impl->stats, 1, OS_SUCCESS);
+            OS_Posix_QueueRingSignal(ring, 1);
+            return_code = OS_SUCCESS;
+        }
+
+        OS_Posix_QueueRingExit(impl);
+
+        return return_code;
+    }
+#endif
+
+    /* mq does not allow direct access to the queue storage */
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueueBorrow_Impl(const OS_object_token_t *token, const void **buffer, size_t *size_copied, int32 timeout)
+{
+#ifdef OS_POSIX_HAVE_FUTEX
+    OS_impl_queue_internal_record_t *impl;
+    OS_impl_queue_ring_t *           ring;
+    OS_impl_queue_ring_slot_t *      slot;
+    int32                            return_code;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_queue_table, *token);
+    if (impl->ring != NULL)
+    {
+        ring = OS_Posix_QueueRingEnter(impl);
+        if (ring == NULL)
+        {
+            return OS_ERR_INVALID_ID;
+        }
+
+        return_code = OS_Posix_QueueRingBorrow(impl, ring, &slot, timeout);
+        if (return_code == OS_SUCCESS)
+        {
+            __atomic_store_n(&slot->owner, OS_POSIX_QUEUE_SLOT_BORROWED, __ATOMIC_RELAXED);
+            *buffer      = slot + 1;
+            *size_copied = slot->size;
+            OS_Posix_QueueStatsGet(&impl->stats, 1, return_code);
+        }
+        else
+        {
+            *size_copied = OSAL_SIZE_C(0);
+            OS_Posix_QueueStatsGet(&impl->stats, 0, return_code);
+        }
+
+        OS_Posix_QueueRingExit(impl);
+
+        return return_code;
+    }
+#endif
+
+    /* mq does not allow direct access to the queue storage */
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueueRelease_Impl(const OS_object_token_t *token, const void *buffer)
+{
+#ifdef OS_POSIX_HAVE_FUTEX
+    OS_impl_queue_internal_record_t *impl;
+    OS_impl_queue_ring_t *           ring;
+    OS_impl_queue_ring_slot_t *      slot;
+    int32                            return_code;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_queue_table, *token);
+    if (impl->ring != NULL)
+    {
+        ring = OS_Posix_QueueRingEnter(impl);
+        if (ring == NULL)
+        {
+            return OS_ERR_INVALID_ID;
+        }
+
+        slot = OS_Posix_QueueRingSlotFromBuffer(ring, buffer, OS_POSIX_QUEUE_SLOT_BORROWED);
+        if (slot == NULL)
+        {
+            return_code = OS_INVALID_POINTER;
+        }
+        else
+        {
+            OS_Posix_QueueRingRelease(ring, slot);
+            return_code = OS_SUCCESS;
+        }
+
+        OS_Posix_QueueRingExit(impl);
+
+        return return_code;
+    }
+#endif
+
+    /* mq does not allow direct access to the queue storage */
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueueGetMulti_Impl(const OS_object_token_t *token, void *const *data, size_t size, size_t *size_copied,
+                            uint32 count, uint32 *count_copied, int32 timeout)
+{
+#ifdef OS_POSIX_HAVE_FUTEX
+    OS_impl_queue_internal_record_t *impl;
+    OS_impl_queue_ring_t *           ring;
+    OS_impl_queue_ring_slot_t *      slot;
+    int32                            return_code;
+    uint32                           i;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_queue_table, *token);
+    if (impl->ring != NULL)
+    {
+        ring = OS_Posix_QueueRingEnter(impl);
+        if (ring == NULL)
+        {
+            return OS_ERR_INVALID_ID;
+        }
+
+        /* only the first message is waited for, the rest are whatever is already in the ring */
+        i           = 0;
+        return_code = OS_Posix_QueueRingBorrow(impl, ring, &slot, timeout);
+        while (return_code == OS_SUCCESS)
+        {
+            size_copied[i] = slot->size;
+            memcpy(data[i], slot + 1, slot->size);
+            OS_Posix_QueueRingRelease(ring, slot);
+
+            ++i;
+            if (i >= count)
+            {
+                break;
+            }
+
+            return_code = OS_Posix_QueueRingTryBorrow(ring, &slot);
+        }
+
+        *count_copied = i;
+        OS_Posix_QueueStatsGet(&impl->stats, i, return_code);
+        if (i > 0)
+        {
+            return_code = OS_SUCCESS;
+        }
+
+        OS_Posix_QueueRingExit(impl);
+
+        return return_code;
+    }
+#endif
+
+    /* mq can only receive one message per call */
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueuePutMulti_Impl(const OS_object_token_t *token, const void *const *data, const size_t *size, uint32 count,
+                            uint32 *count_put, uint32 flags)
+{
+#ifdef OS_POSIX_HAVE_FUTEX
+    OS_impl_queue_internal_record_t *impl;
+    OS_impl_queue_ring_t *           ring;
+    OS_impl_queue_ring_slot_t *      slot;
+    int32                            return_code;
+    uint32                           i;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_queue_table, *token);
+    if (impl->ring != NULL)
+    {
+        ring = OS_Posix_QueueRingEnter(impl);
+        if (ring == NULL)
+        {
+            return OS_ERR_INVALID_ID;
+        }
+
+        return_code = OS_SUCCESS;
+        for (i = 0; i < count; ++i)
+        {
+            return_code = OS_Posix_QueueRingReserve(ring, &slot);
+            if (return_code != OS_SUCCESS)
+            {
+                break;
+            }
+
+            memcpy(slot + 1, data[i], size[i]);
+            OS_Posix_QueueRingCommit(ring, slot, size[i]);
+        }
+
+        *count_put = i;
+        OS_Posix_QueueStatsPut(&impl->stats, i, return_code);
+        if (i > 0)
+        {
+            /* one wakeup for the whole batch */
+            OS_Posix_QueueRingSignal(ring, i);
+            return_code = OS_SUCCESS;
+        }
+
+        OS_Posix_QueueRingExit(impl);
+
+        return return_code;
+    }
+#endif
+
+    /* mq can only send one message per call */
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueueGetInfo_Impl(const OS_object_token_t *token, OS_queue_prop_t *queue_prop)
+{
+    OS_impl_queue_internal_record_t *impl;
+    int32                            depth;
+    uint32                           high_water;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_queue_table, *token);
+
+    /*
+     * The depth is not updated atomically with the queue itself, so it can be
+     * briefly out of range while other tasks are putting and getting messages.
+     */
+    depth = (int32)OS_Posix_QueueStatGet(&impl->stats.depth);
+    if (depth < 0)
+    {
+        depth = 0;
+    }
+    else if ((uint32)depth > queue_prop->max_depth)
+    {
+        depth = queue_prop->max_depth;
+    }
+
+    high_water = OS_Posix_QueueStatGet(&impl->stats.high_water);
+    if (high_water > queue_prop->max_depth)
+    {
+        high_water = queue_prop->max_depth;
+    }
+
+    queue_prop->depth         = OSAL_BLOCKCOUNT_C(depth);
+    queue_prop->high_water    = OSAL_BLOCKCOUNT_C(high_water);
+    queue_prop->put_count     = OS_Posix_QueueStatGet(&impl->stats.put_count);
+    queue_prop->get_count     = OS_Posix_QueueStatGet(&impl->stats.get_count);
+    queue_prop->full_count    = OS_Posix_QueueStatGet(&impl->stats.full_count);
+    queue_prop->timeout_count = OS_Posix_QueueStatGet(&impl->stats.timeout_count);
+
+    return OS_SUCCESS;
+}
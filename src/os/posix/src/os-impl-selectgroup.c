@@ -0,0 +1,330 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ * \ingroup  posix
+ *
+ * Purpose: This file contains the select group implementation, based on epoll
+ *
+ * Each select group is an epoll instance.  The handles in the group are
+ * registered with it, so nothing needs to be converted or scanned on each
+ * wait, and the file descriptor values are not limited by FD_SETSIZE.
+ */
+
+/****************************************************************************************
+                                    INCLUDE FILES
+ ***************************************************************************************/
+
+#include "os-posix.h"
+#include "os-impl-io.h"
+#include "os-impl-selectgroup.h"
+#include "os-shared-clock.h"
+#include "os-shared-idmap.h"
+#include "os-shared-select.h"
+
+#ifdef OS_POSIX_HAVE_EPOLL
+#include <sys/epoll.h>
+#endif
+
+/* Tables where the OS object information is stored */
+OS_impl_selgroup_internal_record_t OS_impl_selgroup_table[OS_MAX_SELECT_GROUPS];
+
+/****************************************************************************************
+                                  SELECT GROUP API
+ ***************************************************************************************/
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_Posix_SelectGroupAPI_Impl_Init(void)
+{
+    osal_index_t idx;
+
+    for (idx = 0; idx < OS_MAX_SELECT_GROUPS; ++idx)
+    {
+        OS_impl_selgroup_table[idx].epoll_fd = -1;
+    }
+
+    return OS_SUCCESS;
+}
+
+#ifdef OS_POSIX_HAVE_EPOLL
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Gets the epoll timeout, in milliseconds, until abs_timeout.
+ *           Partial milliseconds are rounded up, so the wait does not end early.
+ *
+ *-----------------------------------------------------------------*/
+static int OS_Posix_SelectGroupTimeout(OS_time_t abs_timeout)
+{
+    OS_time_t curr_time;
+    int64     msecs;
+
+    /* Implementations may pass OS_TIME_MAX to mean wait forever */
+    if (OS_TimeEqual(abs_timeout, OS_TIME_MAX))
+    {
+        return -1;
+    }
+
+    curr_time = abs_timeout;
+    if (OS_TimeGetSign(abs_timeout) > 0)
+    {
+        OS_GetLocalTime_Impl(&curr_time);
+        curr_time = OS_TimeSubtract(abs_timeout, curr_time);
+    }
+
+    if (OS_TimeGetSign(curr_time) <= 0)
+    {
+        /* timeout has already passed - this will still poll, but not block */
+        return 0;
+    }
+
+    msecs = OS_TimeGetTotalMilliseconds(OS_TimeAdd(curr_time, OS_TimeFromTotalMicroseconds(999)));
+    if (msecs > INT_MAX)
+    {
+        msecs = INT_MAX;
+    }
+
+    return (int)msecs;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_SelectGroupCreate_Impl(const OS_object_token_t *token, uint32 options)
+{
+    OS_impl_selgroup_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_selgroup_table, *token);
+
+    impl->epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    if (impl->epoll_fd < 0)
+    {
+        OS_DEBUG("epoll_create1() failed: %s\n", strerror(errno));
+        return OS_ERROR;
+    }
+
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_SelectGroupDelete_Impl(const OS_object_token_t *token)
+{
+    OS_impl_selgroup_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_selgroup_table, *token);
+
+    close(impl->epoll_fd);
+    impl->epoll_fd = -1;
+
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_SelectGroupAdd_Impl(const OS_object_token_t *token, const OS_object_token_t *stream_token,
+                             uint32 StateFlags)
+{
+    OS_impl_selgroup_internal_record_t *impl;
+    OS_impl_file_internal_record_t *    stream;
+    struct epoll_event                  event;
+    int                                 status;
+
+    impl   = OS_OBJECT_TABLE_GET(OS_impl_selgroup_table, *token);
+    stream = OS_OBJECT_TABLE_GET(OS_impl_filehandle_table, *stream_token);
+
+    if (!stream->selectable)
+    {
+        return OS_ERR_OPERATION_NOT_SUPPORTED;
+    }
+
+    memset(&event, 0, sizeof(event));
+    if (StateFlags & OS_STREAM_STATE_READABLE)
+    {
+        event.events |= EPOLLIN;
+    }
+    if (StateFlags & OS_STREAM_STATE_WRITABLE)
+    {
+        event.events |= EPOLLOUT;
+    }
+
+    /*
+     * The OSAL ID is kept with the descriptor, so the wait does not need to map
+     * descriptors back to IDs.  The requested flags are kept too, as errors
+     * and hangups are always reported and must be mapped to a requested state.
+     */
+    event.data.u64 = ((uint64)StateFlags << 32) | OS_ObjectIdToInteger(stream_token->obj_id);
+
+    status = epoll_ctl(impl->epoll_fd, EPOLL_CTL_ADD, stream->fd, &event);
+    if (status < 0 && errno == EEXIST)
+    {
+        /* already in the group, so only change the flags */
+        status = epoll_ctl(impl->epoll_fd, EPOLL_CTL_MOD, stream->fd, &event);
+    }
+
+    if (status < 0)
+    {
+        OS_DEBUG("epoll_ctl() failed: %s\n", strerror(errno));
+        return OS_ERROR;
+    }
+
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_SelectGroupRemove_Impl(const OS_object_token_t *token, const OS_object_token_t *stream_token)
+{
+    OS_impl_selgroup_internal_record_t *impl;
+    OS_impl_file_internal_record_t *    stream;
+
+    impl   = OS_OBJECT_TABLE_GET(OS_impl_selgroup_table, *token);
+    stream = OS_OBJECT_TABLE_GET(OS_impl_filehandle_table, *stream_token);
+
+    if (epoll_ctl(impl->epoll_fd, EPOLL_CTL_DEL, stream->fd, NULL) < 0)
+    {
+        return OS_ERROR;
+    }
+
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_SelectGroupWait_Impl(const OS_object_token_t *token, OS_SelectGroupEvent_t *Events, uint32 MaxEvents,
+                              uint32 *EventCount, OS_time_t abs_timeout)
+{
+    OS_impl_selgroup_internal_record_t *impl;
+    struct epoll_event                  os_events[OS_MAX_NUM_OPEN_FILES];
+    int                                 os_status;
+    int                                 i;
+    uint32                              requested;
+    uint32                              flags;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_selgroup_table, *token);
+
+    /* A group cannot contain more handles than there are file handles */
+    if (MaxEvents > OS_MAX_NUM_OPEN_FILES)
+    {
+        MaxEvents = OS_MAX_NUM_OPEN_FILES;
+    }
+
+    do
+    {
+        os_status = epoll_wait(impl->epoll_fd, os_events, MaxEvents, OS_Posix_SelectGroupTimeout(abs_timeout));
+    } while (os_status < 0 && errno == EINTR);
+
+    if (os_status < 0)
+    {
+        return OS_ERROR;
+    }
+
+    if (os_status == 0)
+    {
+        return OS_ERROR_TIMEOUT;
+    }
+
+    for (i = 0; i < os_status; ++i)
+    {
+        /*
+         * As with select(), a descriptor with an error or hangup is reported
+         * as ready, so the subsequent read or write will see the condition.
+         */
+        requested = os_events[i].data.u64 >> 32;
+        flags     = 0;
+        if (os_events[i].events & (EPOLLHUP | EPOLLERR))
+        {
+            flags = requested;
+        }
+        if (os_events[i].events & EPOLLIN)
+        {
+            flags |= OS_STREAM_STATE_READABLE;
+        }
+        if (os_events[i].events & EPOLLOUT)
+        {
+            flags |= OS_STREAM_STATE_WRITABLE;
+        }
+
+        Events[i].objid      = OS_ObjectIdFromInteger(os_events[i].data.u64 & 0xFFFFFFFF);
+        Events[i].StateFlags = flags & requested;
+    }
+
+    *EventCount = os_status;
+
+    return OS_SUCCESS;
+}
+
+#else
+
+/*
+ * Without epoll, select groups are not supported
+ */
+
+int32 OS_SelectGroupCreate_Impl(const OS_object_token_t *token, uint32 options)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
+int32 OS_SelectGroupDelete_Impl(const OS_object_token_t *token)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
+int32 OS_SelectGroupAdd_Impl(const OS_object_token_t *token, const OS_object_token_t *stream_token,
+                             uint32 StateFlags)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
+int32 OS_SelectGroupRemove_Impl(const OS_object_token_t *token, const OS_object_token_t *stream_token)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
+int32 OS_SelectGroupWait_Impl(const OS_object_token_t *token, OS_SelectGroupEvent_t *Events, uint32 MaxEvents,
+                              uint32 *EventCount, OS_time_t abs_timeout)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
+#endif /* OS_POSIX_HAVE_EPOLL */
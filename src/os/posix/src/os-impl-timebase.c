@@ -39,6 +39,12 @@
 #include "os-shared-timebase.h"
 #include "os-shared-idmap.h"
 #include "os-shared-common.h"
+#include "os-shared-task.h"
+
+#ifdef OS_POSIX_TIMEBASE_TIMERFD
+#include <sys/timerfd.h>
+#include <sys/epoll.h>
+#endif
 
 /****************************************************************************************
                                 EXTERNAL FUNCTION PROTOTYPES
@@ -72,6 +78,15 @@ static void OS_UsecToTimespec(uint32 usecs, struct timespec *time_spec);
 
 OS_impl_timebase_internal_record_t OS_impl_timebase_table[OS_MAX_TIMEBASES];
 
+#ifdef OS_POSIX_TIMEBASE_TIMERFD
+/*
+ * The epoll instance of the dispatcher thread that services all timerfd time bases.
+ * This is created along with the thread when the first such time base is created,
+ * and then kept for the life of the process.
+ */
+static int OS_Posix_TimeBaseEpollFd = -1;
+#endif
+
 /****************************************************************************************
                                 INTERNAL FUNCTIONS
  ***************************************************************************************/
@@ -179,6 +194,171 @@ static uint32 OS_TimeBase_SigWaitImpl(osal_id_t obj_id)
     return interval_time;
 }
 
+#ifdef OS_POSIX_TIMEBASE_TIMERFD
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Consume the pending expirations of a timerfd time base
+ *
+ *  Returns: The elapsed time, in the same units as the time base
+ *           start and interval times, or 0 if nothing has expired
+ *
+ *-----------------------------------------------------------------*/
+static uint32 OS_Posix_TimeBaseReadTimerFd(osal_index_t idx)
+{
+    OS_impl_timebase_internal_record_t *impl;
+    OS_timebase_internal_record_t *     timebase;
+    uint64                              expirations;
+    uint32                              tick_time;
+
+    impl      = &OS_impl_timebase_table[idx];
+    timebase  = &OS_timebase_table[idx];
+    tick_time = 0;
+
+    pthread_mutex_lock(&impl->handler_mutex);
+
+    /*
+     * The descriptor is checked under the lock, as the time base may have been
+     * deleted after epoll reported it.  The read does not block, so a stale
+     * event simply finds nothing to read.
+     *
+     * Unlike a signal, the expiration count includes any overruns, so no time
+     * is lost if the dispatcher was held up by a slow callback.
+     */
+    if (impl->timer_fd >= 0 &&
+        read(impl->timer_fd, &expirations, sizeof(expirations)) == (ssize_t)sizeof(expirations) && expirations > 0)
+    {
+        if (impl->reset_flag != 0)
+        {
+            /* first expiry since timer_set() reflects the configured start time */
+            tick_time        = timebase->nominal_start_time;
+            impl->reset_flag = 0;
+            --expirations;
+        }
+
+        tick_time += (uint32)expirations * timebase->nominal_interval_time;
+    }
+
+    pthread_mutex_unlock(&impl->handler_mutex);
+
+    return tick_time;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Entry point of the timerfd dispatcher thread
+ *
+ *           Waits for any of the timerfd time bases to expire, and
+ *           processes the application callbacks of each one in turn.
+ *
+ *-----------------------------------------------------------------*/
+static void *OS_Posix_TimeBaseDispatchEntry(void *arg)
+{
+    struct epoll_event events[OS_MAX_TIMEBASES];
+    OS_object_token_t  token;
+    osal_id_t          timebase_id;
+    osal_index_t       idx;
+    uint32             tick_time;
+    int                nevents;
+    int                i;
+
+    while (1)
+    {
+        nevents = epoll_wait(OS_Posix_TimeBaseEpollFd, events, OS_MAX_TIMEBASES, -1);
+
+        /* on error (e.g. EINTR) nevents is negative, so this just waits again */
+        for (i = 0; i < nevents; ++i)
+        {
+            idx       = OSAL_INDEX_C(events[i].data.u32);
+            tick_time = OS_Posix_TimeBaseReadTimerFd(idx);
+            if (tick_time == 0)
+            {
+                continue;
+            }
+
+            timebase_id = OS_global_timebase_table[idx].active_id;
+            if (OS_ObjectIdGetById(OS_LOCK_MODE_NONE, OS_OBJECT_TYPE_OS_TIMEBASE, timebase_id, &token) == OS_SUCCESS)
+            {
+                /*
+                 * Register as the handler of this time base while giving its callbacks, this
+                 * prevents the application from configuring timers from a callback context.
+                 */
+                OS_TaskRegister_Impl(timebase_id);
+                OS_TimeBase_ProcessTick(&token, tick_time);
+            }
+        }
+    }
+
+    return NULL;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Create a timerfd for a simulated time base and add it
+ *           to the dispatcher, starting the dispatcher if needed.
+ *
+ *           This is called with the time base table locked.
+ *
+ *  Returns: OS_SUCCESS on success, or relevant error code
+ *
+ *-----------------------------------------------------------------*/
+static int32 OS_Posix_TimeBaseCreateTimerFd(const OS_object_token_t *token)
+{
+    OS_impl_timebase_internal_record_t *local;
+    struct epoll_event                  event;
+    pthread_t                           dispatch_thread;
+    int                                 epoll_fd;
+    int32                               return_code;
+
+    local = OS_OBJECT_TABLE_GET(OS_impl_timebase_table, *token);
+
+    if (OS_Posix_TimeBaseEpollFd < 0)
+    {
+        epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+        if (epoll_fd < 0)
+        {
+            OS_DEBUG("epoll_create1() failed: %s\n", strerror(errno));
+            return OS_TIMER_ERR_UNAVAILABLE;
+        }
+
+        OS_Posix_TimeBaseEpollFd = epoll_fd;
+
+        return_code = OS_Posix_InternalTaskCreate_Impl(&dispatch_thread, OSAL_PRIORITY_C(0), OSAL_TASK_STACK_ALLOCATE,
+                                                       PTHREAD_STACK_MIN, OS_Posix_TimeBaseDispatchEntry, NULL);
+        if (return_code != OS_SUCCESS)
+        {
+            OS_Posix_TimeBaseEpollFd = -1;
+            close(epoll_fd);
+            return return_code;
+        }
+    }
+
+    local->timer_fd = timerfd_create(OS_PREFERRED_CLOCK, TFD_NONBLOCK | TFD_CLOEXEC);
+    if (local->timer_fd < 0)
+    {
+        OS_DEBUG("timerfd_create() failed: %s\n", strerror(errno));
+        return OS_TIMER_ERR_UNAVAILABLE;
+    }
+
+    memset(&event, 0, sizeof(event));
+    event.events   = EPOLLIN;
+    event.data.u32 = OS_ObjectIndexFromToken(token);
+    if (epoll_ctl(OS_Posix_TimeBaseEpollFd, EPOLL_CTL_ADD, local->timer_fd, &event) < 0)
+    {
+        OS_DEBUG("epoll_ctl() failed: %s\n", strerror(errno));
+        close(local->timer_fd);
+        local->timer_fd = -1;
+        return OS_TIMER_ERR_UNAVAILABLE;
+    }
+
+    return OS_SUCCESS;
+}
+
+#endif /* OS_POSIX_TIMEBASE_TIMERFD */
+
 /****************************************************************************************
                                 INITIALIZATION FUNCTION
  ***************************************************************************************/
@@ -271,6 +451,8 @@ int32 OS_Posix_TimeBaseAPI_Impl_Init(void)
                 return_code = OS_ERROR;
                 break;
             }
+
+            OS_impl_timebase_table[idx].timer_fd = -1;
         }
 
         /*
@@ -333,6 +515,21 @@ int32 OS_TimeBaseCreate_Impl(const OS_object_token_t *token)
     local    = OS_OBJECT_TABLE_GET(OS_impl_timebase_table, *token);
     timebase = OS_OBJECT_TABLE_GET(OS_timebase_table, *token);
 
+    local->assigned_signal = 0;
+    local->timer_fd        = -1;
+
+#ifdef OS_POSIX_TIMEBASE_TIMERFD
+    /*
+     * A simulated tick is serviced by the common dispatcher thread, so there is
+     * no dedicated thread.  A time base with an external sync function still
+     * gets its own thread below, as the sync function may block.
+     */
+    if (timebase->external_sync == NULL)
+    {
+        return OS_Posix_TimeBaseCreateTimerFd(token);
+    }
+#endif
+
     /*
      * Spawn a dedicated time base handler thread
      *
@@ -354,8 +551,6 @@ int32 OS_TimeBaseCreate_Impl(const OS_object_token_t *token)
         return return_code;
     }
 
-    local->assigned_signal = 0;
-
     /*
      * Set up the necessary OS constructs
      *
@@ -496,7 +691,7 @@ int32 OS_TimeBaseSet_Impl(const OS_object_token_t *token, uint32 start_time, uin
     return_code = OS_SUCCESS;
 
     /* There is only something to do here if we are generating a simulated tick */
-    if (local->assigned_signal != 0)
+    if (local->assigned_signal != 0 || local->timer_fd >= 0)
     {
         /*
         ** Convert from Microseconds to timespec structures
@@ -508,9 +703,18 @@ int32 OS_TimeBaseSet_Impl(const OS_object_token_t *token, uint32 start_time, uin
         /*
         ** Program the real timer
         */
-        status = timer_settime(local->host_timerid, 0, /* Flags field can be zero */
-                               &timeout,               /* struct itimerspec */
-                               NULL);                  /* Oldvalue */
+#ifdef OS_POSIX_TIMEBASE_TIMERFD
+        if (local->timer_fd >= 0)
+        {
+            status = timerfd_settime(local->timer_fd, 0, &timeout, NULL);
+        }
+        else
+#endif
+        {
+            status = timer_settime(local->host_timerid, 0, /* Flags field can be zero */
+                                   &timeout,               /* struct itimerspec */
+                                   NULL);                  /* Oldvalue */
+        }
 
         if (status < 0)
         {
@@ -544,6 +748,24 @@ int32 OS_TimeBaseDelete_Impl(const OS_object_token_t *token)
 
     local = OS_OBJECT_TABLE_GET(OS_impl_timebase_table, *token);
 
+#ifdef OS_POSIX_TIMEBASE_TIMERFD
+    if (local->timer_fd >= 0)
+    {
+        /*
+         * There is no dedicated thread to cancel, just remove the timer from the
+         * dispatcher.  This is done under the lock so the dispatcher cannot be
+         * reading from the descriptor as it is closed.
+         */
+        pthread_mutex_lock(&local->handler_mutex);
+        epoll_ctl(OS_Posix_TimeBaseEpollFd, EPOLL_CTL_DEL, local->timer_fd, NULL);
+        close(local->timer_fd);
+        local->timer_fd = -1;
+        pthread_mutex_unlock(&local->handler_mutex);
+
+        return OS_SUCCESS;
+    }
+#endif
+
     pthread_cancel(local->handler_thread);
 
     /*
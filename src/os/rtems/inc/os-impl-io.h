@@ -29,6 +29,7 @@
 #include "osconfig.h"
 #include <stdbool.h>
 #include <unistd.h>
+#include <sys/uio.h>
 
 typedef struct
 {
@@ -102,6 +102,7 @@ void OS_ConsoleWakeup_Impl(const OS_object_token_t *token)
 static void OS_ConsoleTask_Entry(rtems_task_argument arg)
 {
     OS_object_token_t                  token;
+    int32                              status;
     OS_impl_console_internal_record_t *local;
 
     if (OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, OS_OBJECT_TYPE_OS_CONSOLE, OS_ObjectIdFromInteger(arg), &token) ==
@@ -112,7 +113,13 @@ static void OS_ConsoleTask_Entry(rtems_task_argument arg)
         /* Loop forever (unless shutdown is set) */
         while (OS_SharedGlobalVars.GlobalState != OS_SHUTDOWN_MAGIC_NUMBER)
         {
-            OS_ConsoleOutput_Impl(&token);
+            /* staged records remain if the console buffer filled, so write it out and continue */
+            do
+            {
+                status = OS_ConsoleDrainStaging(&token);
+                OS_ConsoleOutput_Impl(&token);
+            } while (status == OS_QUEUE_FULL);
+
             rtems_semaphore_obtain(local->data_sem, RTEMS_WAIT, RTEMS_NO_TIMEOUT);
         }
         OS_ObjectIdRelease(&token);
@@ -74,3 +74,62 @@ int32 OS_Rtems_StreamAPI_Impl_Init(void)
 
     return OS_SUCCESS;
 }
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *  There is no kernel-side copy on this OS, so OS_cp() uses its own copy loop.
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_FileCopy_Impl(const OS_object_token_t *src_token, const OS_object_token_t *dest_token)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *  Mapping files into memory is not supported on this OS.
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_FileMap_Impl(const OS_object_token_t *token, OS_file_mapping_t *map, uint32 flags)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_FileUnmap_Impl(const OS_object_token_t *token, const OS_file_mapping_t *map, uint32 flags)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_FileAsyncSubmit_Impl(const OS_object_token_t *token, OS_FileAsyncReq_t *req)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_FileAsyncWait_Impl(OS_time_t abs_timeout)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
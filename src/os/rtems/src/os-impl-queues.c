@@ -286,3 +286,75 @@ int32 OS_QueueGetInfo_Impl(const OS_object_token_t *token, OS_queue_prop_t *queu
     /* No extra info for queues in the OS implementation */
     return OS_SUCCESS;
 }
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueueReserve_Impl(const OS_object_token_t *token, void **buffer)
+{
+    /* RTEMS message queues do not allow direct access to the queue storage */
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueueCommit_Impl(const OS_object_token_t *token, void *buffer, size_t size)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueueBorrow_Impl(const OS_object_token_t *token, const void **buffer, size_t *size_copied, int32 timeout)
+{
+    /* RTEMS message queues do not allow direct access to the queue storage */
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueueRelease_Impl(const OS_object_token_t *token, const void *buffer)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueueGetMulti_Impl(const OS_object_token_t *token, void *const *data, size_t size, size_t *size_copied,
+                            uint32 count, uint32 *count_copied, int32 timeout)
+{
+    /* RTEMS message queues receive one message per call */
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueuePutMulti_Impl(const OS_object_token_t *token, const void *const *data, const size_t *size, uint32 count,
+                            uint32 *count_put, uint32 flags)
+{
+    /* RTEMS message queues send one message per call */
+    return OS_ERR_NOT_IMPLEMENTED;
+}
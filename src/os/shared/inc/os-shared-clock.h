@@ -50,4 +50,50 @@ int32 OS_GetLocalTime_Impl(OS_time_t *time_struct);
  ------------------------------------------------------------------*/
 int32 OS_SetLocalTime_Impl(const OS_time_t *time_struct);
 
+/*----------------------------------------------------------------
+
+    Purpose: Get the time from a clock that is never set or adjusted
+
+    Returns: OS_SUCCESS on success, or relevant error code
+ ------------------------------------------------------------------*/
+int32 OS_GetMonotonicTime_Impl(OS_time_t *time_struct);
+
+/*----------------------------------------------------------------
+
+    Purpose: Get the monotonic time from the fastest source that
+             provides at least millisecond resolution
+
+    Returns: OS_SUCCESS on success, or relevant error code
+ ------------------------------------------------------------------*/
+int32 OS_GetCoarseTime_Impl(OS_time_t *time_struct);
+
+/*----------------------------------------------------------------
+
+    Purpose: Read the free-running hardware counter
+
+    Returns: The counter value
+ ------------------------------------------------------------------*/
+uint64 OS_GetRawCounter_Impl(void);
+
+/*----------------------------------------------------------------
+
+    Purpose: Get the rate of the hardware counter, if known
+
+    Returns: The counter frequency in Hz, or 0 if it must be measured
+ ------------------------------------------------------------------*/
+uint64 OS_GetRawCounterFreq_Impl(void);
+
+/*
+ * Clock API shared layer functions
+ */
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_ClockAPI_Init
+
+   Purpose: Initialize the OS-independent layer for the clock API
+
+   returns: OS_SUCCESS on success, or relevant error code
+---------------------------------------------------------------------------------------*/
+int32 OS_ClockAPI_Init(void);
+
 #endif /* OS_SHARED_CLOCK_H */
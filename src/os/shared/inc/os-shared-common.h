@@ -58,6 +58,13 @@ struct OS_shared_global_vars
      * because they are updated and read by different threads
      */
     volatile bool PrintfEnabled;
+
+    /*
+     * Whether OS_printf() only captures its arguments, leaving
+     * the formatting to the console utility task
+     */
+    bool PrintfDeferred;
+
     uint32        MicroSecPerTick;
     uint32        TicksPerSecond;
 
@@ -77,6 +84,34 @@ struct OS_shared_global_vars
  */
 extern OS_SharedGlobalVars_t OS_SharedGlobalVars;
 
+#ifdef OSAL_CONFIG_DEBUG_PRINTF
+
+#define OS_DEBUG_MAX_LINE_LEN 132
+#define OS_DEBUG_TRACE_DEPTH  32
+
+/*
+ * A line of the debug trace ring
+ *
+ * The sequence number is zero while the line is being written, so a
+ * reader can tell which lines are complete and in what order.  The busy
+ * flag keeps two writers from using the same line at once, which can
+ * happen when a writer is preempted while the ring wraps around.
+ */
+typedef struct
+{
+    uint32 Sequence;
+    bool   Busy;
+    char   Text[OS_DEBUG_MAX_LINE_LEN];
+} OS_debug_trace_line_t;
+
+/*
+ * The most recent debug lines, and the number of lines written so far
+ */
+extern OS_debug_trace_line_t OS_debug_trace_ring[OS_DEBUG_TRACE_DEPTH];
+extern uint32                OS_debug_trace_count;
+
+#endif
+
 /*---------------------------------------------------------------------------------------
    Name: OS_NotifyEvent
 
@@ -51,10 +51,41 @@ typedef struct
     volatile size_t WritePos;       /**< Offset of next byte to write */
     uint32          OverflowEvents; /**< Number of lines dropped due to overflow */
     bool            IsAsync;        /**< Whether to write data via deferred utility task */
+
+    bool      WakeupPending;    /**< Set when the utility task has been woken, until it drains */
+    uint32    DrainCount;       /**< Number of times the staging rings were drained */
+    uint64    BytesWritten;     /**< Total bytes written to the output device */
+    OS_time_t LastDrainLatency; /**< Age of the oldest record at the most recent drain */
+    OS_time_t MaxDrainLatency;  /**< Largest drain latency observed */
 } OS_console_internal_record_t;
 
 extern OS_console_internal_record_t OS_console_table[OS_MAX_CONSOLES];
 
+/**
+ * Number of console staging rings
+ *
+ * Each OSAL task has its own ring, and one additional ring is shared
+ * by all other callers (such as threads not created through OSAL).
+ */
+#define OS_CONSOLE_STAGING_COUNT (OS_MAX_TASKS + 1)
+
+/**
+ * Staging ring for asynchronous console output
+ *
+ * Each ring has a single producer and a single consumer, the console
+ * utility task.  The positions are free-running and only advanced by
+ * their owner, with the write position published after the record is
+ * complete, so neither side needs a lock.
+ */
+typedef struct
+{
+    uint32 ReadPos;                        /**< Position of next byte to read, updated by the consumer */
+    uint32 WritePos;                       /**< Position of next byte to write, updated by the producer */
+    char   Buffer[OS_PRINTF_STAGING_SIZE]; /**< Record storage */
+} OS_console_staging_t;
+
+extern OS_console_staging_t OS_console_staging_table[OS_CONSOLE_STAGING_COUNT];
+
 /****************************************************************************************
                  CONSOLE / DEBUG API LOW-LEVEL IMPLEMENTATION FUNCTIONS
  ****************************************************************************************/
@@ -87,4 +118,20 @@ int32 OS_ConsoleCreate_Impl(const OS_object_token_t *token);
  ------------------------------------------------------------------*/
 void OS_ConsoleWakeup_Impl(const OS_object_token_t *token);
 
+/*----------------------------------------------------------------
+
+    Purpose: Move staged console output into the console buffer
+
+   This is invoked by the console utility task before writing the
+   console buffer to the device.  Records are taken from all of the
+   staging rings in timestamp order.
+
+   This also clears the pending wakeup, so that writers posted after
+   this point will wake the utility task again.
+
+   returns: OS_SUCCESS if all staged records were moved, or
+            OS_QUEUE_FULL if the console buffer filled first
+ ------------------------------------------------------------------*/
+int32 OS_ConsoleDrainStaging(const OS_object_token_t *token);
+
 #endif /* OS_SHARED_CONSOLE_H */
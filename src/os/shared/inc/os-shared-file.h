@@ -29,12 +29,24 @@
 #include "osapi-file.h"
 #include "os-shared-globaldefs.h"
 
+/*
+ * A memory mapping of part of a file
+ */
+typedef struct
+{
+    void *        addr;   /**< Address of the mapped data, as given to the user (NULL while not mapped) */
+    osal_offset_t offset; /**< File offset of the mapped data */
+    size_t        length; /**< Length of the mapped data (zero if this entry is not in use) */
+} OS_file_mapping_t;
+
 typedef struct
 {
-    char   stream_name[OS_MAX_PATH_LEN];
-    uint8  socket_domain;
-    uint8  socket_type;
-    uint16 stream_state;
+    char              stream_name[OS_MAX_PATH_LEN];
+    uint8             socket_domain;
+    uint8             socket_type;
+    uint16            stream_state;
+    uint16            map_count; /**< Number of active mappings, the handle cannot be closed while nonzero */
+    OS_file_mapping_t mappings[OS_FILE_MAX_MAPPINGS];
 } OS_stream_internal_record_t;
 
 /*
@@ -78,6 +90,15 @@ int32 OS_FileAPI_Init(void);
  ------------------------------------------------------------------*/
 int32 OS_GenericSeek_Impl(const OS_object_token_t *token, int32 offset, uint32 whence);
 
+/*----------------------------------------------------------------
+
+    Purpose: Seek to a given position in a file, using 64-bit offsets
+
+    Returns: OS_SUCCESS on success, or relevant error code
+ ------------------------------------------------------------------*/
+int32 OS_GenericSeek64_Impl(const OS_object_token_t *token, osal_offset_t offset, uint32 whence,
+                            osal_offset_t *position);
+
 /*----------------------------------------------------------------
 
     Purpose: Read from a file descriptor
@@ -96,6 +117,43 @@ int32 OS_GenericRead_Impl(const OS_object_token_t *token, void *buffer, size_t n
  ------------------------------------------------------------------*/
 int32 OS_GenericWrite_Impl(const OS_object_token_t *token, const void *buffer, size_t nbytes, OS_time_t abs_timeout);
 
+/*----------------------------------------------------------------
+
+    Purpose: Read from a file descriptor into multiple buffers
+             This may be a normal file or a socket/pipe
+
+    Returns: Number of bytes read (non-negative) on success, or relevant error code (negative)
+ ------------------------------------------------------------------*/
+int32 OS_GenericReadv_Impl(const OS_object_token_t *token, const OS_iovec_t *iov, uint32 iovcnt,
+                           OS_time_t abs_timeout);
+
+/*----------------------------------------------------------------
+
+    Purpose: Write to a file descriptor from multiple buffers
+             This may be a normal file or a socket/pipe
+
+    Returns: Number of bytes written (non-negative) on success, or relevant error code (negative)
+ ------------------------------------------------------------------*/
+int32 OS_GenericWritev_Impl(const OS_object_token_t *token, const OS_iovec_t *iov, uint32 iovcnt,
+                            OS_time_t abs_timeout);
+
+/*----------------------------------------------------------------
+
+    Purpose: Read from a given offset in a file, without changing the file position
+
+    Returns: Number of bytes read (non-negative) on success, or relevant error code (negative)
+ ------------------------------------------------------------------*/
+int32 OS_GenericPread_Impl(const OS_object_token_t *token, void *buffer, size_t nbytes, osal_offset_t offset);
+
+/*----------------------------------------------------------------
+
+    Purpose: Write to a given offset in a file, without changing the file position
+
+    Returns: Number of bytes written (non-negative) on success, or relevant error code (negative)
+ ------------------------------------------------------------------*/
+int32 OS_GenericPwrite_Impl(const OS_object_token_t *token, const void *buffer, size_t nbytes,
+                            osal_offset_t offset);
+
 /*----------------------------------------------------------------
 
     Purpose: Close a file descriptor
@@ -114,6 +172,64 @@ int32 OS_GenericClose_Impl(const OS_object_token_t *token);
  ------------------------------------------------------------------*/
 int32 OS_FileOpen_Impl(const OS_object_token_t *token, const char *local_path, int32 flags, int32 access_mode);
 
+/*----------------------------------------------------------------
+
+    Purpose: Copies the remaining content of one open file to another,
+             from the current position of each, without passing the data
+             through a user space buffer.
+
+    Returns: OS_SUCCESS if the end of the source file was reached.
+             Otherwise an error code, in which case the caller should copy the
+             remaining data from the current file positions by other means.
+ ------------------------------------------------------------------*/
+int32 OS_FileCopy_Impl(const OS_object_token_t *src_token, const OS_object_token_t *dest_token);
+
+/*----------------------------------------------------------------
+
+    Purpose: Maps "map->length" bytes of the file, starting at "map->offset", into memory
+             with the access and advice given in "flags", and sets "map->addr" to the
+             address of the data at "map->offset".
+
+    Returns: OS_SUCCESS on success, or relevant error code
+ ------------------------------------------------------------------*/
+int32 OS_FileMap_Impl(const OS_object_token_t *token, OS_file_mapping_t *map, uint32 flags);
+
+/*----------------------------------------------------------------
+
+    Purpose: Removes a mapping created by OS_FileMap_Impl()
+             If "flags" includes OS_FILE_MAP_SYNC, changes are stored to the file first.
+
+    Returns: OS_SUCCESS on success, or relevant error code
+ ------------------------------------------------------------------*/
+int32 OS_FileUnmap_Impl(const OS_object_token_t *token, const OS_file_mapping_t *map, uint32 flags);
+
+/*----------------------------------------------------------------
+
+    Purpose: Starts an asynchronous file request in the background
+             The OS layer must keep the underlying file open until the request completes
+
+    Returns: OS_SUCCESS on success, or relevant error code
+ ------------------------------------------------------------------*/
+int32 OS_FileAsyncSubmit_Impl(const OS_object_token_t *token, OS_FileAsyncReq_t *req);
+
+/*----------------------------------------------------------------
+
+    Purpose: Waits until at least one asynchronous file request has completed,
+             and calls OS_FileAsyncComplete() for every completed request
+
+    Returns: Number of completed requests (positive), or relevant error code (negative)
+ ------------------------------------------------------------------*/
+int32 OS_FileAsyncWait_Impl(OS_time_t abs_timeout);
+
+/*----------------------------------------------------------------
+
+    Purpose: Hands a completed asynchronous file request back to the application
+             Sets the result, then gives the callback and the completion queue
+
+             This is called by OS_FileAsyncWait_Impl(), outside of any OS layer locks
+ ------------------------------------------------------------------*/
+void OS_FileAsyncComplete(OS_FileAsyncReq_t *req, int32 result);
+
 /*----------------------------------------------------------------
 
     Purpose: Takes a shell command in and writes the output of that command to the specified file
@@ -178,4 +294,14 @@ int32 OS_FileChmod_Impl(const char *local_path, uint32 access_mode);
  */
 int32 OS_FileIteratorClose(osal_id_t filedes, void *arg);
 
+/*----------------------------------------------------------------
+
+    Purpose: Validates a list of segments passed to a vectored read/write call
+             Every segment with a nonzero length must have a buffer, and the
+             total length must be a valid transfer size.
+
+    Returns: OS_SUCCESS if valid, or relevant error code
+ ------------------------------------------------------------------*/
+int32 OS_IoVecCheck(const OS_iovec_t *iov, uint32 iovcnt);
+
 #endif /* OS_SHARED_FILE_H */
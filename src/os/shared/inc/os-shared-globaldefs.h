@@ -90,11 +90,20 @@ CompileTimeAssert(sizeof(OS_VoidPtrValueWrapper_t) == sizeof(void *), VoidValueW
 #if defined(OSAL_CONFIG_DEBUG_PRINTF)
 extern void OS_DebugPrintf(uint32 Level, const char *Func, uint32 Line, const char *Format, ...);
 /* Debug printfs are compiled in, but also can be disabled by a run-time flag.
+ * Those above OS_DEBUG_MAX_LEVEL are constant false, so the compiler removes them.
  * Note that the ##__VA_ARGS__ syntax works on GCC but might need tweaks for other compilers... */
-#define OS_DEBUG_LEV(l, ...) OS_DebugPrintf(l, __func__, __LINE__, __VA_ARGS__);
-#define OS_DEBUG(...)        OS_DEBUG_LEV(1, __VA_ARGS__)
+#define OS_DEBUG_LEV(l, ...)                                    \
+    do                                                          \
+    {                                                           \
+        if ((l) <= OS_DEBUG_MAX_LEVEL)                          \
+        {                                                       \
+            OS_DebugPrintf(l, __func__, __LINE__, __VA_ARGS__); \
+        }                                                       \
+    } while (0)
+#define OS_DEBUG(...) OS_DEBUG_LEV(1, __VA_ARGS__)
 #else
 /* Debug printfs are not compiled in at all */
+#define OS_DEBUG_LEV(l, ...)
 #define OS_DEBUG(...)
 #endif
 
@@ -34,6 +34,11 @@
 /*
  * This supplies a non-abstract definition of "OS_common_record_t"
  */
+/*
+ * NOTE: the active_id and refcount fields may be accessed by tasks which
+ * do not hold the global table lock (see OS_ObjectIdRefcountTryAcquire).
+ * Only the idmap implementation should modify these fields directly.
+ */
 struct OS_common_record
 {
     const char *name_entry;
@@ -57,7 +62,8 @@ typedef enum
     OS_FILESYS_BASE      = OS_MODULE_BASE + OS_MAX_MODULES,
     OS_CONSOLE_BASE      = OS_FILESYS_BASE + OS_MAX_FILE_SYSTEMS,
     OS_CONDVAR_BASE      = OS_CONSOLE_BASE + OS_MAX_CONSOLES,
-    OS_MAX_TOTAL_RECORDS = OS_CONDVAR_BASE + OS_MAX_CONDVARS
+    OS_SELGROUP_BASE     = OS_CONDVAR_BASE + OS_MAX_CONDVARS,
+    OS_MAX_TOTAL_RECORDS = OS_SELGROUP_BASE + OS_MAX_SELECT_GROUPS
 } OS_ObjectIndex_t;
 
 /*
@@ -155,6 +161,7 @@ extern OS_common_record_t *const OS_global_module_table;
 extern OS_common_record_t *const OS_global_filesys_table;
 extern OS_common_record_t *const OS_global_console_table;
 extern OS_common_record_t *const OS_global_condvar_table;
+extern OS_common_record_t *const OS_global_selgroup_table;
 
 /****************************************************************************************
                                 ID MAPPING FUNCTIONS
@@ -532,5 +539,10 @@ bool  OS_ObjectFilterActive(void *ref, const OS_object_token_t *token, const OS_
 bool  OS_ObjectNameMatch(void *ref, const OS_object_token_t *token, const OS_common_record_t *obj);
 int32 OS_ObjectIdFindNextMatch(OS_ObjectMatchFunc_t MatchFunc, void *arg, OS_object_token_t *token);
 int32 OS_ObjectIdFindNextFree(OS_object_token_t *token);
+int32 OS_ObjectIdFindNameMatch(const char *name, OS_object_token_t *token);
+void  OS_ObjectIdNameIndexInsert(const OS_object_token_t *token, const char *name);
+void  OS_ObjectIdNameIndexRemove(const OS_object_token_t *token);
+bool  OS_ObjectIdRefcountTryAcquire(OS_object_token_t *token);
+void  OS_ObjectIdRefcountRelease(OS_object_token_t *token);
 
 #endif /* OS_SHARED_IDMAP_H */
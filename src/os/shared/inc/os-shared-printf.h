@@ -42,6 +42,8 @@
    ring buffer into the actual output device/descriptor
 
    The data is already formatted, this just writes the characters.
+   The data in the ring buffer is written to the device in a single
+   operation, where the device allows it.
  ------------------------------------------------------------------*/
 void OS_ConsoleOutput_Impl(const OS_object_token_t *token);
 
@@ -29,11 +29,38 @@
 #include "osapi-queue.h"
 #include "os-shared-globaldefs.h"
 
+/*
+ * States of a zero-copy buffer of a queue
+ */
+enum
+{
+    OS_QUEUE_SLOT_FREE,     /**< available for OS_QueueReserve() or OS_QueueBorrow() */
+    OS_QUEUE_SLOT_RESERVED, /**< held by the caller of OS_QueueReserve(), until OS_QueueCommit() */
+    OS_QUEUE_SLOT_BORROWED, /**< held by the caller of OS_QueueBorrow(), until OS_QueueRelease() */
+    OS_QUEUE_SLOT_BUSY      /**< a message is being copied in or out of the queue */
+};
+
+/*
+ * Buffer for a zero-copy operation on a queue whose storage cannot be
+ * accessed directly.  The message is copied between this and the queue.
+ */
+typedef struct
+{
+    uint8 state; /**< one of the OS_QUEUE_SLOT_* values */
+    union
+    {
+        uint8  data[OS_QUEUE_ZEROCOPY_SLOT_SIZE];
+        uint64 AlignU64;
+        void * AlignPtr;
+    } u;
+} OS_queue_slot_t;
+
 typedef struct
 {
     char              queue_name[OS_MAX_API_NAME];
     size_t            max_size;
     osal_blockcount_t max_depth;
+    OS_queue_slot_t   slots[OS_QUEUE_ZEROCOPY_SLOTS]; /**< state is protected by the global table lock */
 } OS_queue_internal_record_t;
 
 /*
@@ -94,7 +121,79 @@ int32 OS_QueuePut_Impl(const OS_object_token_t *token, const void *data, size_t
 
 /*----------------------------------------------------------------
 
-    Purpose: Obtain OS-specific information about a message queue
+    Purpose: Reserve storage for a message directly within the message queue
+
+    Returns: OS_SUCCESS on success, or relevant error code
+             OS_QUEUE_FULL must be returned if the queue is full.
+             OS_ERR_NOT_IMPLEMENTED must be returned if the queue storage cannot be
+             accessed directly, in which case the shared layer copies the message instead.
+ ------------------------------------------------------------------*/
+int32 OS_QueueReserve_Impl(const OS_object_token_t *token, void **buffer);
+
+/*----------------------------------------------------------------
+
+    Purpose: Make a message previously reserved via OS_QueueReserve_Impl available to readers
+
+    Returns: OS_SUCCESS on success, or relevant error code
+             OS_ERR_NOT_IMPLEMENTED must be returned if OS_QueueReserve_Impl is not implemented
+ ------------------------------------------------------------------*/
+int32 OS_QueueCommit_Impl(const OS_object_token_t *token, void *buffer, size_t size);
+
+/*----------------------------------------------------------------
+
+    Purpose: Receive a message on a message queue, without copying it out of the queue.
+             The calling task will be blocked if no message is immediately available
+
+    Returns: OS_SUCCESS on success, or relevant error code
+             OS_QUEUE_TIMEOUT must be returned if the timeout expired and no message was received
+             OS_QUEUE_EMPTY must be returned if the queue is empty when polled (OS_CHECK)
+             OS_ERR_NOT_IMPLEMENTED must be returned if the queue storage cannot be
+             accessed directly, in which case the shared layer copies the message instead.
+ ------------------------------------------------------------------*/
+int32 OS_QueueBorrow_Impl(const OS_object_token_t *token, const void **buffer, size_t *size_copied, int32 timeout);
+
+/*----------------------------------------------------------------
+
+    Purpose: Return the storage of a message previously received via OS_QueueBorrow_Impl
+
+    Returns: OS_SUCCESS on success, or relevant error code
+             OS_ERR_NOT_IMPLEMENTED must be returned if OS_QueueBorrow_Impl is not implemented
+ ------------------------------------------------------------------*/
+int32 OS_QueueRelease_Impl(const OS_object_token_t *token, const void *buffer);
+
+/*----------------------------------------------------------------
+
+    Purpose: Receive up to "count" messages on a message queue.
+             The calling task will be blocked if no message is immediately available,
+             but will not wait for any further messages once one has been received
+
+    Returns: OS_SUCCESS if at least one message was received, or relevant error code
+             OS_QUEUE_TIMEOUT must be returned if the timeout expired and no message was received
+             OS_QUEUE_EMPTY must be returned if the queue is empty when polled (OS_CHECK)
+             OS_ERR_NOT_IMPLEMENTED must be returned if messages can only be received one at a
+             time, in which case the shared layer calls OS_QueueGet_Impl for each message instead.
+ ------------------------------------------------------------------*/
+int32 OS_QueueGetMulti_Impl(const OS_object_token_t *token, void *const *data, size_t size, size_t *size_copied,
+                            uint32 count, uint32 *count_copied, int32 timeout);
+
+/*----------------------------------------------------------------
+
+    Purpose: Put up to "count" messages on a message queue, stopping when the queue is full
+
+    Returns: OS_SUCCESS if at least one message was put, or relevant error code
+             OS_QUEUE_FULL must be returned if the queue is full and no message was put.
+             OS_ERR_NOT_IMPLEMENTED must be returned if messages can only be sent one at a
+             time, in which case the shared layer calls OS_QueuePut_Impl for each message instead.
+ ------------------------------------------------------------------*/
+int32 OS_QueuePutMulti_Impl(const OS_object_token_t *token, const void *const *data, const size_t *size, uint32 count,
+                            uint32 *count_put, uint32 flags);
+
+/*----------------------------------------------------------------
+
+    Purpose: Obtain OS-specific information about a message queue, such as the
+             current depth and message statistics.  The name, creator and configured
+             limits are already filled in by the shared layer, and any statistics
+             which are not kept by the implementation should be left as zero.
 
     Returns: OS_SUCCESS on success, or relevant error code
  ------------------------------------------------------------------*/
@@ -74,4 +74,75 @@ int32 OS_SelectSingle_Impl(const OS_object_token_t *token, uint32 *SelectFlags,
  ------------------------------------------------------------------*/
 int32 OS_SelectMultiple_Impl(OS_FdSet *ReadSet, OS_FdSet *WriteSet, OS_time_t abs_timeout);
 
+/*
+ * Select group API
+ * Blocks until handles in a persistent set of handles are ready
+ */
+
+typedef struct
+{
+    char obj_name[OS_MAX_API_NAME];
+} OS_selgroup_internal_record_t;
+
+/*
+ * These record types have extra information with each entry.  These tables are used
+ * to share extra data between the common layer and the OS-specific implementation.
+ */
+extern OS_selgroup_internal_record_t OS_selgroup_table[OS_MAX_SELECT_GROUPS];
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_SelectGroupAPI_Init
+
+   Purpose: Initialize the OS-independent layer for select group objects
+
+   returns: OS_SUCCESS on success, or relevant error code
+---------------------------------------------------------------------------------------*/
+int32 OS_SelectGroupAPI_Init(void);
+
+/*----------------------------------------------------------------
+
+    Purpose: Prepare/allocate OS resources for a select group object
+
+    Returns: OS_SUCCESS on success, or relevant error code
+ ------------------------------------------------------------------*/
+int32 OS_SelectGroupCreate_Impl(const OS_object_token_t *token, uint32 options);
+
+/*----------------------------------------------------------------
+
+    Purpose: Free the OS resources associated with a select group object
+
+    Returns: OS_SUCCESS on success, or relevant error code
+ ------------------------------------------------------------------*/
+int32 OS_SelectGroupDelete_Impl(const OS_object_token_t *token);
+
+/*----------------------------------------------------------------
+
+    Purpose: Add a file handle to the select group, or change the
+             state(s) it is waited for if it is already in the group
+
+    Returns: OS_SUCCESS on success, or relevant error code
+             OS_ERR_OPERATION_NOT_SUPPORTED if the file handle does not support select
+ ------------------------------------------------------------------*/
+int32 OS_SelectGroupAdd_Impl(const OS_object_token_t *token, const OS_object_token_t *stream_token,
+                             uint32 StateFlags);
+
+/*----------------------------------------------------------------
+
+    Purpose: Remove a file handle from the select group
+
+    Returns: OS_SUCCESS on success, or relevant error code
+ ------------------------------------------------------------------*/
+int32 OS_SelectGroupRemove_Impl(const OS_object_token_t *token, const OS_object_token_t *stream_token);
+
+/*----------------------------------------------------------------
+
+    Purpose: Waits for any file handle in the select group to become ready
+             Up to MaxEvents ready handles are stored in Events
+
+    Returns: OS_SUCCESS if any handle is ready, or relevant error code
+             OS_ERROR_TIMEOUT if no handle became ready before abs_timeout
+ ------------------------------------------------------------------*/
+int32 OS_SelectGroupWait_Impl(const OS_object_token_t *token, OS_SelectGroupEvent_t *Events, uint32 MaxEvents,
+                              uint32 *EventCount, OS_time_t abs_timeout);
+
 #endif /* OS_SHARED_SELECT_H */
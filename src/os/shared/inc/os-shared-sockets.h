@@ -118,6 +118,40 @@ int32 OS_SocketRecvFrom_Impl(const OS_object_token_t *token, void *buffer, size_
 int32 OS_SocketSendTo_Impl(const OS_object_token_t *token, const void *buffer, size_t buflen,
                            const OS_SockAddr_t *RemoteAddr);
 
+/*----------------------------------------------------------------
+
+    Purpose: Sends a datagram from the specified socket (must be of the DATAGRAM type)
+             to the remote address specified by "RemoteAddr"
+             The datagram is gathered from the "iovcnt" segments in "iov"
+
+    Returns: OS_SUCCESS on success, or relevant error code
+ ------------------------------------------------------------------*/
+int32 OS_SocketSendToV_Impl(const OS_object_token_t *token, const OS_iovec_t *iov, uint32 iovcnt,
+                            const OS_SockAddr_t *RemoteAddr);
+
+/*----------------------------------------------------------------
+
+    Purpose: Receives up to "MsgCount" datagrams from the specified socket
+             (must be of the DATAGRAM type) into the buffers in "Msgs"
+             Will wait until "abs_timeout" for the first datagram, then
+             receives any others which are already queued without blocking.
+             "MsgCount" will not exceed OS_SOCKET_MSG_MAX.
+
+    Returns: Number of datagrams received, or relevant error code
+ ------------------------------------------------------------------*/
+int32 OS_SocketRecvFromMulti_Impl(const OS_object_token_t *token, OS_SockMsg_t *Msgs, uint32 MsgCount,
+                                  OS_time_t abs_timeout);
+
+/*----------------------------------------------------------------
+
+    Purpose: Sends up to "MsgCount" datagrams from the specified socket
+             (must be of the DATAGRAM type), each to its own remote address.
+             "MsgCount" will not exceed OS_SOCKET_MSG_MAX.
+
+    Returns: Number of datagrams sent, or relevant error code
+ ------------------------------------------------------------------*/
+int32 OS_SocketSendToMulti_Impl(const OS_object_token_t *token, OS_SockMsg_t *Msgs, uint32 MsgCount);
+
 /*----------------------------------------------------------------
 
     Purpose: Get OS-specific information about a socket
@@ -38,10 +38,9 @@ typedef struct
     char              timer_name[OS_MAX_API_NAME];
     uint32            flags;
     OS_object_token_t timebase_token;
-    osal_id_t         prev_cb;
-    osal_id_t         next_cb;
+    uint32            sched_pos;   /* position in the timebase schedule plus one, or 0 if not armed */
+    uint32            expire_time; /* timebase freerun_time at which the next callback is due */
     uint32            backlog_resets;
-    int32             wait_time;
     int32             interval_time;
     OS_ArgCallback_t  callback_ptr;
     void *            callback_arg;
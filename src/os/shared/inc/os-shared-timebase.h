@@ -34,10 +34,16 @@ typedef struct
     char           timebase_name[OS_MAX_API_NAME];
     OS_TimerSync_t external_sync;
     uint32         accuracy_usec;
-    osal_id_t      first_cb;
     uint32         freerun_time;
     uint32         nominal_start_time;
     uint32         nominal_interval_time;
+
+    /*
+     * Armed timer callbacks, as a binary min-heap of OS_timecb_table indices
+     * ordered by expiry time.  The entry at index 0 is always the next one due.
+     */
+    uint32       sched_count;
+    osal_index_t sched[OS_MAX_TIMERS];
 } OS_timebase_internal_record_t;
 
 /*
@@ -122,6 +128,40 @@ int32 OS_TimeBaseGetInfo_Impl(const OS_object_token_t *token, OS_timebase_prop_t
  ------------------------------------------------------------------*/
 void OS_TimeBase_CallbackThread(osal_id_t timebase_id);
 
+/*----------------------------------------------------------------
+
+    Purpose: Advance the time base by the given number of ticks and
+             give any application callbacks that are due.
+
+             This is normally invoked by OS_TimeBase_CallbackThread, but
+             may also be used by an implementation that services more
+             than one time base from the same thread.  The caller must
+             be registered as a time base handler (OS_TaskRegister_Impl)
+             and must not hold the time base lock.
+
+    Returns: OS_SUCCESS, or OS_ERR_INVALID_ID if the time base was deleted
+ ------------------------------------------------------------------*/
+int32 OS_TimeBase_ProcessTick(const OS_object_token_t *token, uint32 tick_time);
+
+/*----------------------------------------------------------------
+
+    Purpose: Arm the given timer callback on the time base schedule, or
+             move it to its new position if it is already armed.  The
+             expire_time of the callback must be set before calling this.
+
+             The time base lock must be held by the caller.
+ ------------------------------------------------------------------*/
+void OS_TimeBaseScheduleCallback(OS_timebase_internal_record_t *timebase, osal_index_t timecb_idx);
+
+/*----------------------------------------------------------------
+
+    Purpose: Remove the given timer callback from the time base schedule,
+             if it is currently armed.
+
+             The time base lock must be held by the caller.
+ ------------------------------------------------------------------*/
+void OS_TimeBaseCancelCallback(OS_timebase_internal_record_t *timebase, osal_index_t timecb_idx);
+
 /*----------------------------------------------------------------
 
     Purpose: Convert milliseconds to ticks
@@ -38,6 +38,84 @@
  */
 #include "os-shared-clock.h"
 
+/*
+ * The minimum interval over which the raw counter rate is measured,
+ * and the interval after which the measurement is kept.
+ */
+#define OS_CLOCK_MIN_CALIBRATION_NS    1000000
+#define OS_CLOCK_SETTLE_CALIBRATION_NS 1000000000
+
+/*
+ * The reference point for measuring the raw counter rate
+ */
+typedef struct
+{
+    uint64    BaseCount; /**< Raw counter value at initialization */
+    OS_time_t BaseTime;  /**< Monotonic time at initialization */
+    uint64    Freq;      /**< Counter frequency in Hz, or 0 if not yet determined */
+} OS_clock_rawcounter_t;
+
+static OS_clock_rawcounter_t OS_clock_rawcounter;
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_ClockAPI_Init(void)
+{
+    memset(&OS_clock_rawcounter, 0, sizeof(OS_clock_rawcounter));
+
+    OS_clock_rawcounter.Freq      = OS_GetRawCounterFreq_Impl();
+    OS_clock_rawcounter.BaseCount = OS_GetRawCounter_Impl();
+
+    return OS_GetMonotonicTime_Impl(&OS_clock_rawcounter.BaseTime);
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Measures the raw counter frequency against the monotonic clock
+ *
+ *    The measurement covers the whole time since initialization, so it
+ *    improves the longer OSAL has been running.  Once that is long enough,
+ *    the result is kept and the counter is not measured again.
+ *
+ *-----------------------------------------------------------------*/
+static int32 OS_Clock_CalibrateRawCounter(uint64 *freq)
+{
+    uint64    count;
+    int64     elapsed_ns;
+    OS_time_t now;
+    int32     return_code;
+
+    do
+    {
+        count       = OS_GetRawCounter_Impl();
+        return_code = OS_GetMonotonicTime_Impl(&now);
+        if (return_code != OS_SUCCESS)
+        {
+            return return_code;
+        }
+        elapsed_ns = OS_TimeGetTotalNanoseconds(OS_TimeSubtract(now, OS_clock_rawcounter.BaseTime));
+    } while (elapsed_ns < OS_CLOCK_MIN_CALIBRATION_NS);
+
+    /* floating point avoids overflow, however long the interval is */
+    *freq = (uint64)(((double)(count - OS_clock_rawcounter.BaseCount) * 1e9) / (double)elapsed_ns);
+    if (*freq == 0)
+    {
+        /* the counter is not running */
+        return OS_ERROR;
+    }
+
+    if (elapsed_ns >= OS_CLOCK_SETTLE_CALIBRATION_NS)
+    {
+        __atomic_store_n(&OS_clock_rawcounter.Freq, *freq, __ATOMIC_RELAXED);
+    }
+
+    return OS_SUCCESS;
+}
+
 /*----------------------------------------------------------------
  *
  *  Purpose: Implemented per public OSAL API
@@ -66,6 +144,75 @@ int32 OS_SetLocalTime(const OS_time_t *time_struct)
     return OS_SetLocalTime_Impl(time_struct);
 }
 
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_GetMonotonicTime(OS_time_t *time_struct)
+{
+    /* Check parameters */
+    OS_CHECK_POINTER(time_struct);
+
+    return OS_GetMonotonicTime_Impl(time_struct);
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_GetCoarseTime(OS_time_t *time_struct)
+{
+    /* Check parameters */
+    OS_CHECK_POINTER(time_struct);
+
+    return OS_GetCoarseTime_Impl(time_struct);
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+uint64 OS_GetRawCounter(void)
+{
+    return OS_GetRawCounter_Impl();
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_RawCounterToTime(uint64 count, OS_time_t *time_struct)
+{
+    uint64 freq;
+    int32  return_code;
+
+    /* Check parameters */
+    OS_CHECK_POINTER(time_struct);
+
+    freq = __atomic_load_n(&OS_clock_rawcounter.Freq, __ATOMIC_RELAXED);
+    if (freq == 0)
+    {
+        return_code = OS_Clock_CalibrateRawCounter(&freq);
+        if (return_code != OS_SUCCESS)
+        {
+            return return_code;
+        }
+    }
+
+    /* the remainder is less than freq, so scaling it to nanoseconds fits in 64 bits for any practical rate */
+    *time_struct = OS_TimeAssembleFromNanoseconds(count / freq, ((count % freq) * 1000000000) / freq);
+
+    return OS_SUCCESS;
+}
+
 /*----------------------------------------------------------------
  *
  *  Purpose: Implemented per public OSAL API
@@ -39,6 +39,7 @@
  * User defined include files
  */
 #include "os-shared-binsem.h"
+#include "os-shared-clock.h"
 #include "os-shared-common.h"
 #include "os-shared-condvar.h"
 #include "os-shared-countsem.h"
@@ -51,6 +52,7 @@
 #include "os-shared-network.h"
 #include "os-shared-printf.h"
 #include "os-shared-queue.h"
+#include "os-shared-select.h"
 #include "os-shared-sockets.h"
 #include "os-shared-task.h"
 #include "os-shared-timebase.h"
@@ -59,6 +61,7 @@
 OS_SharedGlobalVars_t OS_SharedGlobalVars = {
     .GlobalState     = 0,
     .PrintfEnabled   = false,
+    .PrintfDeferred  = false,
     .MicroSecPerTick = 0, /* invalid, _must_ be set by implementation init */
     .TicksPerSecond  = 0, /* invalid, _must_ be set by implementation init */
     .EventHandler    = NULL,
@@ -188,6 +191,9 @@ int32 OS_API_Init(void)
             case OS_OBJECT_TYPE_OS_CONDVAR:
                 return_code = OS_CondVarAPI_Init();
                 break;
+            case OS_OBJECT_TYPE_OS_SELGROUP:
+                return_code = OS_SelectGroupAPI_Init();
+                break;
             default:
                 break;
         }
@@ -208,6 +214,11 @@ int32 OS_API_Init(void)
         return_code = OS_SocketAPI_Init();
     }
 
+    if (return_code == OS_SUCCESS)
+    {
+        return_code = OS_ClockAPI_Init();
+    }
+
     /*
      * Confirm that somewhere during initialization,
      * the time variables got set to something valid
@@ -342,6 +353,9 @@ void OS_CleanUpObject(osal_id_t object_id, void *arg)
         case OS_OBJECT_TYPE_OS_CONDVAR:
             OS_CondVarDelete(object_id);
             break;
+        case OS_OBJECT_TYPE_OS_SELGROUP:
+            OS_SelectGroupDelete(object_id);
+            break;
         default:
             break;
     }
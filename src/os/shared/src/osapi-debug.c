@@ -24,6 +24,13 @@
  *      Contains the implementation for OS_DEBUG().
  *
  *      This is only compiled when OSAL_CONFIG_DEBUG_PRINTF is enabled.
+ *
+ *      Each statement is formatted as a single line, which is kept in a
+ *      trace ring and written to the console in one call.  Where the BSP
+ *      writes each call in one piece, no lock is taken, so that enabling
+ *      debug output does not serialize the tasks that produce it.  The trace
+ *      ring holds the most recent lines, so they can be found with a debugger
+ *      even if the console output is lost.
  */
 
 /****************************************************************************************
@@ -42,7 +49,9 @@
 #include "bsp-impl.h"
 
 #define OS_DEBUG_OUTPUT_STREAM stdout
-#define OS_DEBUG_MAX_LINE_LEN  132
+
+OS_debug_trace_line_t OS_debug_trace_ring[OS_DEBUG_TRACE_DEPTH];
+uint32                OS_debug_trace_count;
 
 /*----------------------------------------------------------------
  *
@@ -51,26 +60,67 @@
  *-----------------------------------------------------------------*/
 void OS_DebugPrintf(uint32 Level, const char *Func, uint32 Line, const char *Format, ...)
 {
-    char    buffer[OS_DEBUG_MAX_LINE_LEN];
-    va_list va;
+    OS_debug_trace_line_t *trace;
+    char                   buffer[OS_DEBUG_MAX_LINE_LEN];
+    uint32                 seq;
+    int                    len;
+    int                    body_len;
+    va_list                va;
 
     if (OS_SharedGlobalVars.DebugLevel >= Level)
     {
-        /*
-         * Lock the console so this appears coherently,
-         * not mixed with other chars from other tasks
-         */
-        OS_BSP_Lock_Impl();
-
-        snprintf(buffer, sizeof(buffer), "%s():%lu:", Func, (unsigned long)Line);
-        OS_BSP_ConsoleOutput_Impl(buffer, strlen(buffer));
+        /* The prefix and the message are formatted together, so they are written in one call */
+        len = snprintf(buffer, sizeof(buffer), "%s():%lu:", Func, (unsigned long)Line);
+        if (len < 0)
+        {
+            len = 0;
+        }
+        else if ((size_t)len >= sizeof(buffer))
+        {
+            len = sizeof(buffer) - 1;
+        }
 
         va_start(va, Format);
-        vsnprintf(buffer, sizeof(buffer), Format, va);
+        body_len = vsnprintf(&buffer[len], sizeof(buffer) - len, Format, va);
         va_end(va);
 
-        OS_BSP_ConsoleOutput_Impl(buffer, strlen(buffer));
+        if (body_len > 0)
+        {
+            len += body_len;
+            if ((size_t)len >= sizeof(buffer))
+            {
+                len = sizeof(buffer) - 1;
+            }
+        }
+
+        /* a formatting error may leave the buffer unterminated */
+        buffer[len] = 0;
+
+        /*
+         * Each caller claims its own line in the trace ring, so no lock is needed.
+         * A line is only reused once OS_DEBUG_TRACE_DEPTH newer lines have been claimed.
+         * If another writer still has the line, this one is left out of the trace.
+         */
+        seq   = __atomic_add_fetch(&OS_debug_trace_count, 1, __ATOMIC_RELAXED);
+        trace = &OS_debug_trace_ring[seq % OS_DEBUG_TRACE_DEPTH];
+        if (!__atomic_exchange_n(&trace->Busy, true, __ATOMIC_ACQUIRE))
+        {
+            __atomic_store_n(&trace->Sequence, 0, __ATOMIC_RELAXED);
+            memcpy(trace->Text, buffer, len + 1);
+            __atomic_store_n(&trace->Sequence, seq, __ATOMIC_RELEASE);
+            __atomic_store_n(&trace->Busy, false, __ATOMIC_RELEASE);
+        }
 
-        OS_BSP_Unlock_Impl();
+        /* Without atomic console writes, the lock keeps the line together */
+        if (OS_BSP_Global.ConsoleAtomicWrite)
+        {
+            OS_BSP_ConsoleOutput_Impl(buffer, len);
+        }
+        else
+        {
+            OS_BSP_Lock_Impl();
+            OS_BSP_ConsoleOutput_Impl(buffer, len);
+            OS_BSP_Unlock_Impl();
+        }
     }
 }
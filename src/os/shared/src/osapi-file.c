@@ -43,6 +43,7 @@
  * Other OSAL public APIs used by this module
  */
 #include "osapi-filesys.h"
+#include "osapi-queue.h"
 #include "osapi-sockets.h"
 
 /*
@@ -160,17 +161,33 @@ int32 OS_OpenCreate(osal_id_t *filedes, const char *path, int32 flags, int32 acc
  *-----------------------------------------------------------------*/
 int32 OS_close(osal_id_t filedes)
 {
-    OS_object_token_t token;
-    int32             return_code;
+    OS_object_token_t            token;
+    OS_stream_internal_record_t *stream;
+    int32                        return_code;
 
     /* Make sure the file descriptor is legit before using it */
     return_code = OS_ObjectIdGetById(OS_LOCK_MODE_EXCLUSIVE, LOCAL_OBJID_TYPE, filedes, &token);
     if (return_code == OS_SUCCESS)
     {
-        return_code = OS_GenericClose_Impl(&token);
+        stream = OS_OBJECT_TABLE_GET(OS_stream_table, token);
+
+        /*
+         * The user may still be accessing the data of an active mapping, so
+         * all mappings must be removed with OS_FileUnmap() before the handle
+         * can be closed.
+         */
+        if (stream->map_count > 0)
+        {
+            OS_ObjectIdRelease(&token);
+            return_code = OS_ERR_OBJECT_IN_USE;
+        }
+        else
+        {
+            return_code = OS_GenericClose_Impl(&token);
 
-        /* Complete the operation via the common routine */
-        return_code = OS_ObjectIdFinalizeDelete(return_code, &token);
+            /* Complete the operation via the common routine */
+            return_code = OS_ObjectIdFinalizeDelete(return_code, &token);
+        }
     }
 
     return return_code;
@@ -271,6 +288,340 @@ int32 OS_write(osal_id_t filedes, const void *buffer, size_t nbytes)
     return OS_TimedWrite(filedes, buffer, nbytes, OS_PEND);
 }
 
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_IoVecCheck(const OS_iovec_t *iov, uint32 iovcnt)
+{
+    uint32 i;
+    size_t total;
+
+    OS_CHECK_POINTER(iov);
+    ARGCHECK(iovcnt > 0 && iovcnt <= OS_IOV_MAX, OS_ERR_INVALID_SIZE);
+
+    total = 0;
+    for (i = 0; i < iovcnt; ++i)
+    {
+        if (iov[i].Length > 0)
+        {
+            OS_CHECK_POINTER(iov[i].Buffer);
+        }
+
+        /* checked against the remaining space first, so the sum cannot overflow */
+        ARGCHECK(iov[i].Length < (UINT32_MAX / 2) - total, OS_ERR_INVALID_SIZE);
+        total += iov[i].Length;
+    }
+
+    OS_CHECK_SIZE(total);
+
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_TimedReadvAbs(osal_id_t filedes, const OS_iovec_t *iov, uint32 iovcnt, OS_time_t abstime)
+{
+    OS_object_token_t token;
+    int32             return_code;
+
+    /* Check Parameters */
+    return_code = OS_IoVecCheck(iov, iovcnt);
+    if (return_code != OS_SUCCESS)
+    {
+        return return_code;
+    }
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, LOCAL_OBJID_TYPE, filedes, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        return_code = OS_GenericReadv_Impl(&token, iov, iovcnt, abstime);
+
+        OS_ObjectIdRelease(&token);
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_TimedReadv(osal_id_t filedes, const OS_iovec_t *iov, uint32 iovcnt, int32 timeout)
+{
+    return OS_TimedReadvAbs(filedes, iov, iovcnt, OS_TimeFromRelativeMilliseconds(timeout));
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_readv(osal_id_t filedes, const OS_iovec_t *iov, uint32 iovcnt)
+{
+    return OS_TimedReadv(filedes, iov, iovcnt, OS_PEND);
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_TimedWritevAbs(osal_id_t filedes, const OS_iovec_t *iov, uint32 iovcnt, OS_time_t abstime)
+{
+    OS_object_token_t token;
+    int32             return_code;
+
+    /* Check Parameters */
+    return_code = OS_IoVecCheck(iov, iovcnt);
+    if (return_code != OS_SUCCESS)
+    {
+        return return_code;
+    }
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, LOCAL_OBJID_TYPE, filedes, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        return_code = OS_GenericWritev_Impl(&token, iov, iovcnt, abstime);
+
+        OS_ObjectIdRelease(&token);
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_TimedWritev(osal_id_t filedes, const OS_iovec_t *iov, uint32 iovcnt, int32 timeout)
+{
+    return OS_TimedWritevAbs(filedes, iov, iovcnt, OS_TimeFromRelativeMilliseconds(timeout));
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_writev(osal_id_t filedes, const OS_iovec_t *iov, uint32 iovcnt)
+{
+    return OS_TimedWritev(filedes, iov, iovcnt, OS_PEND);
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_pread(osal_id_t filedes, void *buffer, size_t nbytes, osal_offset_t offset)
+{
+    OS_object_token_t token;
+    int32             return_code;
+
+    /* Check Parameters */
+    OS_CHECK_POINTER(buffer);
+    OS_CHECK_SIZE(nbytes);
+    ARGCHECK(offset >= 0, OS_ERR_INVALID_ARGUMENT);
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, LOCAL_OBJID_TYPE, filedes, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        return_code = OS_GenericPread_Impl(&token, buffer, nbytes, offset);
+
+        OS_ObjectIdRelease(&token);
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_pwrite(osal_id_t filedes, const void *buffer, size_t nbytes, osal_offset_t offset)
+{
+    OS_object_token_t token;
+    int32             return_code;
+
+    /* Check Parameters */
+    OS_CHECK_POINTER(buffer);
+    OS_CHECK_SIZE(nbytes);
+    ARGCHECK(offset >= 0, OS_ERR_INVALID_ARGUMENT);
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, LOCAL_OBJID_TYPE, filedes, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        return_code = OS_GenericPwrite_Impl(&token, buffer, nbytes, offset);
+
+        OS_ObjectIdRelease(&token);
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_FileMap(osal_id_t filedes, osal_offset_t offset, size_t length, uint32 flags, void **addr)
+{
+    OS_object_token_t            token;
+    OS_stream_internal_record_t *stream;
+    OS_file_mapping_t *          map;
+    OS_file_mapping_t            local_map;
+    uint32                       i;
+    int32                        return_code;
+
+    /* Check Parameters */
+    OS_CHECK_POINTER(addr);
+    ARGCHECK(length > 0, OS_ERR_INVALID_SIZE);
+    ARGCHECK(offset >= 0, OS_ERR_INVALID_ARGUMENT);
+    ARGCHECK((flags & (OS_FILE_MAP_READ | OS_FILE_MAP_WRITE)) != 0, OS_ERR_INVALID_ARGUMENT);
+    ARGCHECK((flags & (OS_FILE_MAP_SEQUENTIAL | OS_FILE_MAP_RANDOM)) !=
+                 (OS_FILE_MAP_SEQUENTIAL | OS_FILE_MAP_RANDOM),
+             OS_ERR_INVALID_ARGUMENT);
+
+    /*
+     * The refcount prevents the handle from being closed, while mapping the
+     * file is done without the global lock, as it may take some time.  The
+     * global lock is only held while the mappings table is modified.
+     */
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, LOCAL_OBJID_TYPE, filedes, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        stream = OS_OBJECT_TABLE_GET(OS_stream_table, token);
+
+        /* An entry with a nonzero length is in use, so setting it reserves the entry */
+        OS_Lock_Global(&token);
+        map = NULL;
+        for (i = 0; i < OS_FILE_MAX_MAPPINGS; ++i)
+        {
+            if (stream->mappings[i].length == 0)
+            {
+                map         = &stream->mappings[i];
+                map->addr   = NULL;
+                map->offset = offset;
+                map->length = length;
+                break;
+            }
+        }
+        OS_Unlock_Global(&token);
+
+        if (map == NULL)
+        {
+            return_code = OS_ERR_NO_FREE_IDS;
+        }
+        else
+        {
+            local_map = *map;
+
+            return_code = OS_FileMap_Impl(&token, &local_map, flags);
+
+            OS_Lock_Global(&token);
+            if (return_code == OS_SUCCESS)
+            {
+                map->addr = local_map.addr;
+                ++stream->map_count;
+                *addr = local_map.addr;
+            }
+            else
+            {
+                map->length = 0;
+            }
+            OS_Unlock_Global(&token);
+        }
+
+        OS_ObjectIdRelease(&token);
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_FileUnmap(osal_id_t filedes, void *addr, uint32 flags)
+{
+    OS_object_token_t            token;
+    OS_stream_internal_record_t *stream;
+    OS_file_mapping_t *          map;
+    OS_file_mapping_t            local_map;
+    uint32                       i;
+    int32                        return_code;
+
+    /* Check Parameters */
+    OS_CHECK_POINTER(addr);
+
+    /* As in OS_FileMap(), the global lock is only held while the mappings table is modified */
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, LOCAL_OBJID_TYPE, filedes, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        stream = OS_OBJECT_TABLE_GET(OS_stream_table, token);
+
+        /* Clearing the address keeps the entry reserved, but stops it from being unmapped twice */
+        OS_Lock_Global(&token);
+        map = NULL;
+        for (i = 0; i < OS_FILE_MAX_MAPPINGS; ++i)
+        {
+            if (stream->mappings[i].addr == addr)
+            {
+                map       = &stream->mappings[i];
+                local_map = *map;
+                map->addr = NULL;
+                break;
+            }
+        }
+        OS_Unlock_Global(&token);
+
+        if (map == NULL)
+        {
+            return_code = OS_ERR_INVALID_ARGUMENT;
+        }
+        else
+        {
+            return_code = OS_FileUnmap_Impl(&token, &local_map, flags);
+
+            OS_Lock_Global(&token);
+            if (return_code == OS_SUCCESS)
+            {
+                map->length = 0;
+                --stream->map_count;
+            }
+            else
+            {
+                map->addr = local_map.addr;
+            }
+            OS_Unlock_Global(&token);
+        }
+
+        OS_ObjectIdRelease(&token);
+    }
+
+    return return_code;
+}
+
 /*----------------------------------------------------------------
  *
  *  Purpose: Implemented per public OSAL API
@@ -338,6 +689,30 @@ int32 OS_lseek(osal_id_t filedes, int32 offset, uint32 whence)
     return return_code;
 }
 
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_lseek64(osal_id_t filedes, osal_offset_t offset, uint32 whence, osal_offset_t *position)
+{
+    OS_object_token_t token;
+    int32             return_code;
+
+    /* Check Parameters */
+    OS_CHECK_POINTER(position);
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, LOCAL_OBJID_TYPE, filedes, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        return_code = OS_GenericSeek64_Impl(&token, offset, whence, position);
+        OS_ObjectIdRelease(&token);
+    }
+
+    return return_code;
+}
+
 /*----------------------------------------------------------------
  *
  *  Purpose: Implemented per public OSAL API
@@ -412,13 +787,15 @@ int32 OS_rename(const char *old_filename, const char *new_filename)
  *-----------------------------------------------------------------*/
 int32 OS_cp(const char *src, const char *dest)
 {
-    int32     return_code;
-    int32     rd_size;
-    int32     wr_size;
-    int32     wr_total;
-    osal_id_t file1;
-    osal_id_t file2;
-    uint8     copyblock[OS_CP_BLOCK_SIZE];
+    int32             return_code;
+    int32             rd_size;
+    int32             wr_size;
+    int32             wr_total;
+    osal_id_t         file1;
+    osal_id_t         file2;
+    OS_object_token_t src_token;
+    OS_object_token_t dest_token;
+    uint8             copyblock[OS_CP_BLOCK_SIZE];
 
     /* Check Parameters */
     OS_CHECK_POINTER(src);
@@ -432,29 +809,64 @@ int32 OS_cp(const char *src, const char *dest)
         return_code = OS_OpenCreate(&file2, dest, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_WRITE_ONLY);
     }
 
-    while (return_code == OS_SUCCESS)
+    /*
+     * Both handles are resolved once, and held for the whole copy, rather
+     * than on every read and write of the copy loop.
+     */
+    if (return_code == OS_SUCCESS)
     {
-        rd_size = OS_read(file1, copyblock, sizeof(copyblock));
-        if (rd_size < 0)
-        {
-            return_code = rd_size;
-            break;
-        }
-        if (rd_size == 0)
+        return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, LOCAL_OBJID_TYPE, file1, &src_token);
+        if (return_code == OS_SUCCESS)
         {
-            break;
+            return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, LOCAL_OBJID_TYPE, file2, &dest_token);
+            if (return_code != OS_SUCCESS)
+            {
+                OS_ObjectIdRelease(&src_token);
+            }
         }
-        wr_total = 0;
-        while (wr_total < rd_size)
+    }
+
+    if (return_code == OS_SUCCESS)
+    {
+        /*
+         * First let the OS copy the data directly, if it is able to.  If this does
+         * not finish the copy, the rest is copied from the current file positions
+         * via the buffer here.
+         */
+        if (OS_FileCopy_Impl(&src_token, &dest_token) != OS_SUCCESS)
         {
-            wr_size = OS_write(file2, &copyblock[wr_total], rd_size - wr_total);
-            if (wr_size < 0)
+            while (true)
             {
-                return_code = wr_size;
-                break;
+                rd_size = OS_GenericRead_Impl(&src_token, copyblock, sizeof(copyblock), OS_TIME_MAX);
+                if (rd_size < 0)
+                {
+                    return_code = rd_size;
+                    break;
+                }
+                if (rd_size == 0)
+                {
+                    break;
+                }
+                wr_total = 0;
+                while (wr_total < rd_size)
+                {
+                    wr_size = OS_GenericWrite_Impl(&dest_token, &copyblock[wr_total], rd_size - wr_total, OS_TIME_MAX);
+                    if (wr_size < 0)
+                    {
+                        return_code = wr_size;
+                        break;
+                    }
+                    wr_total += wr_size;
+                }
+                if (return_code != OS_SUCCESS)
+                {
+                    break;
+                }
             }
-            wr_total += wr_size;
         }
+
+        OS_ObjectIdRelease(&dest_token);
+        OS_ObjectIdRelease(&src_token);
     }
 
     if (OS_ObjectIdDefined(file1))
@@ -634,3 +1046,100 @@ int32 OS_CloseAllFiles(void)
 
     return return_code;
 }
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_FileAsyncSubmit(OS_FileAsyncReq_t *Req)
+{
+    OS_object_token_t token;
+    int32             return_code;
+
+    /* Check Parameters */
+    OS_CHECK_POINTER(Req);
+    ARGCHECK(Req->Offset >= 0, OS_ERR_INVALID_ARGUMENT);
+
+    switch (Req->Operation)
+    {
+        case OS_FILE_ASYNC_READ:
+        case OS_FILE_ASYNC_WRITE:
+            OS_CHECK_POINTER(Req->Buffer);
+            OS_CHECK_SIZE(Req->Length);
+            break;
+        case OS_FILE_ASYNC_SYNC:
+            break;
+        default:
+            return OS_ERR_INVALID_ARGUMENT;
+    }
+
+    /*
+     * The handle is only held while starting the request - the implementation
+     * keeps its own reference to the underlying file until the request completes,
+     * so closing the handle does not need to wait for it.
+     */
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, LOCAL_OBJID_TYPE, Req->FileId, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        return_code = OS_FileAsyncSubmit_Impl(&token, Req);
+
+        OS_ObjectIdRelease(&token);
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_FileAsyncWaitAbs(OS_time_t abstime)
+{
+    return OS_FileAsyncWait_Impl(abstime);
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_FileAsyncWait(int32 msecs)
+{
+    return OS_FileAsyncWaitAbs(OS_TimeFromRelativeMilliseconds(msecs));
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void OS_FileAsyncComplete(OS_FileAsyncReq_t *Req, int32 result)
+{
+    osal_id_t queue_id;
+    int32     return_code;
+
+    /* the callback may reuse the request, so get the queue first */
+    queue_id    = Req->CompletionQueue;
+    Req->Result = result;
+
+    if (Req->Callback != NULL)
+    {
+        Req->Callback(Req);
+    }
+
+    if (OS_ObjectIdDefined(queue_id))
+    {
+        /* the queue carries the request pointer, not a copy of the request */
+        return_code = OS_QueuePut(queue_id, &Req, sizeof(Req), 0);
+        if (return_code != OS_SUCCESS)
+        {
+            OS_DEBUG("Async file completion not queued: %d\n", (int)return_code);
+        }
+    }
+}
@@ -57,6 +57,21 @@
 #define OS_LOCK_KEY_FIXED_VALUE 0x4D000000
 #define OS_LOCK_KEY_INVALID     ((osal_key_t) {0})
 
+/*
+ * If the compiler provides atomic builtins, then REFCOUNT locks can be
+ * obtained and released without taking the global table lock at all.
+ *
+ * In this mode the "active_id" and "refcount" fields of a record may be
+ * read and modified by tasks which do not hold the table lock, so every
+ * access which can race with those tasks goes through the helpers below.
+ *
+ * Without atomic builtins, all accesses are protected by the table lock
+ * as they always have been, and the helpers reduce to plain accesses.
+ */
+#ifdef __ATOMIC_SEQ_CST
+#define OS_OBJECT_ID_LOCKFREE_REFCOUNT
+#endif
+
 /*
  * A structure containing the user-specified
  * details of a "foreach" iteration request
@@ -89,6 +104,38 @@ typedef struct
 
 OS_objtype_state_t OS_objtype_state[OS_OBJECT_TYPE_USER];
 
+/*
+ * Bitmap of records in OS_common_table which are in use, one bit per record.
+ *
+ * This allows OS_ObjectIdFindNextFree() to skip directly to the next free record
+ * rather than checking each record in turn.  It is only used as a hint - records
+ * are always checked before being used, and the bitmap is rebuilt from the records
+ * before reporting that no IDs are free.
+ *
+ * One word of the bitmap may cover records of more than one object type, and
+ * each type is protected by its own lock, so the bits are changed atomically
+ * where the compiler supports it.  Otherwise a bit may be lost, which is
+ * tolerated as the bitmap is only a hint.
+ */
+static uint32 OS_common_table_inuse[(OS_MAX_TOTAL_RECORDS + 31) / 32];
+
+#ifdef OSAL_CONFIG_NAME_INDEX
+/*
+ * Hash index of object names, to avoid a linear scan of the table on every
+ * name lookup or duplicate name check.
+ *
+ * This is an open-addressed (linear probing) hash table.  Each object type uses a
+ * region twice the size of its own record table, at twice its base offset, so the
+ * load factor never exceeds 50% and a probe always ends at an empty slot.  Each slot
+ * holds the local record index plus 1, or 0 if the slot is empty.
+ *
+ * The hash that was used to insert each record is kept in OS_name_index_hash, so
+ * the entry can be found again on removal regardless of the current name_entry.
+ */
+static uint32 OS_name_index_slots[2 * OS_MAX_TOTAL_RECORDS];
+static uint32 OS_name_index_hash[OS_MAX_TOTAL_RECORDS];
+#endif
+
 OS_common_record_t *const OS_global_task_table      = &OS_common_table[OS_TASK_BASE];
 OS_common_record_t *const OS_global_queue_table     = &OS_common_table[OS_QUEUE_BASE];
 OS_common_record_t *const OS_global_bin_sem_table   = &OS_common_table[OS_BINSEM_BASE];
@@ -102,6 +149,153 @@ OS_common_record_t *const OS_global_module_table    = &OS_common_table[OS_MODULE
 OS_common_record_t *const OS_global_filesys_table   = &OS_common_table[OS_FILESYS_BASE];
 OS_common_record_t *const OS_global_console_table   = &OS_common_table[OS_CONSOLE_BASE];
 OS_common_record_t *const OS_global_condvar_table   = &OS_common_table[OS_CONDVAR_BASE];
+OS_common_record_t *const OS_global_selgroup_table  = &OS_common_table[OS_SELGROUP_BASE];
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Reads the active_id of a record which may be concurrently
+ *           modified by another task.
+ *
+ *-----------------------------------------------------------------*/
+static inline osal_id_t OS_ObjectIdGetActive(OS_common_record_t *obj)
+{
+#ifdef OS_OBJECT_ID_LOCKFREE_REFCOUNT
+    osal_id_t id;
+
+    __atomic_load(&obj->active_id, &id, __ATOMIC_SEQ_CST);
+
+    return id;
+#else
+    return obj->active_id;
+#endif
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Writes the active_id of a record.  The global table
+ *           lock must be held by the caller.
+ *
+ *-----------------------------------------------------------------*/
+static inline void OS_ObjectIdSetActive(OS_common_record_t *obj, osal_id_t id)
+{
+#ifdef OS_OBJECT_ID_LOCKFREE_REFCOUNT
+    __atomic_store(&obj->active_id, &id, __ATOMIC_SEQ_CST);
+#else
+    obj->active_id = id;
+#endif
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Reads the current refcount of a record
+ *
+ *-----------------------------------------------------------------*/
+static inline uint16 OS_ObjectIdGetRefcount(OS_common_record_t *obj)
+{
+#ifdef OS_OBJECT_ID_LOCKFREE_REFCOUNT
+    return __atomic_load_n(&obj->refcount, __ATOMIC_SEQ_CST);
+#else
+    return obj->refcount;
+#endif
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Increments the refcount of a record
+ *
+ *-----------------------------------------------------------------*/
+static inline void OS_ObjectIdIncrRefcount(OS_common_record_t *obj)
+{
+#ifdef OS_OBJECT_ID_LOCKFREE_REFCOUNT
+    __atomic_add_fetch(&obj->refcount, 1, __ATOMIC_SEQ_CST);
+#else
+    ++obj->refcount;
+#endif
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Decrements the refcount of a record, if nonzero
+ *
+ *-----------------------------------------------------------------*/
+static inline void OS_ObjectIdDecrRefcount(OS_common_record_t *obj)
+{
+#ifdef OS_OBJECT_ID_LOCKFREE_REFCOUNT
+    uint16 count;
+
+    /* the check and the decrement must be a single step, as other tasks may release concurrently */
+    count = __atomic_load_n(&obj->refcount, __ATOMIC_SEQ_CST);
+    while (count > 0 &&
+           !__atomic_compare_exchange_n(&obj->refcount, &count, count - 1, true, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST))
+    {
+        /* count was reloaded, try again */
+    }
+#else
+    if (obj->refcount > 0)
+    {
+        --obj->refcount;
+    }
+#endif
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Marks a record in OS_common_table as in use
+ *
+ *-----------------------------------------------------------------*/
+static inline void OS_ObjectIdMarkInUse(uint32 idx)
+{
+#ifdef OS_OBJECT_ID_LOCKFREE_REFCOUNT
+    __atomic_fetch_or(&OS_common_table_inuse[idx / 32], 1U << (idx % 32), __ATOMIC_RELAXED);
+#else
+    OS_common_table_inuse[idx / 32] |= (1U << (idx % 32));
+#endif
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Marks a record in OS_common_table as free
+ *
+ *-----------------------------------------------------------------*/
+static inline void OS_ObjectIdMarkFree(uint32 idx)
+{
+#ifdef OS_OBJECT_ID_LOCKFREE_REFCOUNT
+    __atomic_fetch_and(&OS_common_table_inuse[idx / 32], ~(1U << (idx % 32)), __ATOMIC_RELAXED);
+#else
+    OS_common_table_inuse[idx / 32] &= ~(1U << (idx % 32));
+#endif
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Gets the position of the lowest clear bit in a word,
+ *           which must not be all ones.
+ *
+ *-----------------------------------------------------------------*/
+static inline uint32 OS_ObjectIdFirstClearBit(uint32 word)
+{
+#ifdef __GNUC__
+    return __builtin_ctz(~word);
+#else
+    uint32 bit = 0;
+
+    while ((word & 1) != 0)
+    {
+        word >>= 1;
+        ++bit;
+    }
+
+    return bit;
+#endif
+}
 
 /*
  *********************************************************************************
@@ -119,6 +313,11 @@ int32 OS_ObjectIdInit(void)
 {
     memset(OS_common_table, 0, sizeof(OS_common_table));
     memset(OS_objtype_state, 0, sizeof(OS_objtype_state));
+    memset(OS_common_table_inuse, 0, sizeof(OS_common_table_inuse));
+#ifdef OSAL_CONFIG_NAME_INDEX
+    memset(OS_name_index_slots, 0, sizeof(OS_name_index_slots));
+    memset(OS_name_index_hash, 0, sizeof(OS_name_index_hash));
+#endif
     return OS_SUCCESS;
 }
 
@@ -157,6 +356,8 @@ uint32 OS_GetMaxForObjectType(osal_objtype_t idtype)
             return OS_MAX_CONSOLES;
         case OS_OBJECT_TYPE_OS_CONDVAR:
             return OS_MAX_CONDVARS;
+        case OS_OBJECT_TYPE_OS_SELGROUP:
+            return OS_MAX_SELECT_GROUPS;
         default:
             return 0;
     }
@@ -197,6 +398,8 @@ uint32 OS_GetBaseForObjectType(osal_objtype_t idtype)
             return OS_CONSOLE_BASE;
         case OS_OBJECT_TYPE_OS_CONDVAR:
             return OS_CONDVAR_BASE;
+        case OS_OBJECT_TYPE_OS_SELGROUP:
+            return OS_SELGROUP_BASE;
         default:
             return 0;
     }
@@ -415,7 +618,7 @@ int32 OS_ObjectIdConvertToken(OS_object_token_t *token)
     {
         /* Validate the integrity of the ID.  As the "active_id" is a single
          * integer, we can do this check regardless of whether global is locked or not. */
-        if (OS_ObjectIdEqual(obj->active_id, expected_id))
+        if (OS_ObjectIdEqual(OS_ObjectIdGetActive(obj), expected_id))
         {
             /*
              * Got an ID match...
@@ -428,15 +631,19 @@ int32 OS_ObjectIdConvertToken(OS_object_token_t *token)
                  */
                 if (!OS_ObjectIdEqual(expected_id, OS_OBJECT_ID_RESERVED))
                 {
-                    expected_id    = OS_OBJECT_ID_RESERVED;
-                    obj->active_id = expected_id;
+                    expected_id = OS_OBJECT_ID_RESERVED;
+                    OS_ObjectIdSetActive(obj, expected_id);
                 }
 
                 /*
                  * Also confirm that reference count is zero
                  * If not zero, will need to wait for other tasks to release.
+                 *
+                 * Note this check must come after setting the ID to RESERVED above,
+                 * so that any task which concurrently obtains a refcount without
+                 * the global lock will see the RESERVED ID and back out again.
                  */
-                if (obj->refcount == 0)
+                if (OS_ObjectIdGetRefcount(obj) == 0)
                 {
                     return_code = OS_SUCCESS;
                     break;
@@ -451,7 +658,8 @@ int32 OS_ObjectIdConvertToken(OS_object_token_t *token)
                 break;
             }
         }
-        else if (token->lock_mode == OS_LOCK_MODE_NONE || !OS_ObjectIdEqual(obj->active_id, OS_OBJECT_ID_RESERVED))
+        else if (token->lock_mode == OS_LOCK_MODE_NONE ||
+                 !OS_ObjectIdEqual(OS_ObjectIdGetActive(obj), OS_OBJECT_ID_RESERVED))
         {
             /* Not an ID match and not RESERVED - fail out */
             return_code = OS_ERR_INVALID_ID;
@@ -491,7 +699,7 @@ int32 OS_ObjectIdConvertToken(OS_object_token_t *token)
         {
             /* always increment the refcount, which means a task is actively
              * using or modifying this record. */
-            ++obj->refcount;
+            OS_ObjectIdIncrRefcount(obj);
 
             /*
              * On a successful operation, the global is unlocked if it is
@@ -516,13 +724,82 @@ int32 OS_ObjectIdConvertToken(OS_object_token_t *token)
              * it back to the original value which is in the token.
              * (note it had to match initially before overwrite)
              */
-            obj->active_id = OS_ObjectIdFromToken(token);
+            OS_ObjectIdSetActive(obj, OS_ObjectIdFromToken(token));
         }
     }
 
     return return_code;
 }
 
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *
+ *   Attempt to obtain a REFCOUNT style lock on the record referenced
+ *   by the token, without acquiring the global table lock.
+ *
+ *   The refcount is incremented first, and then the active_id is checked.
+ *   This succeeds only if the record is in a steady state, that is the
+ *   active_id still matches the token.  An EXCLUSIVE request sets the ID to
+ *   RESERVED _before_ checking for a zero refcount, so either it will see the
+ *   increment here, or this will see the RESERVED ID and back out again.
+ *
+ *   If this returns false, then no refcount is held, and the caller should
+ *   use the normal (locked) path which handles all other states.
+ *
+ *   returns: true if the refcount was obtained, false otherwise
+ *
+ *-----------------------------------------------------------------*/
+bool OS_ObjectIdRefcountTryAcquire(OS_object_token_t *token)
+{
+#ifdef OS_OBJECT_ID_LOCKFREE_REFCOUNT
+    OS_common_record_t *obj;
+
+    obj = OS_ObjectIdGlobalFromToken(token);
+
+    OS_ObjectIdIncrRefcount(obj);
+
+    if (!OS_ObjectIdEqual(OS_ObjectIdGetActive(obj), token->obj_id))
+    {
+        /* not in a steady state, must back out the refcount */
+        OS_ObjectIdRefcountRelease(token);
+        return false;
+    }
+
+    return true;
+#else
+    return false;
+#endif
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *
+ *   Release a REFCOUNT style lock on the record referenced by the token,
+ *   without acquiring the global table lock.
+ *
+ *   The global table lock is only taken if the record is no longer in a
+ *   steady state (i.e. an EXCLUSIVE request has set the ID to RESERVED),
+ *   as that task may be waiting for the refcount to reach zero and it needs
+ *   to be notified of the change.
+ *
+ *-----------------------------------------------------------------*/
+void OS_ObjectIdRefcountRelease(OS_object_token_t *token)
+{
+    OS_common_record_t *obj;
+
+    obj = OS_ObjectIdGlobalFromToken(token);
+
+    OS_ObjectIdDecrRefcount(obj);
+
+    if (!OS_ObjectIdEqual(OS_ObjectIdGetActive(obj), token->obj_id))
+    {
+        OS_Lock_Global(token);
+        OS_Unlock_Global(token);
+    }
+}
+
 /*----------------------------------------------------------------
  *
  *  Purpose: Local helper routine, not part of OSAL API.
@@ -569,6 +846,122 @@ int32 OS_ObjectIdFindNextMatch(OS_ObjectMatchFunc_t MatchFunc, void *arg, OS_obj
     return return_code;
 }
 
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Finds the first record of OS_common_table at or after "idx"
+ *           which is not marked as in use.
+ *
+ *  returns: index of the record, which may be beyond the end of the
+ *           range of interest if all records in that range are in use.
+ *
+ *-----------------------------------------------------------------*/
+static uint32 OS_ObjectIdSearchInUseBitmap(uint32 idx, uint32 last)
+{
+    uint32 word;
+
+    while (idx < last)
+    {
+#ifdef OS_OBJECT_ID_LOCKFREE_REFCOUNT
+        word = __atomic_load_n(&OS_common_table_inuse[idx / 32], __ATOMIC_RELAXED);
+#else
+        word = OS_common_table_inuse[idx / 32];
+#endif
+
+        /* bits below idx have already been checked, so treat those as in use */
+        word |= (1U << (idx % 32)) - 1;
+        if (word != 0xFFFFFFFF)
+        {
+            idx = (idx & ~31U) + OS_ObjectIdFirstClearBit(word);
+            break;
+        }
+
+        idx = (idx & ~31U) + 32;
+    }
+
+    return idx;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Finds the first free record in the range [first, last)
+ *           of the object type with records starting at base_id.
+ *
+ *  returns: local index of the record, or a value >= last if none
+ *
+ *-----------------------------------------------------------------*/
+static uint32 OS_ObjectIdSearchFree(uint32 base_id, uint32 first, uint32 last)
+{
+    uint32 idx;
+
+    idx = base_id + first;
+    while (true)
+    {
+        idx = OS_ObjectIdSearchInUseBitmap(idx, base_id + last);
+        if (idx >= (base_id + last) || !OS_ObjectIdDefined(OS_common_table[idx].active_id))
+        {
+            break;
+        }
+
+        /* record is in use but was not marked as such */
+        OS_ObjectIdMarkInUse(idx);
+        ++idx;
+    }
+
+    return idx - base_id;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Finds the first free record of the object type with records
+ *           starting at base_id, in rotation order beginning at "start".
+ *
+ *  returns: local index of the record, or max_id if none are free
+ *
+ *-----------------------------------------------------------------*/
+static uint32 OS_ObjectIdFindFreeRecord(uint32 base_id, uint32 max_id, uint32 start)
+{
+    uint32 local_id;
+    uint32 attempt;
+    uint32 i;
+
+    for (attempt = 0; attempt < 2; ++attempt)
+    {
+        local_id = OS_ObjectIdSearchFree(base_id, start, max_id);
+        if (local_id < max_id)
+        {
+            break;
+        }
+
+        local_id = OS_ObjectIdSearchFree(base_id, 0, start);
+        if (local_id < start)
+        {
+            break;
+        }
+
+        /*
+         * Nothing is free according to the bitmap.  Rebuild it from the
+         * records themselves, in case it is stale, and try once more.
+         */
+        local_id = max_id;
+        for (i = 0; i < max_id; ++i)
+        {
+            if (OS_ObjectIdDefined(OS_common_table[base_id + i].active_id))
+            {
+                OS_ObjectIdMarkInUse(base_id + i);
+            }
+            else
+            {
+                OS_ObjectIdMarkFree(base_id + i);
+            }
+        }
+    }
+
+    return local_id;
+}
+
 /*----------------------------------------------------------------
  *
  *  Purpose: Local helper routine, not part of OSAL API.
@@ -590,7 +983,7 @@ int32 OS_ObjectIdFindNextFree(OS_object_token_t *token)
     uint32              base_id;
     uint32              local_id = 0;
     uint32              serial;
-    uint32              i;
+    uint32              start;
     int32               return_code;
     OS_common_record_t *obj = NULL;
     OS_objtype_state_t *objtype_state;
@@ -610,36 +1003,50 @@ int32 OS_ObjectIdFindNextFree(OS_object_token_t *token)
     }
     else
     {
-        return_code = OS_ERR_NO_FREE_IDS;
-        serial      = OS_ObjectIdToSerialNumber_Impl(objtype_state->last_id_issued);
-    }
+        /*
+         * The search starts at the slot following the last-issued ID, and the
+         * serial number advances by the number of slots passed, so the serial
+         * number continues to rotate through the whole ID space.
+         */
+        serial   = OS_ObjectIdToSerialNumber_Impl(objtype_state->last_id_issued);
+        start    = (serial + 1) % max_id;
+        local_id = OS_ObjectIdFindFreeRecord(base_id, max_id, start);
 
-    for (i = 0; i < max_id; ++i)
-    {
-        local_id = (++serial) % max_id;
-        if (serial >= OS_OBJECT_INDEX_MASK)
+        if (local_id < max_id)
         {
-            /* reset to beginning of ID space */
-            serial = local_id;
+            serial += 1 + ((local_id + max_id - start) % max_id);
+            if (serial >= OS_OBJECT_INDEX_MASK)
+            {
+                /* reset to beginning of ID space */
+                serial = local_id;
+            }
+            return_code = OS_SUCCESS;
         }
-        obj = &OS_common_table[local_id + base_id];
-        if (!OS_ObjectIdDefined(obj->active_id))
+        else
         {
-            return_code = OS_SUCCESS;
-            break;
+            return_code = OS_ERR_NO_FREE_IDS;
         }
     }
 
     if (return_code == OS_SUCCESS)
     {
+        obj = &OS_common_table[local_id + base_id];
+        OS_ObjectIdMarkInUse(local_id + base_id);
+
         token->obj_idx = OSAL_INDEX_C(local_id);
         OS_ObjectIdCompose_Impl(token->obj_type, serial, &token->obj_id);
 
-        /* Ensure any data in the record has been cleared */
-        obj->active_id  = token->obj_id;
+        /*
+         * Ensure any data in the record has been cleared
+         *
+         * Note the refcount is not reset here - a free record always has
+         * a refcount of zero, except transiently while another task backs
+         * out of a lock-free refcount attempt using a stale ID.  Resetting it
+         * would make that task's decrement unbalanced.
+         */
+        OS_ObjectIdSetActive(obj, token->obj_id);
         obj->name_entry = NULL;
         obj->creator    = OS_TaskGetId();
-        obj->refcount   = 0;
 
         /* preemptively update the last id issued */
         objtype_state->last_id_issued = token->obj_id;
@@ -654,6 +1061,222 @@ int32 OS_ObjectIdFindNextFree(OS_object_token_t *token)
     return return_code;
 }
 
+#ifdef OSAL_CONFIG_NAME_INDEX
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Computes the hash of an object name (32-bit FNV-1a)
+ *
+ *-----------------------------------------------------------------*/
+static uint32 OS_ObjectIdNameHash(const char *name)
+{
+    uint32 hash = 2166136261U;
+
+    while (*name != 0)
+    {
+        hash ^= (uint8)*name;
+        hash *= 16777619U;
+        ++name;
+    }
+
+    return hash;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Gets the region of the name index used by the given object type
+ *
+ *  Outputs: *size is set to the number of slots in the region, which is
+ *           zero if objects of this type are not indexed by name.
+ *
+ *  returns: pointer to the first slot of the region
+ *
+ *-----------------------------------------------------------------*/
+static uint32 *OS_ObjectIdNameIndexRegion(osal_objtype_t idtype, uint32 *size)
+{
+    /*
+     * File and directory names are not unique, and the name of a socket
+     * is changed after creation, so these types are always searched linearly.
+     */
+    if (idtype == OS_OBJECT_TYPE_OS_STREAM || idtype == OS_OBJECT_TYPE_OS_DIR)
+    {
+        *size = 0;
+    }
+    else
+    {
+        *size = 2 * OS_GetMaxForObjectType(idtype);
+    }
+
+    return &OS_name_index_slots[2 * OS_GetBaseForObjectType(idtype)];
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Follows the probe sequence starting at the slot for "hash",
+ *           until reaching a slot containing "value" or an empty slot.
+ *
+ *  returns: position of the slot within the region
+ *
+ *-----------------------------------------------------------------*/
+static uint32 OS_ObjectIdNameIndexProbe(const uint32 *slots, uint32 size, uint32 hash, uint32 value)
+{
+    uint32 pos = hash % size;
+
+    while (slots[pos] != 0 && slots[pos] != value)
+    {
+        pos = (pos + 1) % size;
+    }
+
+    return pos;
+}
+#endif
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Adds the record referenced by the token to the name index
+ *
+ *           Note: This is an internal helper function and no locking is performed.
+ *           The appropriate global table lock must be held prior to calling this.
+ *
+ *-----------------------------------------------------------------*/
+void OS_ObjectIdNameIndexInsert(const OS_object_token_t *token, const char *name)
+{
+#ifdef OSAL_CONFIG_NAME_INDEX
+    uint32 *slots;
+    uint32  size;
+    uint32  hash;
+    uint32  pos;
+
+    slots = OS_ObjectIdNameIndexRegion(token->obj_type, &size);
+
+    if (size != 0 && name != NULL)
+    {
+        /* ensure the record appears in the index only once */
+        OS_ObjectIdNameIndexRemove(token);
+
+        hash = OS_ObjectIdNameHash(name);
+        pos  = OS_ObjectIdNameIndexProbe(slots, size, hash, 0);
+
+        OS_name_index_hash[OS_GetBaseForObjectType(token->obj_type) + token->obj_idx] = hash;
+        slots[pos]                                                                   = token->obj_idx + 1;
+    }
+#endif
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Removes the record referenced by the token from the name index,
+ *           if present.
+ *
+ *           Note: This is an internal helper function and no locking is performed.
+ *           The appropriate global table lock must be held prior to calling this.
+ *
+ *-----------------------------------------------------------------*/
+void OS_ObjectIdNameIndexRemove(const OS_object_token_t *token)
+{
+#ifdef OSAL_CONFIG_NAME_INDEX
+    uint32 *slots;
+    uint32  size;
+    uint32  base_idx;
+    uint32  pos;
+    uint32  next;
+    uint32  home;
+
+    slots    = OS_ObjectIdNameIndexRegion(token->obj_type, &size);
+    base_idx = OS_GetBaseForObjectType(token->obj_type);
+
+    if (size != 0)
+    {
+        pos = OS_ObjectIdNameIndexProbe(slots, size, OS_name_index_hash[base_idx + token->obj_idx],
+                                        token->obj_idx + 1);
+
+        if (slots[pos] != 0)
+        {
+            slots[pos] = 0;
+
+            /*
+             * Move back any subsequent entries in the same cluster which are
+             * now separated from their home slot by the empty slot.  This keeps
+             * every probe sequence unbroken without needing "deleted" markers.
+             */
+            next = (pos + 1) % size;
+            while (slots[next] != 0)
+            {
+                home = OS_name_index_hash[base_idx + slots[next] - 1] % size;
+                if (((next + size - home) % size) >= ((next + size - pos) % size))
+                {
+                    slots[pos]  = slots[next];
+                    slots[next] = 0;
+                    pos         = next;
+                }
+                next = (next + 1) % size;
+            }
+        }
+    }
+#endif
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Locate an existing object with a matching name.
+ *           Matching object ID is stored in the token.
+ *
+ *           This uses the name index if enabled for the object type,
+ *           otherwise it is the same as OS_ObjectIdFindNextMatch()
+ *           with OS_ObjectNameMatch().
+ *
+ *           This is an internal function and no table locking is performed here.
+ *           Locking must be done by the calling function.
+ *
+ *  returns: OS_ERR_NAME_NOT_FOUND if not found, OS_SUCCESS if match is found
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_ObjectIdFindNameMatch(const char *name, OS_object_token_t *token)
+{
+#ifdef OSAL_CONFIG_NAME_INDEX
+    int32               return_code;
+    uint32 *            slots;
+    uint32              size;
+    uint32              pos;
+    OS_common_record_t *base;
+    OS_common_record_t *record;
+
+    slots = OS_ObjectIdNameIndexRegion(token->obj_type, &size);
+
+    if (size != 0)
+    {
+        return_code   = OS_ERR_NAME_NOT_FOUND;
+        base          = &OS_common_table[OS_GetBaseForObjectType(token->obj_type)];
+        pos           = OS_ObjectIdNameHash(name) % size;
+        token->obj_id = OS_OBJECT_ID_UNDEFINED;
+
+        while (slots[pos] != 0)
+        {
+            token->obj_idx = OSAL_INDEX_C(slots[pos] - 1);
+            record         = OS_OBJECT_TABLE_GET(base, *token);
+
+            if (OS_ObjectIdDefined(record->active_id) && OS_ObjectNameMatch((void *)name, token, record))
+            {
+                return_code   = OS_SUCCESS;
+                token->obj_id = record->active_id;
+                break;
+            }
+
+            pos = (pos + 1) % size;
+        }
+
+        return return_code;
+    }
+#endif
+
+    return OS_ObjectIdFindNextMatch(OS_ObjectNameMatch, (void *)name, token);
+}
+
 /*
  *********************************************************************************
  *          OSAL INTERNAL FUNCTIONS
@@ -947,7 +1570,22 @@ int32 OS_ObjectIdGetBySearch(OS_lock_mode_t lock_mode, osal_objtype_t idtype, OS
  *-----------------------------------------------------------------*/
 int32 OS_ObjectIdGetByName(OS_lock_mode_t lock_mode, osal_objtype_t idtype, const char *name, OS_object_token_t *token)
 {
-    return OS_ObjectIdGetBySearch(lock_mode, idtype, OS_ObjectNameMatch, (void *)name, token);
+    int32 return_code;
+
+    OS_ObjectIdTransactionInit(lock_mode, idtype, token);
+
+    return_code = OS_ObjectIdFindNameMatch(name, token);
+
+    if (return_code == OS_SUCCESS)
+    {
+        return_code = OS_ObjectIdConvertToken(token);
+    }
+    else
+    {
+        OS_ObjectIdTransactionCancel(token);
+    }
+
+    return return_code;
 }
 
 /*----------------------------------------------------------------
@@ -1001,6 +1639,33 @@ int32 OS_ObjectIdGetById(OS_lock_mode_t lock_mode, osal_objtype_t idtype, osal_i
 {
     int32 return_code;
 
+    /*
+     * A REFCOUNT lock is first attempted without the global table lock.
+     * If the record is not in a steady state then this falls back to the
+     * normal path below, which waits or fails as appropriate.
+     */
+    if (lock_mode == OS_LOCK_MODE_REFCOUNT)
+    {
+        return_code = OS_ObjectIdTransactionInit(OS_LOCK_MODE_NONE, idtype, token);
+        if (return_code == OS_SUCCESS)
+        {
+            return_code = OS_ObjectIdToArrayIndex(idtype, id, &token->obj_idx);
+        }
+
+        if (return_code != OS_SUCCESS)
+        {
+            return return_code;
+        }
+
+        token->obj_id = id;
+
+        if (OS_ObjectIdRefcountTryAcquire(token))
+        {
+            token->lock_mode = OS_LOCK_MODE_REFCOUNT;
+            return OS_SUCCESS;
+        }
+    }
+
     return_code = OS_ObjectIdTransactionInit(lock_mode, idtype, token);
     if (return_code != OS_SUCCESS)
     {
@@ -1053,6 +1718,19 @@ void OS_ObjectIdTransactionFinish(OS_object_token_t *token, const osal_id_t *fin
         return;
     }
 
+#ifdef OS_OBJECT_ID_LOCKFREE_REFCOUNT
+    /*
+     * A REFCOUNT lock with no ID update pending can be released without
+     * re-acquiring the global table lock in most cases.
+     */
+    if (token->lock_mode == OS_LOCK_MODE_REFCOUNT && final_id == NULL)
+    {
+        OS_ObjectIdRefcountRelease(token);
+        token->lock_mode = OS_LOCK_MODE_NONE;
+        return;
+    }
+#endif
+
     record = OS_ObjectIdGlobalFromToken(token);
 
     /* re-acquire global table lock to adjust refcount */
@@ -1061,10 +1739,7 @@ void OS_ObjectIdTransactionFinish(OS_object_token_t *token, const osal_id_t *fin
         OS_Lock_Global(token);
     }
 
-    if (record->refcount > 0)
-    {
-        --record->refcount;
-    }
+    OS_ObjectIdDecrRefcount(record);
 
     /*
      * at this point the global mutex is always held, either
@@ -1076,7 +1751,14 @@ void OS_ObjectIdTransactionFinish(OS_object_token_t *token, const osal_id_t *fin
      */
     if (final_id != NULL)
     {
-        record->active_id = *final_id;
+        /* If the record is being returned to the pool, it must also leave the name index */
+        if (!OS_ObjectIdDefined(*final_id))
+        {
+            OS_ObjectIdNameIndexRemove(token);
+            OS_ObjectIdMarkFree(OS_GetBaseForObjectType(token->obj_type) + token->obj_idx);
+        }
+
+        OS_ObjectIdSetActive(record, *final_id);
     }
     else if (token->lock_mode == OS_LOCK_MODE_EXCLUSIVE)
     {
@@ -1085,7 +1767,7 @@ void OS_ObjectIdTransactionFinish(OS_object_token_t *token, const osal_id_t *fin
          * was reset to OS_OBJECT_ID_RESERVED.  This must restore the original
          * object ID from the token.
          */
-        record->active_id = token->obj_id;
+        OS_ObjectIdSetActive(record, token->obj_id);
     }
 
     /* always unlock (this also covers OS_LOCK_MODE_GLOBAL case) */
@@ -1167,7 +1849,7 @@ int32 OS_ObjectIdAllocateNew(osal_objtype_t idtype, const char *name, OS_object_
      */
     if (name != NULL)
     {
-        return_code = OS_ObjectIdFindNextMatch(OS_ObjectNameMatch, (void *)name, token);
+        return_code = OS_ObjectIdFindNameMatch(name, token);
     }
     else
     {
@@ -1193,6 +1875,13 @@ int32 OS_ObjectIdAllocateNew(osal_objtype_t idtype, const char *name, OS_object_
     }
     else
     {
+        /*
+         * The name is indexed from this point, while the global table is still locked,
+         * so that a concurrent create of the same name is detected as a duplicate once
+         * the name_entry is set.  It is removed again if the create is not finalized.
+         */
+        OS_ObjectIdNameIndexInsert(token, name);
+
         return_code = OS_NotifyEvent(OS_EVENT_RESOURCE_ALLOCATED, token->obj_id, NULL);
     }
 
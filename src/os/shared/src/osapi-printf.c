@@ -32,6 +32,10 @@
  *      the machine's C library does not provide this function, the user
  *      would have to provide a compatible substitute to link to.
  *
+ *      If OSAL_CONFIG_PRINTF_DEFERRED is set, the formatting is instead done
+ *      later by the console utility task.  The calling task only captures the
+ *      argument values, which are then applied to the same format string.
+ *
  *      Once the string is formatted, it is passed to the lower level
  *      implementation to do the actual output.  This would typically write
  *      to a console device but may alternatively write to any other
@@ -50,9 +54,11 @@
 /*
  * User defined include files
  */
+#include "os-shared-clock.h"
 #include "os-shared-common.h"
 #include "os-shared-idmap.h"
 #include "os-shared-printf.h"
+#include "os-shared-task.h"
 
 /*
  * The choice of whether to run a separate utility task
@@ -64,12 +70,94 @@
 #define OS_CONSOLE_IS_ASYNC false
 #endif
 
+/*
+ * Deferred formatting is only possible when there is a utility task to do it
+ */
+#ifdef OSAL_CONFIG_PRINTF_DEFERRED
+#define OS_PRINTF_IS_DEFERRED OS_CONSOLE_IS_ASYNC
+#else
+#define OS_PRINTF_IS_DEFERRED false
+#endif
+
+/*
+ * Maximum length of a single conversion specification in a deferred format,
+ * such as "%-+#08.3llx".  Anything longer is not output.
+ */
+#define OS_PRINTF_MAX_SPEC_LEN 32
+
 /* reserve buffer memory for the printf console device */
 static char OS_printf_buffer_mem[(sizeof(OS_PRINTF_CONSOLE_NAME) + OS_BUFFER_SIZE) * OS_BUFFER_MSG_DEPTH];
 
 /* The global console state table */
 OS_console_internal_record_t OS_console_table[OS_MAX_CONSOLES];
 
+/* The staging rings for asynchronous console output */
+OS_console_staging_t OS_console_staging_table[OS_CONSOLE_STAGING_COUNT];
+
+/* Positions are free-running, so the ring size must evenly divide their range */
+CompileTimeAssert((OS_PRINTF_STAGING_SIZE & (OS_PRINTF_STAGING_SIZE - 1)) == 0, PrintfStagingSizeNotPowerOfTwo);
+
+/*
+ * Header of each record in a staging ring
+ *
+ * This is followed by either the text, or if Format is set, the
+ * arguments captured for deferred formatting of that string.
+ */
+typedef struct
+{
+    OS_time_t   Timestamp; /**< Time the record was staged, for ordering output */
+    const char *Format;    /**< Format string to apply to the arguments, or NULL for text */
+    uint32      Length;    /**< Length of the data following the header */
+} OS_console_staged_hdr_t;
+
+/*
+ * The type of argument consumed by a printf conversion specification
+ */
+typedef enum
+{
+    OS_PRINTF_ARG_NONE, /**< No argument, such as "%%" */
+    OS_PRINTF_ARG_INT,
+    OS_PRINTF_ARG_LONG,
+    OS_PRINTF_ARG_LONGLONG,
+    OS_PRINTF_ARG_INTMAX,
+    OS_PRINTF_ARG_SIZE,
+    OS_PRINTF_ARG_PTRDIFF,
+    OS_PRINTF_ARG_DOUBLE,
+    OS_PRINTF_ARG_LONGDOUBLE,
+    OS_PRINTF_ARG_POINTER,
+    OS_PRINTF_ARG_STRING,
+    OS_PRINTF_ARG_UNSUPPORTED /**< A pointer that is captured but not output, such as "%n" */
+} OS_printf_argtype_t;
+
+/*
+ * A single conversion specification within a printf format string
+ */
+typedef struct
+{
+    const char *        Start;     /**< Location of the '%' in the format string */
+    size_t              Length;    /**< Length of the whole specification */
+    uint32              StarCount; /**< Number of '*' width/precision arguments, which are int */
+    bool                StarPrec;  /**< Set if the precision is the last '*' argument */
+    int32               Precision; /**< Precision given in the format, or -1 if none */
+    OS_printf_argtype_t ArgType;   /**< Type of the value argument */
+} OS_printf_spec_t;
+
+/*
+ * Storage for any one printf argument value
+ */
+typedef union
+{
+    int         i;
+    long        l;
+    long long   ll;
+    intmax_t    im;
+    size_t      sz;
+    ptrdiff_t   pd;
+    double      d;
+    long double ld;
+    const void *p;
+} OS_printf_argval_t;
+
 /*
  *********************************************************************************
  *          INITIALIZATION
@@ -107,6 +195,10 @@ int32 OS_ConsoleAPI_Init(void)
         console->BufSize = sizeof(OS_printf_buffer_mem);
         console->IsAsync = OS_CONSOLE_IS_ASYNC;
 
+        OS_SharedGlobalVars.PrintfDeferred = OS_PRINTF_IS_DEFERRED;
+
+        memset(OS_console_staging_table, 0, sizeof(OS_console_staging_table));
+
         return_code = OS_ConsoleCreate_Impl(&token);
 
         /* Check result, finalize record, and unlock global table. */
@@ -179,72 +271,949 @@ static int32 OS_Console_CopyOut(OS_console_internal_record_t *console, const cha
     return return_code;
 }
 
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *    Find the next conversion specification in a printf format string
+ *
+ *    If one is found, the literal text before it runs from Format
+ *    up to Spec->Start.
+ *
+ *    Returns true if a conversion specification was found
+ *
+ *-----------------------------------------------------------------*/
+static bool OS_Printf_NextSpec(const char *Format, OS_printf_spec_t *Spec)
+{
+    const char *pfmt;
+    char        Modifier;
+
+    pfmt = Format;
+    while (*pfmt != '%')
+    {
+        if (*pfmt == 0)
+        {
+            return false;
+        }
+        ++pfmt;
+    }
+
+    Spec->Start     = pfmt;
+    Spec->StarCount = 0;
+    Spec->StarPrec  = false;
+    Spec->Precision = -1;
+    Spec->ArgType   = OS_PRINTF_ARG_NONE;
+    ++pfmt;
+
+    /* flags */
+    while (*pfmt == '-' || *pfmt == '+' || *pfmt == ' ' || *pfmt == '#' || *pfmt == '0')
+    {
+        ++pfmt;
+    }
+
+    /* field width */
+    if (*pfmt == '*')
+    {
+        ++Spec->StarCount;
+        ++pfmt;
+    }
+    while (*pfmt >= '0' && *pfmt <= '9')
+    {
+        ++pfmt;
+    }
+
+    /* precision - a large value is limited, as it cannot be reached within a buffer anyway */
+    if (*pfmt == '.')
+    {
+        ++pfmt;
+        Spec->Precision = 0;
+        if (*pfmt == '*')
+        {
+            ++Spec->StarCount;
+            Spec->StarPrec = true;
+            ++pfmt;
+        }
+        while (*pfmt >= '0' && *pfmt <= '9')
+        {
+            if (Spec->Precision < OS_BUFFER_SIZE)
+            {
+                Spec->Precision = (Spec->Precision * 10) + (*pfmt - '0');
+            }
+            ++pfmt;
+        }
+    }
+
+    /* length modifier - "ll" is recorded as 'q'; "h" and "hh" need none, as those are promoted to int */
+    Modifier = 0;
+    switch (*pfmt)
+    {
+        case 'h':
+            ++pfmt;
+            if (*pfmt == 'h')
+            {
+                ++pfmt;
+            }
+            break;
+        case 'l':
+            Modifier = 'l';
+            ++pfmt;
+            if (*pfmt == 'l')
+            {
+                Modifier = 'q';
+                ++pfmt;
+            }
+            break;
+        case 'j':
+        case 'z':
+        case 't':
+        case 'L':
+            Modifier = *pfmt;
+            ++pfmt;
+            break;
+        default:
+            break;
+    }
+
+    /* conversion */
+    switch (*pfmt)
+    {
+        case 'd':
+        case 'i':
+        case 'o':
+        case 'u':
+        case 'x':
+        case 'X':
+            switch (Modifier)
+            {
+                case 'l':
+                    Spec->ArgType = OS_PRINTF_ARG_LONG;
+                    break;
+                case 'q':
+                    Spec->ArgType = OS_PRINTF_ARG_LONGLONG;
+                    break;
+                case 'j':
+                    Spec->ArgType = OS_PRINTF_ARG_INTMAX;
+                    break;
+                case 'z':
+                    Spec->ArgType = OS_PRINTF_ARG_SIZE;
+                    break;
+                case 't':
+                    Spec->ArgType = OS_PRINTF_ARG_PTRDIFF;
+                    break;
+                default:
+                    Spec->ArgType = OS_PRINTF_ARG_INT;
+                    break;
+            }
+            break;
+        case 'c':
+            Spec->ArgType = OS_PRINTF_ARG_INT;
+            break;
+        case 'e':
+        case 'E':
+        case 'f':
+        case 'F':
+        case 'g':
+        case 'G':
+        case 'a':
+        case 'A':
+            Spec->ArgType = (Modifier == 'L') ? OS_PRINTF_ARG_LONGDOUBLE : OS_PRINTF_ARG_DOUBLE;
+            break;
+        case 'p':
+            Spec->ArgType = OS_PRINTF_ARG_POINTER;
+            break;
+        case 's':
+            /* wide strings are not copied, so they cannot be output later */
+            Spec->ArgType = (Modifier == 'l') ? OS_PRINTF_ARG_UNSUPPORTED : OS_PRINTF_ARG_STRING;
+            break;
+        case 'n':
+            Spec->ArgType = OS_PRINTF_ARG_UNSUPPORTED;
+            break;
+        default:
+            /* "%%", or an invalid specification that is output as-is */
+            break;
+    }
+
+    if (*pfmt != 0)
+    {
+        ++pfmt;
+    }
+
+    Spec->Length = pfmt - Spec->Start;
+
+    return true;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *    Gets the size of a captured printf argument value
+ *
+ *    Strings are variable length, and are not handled here.
+ *
+ *-----------------------------------------------------------------*/
+static size_t OS_Printf_ArgSize(OS_printf_argtype_t ArgType)
+{
+    OS_printf_argval_t Value;
+    size_t             Size;
+
+    switch (ArgType)
+    {
+        case OS_PRINTF_ARG_INT:
+            Size = sizeof(Value.i);
+            break;
+        case OS_PRINTF_ARG_LONG:
+            Size = sizeof(Value.l);
+            break;
+        case OS_PRINTF_ARG_LONGLONG:
+            Size = sizeof(Value.ll);
+            break;
+        case OS_PRINTF_ARG_INTMAX:
+            Size = sizeof(Value.im);
+            break;
+        case OS_PRINTF_ARG_SIZE:
+            Size = sizeof(Value.sz);
+            break;
+        case OS_PRINTF_ARG_PTRDIFF:
+            Size = sizeof(Value.pd);
+            break;
+        case OS_PRINTF_ARG_DOUBLE:
+            Size = sizeof(Value.d);
+            break;
+        case OS_PRINTF_ARG_LONGDOUBLE:
+            Size = sizeof(Value.ld);
+            break;
+        case OS_PRINTF_ARG_POINTER:
+        case OS_PRINTF_ARG_UNSUPPORTED:
+            Size = sizeof(Value.p);
+            break;
+        default:
+            Size = 0;
+            break;
+    }
+
+    return Size;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *    Capture the arguments of a printf call for deferred formatting
+ *
+ *    The values are stored in order, without padding.  Strings are copied
+ *    along with their terminator, and truncated if necessary.  As with
+ *    vsnprintf(), no more of a string than its precision is read, so the
+ *    string need not be terminated.  Capture stops at the first value that
+ *    does not fit.
+ *
+ *    Returns the number of bytes stored into the buffer
+ *
+ *-----------------------------------------------------------------*/
+static size_t OS_Printf_CaptureArgs(char *Buffer, size_t BufSize, const char *Format, va_list va)
+{
+    OS_printf_spec_t   Spec;
+    OS_printf_argval_t Value;
+    const char *       Str;
+    size_t             Pos;
+    size_t             Size;
+    size_t             Limit;
+    int32              Precision;
+    uint32             idx;
+
+    Pos = 0;
+    while (OS_Printf_NextSpec(Format, &Spec))
+    {
+        Format    = Spec.Start + Spec.Length;
+        Precision = Spec.Precision;
+
+        for (idx = 0; idx < Spec.StarCount; ++idx)
+        {
+            Value.i = va_arg(va, int);
+            if (Spec.StarPrec && idx == (Spec.StarCount - 1))
+            {
+                /* a negative precision is taken as if it were omitted */
+                Precision = Value.i;
+            }
+            if ((BufSize - Pos) < sizeof(Value.i))
+            {
+                return Pos;
+            }
+            memcpy(&Buffer[Pos], &Value.i, sizeof(Value.i));
+            Pos += sizeof(Value.i);
+        }
+
+        switch (Spec.ArgType)
+        {
+            case OS_PRINTF_ARG_INT:
+                Value.i = va_arg(va, int);
+                break;
+            case OS_PRINTF_ARG_LONG:
+                Value.l = va_arg(va, long);
+                break;
+            case OS_PRINTF_ARG_LONGLONG:
+                Value.ll = va_arg(va, long long);
+                break;
+            case OS_PRINTF_ARG_INTMAX:
+                Value.im = va_arg(va, intmax_t);
+                break;
+            case OS_PRINTF_ARG_SIZE:
+                Value.sz = va_arg(va, size_t);
+                break;
+            case OS_PRINTF_ARG_PTRDIFF:
+                Value.pd = va_arg(va, ptrdiff_t);
+                break;
+            case OS_PRINTF_ARG_DOUBLE:
+                Value.d = va_arg(va, double);
+                break;
+            case OS_PRINTF_ARG_LONGDOUBLE:
+                Value.ld = va_arg(va, long double);
+                break;
+            case OS_PRINTF_ARG_POINTER:
+            case OS_PRINTF_ARG_UNSUPPORTED:
+            case OS_PRINTF_ARG_STRING:
+                Value.p = va_arg(va, const void *);
+                break;
+            default:
+                break;
+        }
+
+        if (Spec.ArgType == OS_PRINTF_ARG_STRING)
+        {
+            Str = Value.p;
+            if (Str == NULL)
+            {
+                Str = "(null)";
+            }
+            if (Pos >= BufSize)
+            {
+                return Pos;
+            }
+
+            Limit = BufSize - Pos - 1;
+            if (Precision >= 0 && (size_t)Precision < Limit)
+            {
+                Limit = Precision;
+            }
+
+            Size = 0;
+            while (Size < Limit && Str[Size] != 0)
+            {
+                ++Size;
+            }
+            memcpy(&Buffer[Pos], Str, Size);
+            Buffer[Pos + Size] = 0;
+            Pos += Size + 1;
+        }
+        else
+        {
+            Size = OS_Printf_ArgSize(Spec.ArgType);
+            if ((BufSize - Pos) < Size)
+            {
+                return Pos;
+            }
+            memcpy(&Buffer[Pos], &Value, Size);
+            Pos += Size;
+        }
+    }
+
+    return Pos;
+}
+
 /*
- *********************************************************************************
- *          PUBLIC API (application-callable functions)
- *********************************************************************************
+ * Formats one captured value, preceded by any captured '*' arguments
  */
+#define OS_PRINTF_FORMAT_VALUE(val)                                                \
+    ((Spec->StarCount == 0)   ? snprintf(Buffer, BufSize, SpecBuf, val)           \
+     : (Spec->StarCount == 1) ? snprintf(Buffer, BufSize, SpecBuf, Stars[0], val) \
+                              : snprintf(Buffer, BufSize, SpecBuf, Stars[0], Stars[1], val))
 
 /*----------------------------------------------------------------
  *
  *  Purpose: Local helper routine, not part of OSAL API.
- *           Write into the console ring buffer
+ *    Format one conversion specification using captured arguments
+ *
+ *    ArgPos is an input-output, and is advanced past the arguments used.
+ *
+ *    Returns the length of the output as for snprintf(), or -1 if the
+ *    arguments were not all captured
  *
  *-----------------------------------------------------------------*/
-int32 OS_ConsoleWrite(osal_id_t console_id, const char *Str)
+static int OS_Printf_FormatSpec(char *Buffer, size_t BufSize, const OS_printf_spec_t *Spec, const char *Args,
+                                size_t ArgSize, size_t *ArgPos)
+{
+    OS_printf_argval_t Value;
+    char               SpecBuf[OS_PRINTF_MAX_SPEC_LEN];
+    int                Stars[2];
+    size_t             Size;
+    uint32             idx;
+
+    for (idx = 0; idx < Spec->StarCount; ++idx)
+    {
+        if ((ArgSize - *ArgPos) < sizeof(Stars[idx]))
+        {
+            return -1;
+        }
+        memcpy(&Stars[idx], &Args[*ArgPos], sizeof(Stars[idx]));
+        *ArgPos += sizeof(Stars[idx]);
+    }
+
+    memset(&Value, 0, sizeof(Value));
+    if (Spec->ArgType == OS_PRINTF_ARG_STRING)
+    {
+        /* the string was captured with its terminator */
+        if (*ArgPos >= ArgSize)
+        {
+            return -1;
+        }
+        Value.p = &Args[*ArgPos];
+        Size    = strlen(Value.p) + 1;
+    }
+    else
+    {
+        Size = OS_Printf_ArgSize(Spec->ArgType);
+        if ((ArgSize - *ArgPos) < Size)
+        {
+            return -1;
+        }
+        memcpy(&Value, &Args[*ArgPos], Size);
+    }
+    *ArgPos += Size;
+
+    if (Spec->ArgType == OS_PRINTF_ARG_UNSUPPORTED || Spec->Length >= sizeof(SpecBuf))
+    {
+        /* nothing is output */
+        return 0;
+    }
+
+    if (Spec->ArgType == OS_PRINTF_ARG_NONE)
+    {
+        /* "%%" is output as a single '%', an invalid specification as-is */
+        Size = Spec->Length;
+        if (Size == 2 && Spec->Start[1] == '%')
+        {
+            Size = 1;
+        }
+        memcpy(Buffer, Spec->Start, (Size < BufSize) ? Size : (BufSize - 1));
+        return Size;
+    }
+
+    memcpy(SpecBuf, Spec->Start, Spec->Length);
+    SpecBuf[Spec->Length] = 0;
+
+    switch (Spec->ArgType)
+    {
+        case OS_PRINTF_ARG_INT:
+            return OS_PRINTF_FORMAT_VALUE(Value.i);
+        case OS_PRINTF_ARG_LONG:
+            return OS_PRINTF_FORMAT_VALUE(Value.l);
+        case OS_PRINTF_ARG_LONGLONG:
+            return OS_PRINTF_FORMAT_VALUE(Value.ll);
+        case OS_PRINTF_ARG_INTMAX:
+            return OS_PRINTF_FORMAT_VALUE(Value.im);
+        case OS_PRINTF_ARG_SIZE:
+            return OS_PRINTF_FORMAT_VALUE(Value.sz);
+        case OS_PRINTF_ARG_PTRDIFF:
+            return OS_PRINTF_FORMAT_VALUE(Value.pd);
+        case OS_PRINTF_ARG_DOUBLE:
+            return OS_PRINTF_FORMAT_VALUE(Value.d);
+        case OS_PRINTF_ARG_LONGDOUBLE:
+            return OS_PRINTF_FORMAT_VALUE(Value.ld);
+        default:
+            /* pointers and strings */
+            return OS_PRINTF_FORMAT_VALUE(Value.p);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *    Format a message using arguments captured by OS_Printf_CaptureArgs()
+ *
+ *    Output stops at the first argument that was not captured.
+ *
+ *    Returns the length of the output, which is always terminated
+ *
+ *-----------------------------------------------------------------*/
+static size_t OS_Printf_FormatArgs(char *Buffer, size_t BufSize, const char *Format, const char *Args,
+                                   size_t ArgSize)
+{
+    OS_printf_spec_t Spec;
+    size_t           OutPos;
+    size_t           ArgPos;
+    size_t           Size;
+    int              actualsz;
+    bool             found;
+
+    OutPos = 0;
+    ArgPos = 0;
+    while (OutPos < (BufSize - 1))
+    {
+        /* copy the literal text before the next specification */
+        found = OS_Printf_NextSpec(Format, &Spec);
+        if (found)
+        {
+            Size = Spec.Start - Format;
+        }
+        else
+        {
+            Size = strlen(Format);
+        }
+        if (Size > (BufSize - 1 - OutPos))
+        {
+            Size = BufSize - 1 - OutPos;
+        }
+        memcpy(&Buffer[OutPos], Format, Size);
+        OutPos += Size;
+
+        if (!found)
+        {
+            break;
+        }
+
+        actualsz = OS_Printf_FormatSpec(&Buffer[OutPos], BufSize - OutPos, &Spec, Args, ArgSize, &ArgPos);
+        if (actualsz < 0)
+        {
+            break;
+        }
+
+        OutPos += actualsz;
+        if (OutPos >= BufSize)
+        {
+            /* truncate */
+            OutPos = BufSize - 1;
+        }
+
+        Format = Spec.Start + Spec.Length;
+    }
+
+    Buffer[OutPos] = 0;
+
+    return OutPos;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *    Copy data into a staging ring starting at the given position
+ *
+ *-----------------------------------------------------------------*/
+static void OS_Console_StagingCopyIn(OS_console_staging_t *ring, uint32 Pos, const void *Data, size_t Size)
+{
+    size_t Offset;
+    size_t Chunk;
+
+    Offset = Pos & (OS_PRINTF_STAGING_SIZE - 1);
+    Chunk  = OS_PRINTF_STAGING_SIZE - Offset;
+    if (Chunk > Size)
+    {
+        Chunk = Size;
+    }
+
+    memcpy(&ring->Buffer[Offset], Data, Chunk);
+    memcpy(ring->Buffer, (const char *)Data + Chunk, Size - Chunk);
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *    Copy data out of a staging ring starting at the given position
+ *
+ *-----------------------------------------------------------------*/
+static void OS_Console_StagingCopyOut(const OS_console_staging_t *ring, uint32 Pos, void *Data, size_t Size)
+{
+    size_t Offset;
+    size_t Chunk;
+
+    Offset = Pos & (OS_PRINTF_STAGING_SIZE - 1);
+    Chunk  = OS_PRINTF_STAGING_SIZE - Offset;
+    if (Chunk > Size)
+    {
+        Chunk = Size;
+    }
+
+    memcpy(Data, &ring->Buffer[Offset], Chunk);
+    memcpy((char *)Data + Chunk, ring->Buffer, Size - Chunk);
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *    Write a record into a console staging ring
+ *
+ *    Only the single producer of the ring may call this.  As with the
+ *    console ring buffer, either the entire record is staged or none of it.
+ *
+ *    If Format is NULL the data is text, otherwise it is the arguments
+ *    to format later.  The console name is added when the record is output.
+ *
+ *-----------------------------------------------------------------*/
+static int32 OS_Console_Stage(OS_console_internal_record_t *console, OS_console_staging_t *ring, const char *Format,
+                              const void *Data, size_t DataLen)
+{
+    OS_console_staged_hdr_t hdr;
+    uint32                  WritePos;
+    uint32                  Used;
+
+    memset(&hdr, 0, sizeof(hdr));
+    OS_GetLocalTime_Impl(&hdr.Timestamp);
+    hdr.Format = Format;
+    hdr.Length = DataLen;
+
+    WritePos = __atomic_load_n(&ring->WritePos, __ATOMIC_RELAXED);
+    Used     = WritePos - __atomic_load_n(&ring->ReadPos, __ATOMIC_ACQUIRE);
+
+    if ((sizeof(hdr) + DataLen) > (OS_PRINTF_STAGING_SIZE - Used))
+    {
+        /* the message did not fit */
+        __atomic_add_fetch(&console->OverflowEvents, 1, __ATOMIC_RELAXED);
+        return OS_QUEUE_FULL;
+    }
+
+    OS_Console_StagingCopyIn(ring, WritePos, &hdr, sizeof(hdr));
+    WritePos += sizeof(hdr);
+    OS_Console_StagingCopyIn(ring, WritePos, Data, DataLen);
+    WritePos += DataLen;
+
+    /* publish the complete record to the console task */
+    __atomic_store_n(&ring->WritePos, WritePos, __ATOMIC_RELEASE);
+
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *    Wake the console utility task, if not already woken
+ *
+ *    Any number of writes made before the utility task starts its drain
+ *    are covered by a single wakeup.  The exchange orders the staged record
+ *    before the flag, so the record is seen by the drain that clears it.
+ *
+ *-----------------------------------------------------------------*/
+static void OS_Console_Wakeup(const OS_object_token_t *token, OS_console_internal_record_t *console)
+{
+    if (!__atomic_exchange_n(&console->WakeupPending, true, __ATOMIC_ACQ_REL))
+    {
+        OS_ConsoleWakeup_Impl(token);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *    Append text to the console ring buffer
+ *
+ *    The caller must have already confirmed the console ring has space.
+ *
+ *-----------------------------------------------------------------*/
+static void OS_Console_Append(OS_console_internal_record_t *console, const char *Text, size_t Size)
+{
+    size_t WriteOffset;
+    size_t Chunk;
+
+    WriteOffset = console->WritePos;
+    Chunk       = console->BufSize - WriteOffset;
+    if (Chunk > Size)
+    {
+        Chunk = Size;
+    }
+
+    memcpy(&console->BufBase[WriteOffset], Text, Chunk);
+    memcpy(console->BufBase, Text + Chunk, Size - Chunk);
+
+    WriteOffset += Size;
+    if (WriteOffset >= console->BufSize)
+    {
+        WriteOffset -= console->BufSize;
+    }
+
+    console->WritePos = WriteOffset;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *    Move text from a staging ring into the console ring buffer
+ *
+ *    The caller must have already confirmed the console ring has space.
+ *
+ *-----------------------------------------------------------------*/
+static void OS_Console_StagingMove(OS_console_internal_record_t *console, const OS_console_staging_t *ring,
+                                   uint32 Pos, size_t Size)
+{
+    size_t ReadOffset;
+    size_t WriteOffset;
+    size_t Chunk;
+
+    WriteOffset = console->WritePos;
+    while (Size > 0)
+    {
+        ReadOffset = Pos & (OS_PRINTF_STAGING_SIZE - 1);
+
+        /* copy up to whichever of the two rings wraps first */
+        Chunk = Size;
+        if (Chunk > (OS_PRINTF_STAGING_SIZE - ReadOffset))
+        {
+            Chunk = OS_PRINTF_STAGING_SIZE - ReadOffset;
+        }
+        if (Chunk > (console->BufSize - WriteOffset))
+        {
+            Chunk = console->BufSize - WriteOffset;
+        }
+
+        memcpy(&console->BufBase[WriteOffset], &ring->Buffer[ReadOffset], Chunk);
+
+        Pos += Chunk;
+        Size -= Chunk;
+        WriteOffset += Chunk;
+        if (WriteOffset >= console->BufSize)
+        {
+            WriteOffset = 0;
+        }
+    }
+
+    console->WritePos = WriteOffset;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_ConsoleDrainStaging(const OS_object_token_t *token)
 {
-    int32                         return_code;
-    OS_object_token_t             token;
     OS_console_internal_record_t *console;
-    size_t                        PendingWritePos;
+    OS_console_staging_t *        ring;
+    OS_console_staging_t *        oldest;
+    OS_console_staged_hdr_t       hdr;
+    OS_console_staged_hdr_t       oldest_hdr;
+    OS_time_t                     now;
+    bool                          is_first;
+    uint32                        idx;
+    uint32                        DataPos;
+    size_t                        NameLen;
+    size_t                        ArgLen;
+    size_t                        TextLen;
+    size_t                        Avail;
+    int32                         return_code;
+    char                          ArgBuffer[OS_BUFFER_SIZE];
+    char                          TextBuffer[OS_BUFFER_SIZE];
 
-    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_GLOBAL, OS_OBJECT_TYPE_OS_CONSOLE, console_id, &token);
-    if (return_code == OS_SUCCESS)
+    console     = OS_OBJECT_TABLE_GET(OS_console_table, *token);
+    return_code = OS_SUCCESS;
+    is_first    = true;
+
+    memset(&oldest_hdr, 0, sizeof(oldest_hdr));
+    NameLen = strlen(console->device_name);
+
+    /*
+     * Records staged after this point need another wakeup.  The store is
+     * sequentially consistent so it is not reordered after the ring reads below.
+     */
+    __atomic_store_n(&console->WakeupPending, false, __ATOMIC_SEQ_CST);
+
+    /*
+     * Each pass moves the oldest record found at the head of any ring.
+     * Records within one ring are already in order, so the output follows
+     * the order in which records were stamped.  (The exception is a task
+     * that is preempted between stamping and publishing its record).
+     */
+    while (true)
     {
-        console = OS_OBJECT_TABLE_GET(OS_console_table, token);
+        oldest = NULL;
+        for (idx = 0; idx < OS_CONSOLE_STAGING_COUNT; ++idx)
+        {
+            ring = &OS_console_staging_table[idx];
+            if (__atomic_load_n(&ring->WritePos, __ATOMIC_ACQUIRE) != ring->ReadPos)
+            {
+                OS_Console_StagingCopyOut(ring, ring->ReadPos, &hdr, sizeof(hdr));
+                if (oldest == NULL || OS_TimeCompare(hdr.Timestamp, oldest_hdr.Timestamp) < 0)
+                {
+                    oldest     = ring;
+                    oldest_hdr = hdr;
+                }
+            }
+        }
 
-        /*
-         * The entire string should be put to the ring buffer,
-         * or none of it.  Therefore the WritePos in the table
-         * is not updated until complete success.
-         */
-        PendingWritePos = console->WritePos;
+        if (oldest == NULL)
+        {
+            break;
+        }
 
-        if (console->device_name[0] != 0)
+        if (is_first)
         {
-            return_code = OS_Console_CopyOut(console, console->device_name, &PendingWritePos);
+            /* The first record is the oldest, so its age is the latency of this drain */
+            OS_GetLocalTime_Impl(&now);
+            now = OS_TimeSubtract(now, oldest_hdr.Timestamp);
+            if (OS_TimeGetSign(now) < 0)
+            {
+                /* the clock was set back */
+                now = OS_TimeFromTotalNanoseconds(0);
+            }
+
+            /* OS_ConsoleGetStats() reads these without the lock, only this task writes them */
+            __atomic_store(&console->LastDrainLatency, &now, __ATOMIC_RELAXED);
+            if (OS_TimeCompare(now, console->MaxDrainLatency) > 0)
+            {
+                __atomic_store(&console->MaxDrainLatency, &now, __ATOMIC_RELAXED);
+            }
+            __atomic_add_fetch(&console->DrainCount, 1, __ATOMIC_RELAXED);
+            is_first = false;
         }
-        if (return_code == OS_SUCCESS)
+
+        DataPos = oldest->ReadPos + sizeof(oldest_hdr);
+        if (oldest_hdr.Format != NULL)
         {
-            return_code = OS_Console_CopyOut(console, Str, &PendingWritePos);
+            /* the caller deferred the formatting, so it is done now */
+            ArgLen = oldest_hdr.Length;
+            if (ArgLen > sizeof(ArgBuffer))
+            {
+                ArgLen = sizeof(ArgBuffer);
+            }
+            OS_Console_StagingCopyOut(oldest, DataPos, ArgBuffer, ArgLen);
+            TextLen = OS_Printf_FormatArgs(TextBuffer, sizeof(TextBuffer), oldest_hdr.Format, ArgBuffer, ArgLen);
+        }
+        else
+        {
+            TextLen = oldest_hdr.Length;
         }
 
-        if (return_code == OS_SUCCESS)
+        /* One byte of the console ring is always left free, so that full and empty differ */
+        Avail = (console->ReadPos + console->BufSize - console->WritePos - 1) % console->BufSize;
+        if ((NameLen + TextLen) <= Avail)
         {
-            /* the entire message was successfully written */
-            console->WritePos = PendingWritePos;
+            OS_Console_Append(console, console->device_name, NameLen);
+            if (oldest_hdr.Format != NULL)
+            {
+                OS_Console_Append(console, TextBuffer, TextLen);
+            }
+            else
+            {
+                OS_Console_StagingMove(console, oldest, DataPos, TextLen);
+            }
+        }
+        else if ((NameLen + TextLen) < console->BufSize)
+        {
+            /* this will fit once the console ring is written out, so leave it staged */
+            return_code = OS_QUEUE_FULL;
+            break;
         }
         else
         {
-            /* the message did not fit */
-            ++console->OverflowEvents;
+            /* this can never fit, so discard it */
+            __atomic_add_fetch(&console->OverflowEvents, 1, __ATOMIC_RELAXED);
         }
 
-        /*
-         * Notify the underlying console implementation of new data.
-         * This will forward the data to the actual console device.
-         *
-         * This is done while still locked, so it can support
-         * either a synchronous or asynchronous implementation.
-         */
+        __atomic_store_n(&oldest->ReadPos, DataPos + oldest_hdr.Length, __ATOMIC_RELEASE);
+    }
+
+    return return_code;
+}
+
+/*
+ *********************************************************************************
+ *          PUBLIC API (application-callable functions)
+ *********************************************************************************
+ */
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Write a text or deferred format record to the console
+ *
+ *    If Format is NULL, Data is the text to write (with terminator).
+ *    Otherwise Data holds the arguments captured for that format string.
+ *
+ *-----------------------------------------------------------------*/
+static int32 OS_Console_WriteRecord(osal_id_t console_id, const char *Format, const void *Data, size_t DataLen)
+{
+    int32                         return_code;
+    OS_object_token_t             token;
+    OS_console_internal_record_t *console;
+    size_t                        PendingWritePos;
+    osal_index_t                  task_idx;
+    const char *                  Str;
+    char                          msg_buffer[OS_BUFFER_SIZE];
+
+    /*
+     * An OSAL task writing to an async console only uses its own
+     * staging ring, so this path does not lock the console at all.
+     */
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_NONE, OS_OBJECT_TYPE_OS_CONSOLE, console_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        console = OS_OBJECT_TABLE_GET(OS_console_table, token);
+
+        if (console->IsAsync &&
+            OS_ObjectIdToArrayIndex(OS_OBJECT_TYPE_OS_TASK, OS_TaskGetId_Impl(), &task_idx) == OS_SUCCESS)
+        {
+            return_code = OS_Console_Stage(console, &OS_console_staging_table[task_idx], Format, Data, DataLen);
+
+            /* wake the utility task to run */
+            OS_Console_Wakeup(&token, console);
+
+            return return_code;
+        }
+    }
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_GLOBAL, OS_OBJECT_TYPE_OS_CONSOLE, console_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        console = OS_OBJECT_TABLE_GET(OS_console_table, token);
+
         if (console->IsAsync)
         {
-            /* post the sem for the utility task to run */
-            OS_ConsoleWakeup_Impl(&token);
+            /*
+             * Other callers share the last staging ring.  The console lock
+             * makes them a single producer, and the utility task does not
+             * need the lock to consume it.
+             */
+            return_code = OS_Console_Stage(console, &OS_console_staging_table[OS_CONSOLE_STAGING_COUNT - 1], Format,
+                                           Data, DataLen);
+
+            /* wake the utility task to run */
+            OS_Console_Wakeup(&token, console);
         }
         else
         {
-            /* output directly */
+            if (Format != NULL)
+            {
+                /* there is no utility task, so format it now */
+                OS_Printf_FormatArgs(msg_buffer, sizeof(msg_buffer), Format, Data, DataLen);
+                Str = msg_buffer;
+            }
+            else
+            {
+                Str = Data;
+            }
+
+            /*
+             * The entire string should be put to the ring buffer,
+             * or none of it.  Therefore the WritePos in the table
+             * is not updated until complete success.
+             */
+            PendingWritePos = console->WritePos;
+
+            if (console->device_name[0] != 0)
+            {
+                return_code = OS_Console_CopyOut(console, console->device_name, &PendingWritePos);
+            }
+            if (return_code == OS_SUCCESS)
+            {
+                return_code = OS_Console_CopyOut(console, Str, &PendingWritePos);
+            }
+
+            if (return_code == OS_SUCCESS)
+            {
+                /* the entire message was successfully written */
+                console->WritePos = PendingWritePos;
+            }
+            else
+            {
+                /* the message did not fit */
+                ++console->OverflowEvents;
+            }
+
+            /* output directly, while still locked */
             OS_ConsoleOutput_Impl(&token);
         }
 
@@ -254,6 +1223,17 @@ int32 OS_ConsoleWrite(osal_id_t console_id, const char *Str)
     return return_code;
 }
 
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Write into the console ring buffer
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_ConsoleWrite(osal_id_t console_id, const char *Str)
+{
+    return OS_Console_WriteRecord(console_id, NULL, Str, strlen(Str));
+}
+
 /*----------------------------------------------------------------
  *
  *  Purpose: Implemented per public OSAL API
@@ -265,6 +1245,7 @@ void OS_printf(const char *String, ...)
     va_list va;
     char    msg_buffer[OS_BUFFER_SIZE];
     int     actualsz;
+    size_t  argsz;
 
     BUGCHECK_VOID(String != NULL)
 
@@ -289,6 +1270,18 @@ void OS_printf(const char *String, ...)
          */
         OS_DEBUG("BUG: OS_printf() called when OSAL not initialized: %s", String);
     }
+    else if (OS_SharedGlobalVars.PrintfEnabled && OS_SharedGlobalVars.PrintfDeferred)
+    {
+        /*
+         * Only capture the arguments, the console utility task will do the
+         * formatting.  This requires that the format string remains valid.
+         */
+        va_start(va, String);
+        argsz = OS_Printf_CaptureArgs(msg_buffer, sizeof(msg_buffer), String, va);
+        va_end(va);
+
+        OS_Console_WriteRecord(OS_SharedGlobalVars.PrintfConsoleId, String, msg_buffer, argsz);
+    }
     else if (OS_SharedGlobalVars.PrintfEnabled)
     {
         /* Format and determine the size of string to write */
@@ -334,3 +1327,37 @@ void OS_printf_enable(void)
 {
     OS_SharedGlobalVars.PrintfEnabled = true;
 }
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_ConsoleGetStats(OS_console_stats_t *stats)
+{
+    int32                         return_code;
+    OS_object_token_t             token;
+    OS_console_internal_record_t *console;
+
+    /* Check parameters */
+    OS_CHECK_POINTER(stats);
+
+    return_code =
+        OS_ObjectIdGetById(OS_LOCK_MODE_GLOBAL, OS_OBJECT_TYPE_OS_CONSOLE, OS_SharedGlobalVars.PrintfConsoleId, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        console = OS_OBJECT_TABLE_GET(OS_console_table, token);
+
+        memset(stats, 0, sizeof(*stats));
+        stats->OverflowEvents   = __atomic_load_n(&console->OverflowEvents, __ATOMIC_RELAXED);
+        stats->DrainCount       = __atomic_load_n(&console->DrainCount, __ATOMIC_RELAXED);
+        stats->BytesWritten     = __atomic_load_n(&console->BytesWritten, __ATOMIC_RELAXED);
+        __atomic_load(&console->LastDrainLatency, &stats->LastDrainLatency, __ATOMIC_RELAXED);
+        __atomic_load(&console->MaxDrainLatency, &stats->MaxDrainLatency, __ATOMIC_RELAXED);
+
+        OS_ObjectIdRelease(&token);
+    }
+
+    return return_code;
+}
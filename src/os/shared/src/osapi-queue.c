@@ -33,7 +33,6 @@
                                     INCLUDE FILES
  ***************************************************************************************/
 #include <stdio.h>
-#include <stdlib.h>
 #include <string.h>
 #include <time.h>
 
@@ -51,6 +50,10 @@
 #error "osconfig.h must define OS_MAX_QUEUES to a valid value"
 #endif
 
+#if !defined(OS_QUEUE_ZEROCOPY_SLOTS) || (OS_QUEUE_ZEROCOPY_SLOTS <= 0)
+#error "osconfig.h must define OS_QUEUE_ZEROCOPY_SLOTS to a valid value"
+#endif
+
 enum
 {
     LOCAL_NUM_OBJECTS = OS_MAX_QUEUES,
@@ -59,6 +62,131 @@ enum
 
 OS_queue_internal_record_t OS_queue_table[LOCAL_NUM_OBJECTS];
 
+/****************************************************************************************
+                                ZERO-COPY BUFFERS
+ ***************************************************************************************/
+
+/*
+ * Where the implementation cannot give access to the queue storage, the
+ * zero-copy operations use the preallocated buffers of the queue instead, and
+ * the message is copied between the buffer and the queue.  The buffer states
+ * are only changed while holding the global lock, but the copy itself is done
+ * without the lock as the buffer is then owned by the calling task.
+ */
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Takes a free zero-copy buffer of a queue, and sets it to "new_state"
+ *
+ *  For OS_QUEUE_SLOT_RESERVED this also fails with OS_QUEUE_FULL if
+ *  the queue would not have room for the message once committed.
+ *
+ *-----------------------------------------------------------------*/
+static int32 OS_QueueSlotTake(osal_id_t queue_id, uint8 new_state, OS_queue_slot_t **slot_out)
+{
+    OS_object_token_t           token;
+    OS_queue_internal_record_t *queue;
+    OS_queue_slot_t *           slot;
+    OS_queue_prop_t             queue_prop;
+    uint32                      reserved;
+    uint32                      i;
+    int32                       return_code;
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_GLOBAL, LOCAL_OBJID_TYPE, queue_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        queue = OS_OBJECT_TABLE_GET(OS_queue_table, token);
+
+        slot     = NULL;
+        reserved = 0;
+        for (i = 0; i < OS_QUEUE_ZEROCOPY_SLOTS; ++i)
+        {
+            if (queue->slots[i].state == OS_QUEUE_SLOT_FREE)
+            {
+                if (slot == NULL)
+                {
+                    slot = &queue->slots[i];
+                }
+            }
+            else if (queue->slots[i].state != OS_QUEUE_SLOT_BORROWED)
+            {
+                /* reserved or being committed, so will take space in the queue */
+                ++reserved;
+            }
+        }
+
+        if (slot == NULL)
+        {
+            return_code = OS_QUEUE_FULL;
+        }
+        else if (new_state == OS_QUEUE_SLOT_RESERVED)
+        {
+            /* the depth is only known if the implementation keeps it, otherwise it is zero */
+            memset(&queue_prop, 0, sizeof(queue_prop));
+            queue_prop.max_depth = queue->max_depth;
+            if (OS_QueueGetInfo_Impl(&token, &queue_prop) == OS_SUCCESS &&
+                (queue_prop.depth + reserved) >= queue->max_depth)
+            {
+                return_code = OS_QUEUE_FULL;
+            }
+        }
+
+        if (return_code == OS_SUCCESS)
+        {
+            slot->state = new_state;
+            *slot_out   = slot;
+        }
+
+        OS_ObjectIdRelease(&token);
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Changes the state of a zero-copy buffer of a queue
+ *
+ *  Returns OS_INVALID_POINTER if the buffer is not one of the queue, or
+ *  if it is not in "old_state" (for instance if it was already released).
+ *
+ *-----------------------------------------------------------------*/
+static int32 OS_QueueSlotChange(osal_id_t queue_id, const void *buffer, uint8 old_state, uint8 new_state,
+                                OS_queue_slot_t **slot_out)
+{
+    OS_object_token_t           token;
+    OS_queue_internal_record_t *queue;
+    uint32                      i;
+    int32                       return_code;
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_GLOBAL, LOCAL_OBJID_TYPE, queue_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        queue = OS_OBJECT_TABLE_GET(OS_queue_table, token);
+
+        return_code = OS_INVALID_POINTER;
+        for (i = 0; i < OS_QUEUE_ZEROCOPY_SLOTS; ++i)
+        {
+            if (buffer == queue->slots[i].u.data)
+            {
+                if (queue->slots[i].state == old_state)
+                {
+                    queue->slots[i].state = new_state;
+                    *slot_out             = &queue->slots[i];
+                    return_code           = OS_SUCCESS;
+                }
+                break;
+            }
+        }
+
+        OS_ObjectIdRelease(&token);
+    }
+
+    return return_code;
+}
+
 /****************************************************************************************
                                 MESSAGE QUEUE API
  ***************************************************************************************/
@@ -215,6 +343,329 @@ int32 OS_QueuePut(osal_id_t queue_id, const void *data, size_t size, uint32 flag
     return return_code;
 }
 
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueueReserve(osal_id_t queue_id, void **buffer)
+{
+    OS_object_token_t           token;
+    int32                       return_code;
+    OS_queue_internal_record_t *queue;
+    OS_queue_slot_t *           slot;
+
+    /* Check Parameters */
+    OS_CHECK_POINTER(buffer);
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_NONE, LOCAL_OBJID_TYPE, queue_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        return_code = OS_QueueReserve_Impl(&token, buffer);
+        if (return_code == OS_ERR_NOT_IMPLEMENTED)
+        {
+            /*
+            ** The queue storage cannot be accessed directly, so supply one of
+            ** the buffers of the queue instead, which is copied into the queue on commit
+            */
+            queue = OS_OBJECT_TABLE_GET(OS_queue_table, token);
+            if (queue->max_size > OS_QUEUE_ZEROCOPY_SLOT_SIZE)
+            {
+                return_code = OS_QUEUE_INVALID_SIZE;
+            }
+            else
+            {
+                return_code = OS_QueueSlotTake(queue_id, OS_QUEUE_SLOT_RESERVED, &slot);
+                if (return_code == OS_SUCCESS)
+                {
+                    *buffer = slot->u.data;
+                }
+            }
+        }
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueueCommit(osal_id_t queue_id, void *buffer, size_t size)
+{
+    OS_object_token_t           token;
+    int32                       return_code;
+    OS_queue_internal_record_t *queue;
+    OS_queue_slot_t *           slot;
+
+    /* Check Parameters */
+    OS_CHECK_POINTER(buffer);
+    OS_CHECK_SIZE(size);
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_NONE, LOCAL_OBJID_TYPE, queue_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        queue = OS_OBJECT_TABLE_GET(OS_queue_table, token);
+
+        if (size > queue->max_size)
+        {
+            /*
+            ** The message is larger than the buffer that was reserved
+            */
+            return_code = OS_QUEUE_INVALID_SIZE;
+        }
+        else
+        {
+            return_code = OS_QueueCommit_Impl(&token, buffer, size);
+            if (return_code == OS_ERR_NOT_IMPLEMENTED)
+            {
+                /* This must be a buffer of the queue from OS_QueueReserve(), which is not yet committed */
+                return_code = OS_QueueSlotChange(queue_id, buffer, OS_QUEUE_SLOT_RESERVED, OS_QUEUE_SLOT_BUSY, &slot);
+                if (return_code == OS_SUCCESS)
+                {
+                    return_code = OS_QueuePut_Impl(&token, slot->u.data, size, 0);
+                    OS_QueueSlotChange(queue_id, slot->u.data, OS_QUEUE_SLOT_BUSY, OS_QUEUE_SLOT_FREE, &slot);
+                }
+            }
+        }
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueueBorrow(osal_id_t queue_id, const void **buffer, size_t *size_copied, int32 timeout)
+{
+    OS_object_token_t           token;
+    int32                       return_code;
+    OS_queue_internal_record_t *queue;
+    OS_queue_slot_t *           slot;
+
+    /* Check Parameters */
+    OS_CHECK_POINTER(buffer);
+    OS_CHECK_POINTER(size_copied);
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_NONE, LOCAL_OBJID_TYPE, queue_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        return_code = OS_QueueBorrow_Impl(&token, buffer, size_copied, timeout);
+        if (return_code == OS_ERR_NOT_IMPLEMENTED)
+        {
+            /*
+            ** The queue storage cannot be accessed directly, so receive
+            ** the message into one of the buffers of the queue instead
+            */
+            *size_copied = 0;
+            queue        = OS_OBJECT_TABLE_GET(OS_queue_table, token);
+            if (queue->max_size > OS_QUEUE_ZEROCOPY_SLOT_SIZE)
+            {
+                return_code = OS_QUEUE_INVALID_SIZE;
+            }
+            else if (OS_QueueSlotTake(queue_id, OS_QUEUE_SLOT_BUSY, &slot) != OS_SUCCESS)
+            {
+                /* all buffers are already in use */
+                return_code = OS_ERROR;
+            }
+            else
+            {
+                return_code = OS_QueueGet_Impl(&token, slot->u.data, queue->max_size, size_copied, timeout);
+                if (return_code == OS_SUCCESS)
+                {
+                    *buffer = slot->u.data;
+                    OS_QueueSlotChange(queue_id, slot->u.data, OS_QUEUE_SLOT_BUSY, OS_QUEUE_SLOT_BORROWED, &slot);
+                }
+                else
+                {
+                    OS_QueueSlotChange(queue_id, slot->u.data, OS_QUEUE_SLOT_BUSY, OS_QUEUE_SLOT_FREE, &slot);
+                }
+            }
+        }
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueueRelease(osal_id_t queue_id, const void *buffer)
+{
+    OS_object_token_t token;
+    int32             return_code;
+    OS_queue_slot_t * slot;
+
+    /* Check Parameters */
+    OS_CHECK_POINTER(buffer);
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_NONE, LOCAL_OBJID_TYPE, queue_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        return_code = OS_QueueRelease_Impl(&token, buffer);
+        if (return_code == OS_ERR_NOT_IMPLEMENTED)
+        {
+            /* This must be a buffer of the queue from OS_QueueBorrow(), which is not yet released */
+            return_code = OS_QueueSlotChange(queue_id, buffer, OS_QUEUE_SLOT_BORROWED, OS_QUEUE_SLOT_FREE, &slot);
+        }
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueueGetMulti(osal_id_t queue_id, void *const *data, size_t size, size_t *size_copied, uint32 count,
+                       uint32 *count_copied, int32 timeout)
+{
+    OS_object_token_t           token;
+    int32                       return_code;
+    OS_queue_internal_record_t *queue;
+    uint32                      i;
+
+    /* Check Parameters */
+    OS_CHECK_POINTER(data);
+    OS_CHECK_POINTER(size_copied);
+    OS_CHECK_POINTER(count_copied);
+    OS_CHECK_SIZE(size);
+    OS_CHECK_SIZE(count);
+
+    for (i = 0; i < count; ++i)
+    {
+        OS_CHECK_POINTER(data[i]);
+    }
+
+    *count_copied = 0;
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_NONE, LOCAL_OBJID_TYPE, queue_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        queue = OS_OBJECT_TABLE_GET(OS_queue_table, token);
+
+        if (size < queue->max_size)
+        {
+            /*
+            ** The buffers that the user is passing in are potentially too small
+            */
+            return_code = OS_QUEUE_INVALID_SIZE;
+        }
+        else
+        {
+            return_code = OS_QueueGetMulti_Impl(&token, data, size, size_copied, count, count_copied, timeout);
+            if (return_code == OS_ERR_NOT_IMPLEMENTED)
+            {
+                /*
+                ** Receive the messages one at a time, only waiting for the first
+                */
+                for (i = 0; i < count; ++i)
+                {
+                    return_code =
+                        OS_QueueGet_Impl(&token, data[i], size, &size_copied[i], (i == 0) ? timeout : OS_CHECK);
+                    if (return_code != OS_SUCCESS)
+                    {
+                        break;
+                    }
+                }
+
+                *count_copied = i;
+                if (i > 0)
+                {
+                    return_code = OS_SUCCESS;
+                }
+            }
+        }
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueuePutMulti(osal_id_t queue_id, const void *const *data, const size_t *size, uint32 count,
+                       uint32 *count_put, uint32 flags)
+{
+    OS_object_token_t           token;
+    int32                       return_code;
+    OS_queue_internal_record_t *queue;
+    uint32                      i;
+
+    /* Check Parameters */
+    OS_CHECK_POINTER(data);
+    OS_CHECK_POINTER(size);
+    OS_CHECK_POINTER(count_put);
+    OS_CHECK_SIZE(count);
+
+    for (i = 0; i < count; ++i)
+    {
+        OS_CHECK_POINTER(data[i]);
+        OS_CHECK_SIZE(size[i]);
+    }
+
+    *count_put = 0;
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_NONE, LOCAL_OBJID_TYPE, queue_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        queue = OS_OBJECT_TABLE_GET(OS_queue_table, token);
+
+        for (i = 0; i < count; ++i)
+        {
+            if (size[i] > queue->max_size)
+            {
+                /*
+                ** One of the buffers that the user is passing in is too large
+                */
+                return_code = OS_QUEUE_INVALID_SIZE;
+                break;
+            }
+        }
+
+        if (return_code == OS_SUCCESS)
+        {
+            return_code = OS_QueuePutMulti_Impl(&token, data, size, count, count_put, flags);
+            if (return_code == OS_ERR_NOT_IMPLEMENTED)
+            {
+                /*
+                ** Put the messages one at a time, stopping when the queue is full
+                */
+                for (i = 0; i < count; ++i)
+                {
+                    return_code = OS_QueuePut_Impl(&token, data[i], size[i], flags);
+                    if (return_code != OS_SUCCESS)
+                    {
+                        break;
+                    }
+                }
+
+                *count_put = i;
+                if (i > 0)
+                {
+                    return_code = OS_SUCCESS;
+                }
+            }
+        }
+    }
+
+    return return_code;
+}
+
 /*----------------------------------------------------------------
  *
  *  Purpose: Implemented per public OSAL API
@@ -242,9 +693,10 @@ int32 OS_QueueGetIdByName(osal_id_t *queue_id, const char *queue_name)
  *-----------------------------------------------------------------*/
 int32 OS_QueueGetInfo(osal_id_t queue_id, OS_queue_prop_t *queue_prop)
 {
-    OS_common_record_t *record;
-    int32               return_code;
-    OS_object_token_t   token;
+    OS_common_record_t *        record;
+    OS_queue_internal_record_t *queue;
+    int32                       return_code;
+    OS_object_token_t           token;
 
     /* Check parameters */
     OS_CHECK_POINTER(queue_prop);
@@ -255,14 +707,15 @@ int32 OS_QueueGetInfo(osal_id_t queue_id, OS_queue_prop_t *queue_prop)
     if (return_code == OS_SUCCESS)
     {
         record = OS_OBJECT_TABLE_GET(OS_global_queue_table, token);
+        queue  = OS_OBJECT_TABLE_GET(OS_queue_table, token);
 
         strncpy(queue_prop->name, record->name_entry, sizeof(queue_prop->name) - 1);
-        queue_prop->creator = record->creator;
+        queue_prop->creator   = record->creator;
+        queue_prop->max_depth = queue->max_depth;
+        queue_prop->max_size  = queue->max_size;
 
-        /*
-         * Currently there are no additional queue details provided by the impl layer -
-         * But this could be added in the future (i.e. current/max depth, msg size, etc)
-         */
+        /* The impl layer provides the current depth and message statistics, if it keeps them */
+        return_code = OS_QueueGetInfo_Impl(&token, queue_prop);
 
         OS_ObjectIdRelease(&token);
     }
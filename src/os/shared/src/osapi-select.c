@@ -42,6 +42,16 @@
 #include "os-shared-idmap.h"
 #include "os-shared-select.h"
 
+/*
+ * Sanity checks on the user-supplied configuration
+ * The relevant OS_MAX limit should be defined and greater than zero
+ */
+#if !defined(OS_MAX_SELECT_GROUPS) || (OS_MAX_SELECT_GROUPS <= 0)
+#error "osconfig.h must define OS_MAX_SELECT_GROUPS to a valid value"
+#endif
+
+OS_selgroup_internal_record_t OS_selgroup_table[OS_MAX_SELECT_GROUPS];
+
 /*
  *********************************************************************************
  *          SELECT API
@@ -219,3 +229,191 @@ bool OS_SelectFdIsSet(const OS_FdSet *Set, osal_id_t objid)
      */
     return ((Set->object_ids[local_id >> 3] >> (local_id & 0x7)) & 0x1);
 }
+
+/*
+ *********************************************************************************
+ *          SELECT GROUP API
+ *********************************************************************************
+ */
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Init function for OS-independent layer
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_SelectGroupAPI_Init(void)
+{
+    memset(OS_selgroup_table, 0, sizeof(OS_selgroup_table));
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_SelectGroupCreate(osal_id_t *group_id, const char *group_name, uint32 options)
+{
+    int32                          return_code;
+    OS_object_token_t              token;
+    OS_selgroup_internal_record_t *selgroup;
+
+    /* Check parameters */
+    OS_CHECK_POINTER(group_id);
+    OS_CHECK_APINAME(group_name);
+
+    /* Note - the common ObjectIdAllocate routine will lock the object type and leave it locked. */
+    return_code = OS_ObjectIdAllocateNew(OS_OBJECT_TYPE_OS_SELGROUP, group_name, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        selgroup = OS_OBJECT_TABLE_GET(OS_selgroup_table, token);
+
+        /* Reset the table entry and save the name */
+        OS_OBJECT_INIT(token, selgroup, obj_name, group_name);
+
+        /* Now call the OS-specific implementation.  This reads info from the table. */
+        return_code = OS_SelectGroupCreate_Impl(&token, options);
+
+        /* Check result, finalize record, and unlock global table. */
+        return_code = OS_ObjectIdFinalizeNew(return_code, &token, group_id);
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_SelectGroupDelete(osal_id_t group_id)
+{
+    OS_object_token_t token;
+    int32             return_code;
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_EXCLUSIVE, OS_OBJECT_TYPE_OS_SELGROUP, group_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        return_code = OS_SelectGroupDelete_Impl(&token);
+
+        /* Complete the operation via the common routine */
+        return_code = OS_ObjectIdFinalizeDelete(return_code, &token);
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_SelectGroupAdd(osal_id_t group_id, osal_id_t objid, uint32 StateFlags)
+{
+    OS_object_token_t token;
+    OS_object_token_t stream_token;
+    int32             return_code;
+
+    /* Check parameters */
+    ARGCHECK((StateFlags & (OS_STREAM_STATE_READABLE | OS_STREAM_STATE_WRITABLE)) != 0, OS_ERR_INVALID_ARGUMENT);
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, OS_OBJECT_TYPE_OS_SELGROUP, group_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, OS_OBJECT_TYPE_OS_STREAM, objid, &stream_token);
+        if (return_code == OS_SUCCESS)
+        {
+            return_code = OS_SelectGroupAdd_Impl(&token, &stream_token,
+                                                 StateFlags & (OS_STREAM_STATE_READABLE | OS_STREAM_STATE_WRITABLE));
+
+            OS_ObjectIdRelease(&stream_token);
+        }
+
+        OS_ObjectIdRelease(&token);
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_SelectGroupRemove(osal_id_t group_id, osal_id_t objid)
+{
+    OS_object_token_t token;
+    OS_object_token_t stream_token;
+    int32             return_code;
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, OS_OBJECT_TYPE_OS_SELGROUP, group_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, OS_OBJECT_TYPE_OS_STREAM, objid, &stream_token);
+        if (return_code == OS_SUCCESS)
+        {
+            return_code = OS_SelectGroupRemove_Impl(&token, &stream_token);
+
+            OS_ObjectIdRelease(&stream_token);
+        }
+
+        OS_ObjectIdRelease(&token);
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_SelectGroupWait(osal_id_t group_id, OS_SelectGroupEvent_t *Events, uint32 MaxEvents, uint32 *EventCount,
+                         int32 msecs)
+{
+    OS_object_token_t token;
+    int32             return_code;
+
+    /* Check parameters */
+    OS_CHECK_POINTER(Events);
+    OS_CHECK_POINTER(EventCount);
+    OS_CHECK_SIZE(MaxEvents);
+
+    *EventCount = 0;
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, OS_OBJECT_TYPE_OS_SELGROUP, group_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        return_code = OS_SelectGroupWait_Impl(&token, Events, MaxEvents, EventCount,
+                                              OS_TimeFromRelativeMilliseconds(msecs));
+
+        OS_ObjectIdRelease(&token);
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_SelectGroupGetIdByName(osal_id_t *group_id, const char *group_name)
+{
+    int32 return_code;
+
+    /* Check parameters */
+    OS_CHECK_POINTER(group_id);
+    OS_CHECK_POINTER(group_name);
+
+    return_code = OS_ObjectIdFindByName(OS_OBJECT_TYPE_OS_SELGROUP, group_name, group_id);
+
+    return return_code;
+}
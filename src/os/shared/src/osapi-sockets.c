@@ -577,6 +577,169 @@ int32 OS_SocketSendTo(osal_id_t sock_id, const void *buffer, size_t buflen, cons
     return return_code;
 }
 
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_SocketSendToV(osal_id_t sock_id, const OS_iovec_t *iov, uint32 iovcnt, const OS_SockAddr_t *RemoteAddr)
+{
+    OS_stream_internal_record_t *stream;
+    OS_object_token_t            token;
+    int32                        return_code;
+
+    /* Check Parameters */
+    OS_CHECK_POINTER(RemoteAddr);
+
+    return_code = OS_IoVecCheck(iov, iovcnt);
+    if (return_code != OS_SUCCESS)
+    {
+        return return_code;
+    }
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, LOCAL_OBJID_TYPE, sock_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        stream = OS_OBJECT_TABLE_GET(OS_stream_table, token);
+
+        if (stream->socket_type != OS_SocketType_DATAGRAM)
+        {
+            return_code = OS_ERR_INCORRECT_OBJ_TYPE;
+        }
+        else
+        {
+            return_code = OS_SocketSendToV_Impl(&token, iov, iovcnt, RemoteAddr);
+        }
+
+        OS_ObjectIdRelease(&token);
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Validates a batch of message descriptors, and limits the
+ *           count to the number which may be transferred in one call.
+ *
+ *-----------------------------------------------------------------*/
+static int32 OS_SocketMsgCheck(const OS_SockMsg_t *Msgs, uint32 *MsgCount)
+{
+    uint32 i;
+
+    OS_CHECK_POINTER(Msgs);
+    ARGCHECK(*MsgCount > 0, OS_ERR_INVALID_SIZE);
+
+    if (*MsgCount > OS_SOCKET_MSG_MAX)
+    {
+        *MsgCount = OS_SOCKET_MSG_MAX;
+    }
+
+    for (i = 0; i < *MsgCount; ++i)
+    {
+        OS_CHECK_POINTER(Msgs[i].Buffer);
+        OS_CHECK_SIZE(Msgs[i].BufSize);
+    }
+
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_SocketRecvFromMultiAbs(osal_id_t sock_id, OS_SockMsg_t *Msgs, uint32 MsgCount, OS_time_t abs_timeout)
+{
+    OS_stream_internal_record_t *stream;
+    OS_object_token_t            token;
+    int32                        return_code;
+
+    /* Check Parameters */
+    return_code = OS_SocketMsgCheck(Msgs, &MsgCount);
+    if (return_code != OS_SUCCESS)
+    {
+        return return_code;
+    }
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, LOCAL_OBJID_TYPE, sock_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        stream = OS_OBJECT_TABLE_GET(OS_stream_table, token);
+
+        if (stream->socket_type != OS_SocketType_DATAGRAM)
+        {
+            return_code = OS_ERR_INCORRECT_OBJ_TYPE;
+        }
+        else if ((stream->stream_state & OS_STREAM_STATE_BOUND) == 0)
+        {
+            /* Socket needs to be bound first */
+            return_code = OS_ERR_INCORRECT_OBJ_STATE;
+        }
+        else
+        {
+            return_code = OS_SocketRecvFromMulti_Impl(&token, Msgs, MsgCount, abs_timeout);
+        }
+
+        OS_ObjectIdRelease(&token);
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_SocketRecvFromMulti(osal_id_t sock_id, OS_SockMsg_t *Msgs, uint32 MsgCount, int32 timeout)
+{
+    return OS_SocketRecvFromMultiAbs(sock_id, Msgs, MsgCount, OS_TimeFromRelativeMilliseconds(timeout));
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_SocketSendToMulti(osal_id_t sock_id, OS_SockMsg_t *Msgs, uint32 MsgCount)
+{
+    OS_stream_internal_record_t *stream;
+    OS_object_token_t            token;
+    int32                        return_code;
+
+    /* Check Parameters */
+    return_code = OS_SocketMsgCheck(Msgs, &MsgCount);
+    if (return_code != OS_SUCCESS)
+    {
+        return return_code;
+    }
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, LOCAL_OBJID_TYPE, sock_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        stream = OS_OBJECT_TABLE_GET(OS_stream_table, token);
+
+        if (stream->socket_type != OS_SocketType_DATAGRAM)
+        {
+            return_code = OS_ERR_INCORRECT_OBJ_TYPE;
+        }
+        else
+        {
+            return_code = OS_SocketSendToMulti_Impl(&token, Msgs, MsgCount);
+        }
+
+        OS_ObjectIdRelease(&token);
+    }
+
+    return return_code;
+}
+
 /*----------------------------------------------------------------
  *
  *  Purpose: Implemented per public OSAL API
@@ -94,10 +94,7 @@ static int32 OS_DoTimerAdd(osal_id_t *timer_id, const char *timer_name, osal_id_
     osal_objtype_t                 objtype;
     OS_object_token_t              timebase_token;
     OS_object_token_t              timecb_token;
-    OS_object_token_t              listcb_token;
     OS_timecb_internal_record_t *  timecb;
-    OS_timecb_internal_record_t *  list_timecb;
-    OS_timebase_internal_record_t *timebase;
 
     /*
      * Check parameters
@@ -134,8 +131,7 @@ static int32 OS_DoTimerAdd(osal_id_t *timer_id, const char *timer_name, osal_id_
     return_code = OS_ObjectIdAllocateNew(OS_OBJECT_TYPE_OS_TIMECB, timer_name, &timecb_token);
     if (return_code == OS_SUCCESS)
     {
-        timecb   = OS_OBJECT_TABLE_GET(OS_timecb_table, timecb_token);
-        timebase = OS_OBJECT_TABLE_GET(OS_timebase_table, timebase_token);
+        timecb = OS_OBJECT_TABLE_GET(OS_timecb_table, timecb_token);
 
         /* Reset the table entry and save the name */
         OS_OBJECT_INIT(timecb_token, timecb, timer_name, timer_name);
@@ -150,35 +146,11 @@ static int32 OS_DoTimerAdd(osal_id_t *timer_id, const char *timer_name, osal_id_
         timecb->callback_ptr = callback_ptr;
         timecb->callback_arg = callback_arg;
         timecb->flags        = flags;
-        timecb->prev_cb      = OS_ObjectIdFromToken(&timecb_token);
-        timecb->next_cb      = OS_ObjectIdFromToken(&timecb_token);
 
         /*
-         * Now we need to add it to the time base callback ring, so take the
-         * timebase-specific lock to prevent a tick from being processed at this moment.
+         * The new callback is not placed on the time base schedule here;
+         * it remains idle until it is armed via OS_TimerSet().
          */
-        OS_TimeBaseLock_Impl(&timebase_token);
-
-        if (OS_ObjectIdGetById(OS_LOCK_MODE_NONE, OS_OBJECT_TYPE_OS_TIMECB, timebase->first_cb, &listcb_token) ==
-            OS_SUCCESS)
-        {
-            list_timecb = OS_OBJECT_TABLE_GET(OS_timecb_table, listcb_token);
-
-            timecb->next_cb = OS_ObjectIdFromToken(&listcb_token);
-            timecb->prev_cb = list_timecb->prev_cb;
-
-            if (OS_ObjectIdGetById(OS_LOCK_MODE_NONE, OS_OBJECT_TYPE_OS_TIMECB, timecb->prev_cb, &listcb_token) ==
-                OS_SUCCESS)
-            {
-                list_timecb->prev_cb = OS_ObjectIdFromToken(&timecb_token);
-                list_timecb          = OS_OBJECT_TABLE_GET(OS_timecb_table, listcb_token);
-                list_timecb->next_cb = OS_ObjectIdFromToken(&timecb_token);
-            }
-        }
-
-        timebase->first_cb = OS_ObjectIdFromToken(&timecb_token);
-
-        OS_TimeBaseUnlock_Impl(&timebase_token);
 
         /* Check result, finalize record, and unlock global table. */
         return_code = OS_ObjectIdFinalizeNew(return_code, &timecb_token, timer_id);
@@ -292,11 +264,12 @@ int32 OS_TimerCreate(osal_id_t *timer_id, const char *timer_name, uint32 *clock_
  *-----------------------------------------------------------------*/
 int32 OS_TimerSet(osal_id_t timer_id, uint32 start_time, uint32 interval_time)
 {
-    OS_timecb_internal_record_t *timecb;
-    int32                        return_code;
-    osal_objtype_t               objtype;
-    osal_id_t                    dedicated_timebase_id;
-    OS_object_token_t            token;
+    OS_timecb_internal_record_t *  timecb;
+    OS_timebase_internal_record_t *timebase;
+    int32                          return_code;
+    osal_objtype_t                 objtype;
+    osal_id_t                      dedicated_timebase_id;
+    OS_object_token_t              token;
 
     dedicated_timebase_id = OS_OBJECT_ID_UNDEFINED;
 
@@ -317,7 +290,8 @@ int32 OS_TimerSet(osal_id_t timer_id, uint32 start_time, uint32 interval_time)
     return_code = OS_ObjectIdGetById(OS_LOCK_MODE_GLOBAL, OS_OBJECT_TYPE_OS_TIMECB, timer_id, &token);
     if (return_code == OS_SUCCESS)
     {
-        timecb = OS_OBJECT_TABLE_GET(OS_timecb_table, token);
+        timecb   = OS_OBJECT_TABLE_GET(OS_timecb_table, token);
+        timebase = OS_OBJECT_TABLE_GET(OS_timebase_table, timecb->timebase_token);
 
         OS_TimeBaseLock_Impl(&timecb->timebase_token);
 
@@ -326,9 +300,15 @@ int32 OS_TimerSet(osal_id_t timer_id, uint32 start_time, uint32 interval_time)
             dedicated_timebase_id = OS_ObjectIdFromToken(&timecb->timebase_token);
         }
 
-        timecb->wait_time     = (int32)start_time;
+        /*
+         * With a start_time of zero the entry comes due on the next tick, but
+         * no callback is given until the first interval_time has elapsed.
+         */
+        timecb->expire_time   = timebase->freerun_time + start_time;
         timecb->interval_time = (int32)interval_time;
 
+        OS_TimeBaseScheduleCallback(timebase, OS_ObjectIndexFromToken(&token));
+
         OS_TimeBaseUnlock_Impl(&timecb->timebase_token);
 
         OS_ObjectIdRelease(&token);
@@ -367,10 +347,8 @@ int32 OS_TimerDelete(osal_id_t timer_id)
     osal_id_t                      dedicated_timebase_id;
     OS_object_token_t              timecb_token;
     OS_object_token_t              timebase_token;
-    OS_object_token_t              listcb_token;
     OS_timebase_internal_record_t *timebase;
     OS_timecb_internal_record_t *  timecb;
-    OS_timecb_internal_record_t *  list_timecb;
 
     dedicated_timebase_id = OS_OBJECT_ID_UNDEFINED;
     memset(&timebase_token, 0, sizeof(timebase_token));
@@ -404,35 +382,9 @@ int32 OS_TimerDelete(osal_id_t timer_id)
         }
 
         /*
-         * Now we need to remove it from the time base callback ring
+         * Now we need to remove it from the time base schedule
          */
-        if (OS_ObjectIdEqual(timebase->first_cb, OS_ObjectIdFromToken(&timecb_token)))
-        {
-            if (OS_ObjectIdEqual(OS_ObjectIdFromToken(&timecb_token), timecb->next_cb))
-            {
-                timebase->first_cb = OS_OBJECT_ID_UNDEFINED;
-            }
-            else
-            {
-                timebase->first_cb = timecb->next_cb;
-            }
-        }
-
-        if (OS_ObjectIdGetById(OS_LOCK_MODE_NONE, OS_OBJECT_TYPE_OS_TIMECB, timecb->prev_cb, &listcb_token) ==
-            OS_SUCCESS)
-        {
-            list_timecb          = OS_OBJECT_TABLE_GET(OS_timecb_table, listcb_token);
-            list_timecb->next_cb = timecb->next_cb;
-        }
-        if (OS_ObjectIdGetById(OS_LOCK_MODE_NONE, OS_OBJECT_TYPE_OS_TIMECB, timecb->next_cb, &listcb_token) ==
-            OS_SUCCESS)
-        {
-            list_timecb          = OS_OBJECT_TABLE_GET(OS_timecb_table, listcb_token);
-            list_timecb->prev_cb = timecb->prev_cb;
-        }
-
-        timecb->next_cb = OS_ObjectIdFromToken(&timecb_token);
-        timecb->prev_cb = OS_ObjectIdFromToken(&timecb_token);
+        OS_TimeBaseCancelCallback(timebase, OS_ObjectIndexFromToken(&timecb_token));
 
         OS_TimeBaseUnlock_Impl(&timecb->timebase_token);
 
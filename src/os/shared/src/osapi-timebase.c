@@ -366,13 +366,9 @@ void OS_TimeBase_CallbackThread(osal_id_t timebase_id)
 {
     OS_TimerSync_t                 syncfunc;
     OS_timebase_internal_record_t *timebase;
-    OS_timecb_internal_record_t *  timecb;
-    OS_common_record_t *           record;
     OS_object_token_t              token;
-    OS_object_token_t              cb_token;
     uint32                         tick_time;
     uint32                         spin_cycles;
-    int32                          saved_wait_time;
 
     /*
      * Register this task as a time base handler.
@@ -389,7 +385,6 @@ void OS_TimeBase_CallbackThread(osal_id_t timebase_id)
         return;
     }
 
-    record   = OS_OBJECT_TABLE_GET(OS_global_timebase_table, token);
     timebase = OS_OBJECT_TABLE_GET(OS_timebase_table, token);
 
     syncfunc    = timebase->external_sync;
@@ -445,67 +440,243 @@ void OS_TimeBase_CallbackThread(osal_id_t timebase_id)
             }
         }
 
-        OS_TimeBaseLock_Impl(&token);
+        if (OS_TimeBase_ProcessTick(&token, tick_time) != OS_SUCCESS)
+        {
+            /* this time base got deleted */
+            break;
+        }
+    }
+}
 
-        /*
-         * After waiting, check that our ID still matches
-         * If not then it means this time base got deleted....
-         */
-        if (!OS_ObjectIdEqual(timebase_id, record->active_id))
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           See description in header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_TimeBase_ProcessTick(const OS_object_token_t *token, uint32 tick_time)
+{
+    OS_timebase_internal_record_t *timebase;
+    OS_timecb_internal_record_t *  timecb;
+    OS_common_record_t *           record;
+    osal_index_t                   timecb_idx;
+    int32                          wait_time;
+    int32                          saved_wait_time;
+
+    record   = OS_OBJECT_TABLE_GET(OS_global_timebase_table, *token);
+    timebase = OS_OBJECT_TABLE_GET(OS_timebase_table, *token);
+
+    OS_TimeBaseLock_Impl(token);
+
+    /*
+     * Check that the ID still matches
+     * If not then it means this time base got deleted....
+     */
+    if (!OS_ObjectIdEqual(OS_ObjectIdFromToken(token), record->active_id))
+    {
+        OS_TimeBaseUnlock_Impl(token);
+        return OS_ERR_INVALID_ID;
+    }
+
+    timebase->freerun_time += tick_time;
+
+    /*
+     * The schedule is ordered by expiry time, so only the callbacks
+     * that are actually due are visited here.  Each one is either
+     * moved to its next expiry or dropped from the schedule.
+     */
+    while (timebase->sched_count > 0)
+    {
+        timecb_idx = timebase->sched[0];
+        timecb     = &OS_timecb_table[timecb_idx];
+        wait_time  = (int32)(timecb->expire_time - timebase->freerun_time);
+        if (wait_time > 0)
         {
-            OS_TimeBaseUnlock_Impl(&token);
+            /* earliest callback is not due yet, so neither are the rest */
             break;
         }
 
-        timebase->freerun_time += tick_time;
-        if (OS_ObjectIdGetById(OS_LOCK_MODE_NONE, OS_OBJECT_TYPE_OS_TIMECB, timebase->first_cb, &cb_token) == 0)
+        saved_wait_time = wait_time + (int32)tick_time;
+        while (wait_time <= 0)
         {
-            do
+            wait_time += timecb->interval_time;
+
+            /*
+             * Only allow the "wait_time" underflow to go as far negative as one interval time
+             * This prevents a cb "interval_time" of less than the timebase interval_time from
+             * accumulating infinitely
+             */
+            if (wait_time < -timecb->interval_time)
             {
-                timecb          = OS_OBJECT_TABLE_GET(OS_timecb_table, cb_token);
-                saved_wait_time = timecb->wait_time;
-                timecb->wait_time -= tick_time;
-                while (timecb->wait_time <= 0)
-                {
-                    timecb->wait_time += timecb->interval_time;
-
-                    /*
-                     * Only allow the "wait_time" underflow to go as far negative as one interval time
-                     * This prevents a cb "interval_time" of less than the timebase interval_time from
-                     * accumulating infinitely
-                     */
-                    if (timecb->wait_time < -timecb->interval_time)
-                    {
-                        ++timecb->backlog_resets;
-                        timecb->wait_time = -timecb->interval_time;
-                    }
-
-                    /*
-                     * Only give the callback if the wait_time actually transitioned from positive to negative.
-                     * This allows one-shot operation where the API sets the "wait_time" positive but keeps
-                     * the "interval_time" at zero.  With the interval_time at zero the wait time will never
-                     * go positive again unless the API sets it again.
-                     */
-                    if (saved_wait_time > 0 && timecb->callback_ptr != NULL)
-                    {
-                        (*timecb->callback_ptr)(OS_ObjectIdFromToken(&cb_token), timecb->callback_arg);
-                    }
-
-                    /*
-                     * Do not repeat the loop unless interval_time is configured.
-                     */
-                    if (timecb->interval_time <= 0)
-                    {
-                        break;
-                    }
-                }
-
-            } while (OS_ObjectIdGetById(OS_LOCK_MODE_NONE, OS_OBJECT_TYPE_OS_TIMECB, timecb->next_cb, &cb_token) ==
-                         OS_SUCCESS &&
-                     !OS_ObjectIdEqual(OS_ObjectIdFromToken(&cb_token), timebase->first_cb));
+                ++timecb->backlog_resets;
+                wait_time = -timecb->interval_time;
+            }
+
+            /*
+             * Only give the callback if the wait_time actually transitioned from positive to negative.
+             * This allows one-shot operation where the API sets the "wait_time" positive but keeps
+             * the "interval_time" at zero.  With the interval_time at zero the wait time will never
+             * go positive again unless the API sets it again.
+             */
+            if (saved_wait_time > 0 && timecb->callback_ptr != NULL)
+            {
+                (*timecb->callback_ptr)(OS_global_timecb_table[timecb_idx].active_id, timecb->callback_arg);
+            }
+
+            /*
+             * Do not repeat the loop unless interval_time is configured.
+             */
+            if (timecb->interval_time <= 0)
+            {
+                break;
+            }
         }
 
-        OS_TimeBaseUnlock_Impl(&token);
+        if (wait_time > 0)
+        {
+            timecb->expire_time = timebase->freerun_time + (uint32)wait_time;
+            OS_TimeBaseScheduleCallback(timebase, timecb_idx);
+        }
+        else
+        {
+            /* one-shot has expired, it stays idle until set again */
+            OS_TimeBaseCancelCallback(timebase, timecb_idx);
+        }
+    }
+
+    OS_TimeBaseUnlock_Impl(token);
+
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Store a timer callback index at the given schedule position
+ *
+ *-----------------------------------------------------------------*/
+static void OS_TimeBaseSchedulePlace(OS_timebase_internal_record_t *timebase, uint32 pos, osal_index_t timecb_idx)
+{
+    timebase->sched[pos]                  = timecb_idx;
+    OS_timecb_table[timecb_idx].sched_pos = pos + 1;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Checks if timer callback "a" expires before timer callback "b"
+ *
+ *           The comparison is done on the difference so it remains
+ *           correct when the free run counter wraps around.
+ *
+ *-----------------------------------------------------------------*/
+static bool OS_TimeBaseExpiresBefore(osal_index_t a, osal_index_t b)
+{
+    return ((int32)(OS_timecb_table[a].expire_time - OS_timecb_table[b].expire_time) < 0);
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Restore the schedule ordering after the entry at the
+ *           given position was inserted or had its expiry changed
+ *
+ *-----------------------------------------------------------------*/
+static void OS_TimeBaseScheduleFixup(OS_timebase_internal_record_t *timebase, uint32 pos)
+{
+    osal_index_t timecb_idx;
+    uint32       next;
+
+    timecb_idx = timebase->sched[pos];
+
+    /* move toward the top while it expires before its parent */
+    while (pos > 0)
+    {
+        next = (pos - 1) / 2;
+        if (!OS_TimeBaseExpiresBefore(timecb_idx, timebase->sched[next]))
+        {
+            break;
+        }
+        OS_TimeBaseSchedulePlace(timebase, pos, timebase->sched[next]);
+        pos = next;
+    }
+
+    /* move toward the bottom while a child expires before it */
+    while (true)
+    {
+        next = (2 * pos) + 1;
+        if (next >= timebase->sched_count)
+        {
+            break;
+        }
+        if ((next + 1) < timebase->sched_count &&
+            OS_TimeBaseExpiresBefore(timebase->sched[next + 1], timebase->sched[next]))
+        {
+            ++next;
+        }
+        if (!OS_TimeBaseExpiresBefore(timebase->sched[next], timecb_idx))
+        {
+            break;
+        }
+        OS_TimeBaseSchedulePlace(timebase, pos, timebase->sched[next]);
+        pos = next;
+    }
+
+    OS_TimeBaseSchedulePlace(timebase, pos, timecb_idx);
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           See description in header file for detail
+ *
+ *-----------------------------------------------------------------*/
+void OS_TimeBaseScheduleCallback(OS_timebase_internal_record_t *timebase, osal_index_t timecb_idx)
+{
+    uint32 pos;
+
+    pos = OS_timecb_table[timecb_idx].sched_pos;
+    if (pos == 0)
+    {
+        /* not armed - append at the bottom */
+        pos = timebase->sched_count;
+        ++timebase->sched_count;
+        timebase->sched[pos] = timecb_idx;
+    }
+    else
+    {
+        --pos;
+    }
+
+    OS_TimeBaseScheduleFixup(timebase, pos);
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           See description in header file for detail
+ *
+ *-----------------------------------------------------------------*/
+void OS_TimeBaseCancelCallback(OS_timebase_internal_record_t *timebase, osal_index_t timecb_idx)
+{
+    uint32 pos;
+
+    pos = OS_timecb_table[timecb_idx].sched_pos;
+    if (pos == 0)
+    {
+        /* not armed */
+        return;
+    }
+
+    OS_timecb_table[timecb_idx].sched_pos = 0;
+    --timebase->sched_count;
+    --pos;
+
+    /* fill the hole with the last entry, if this was not the last entry */
+    if (pos < timebase->sched_count)
+    {
+        timebase->sched[pos] = timebase->sched[timebase->sched_count];
+        OS_TimeBaseScheduleFixup(timebase, pos);
     }
 }
 
@@ -37,4 +37,20 @@
  */
 #define OSAL_GETTIME_SOURCE_CLOCK CLOCK_REALTIME
 
+/**
+ * \brief Identifies the clock ID for monotonic time
+ *
+ * This is the clock ID that will be used to implement
+ * OS_GetMonotonicTime().
+ */
+#define OSAL_GETTIME_MONOTONIC_CLOCK CLOCK_MONOTONIC
+
+/**
+ * \brief Identifies the clock ID for coarse monotonic time
+ *
+ * This is the clock ID that will be used to implement OS_GetCoarseTime().
+ * There is no faster clock, so this is the same as the monotonic clock.
+ */
+#define OSAL_GETTIME_COARSE_CLOCK CLOCK_MONOTONIC
+
 #endif /* OS_IMPL_GETTIME_H */
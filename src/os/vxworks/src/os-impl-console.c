@@ -86,6 +86,7 @@ int OS_VxWorks_ConsoleTask_Entry(int arg)
 {
     OS_impl_console_internal_record_t *local;
     OS_object_token_t                  token;
+    int32                              status;
 
     if (OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, OS_OBJECT_TYPE_OS_CONSOLE, OS_ObjectIdFromInteger(arg), &token) ==
         OS_SUCCESS)
@@ -95,7 +96,13 @@ int OS_VxWorks_ConsoleTask_Entry(int arg)
         /* Loop forever (unless shutdown is set) */
         while (OS_SharedGlobalVars.GlobalState != OS_SHUTDOWN_MAGIC_NUMBER)
         {
-            OS_ConsoleOutput_Impl(&token);
+            /* staged records remain if the console buffer filled, so write it out and continue */
+            do
+            {
+                status = OS_ConsoleDrainStaging(&token);
+                OS_ConsoleOutput_Impl(&token);
+            } while (status == OS_QUEUE_FULL);
+
             if (semTake(local->datasem, WAIT_FOREVER) == ERROR)
             {
                 OS_DEBUG("semTake() - vxWorks errno %d\n", errno);
@@ -0,0 +1,233 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+** Name Lookup Speed Test
+**
+** This is a simple way to gauge the cost of looking up an
+** object by name on a given machine and OSAL configuration.
+**
+** The object table for counting semaphores is filled, and
+** then every object is looked up repeatedly by name, using two
+** different methods:
+**
+**  1. OS_CountSemGetIdByName(), which uses the name index if
+**     OSAL_CONFIG_NAME_INDEX is enabled, or a linear search if not.
+**
+**  2. A linear search through the public API, using
+**     OS_ForEachObjectOfType() and OS_GetResourceName().  This
+**     is the same type of search OSAL does when the index is
+**     not enabled, plus the overhead of the callbacks.
+**
+** The average time per lookup is reported for each method, for
+** names that exist and names that do not exist.  Lower numbers
+** indicate better performance.
+*/
+#include <stdio.h>
+#include <string.h>
+#include "common_types.h"
+#include "osapi.h"
+#include "utassert.h"
+#include "uttest.h"
+#include "utbsp.h"
+
+/*
+ * The number of times each name is looked up by each method
+ */
+#define NAMETEST_REPEAT_COUNT 200
+
+typedef struct
+{
+    const char *name;
+    osal_id_t   found_id;
+} NameTest_Search_t;
+
+osal_id_t NameTest_Ids[OS_MAX_COUNT_SEMAPHORES];
+char      NameTest_Names[OS_MAX_COUNT_SEMAPHORES][OS_MAX_API_NAME];
+uint32    NameTest_Count;
+
+/* Define setup and test functions for UT assert */
+void NameSetup(void);
+void NameRun(void);
+void NameTeardown(void);
+
+/*
+ * Callback for OS_ForEachObjectOfType(), for the linear search method
+ */
+void NameTest_SearchCallback(osal_id_t object_id, void *arg)
+{
+    NameTest_Search_t *search = arg;
+    char               name[OS_MAX_API_NAME];
+
+    if (!OS_ObjectIdDefined(search->found_id) && OS_GetResourceName(object_id, name, sizeof(name)) == OS_SUCCESS &&
+        strcmp(name, search->name) == 0)
+    {
+        search->found_id = object_id;
+    }
+}
+
+/*
+ * Look up a name using OS_CountSemGetIdByName()
+ */
+int32 NameTest_LookupByApi(const char *name, osal_id_t *id)
+{
+    return OS_CountSemGetIdByName(id, name);
+}
+
+/*
+ * Look up a name using a linear search through the public API
+ */
+int32 NameTest_LookupByScan(const char *name, osal_id_t *id)
+{
+    NameTest_Search_t search;
+
+    search.name     = name;
+    search.found_id = OS_OBJECT_ID_UNDEFINED;
+
+    OS_ForEachObjectOfType(OS_OBJECT_TYPE_OS_COUNTSEM, OS_OBJECT_CREATOR_ANY, NameTest_SearchCallback, &search);
+
+    *id = search.found_id;
+
+    if (!OS_ObjectIdDefined(search.found_id))
+    {
+        return OS_ERR_NAME_NOT_FOUND;
+    }
+
+    return OS_SUCCESS;
+}
+
+/*
+ * Look up every name repeatedly using the given method, and report the average time per lookup.
+ * Names which exist are checked to resolve to the correct ID.
+ */
+void NameTest_Measure(const char *method, int32 (*lookup)(const char *, osal_id_t *))
+{
+    OS_time_t start_time;
+    OS_time_t end_time;
+    osal_id_t id;
+    uint32    i;
+    uint32    j;
+    uint32    errors;
+    char      missing_name[OS_MAX_API_NAME];
+    int64     elapsed_ns;
+
+    errors = 0;
+    OS_GetLocalTime(&start_time);
+    for (j = 0; j < NAMETEST_REPEAT_COUNT; ++j)
+    {
+        for (i = 0; i < NameTest_Count; ++i)
+        {
+            if (lookup(NameTest_Names[i], &id) != OS_SUCCESS || !OS_ObjectIdEqual(id, NameTest_Ids[i]))
+            {
+                ++errors;
+            }
+        }
+    }
+    OS_GetLocalTime(&end_time);
+
+    elapsed_ns = OS_TimeGetTotalNanoseconds(OS_TimeSubtract(end_time, start_time));
+    UtAssert_UINT32_EQ(errors, 0);
+    UtAssert_MIR("%s: %ld ns per lookup (%lu objects, name exists)", method,
+                 (long)(elapsed_ns / (NAMETEST_REPEAT_COUNT * NameTest_Count)), (unsigned long)NameTest_Count);
+
+    errors = 0;
+    OS_GetLocalTime(&start_time);
+    for (j = 0; j < NAMETEST_REPEAT_COUNT; ++j)
+    {
+        for (i = 0; i < NameTest_Count; ++i)
+        {
+            snprintf(missing_name, sizeof(missing_name), "Missing%lu", (unsigned long)i);
+            if (lookup(missing_name, &id) != OS_ERR_NAME_NOT_FOUND)
+            {
+                ++errors;
+            }
+        }
+    }
+    OS_GetLocalTime(&end_time);
+
+    elapsed_ns = OS_TimeGetTotalNanoseconds(OS_TimeSubtract(end_time, start_time));
+    UtAssert_UINT32_EQ(errors, 0);
+    UtAssert_MIR("%s: %ld ns per lookup (%lu objects, name does not exist)", method,
+                 (long)(elapsed_ns / (NAMETEST_REPEAT_COUNT * NameTest_Count)), (unsigned long)NameTest_Count);
+}
+
+void UtTest_Setup(void)
+{
+    if (OS_API_Init() != OS_SUCCESS)
+    {
+        UtAssert_Abort("OS_API_Init() failed");
+    }
+
+    /* the test should call OS_API_Teardown() before exiting */
+    UtTest_AddTeardown(OS_API_Teardown, "Cleanup");
+
+    /*
+     * Register the test setup and check routines in UT assert
+     */
+    UtTest_Add(NameRun, NameSetup, NameTeardown, "NameLookupSpeedTest");
+}
+
+void NameSetup(void)
+{
+    int32 status;
+
+    NameTest_Count = 0;
+
+    /*
+    ** Fill the object table, so a linear search has the most work to do
+    */
+    while (NameTest_Count < OS_MAX_COUNT_SEMAPHORES)
+    {
+        snprintf(NameTest_Names[NameTest_Count], sizeof(NameTest_Names[NameTest_Count]), "Sem%lu",
+                 (unsigned long)NameTest_Count);
+        status = OS_CountSemCreate(&NameTest_Ids[NameTest_Count], NameTest_Names[NameTest_Count], 0, 0);
+        if (status != OS_SUCCESS)
+        {
+            UtAssert_Failed("Sem %lu create Rc=%d", (unsigned long)NameTest_Count, (int)status);
+            break;
+        }
+
+        ++NameTest_Count;
+    }
+
+    UtAssert_NONZERO(NameTest_Count);
+}
+
+void NameRun(void)
+{
+#ifdef OSAL_CONFIG_NAME_INDEX
+    UtAssert_MIR("OSAL_CONFIG_NAME_INDEX is enabled");
+#else
+    UtAssert_MIR("OSAL_CONFIG_NAME_INDEX is not enabled");
+#endif
+
+    if (NameTest_Count > 0)
+    {
+        NameTest_Measure("OS_CountSemGetIdByName", NameTest_LookupByApi);
+        NameTest_Measure("Linear search", NameTest_LookupByScan);
+    }
+}
+
+void NameTeardown(void)
+{
+    while (NameTest_Count > 0)
+    {
+        --NameTest_Count;
+        UtAssert_INT32_EQ(OS_CountSemDelete(NameTest_Ids[NameTest_Count]), OS_SUCCESS);
+    }
+}
@@ -231,6 +231,9 @@ void TestDatagramNetworkApi(void)
     uint32           Buf2  = 0;
     uint32           Buf3  = 222;
     uint32           Buf4  = 0;
+    uint32           VecBuf[3];
+    OS_iovec_t       Iov[2];
+    OS_SockMsg_t     Msgs[3];
     osal_id_t        objid = OS_OBJECT_ID_UNDEFINED;
     osal_id_t        invalid_fd;
     uint16           PortNum = 0;
@@ -310,6 +313,66 @@ void TestDatagramNetworkApi(void)
     UtAssert_True(strcmp(AddrBuffer1, AddrBuffer2) == 0, "AddrBuffer1 (%s) == AddrBuffer2 (%s)", AddrBuffer1,
                   AddrBuffer2);
 
+    /*
+     * Send a datagram made up of two separate segments from peer1 to peer2 and verify
+     * that it arrives as one message
+     */
+    Iov[0].Buffer = &Buf1;
+    Iov[0].Length = sizeof(Buf1);
+    Iov[1].Buffer = &Buf3;
+    Iov[1].Length = sizeof(Buf3);
+    UtAssert_INT32_EQ(OS_SocketSendToV(p1_socket_id, NULL, 2, &p2_addr), OS_INVALID_POINTER);
+    UtAssert_INT32_EQ(OS_SocketSendToV(p1_socket_id, Iov, 2, NULL), OS_INVALID_POINTER);
+    UtAssert_INT32_EQ(OS_SocketSendToV(p1_socket_id, Iov, 0, &p2_addr), OS_ERR_INVALID_SIZE);
+    UtAssert_INT32_EQ(OS_SocketSendToV(invalid_fd, Iov, 2, &p2_addr), OS_ERR_INVALID_ID);
+    UtAssert_INT32_EQ(OS_SocketSendToV(p1_socket_id, Iov, 2, &p2_addr), sizeof(Buf1) + sizeof(Buf3));
+
+    memset(VecBuf, 0, sizeof(VecBuf));
+    UtAssert_INT32_EQ(OS_SocketRecvFrom(p2_socket_id, VecBuf, sizeof(VecBuf), &l_addr, UT_TIMEOUT),
+                      sizeof(Buf1) + sizeof(Buf3));
+    UtAssert_True(VecBuf[0] == Buf1 && VecBuf[1] == Buf3, "VecBuf (%ld,%ld) == (%ld,%ld)", (long)VecBuf[0],
+                  (long)VecBuf[1], (long)Buf1, (long)Buf3);
+
+    /*
+     * Send a batch of two datagrams from peer1 to peer2 and verify that
+     * both are received as separate messages by a single batch receive
+     */
+    memset(Msgs, 0, sizeof(Msgs));
+    Msgs[0].Buffer  = &Buf1;
+    Msgs[0].BufSize = sizeof(Buf1);
+    Msgs[0].Addr    = p2_addr;
+    Msgs[1].Buffer  = &Buf3;
+    Msgs[1].BufSize = sizeof(Buf3);
+    Msgs[1].Addr    = p2_addr;
+    UtAssert_INT32_EQ(OS_SocketSendToMulti(p1_socket_id, NULL, 2), OS_INVALID_POINTER);
+    UtAssert_INT32_EQ(OS_SocketSendToMulti(p1_socket_id, Msgs, 0), OS_ERR_INVALID_SIZE);
+    UtAssert_INT32_EQ(OS_SocketSendToMulti(invalid_fd, Msgs, 2), OS_ERR_INVALID_ID);
+    UtAssert_INT32_EQ(OS_SocketSendToMulti(p1_socket_id, Msgs, 2), 2);
+    UtAssert_UINT32_EQ(Msgs[1].ActualSize, sizeof(Buf3));
+
+    memset(VecBuf, 0, sizeof(VecBuf));
+    memset(Msgs, 0, sizeof(Msgs));
+    Msgs[0].Buffer  = &VecBuf[0];
+    Msgs[0].BufSize = sizeof(VecBuf[0]);
+    Msgs[1].Buffer  = &VecBuf[1];
+    Msgs[1].BufSize = sizeof(VecBuf[1]);
+    Msgs[2].Buffer  = &VecBuf[2];
+    Msgs[2].BufSize = sizeof(VecBuf[2]);
+    UtAssert_INT32_EQ(OS_SocketRecvFromMulti(p2_socket_id, NULL, 3, UT_TIMEOUT), OS_INVALID_POINTER);
+    UtAssert_INT32_EQ(OS_SocketRecvFromMulti(p2_socket_id, Msgs, 0, UT_TIMEOUT), OS_ERR_INVALID_SIZE);
+    UtAssert_INT32_EQ(OS_SocketRecvFromMulti(invalid_fd, Msgs, 3, UT_TIMEOUT), OS_ERR_INVALID_ID);
+
+    /* Depending on timing the second datagram may arrive separately */
+    UtAssert_INT32_GT(OS_SocketRecvFromMulti(p2_socket_id, Msgs, 3, UT_TIMEOUT), 0);
+    if (Msgs[1].ActualSize == 0)
+    {
+        UtAssert_INT32_EQ(OS_SocketRecvFromMulti(p2_socket_id, &Msgs[1], 2, UT_TIMEOUT), 1);
+    }
+    UtAssert_True(VecBuf[0] == Buf1 && VecBuf[1] == Buf3, "VecBuf (%ld,%ld) == (%ld,%ld)", (long)VecBuf[0],
+                  (long)VecBuf[1], (long)Buf1, (long)Buf3);
+    UtAssert_UINT32_EQ(Msgs[1].ActualSize, sizeof(Buf3));
+    UtAssert_UINT32_EQ(Msgs[1].Addr.ActualLength, p1_addr.ActualLength);
+
     /*
      * Send data from peer2 to peer1 and verify
      */
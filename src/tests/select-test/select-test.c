@@ -295,6 +295,64 @@ void TestSelectMultipleRead(void)
     UtAssert_INT32_EQ(OS_SelectFdIsSet(&ReadSet, c2_socket_id), true);
 }
 
+void TestSelectGroupRead(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_SelectGroupWait(osal_id_t group_id, OS_SelectGroupEvent_t *Events, uint32 MaxEvents,
+     *                          uint32 *EventCount, int32 msecs);
+     */
+    osal_id_t             group_id;
+    OS_SelectGroupEvent_t Events[2];
+    uint32                EventCount;
+    int32                 status;
+
+    if (!networkImplemented)
+    {
+        UtAssert_NA("Network API not implemented");
+        return;
+    }
+
+    status = OS_SelectGroupCreate(&group_id, "SelGroup", 0);
+    if (status == OS_ERR_NOT_IMPLEMENTED)
+    {
+        UtAssert_NA("Select group API not implemented");
+        return;
+    }
+
+    UtAssert_INT32_EQ(status, OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_SelectGroupAdd(group_id, c1_socket_id, OS_STREAM_STATE_READABLE), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_SelectGroupAdd(group_id, c1_socket_id, OS_STREAM_STATE_BOUND), OS_ERR_INVALID_ARGUMENT);
+
+    /*
+     * Check for readability on socket 1 should time out, as server1 is waiting on Sem
+     */
+    UtAssert_INT32_EQ(OS_SelectGroupWait(group_id, Events, 2, &EventCount, UT_TIMEOUT), OS_ERROR_TIMEOUT);
+    UtAssert_UINT32_EQ(EventCount, 0);
+
+    /* Server2 has already closed its side, so socket 2 is readable */
+    UtAssert_INT32_EQ(OS_SelectGroupAdd(group_id, c2_socket_id, OS_STREAM_STATE_READABLE), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_SelectGroupWait(group_id, Events, 2, &EventCount, UT_TIMEOUT), OS_SUCCESS);
+    UtAssert_UINT32_EQ(EventCount, 1);
+    UtAssert_True(OS_ObjectIdEqual(Events[0].objid, c2_socket_id), "Events[0].objid (%lu) == c2_socket_id (%lu)",
+                  OS_ObjectIdToInteger(Events[0].objid), OS_ObjectIdToInteger(c2_socket_id));
+    UtAssert_UINT32_EQ(Events[0].StateFlags, OS_STREAM_STATE_READABLE);
+
+    /* Once removed, socket 2 is no longer reported */
+    UtAssert_INT32_EQ(OS_SelectGroupRemove(group_id, c2_socket_id), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_SelectGroupWait(group_id, Events, 2, &EventCount, 0), OS_ERROR_TIMEOUT);
+
+    UtAssert_INT32_EQ(OS_BinSemGive(bin_sem_id), OS_SUCCESS);
+    OS_TaskDelay(10); /* Give server time to run and close the socket */
+
+    UtAssert_INT32_EQ(OS_SelectGroupWait(group_id, Events, 2, &EventCount, UT_TIMEOUT), OS_SUCCESS);
+    UtAssert_UINT32_EQ(EventCount, 1);
+    UtAssert_True(OS_ObjectIdEqual(Events[0].objid, c1_socket_id), "Events[0].objid (%lu) == c1_socket_id (%lu)",
+                  OS_ObjectIdToInteger(Events[0].objid), OS_ObjectIdToInteger(c1_socket_id));
+
+    UtAssert_INT32_EQ(OS_SelectGroupDelete(group_id), OS_SUCCESS);
+}
+
 void TestSelectSingleWrite(void)
 {
     /*
@@ -424,6 +482,7 @@ void UtTest_Setup(void)
 
     UtTest_Add(TestSelectSingleRead, Setup_Single, Teardown_Single, "TestSelectSingleRead");
     UtTest_Add(TestSelectMultipleRead, Setup_Multi, Teardown_Multi, "TestSelectMultipleRead");
+    UtTest_Add(TestSelectGroupRead, Setup_Multi, Teardown_Multi, "TestSelectGroupRead");
     UtTest_Add(TestSelectSingleWrite, Setup_Single, Teardown_Single, "TestSelectSingleWrite");
     UtTest_Add(TestSelectMultipleWrite, Setup_Multi, Teardown_Multi, "TestSelectMultipleWrite");
 }
@@ -17,27 +17,62 @@
  ************************************************************************/
 
 /*
-** Semaphore Speed Test
+** Synchronization and IPC Speed Test
 **
 ** This is a simple way to gauge the performance of the
-** OS/kernel task switching and semaphore implementations
-** on a given machine.
+** OS/kernel task switching and the OSAL synchronization and
+** IPC implementations on a given machine.
 **
-** This implements a flip-flop between two tasks using
-** two semaphores.  Task 1 waits for semaphore 1 and
-** gives semaphore 2, while task 2 waits for semaphore 2
-** and gives semaphore 1.
+** Each benchmark performs a fixed number of operations and
+** times every one of them.  The throughput (operations per second)
+** and the 50th, 99th and 99.9th percentile latency of a single
+** operation are reported.  Lower latencies and higher throughput
+** indicate better performance.
 **
-** The two tasks will run continuously, each pending
-** on each other and swapping between them, for 5 seconds.
+** The benchmarks are:
 **
-** At the end of the test, the total number of "work"
-** cycles for each task is indicated.  Higher numbers
-** indicate better performance.
+**  - Binary and counting semaphores: a flip-flop between two tasks
+**    using two semaphores.  Task 1 gives semaphore 2 and waits for
+**    semaphore 1, while task 2 waits for semaphore 2 and gives
+**    semaphore 1.  The latency is the round trip seen by task 1.
+**
+**  - Mutex: a number of tasks repeatedly take and give the same
+**    mutex, both as a regular and as an adaptive mutex.  The latency
+**    is that of one take/give pair.
+**
+**  - Condition variable: a flip-flop between two tasks, as with the
+**    semaphores, using one condition variable.
+**
+**  - Queue: a put and a get of a single message, at several message
+**    sizes, for a regular queue and a ring buffer queue.
 **
+**  - ID lookup: a number of tasks repeatedly get the name of the
+**    same object, which is dominated by the lookup of its ID.
 **
+**  - Timer: the deviation of each timer callback from the time
+**    it was expected, with a 1ms interval.
+**
+**  - OS_printf: the time taken to print a short line.
+**
+** The following options may be passed on the command line, in addition
+** to the usual UT assert options:
+**
+**  -t <count>  Number of tasks for the mutex and ID lookup benchmarks (default 2)
+**  -n <count>  Number of operations per task (default and max 10000)
+**  -p          Pin each task to a CPU, where supported
+**  -f csv|json Also write the results in this format
+**  -o <file>   Write the formatted results to this file instead of stdout
 */
+
+#ifdef __linux__
+#define _GNU_SOURCE
+#include <sched.h>
+#include <unistd.h>
+#endif
+
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include "common_types.h"
 #include "osapi.h"
 #include "utassert.h"
@@ -46,176 +81,824 @@
 
 /*
  * Note the worker priority must be lower than that of
- * the executive (init) task.  Otherwise, the SemRun()
- * function may never get CPU time to stop the test.
+ * the executive (init) task.  Otherwise, the test functions
+ * may never get CPU time to collect the workers.
  */
-#define SEMTEST_TASK_PRIORITY 150
+#define SPEEDTEST_TASK_PRIORITY 150
 
 /*
- * A limit for the maximum amount
- * of iterations that this test will
- * perform.  This prevents the test
- * from running infinitely in case the
- * time-based stop routine does not
- * work correctly.  See note above
- * about priority requirements.
+ * Limits on the number of worker tasks and on the
+ * number of operations each worker may perform.  Each
+ * operation is timed, so these determine the size of
+ * the sample buffer.
  */
-#define SEMTEST_WORK_LIMIT 10000000
+#define SPEEDTEST_MAX_TASKS   8
+#define SPEEDTEST_MAX_SAMPLES 10000
 
-/* Define setup and test functions for UT assert */
-void SemSetup(void);
-void SemRun(void);
+/*
+ * The maximum number of results which are kept for the
+ * formatted output at the end of the test
+ */
+#define SPEEDTEST_MAX_RESULTS 32
 
 /*
- * A macro for semaphore operation depending on type.
- *
- * This resolves to a function name like e.g. OS_BinSemTake.
+ * How long to wait for workers to finish, in milliseconds.
+ * This prevents the test from waiting forever if a worker
+ * gets stuck.
+ */
+#define SPEEDTEST_WORKER_TIMEOUT 30000
+
+/*
+ * The timer interval for the timer benchmark, in microseconds,
+ * and the number of callbacks to measure.
+ */
+#define SPEEDTEST_TIMER_INTERVAL 1000
+#define SPEEDTEST_TIMER_SAMPLES  500
+
+/*
+ * The number of lines printed for the OS_printf benchmark.
+ * This is kept low to avoid flooding the console.
  */
-#define SEMCALL(type, op) OS_##type##Sem##op
+#define SPEEDTEST_PRINTF_SAMPLES 200
+
+typedef enum
+{
+    SPEEDTEST_FORMAT_NONE,
+    SPEEDTEST_FORMAT_CSV,
+    SPEEDTEST_FORMAT_JSON
+} SpeedTest_Format_t;
+
+typedef struct
+{
+    uint32             task_count;
+    uint32             op_count;
+    bool               pin_cpus;
+    SpeedTest_Format_t format;
+    const char *       output_file;
+} SpeedTest_Options_t;
+
+typedef struct
+{
+    const char *name;
+    char        param[16];
+    uint32      task_count;
+    uint32      op_count;
+    double      ops_per_sec;
+    uint32      p50_ns;
+    uint32      p99_ns;
+    uint32      p999_ns;
+    uint32      max_ns;
+} SpeedTest_Result_t;
 
 /*
- * This test works with either binary or counting
- * semaphores.  To switch between them, set this
- * to either "Bin" or "Count" without quotes.
+ * The function run by each worker task.  It should perform
+ * SpeedTest_Options.op_count operations, and store the latency of
+ * each in the samples array.  It returns the number of samples stored.
  */
-#define SEMOP(op) SEMCALL(Count, op)
+typedef uint32 (*SpeedTest_WorkerFunc_t)(uint32 worker, uint32 *samples);
 
-osal_id_t task_1_id;
-uint32    task_1_work;
+/*
+ * Semaphore operations, so the flip-flop can use either
+ * binary or counting semaphores
+ */
+typedef struct
+{
+    int32 (*Take)(osal_id_t sem_id);
+    int32 (*Give)(osal_id_t sem_id);
+} SpeedTest_SemOps_t;
 
-osal_id_t task_2_id;
-uint32    task_2_work;
+SpeedTest_Options_t SpeedTest_Options;
 
-osal_id_t sem_id_1;
-osal_id_t sem_id_2;
+SpeedTest_Result_t SpeedTest_Results[SPEEDTEST_MAX_RESULTS];
+uint32             SpeedTest_ResultCount;
 
-void task_1(void)
+/*
+ * State shared with the worker tasks
+ */
+SpeedTest_WorkerFunc_t    SpeedTest_WorkerFunc;
+osal_id_t                 SpeedTest_WorkerIds[SPEEDTEST_MAX_TASKS];
+uint32                    SpeedTest_WorkerSamples[SPEEDTEST_MAX_TASKS];
+uint32                    SpeedTest_Samples[SPEEDTEST_MAX_TASKS * SPEEDTEST_MAX_SAMPLES];
+osal_id_t                 SpeedTest_StartSem;
+osal_id_t                 SpeedTest_DoneSem;
+uint32                    SpeedTest_RunNumber;
+const SpeedTest_SemOps_t *SpeedTest_SemOps;
+osal_id_t                 SpeedTest_ObjIds[2];
+volatile uint32           SpeedTest_Turn;
+volatile uint32           SpeedTest_Counter;
+
+/* Timer benchmark state, updated by the timer callback */
+OS_time_t       SpeedTest_TimerLast;
+volatile uint32 SpeedTest_TimerCount;
+
+const SpeedTest_SemOps_t SpeedTest_BinSemOps   = {OS_BinSemTake, OS_BinSemGive};
+const SpeedTest_SemOps_t SpeedTest_CountSemOps = {OS_CountSemTake, OS_CountSemGive};
+
+/*
+ * Get the time elapsed since "start", in nanoseconds
+ */
+uint32 SpeedTest_ElapsedNs(OS_time_t start)
 {
-    uint32 status;
+    OS_time_t now;
+    int64     elapsed;
+
+    OS_GetLocalTime(&now);
+    elapsed = OS_TimeGetTotalNanoseconds(OS_TimeSubtract(now, start));
+    if (elapsed < 0)
+    {
+        /* the local clock was set backwards */
+        elapsed = 0;
+    }
+    else if (elapsed > 0xFFFFFFFF)
+    {
+        elapsed = 0xFFFFFFFF;
+    }
+
+    return elapsed;
+}
+
+int SpeedTest_CompareSamples(const void *a, const void *b)
+{
+    uint32 sa = *((const uint32 *)a);
+    uint32 sb = *((const uint32 *)b);
+
+    return (sa > sb) - (sa < sb);
+}
+
+/*
+ * Pin the calling task to a CPU, based on the worker number
+ */
+void SpeedTest_PinCpu(uint32 worker)
+{
+#ifdef __linux__
+    cpu_set_t cpus;
+    long      cpu_count;
+
+    cpu_count = sysconf(_SC_NPROCESSORS_ONLN);
+    if (cpu_count > 0)
+    {
+        CPU_ZERO(&cpus);
+        CPU_SET(worker % cpu_count, &cpus);
+        if (sched_setaffinity(0, sizeof(cpus), &cpus) != 0)
+        {
+            OS_printf("Worker %u: unable to set CPU affinity\n", (unsigned int)worker);
+        }
+    }
+#endif
+}
+
+/*
+ * Compute the statistics for a set of samples, report them, and
+ * keep them for the formatted output
+ */
+void SpeedTest_Report(const char *name, const char *param, uint32 task_count, uint32 sample_count, int64 elapsed_ns)
+{
+    SpeedTest_Result_t result;
+
+    memset(&result, 0, sizeof(result));
+    result.name       = name;
+    result.task_count = task_count;
+    result.op_count   = sample_count;
+    snprintf(result.param, sizeof(result.param), "%s", param);
+
+    UtAssert_NONZERO(sample_count);
+    if (sample_count == 0)
+    {
+        return;
+    }
+
+    qsort(SpeedTest_Samples, sample_count, sizeof(SpeedTest_Samples[0]), SpeedTest_CompareSamples);
+
+    if (elapsed_ns > 0)
+    {
+        result.ops_per_sec = (double)sample_count * 1000000000.0 / (double)elapsed_ns;
+    }
+    result.p50_ns  = SpeedTest_Samples[((sample_count - 1) * 500) / 1000];
+    result.p99_ns  = SpeedTest_Samples[((sample_count - 1) * 990) / 1000];
+    result.p999_ns = SpeedTest_Samples[((sample_count - 1) * 999) / 1000];
+    result.max_ns  = SpeedTest_Samples[sample_count - 1];
+
+    UtAssert_MIR("%s %s: %lu tasks, %lu ops, %.0f ops/sec, p50=%luns p99=%luns p99.9=%luns max=%luns", name, param,
+                 (unsigned long)task_count, (unsigned long)sample_count, result.ops_per_sec,
+                 (unsigned long)result.p50_ns, (unsigned long)result.p99_ns, (unsigned long)result.p999_ns,
+                 (unsigned long)result.max_ns);
+
+    if (SpeedTest_ResultCount < SPEEDTEST_MAX_RESULTS)
+    {
+        SpeedTest_Results[SpeedTest_ResultCount] = result;
+        ++SpeedTest_ResultCount;
+    }
+}
+
+/*
+ * Entry point for all worker tasks
+ */
+void SpeedTest_WorkerEntry(void)
+{
+    osal_id_t self_id;
+    uint32    worker;
+    uint32    sample_count;
+
+    self_id = OS_TaskGetId();
 
-    OS_printf("Starting task 1\n");
+    /* wait for the start signal, at which point all IDs are known */
+    if (OS_CountSemTake(SpeedTest_StartSem) != OS_SUCCESS)
+    {
+        return;
+    }
+
+    for (worker = 0; worker < SPEEDTEST_MAX_TASKS; ++worker)
+    {
+        if (OS_ObjectIdEqual(self_id, SpeedTest_WorkerIds[worker]))
+        {
+            break;
+        }
+    }
 
-    while (task_1_work < SEMTEST_WORK_LIMIT)
+    if (worker < SPEEDTEST_MAX_TASKS)
+    {
+        if (SpeedTest_Options.pin_cpus)
+        {
+            SpeedTest_PinCpu(worker);
+        }
+
+        sample_count = SpeedTest_WorkerFunc(worker, &SpeedTest_Samples[worker * SPEEDTEST_MAX_SAMPLES]);
+        SpeedTest_WorkerSamples[worker] = sample_count;
+    }
+
+    OS_CountSemGive(SpeedTest_DoneSem);
+}
+
+/*
+ * Run a worker function in several tasks at once, and report the results.
+ *
+ * The samples from all workers are combined, and the throughput is based on
+ * the time from starting the first worker until the last worker is done.
+ */
+void SpeedTest_RunWorkers(const char *name, const char *param, uint32 task_count, SpeedTest_WorkerFunc_t func)
+{
+    char      task_name[OS_MAX_API_NAME];
+    uint32    i;
+    uint32    started;
+    uint32    sample_count;
+    int32     status;
+    OS_time_t start_time;
+    int64     elapsed_ns;
+
+    SpeedTest_WorkerFunc = func;
+    memset(SpeedTest_WorkerIds, 0, sizeof(SpeedTest_WorkerIds));
+    memset(SpeedTest_WorkerSamples, 0, sizeof(SpeedTest_WorkerSamples));
+
+    /* Use a different name each time, in case the previous workers have not quite exited yet */
+    ++SpeedTest_RunNumber;
+    UtAssert_INT32_EQ(OS_CountSemCreate(&SpeedTest_StartSem, "Start", 0, 0), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_CountSemCreate(&SpeedTest_DoneSem, "Done", 0, 0), OS_SUCCESS);
+
+    for (started = 0; started < task_count; ++started)
     {
-        status = SEMOP(Take)(sem_id_1);
+        /* the narrow types keep the worst case name within OS_MAX_API_NAME */
+        snprintf(task_name, sizeof(task_name), "W%hu.%hu", (unsigned short)SpeedTest_RunNumber,
+                 (unsigned short)started);
+        status = OS_TaskCreate(&SpeedTest_WorkerIds[started], task_name, SpeedTest_WorkerEntry,
+                               OSAL_TASK_STACK_ALLOCATE, OSAL_SIZE_C(16384), OSAL_PRIORITY_C(SPEEDTEST_TASK_PRIORITY),
+                               0);
         if (status != OS_SUCCESS)
         {
-            OS_printf("TASK 1: Error calling SemTake 1: %d\n", (int)status);
+            UtAssert_Failed("Task %s create Rc=%d", task_name, (int)status);
             break;
         }
+    }
 
-        ++task_1_work;
+    OS_GetLocalTime(&start_time);
+    for (i = 0; i < started; ++i)
+    {
+        OS_CountSemGive(SpeedTest_StartSem);
+    }
 
-        status = SEMOP(Give)(sem_id_2);
+    for (i = 0; i < started; ++i)
+    {
+        status = OS_CountSemTimedWait(SpeedTest_DoneSem, SPEEDTEST_WORKER_TIMEOUT);
         if (status != OS_SUCCESS)
         {
-            OS_printf("TASK 1: Error calling SemGive 2: %d\n", (int)status);
+            UtAssert_Failed("%s %s: worker did not finish, Rc=%d", name, param, (int)status);
             break;
         }
     }
+
+    elapsed_ns = SpeedTest_ElapsedNs(start_time);
+
+    if (i == started)
+    {
+        /* gather all samples into one contiguous block */
+        sample_count = 0;
+        for (i = 0; i < started; ++i)
+        {
+            memmove(&SpeedTest_Samples[sample_count], &SpeedTest_Samples[i * SPEEDTEST_MAX_SAMPLES],
+                    SpeedTest_WorkerSamples[i] * sizeof(SpeedTest_Samples[0]));
+            sample_count += SpeedTest_WorkerSamples[i];
+        }
+
+        SpeedTest_Report(name, param, started, sample_count, elapsed_ns);
+    }
+    else
+    {
+        /* some workers are stuck, remove them so later runs are not affected */
+        for (i = 0; i < started; ++i)
+        {
+            OS_TaskDelete(SpeedTest_WorkerIds[i]);
+        }
+    }
+
+    UtAssert_INT32_EQ(OS_CountSemDelete(SpeedTest_StartSem), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_CountSemDelete(SpeedTest_DoneSem), OS_SUCCESS);
 }
 
-void task_2(void)
+/*
+ * Semaphore flip-flop.  Worker 0 measures the round trip.
+ */
+uint32 SpeedTest_SemWorker(uint32 worker, uint32 *samples)
 {
-    uint32 status;
+    OS_time_t start_time;
+    uint32    i;
 
-    OS_printf("Starting task 2\n");
+    for (i = 0; i < SpeedTest_Options.op_count; ++i)
+    {
+        if (worker == 0)
+        {
+            OS_GetLocalTime(&start_time);
+            if (SpeedTest_SemOps->Give(SpeedTest_ObjIds[1]) != OS_SUCCESS ||
+                SpeedTest_SemOps->Take(SpeedTest_ObjIds[0]) != OS_SUCCESS)
+            {
+                OS_printf("Worker %u: semaphore error\n", (unsigned int)worker);
+                break;
+            }
+            samples[i] = SpeedTest_ElapsedNs(start_time);
+        }
+        else if (SpeedTest_SemOps->Take(SpeedTest_ObjIds[1]) != OS_SUCCESS ||
+                 SpeedTest_SemOps->Give(SpeedTest_ObjIds[0]) != OS_SUCCESS)
+        {
+            OS_printf("Worker %u: semaphore error\n", (unsigned int)worker);
+            break;
+        }
+    }
 
-    while (task_2_work < SEMTEST_WORK_LIMIT)
+    return (worker == 0) ? i : 0;
+}
+
+void SpeedTest_SemFlipFlop(const char *name, const SpeedTest_SemOps_t *ops,
+                           int32 (*create)(osal_id_t *, const char *, uint32, uint32),
+                           int32 (*delete_func)(osal_id_t))
+{
+    SpeedTest_SemOps = ops;
+    UtAssert_INT32_EQ(create(&SpeedTest_ObjIds[0], "Sem1", 0, 0), OS_SUCCESS);
+    UtAssert_INT32_EQ(create(&SpeedTest_ObjIds[1], "Sem2", 0, 0), OS_SUCCESS);
+
+    SpeedTest_RunWorkers(name, "flip-flop", 2, SpeedTest_SemWorker);
+
+    UtAssert_INT32_EQ(delete_func(SpeedTest_ObjIds[0]), OS_SUCCESS);
+    UtAssert_INT32_EQ(delete_func(SpeedTest_ObjIds[1]), OS_SUCCESS);
+}
+
+void SpeedTest_BinSem(void)
+{
+    SpeedTest_SemFlipFlop("BinSem", &SpeedTest_BinSemOps, OS_BinSemCreate, OS_BinSemDelete);
+}
+
+void SpeedTest_CountSem(void)
+{
+    SpeedTest_SemFlipFlop("CountSem", &SpeedTest_CountSemOps, OS_CountSemCreate, OS_CountSemDelete);
+}
+
+/*
+ * Mutex contention.  Every worker measures each take/give pair.
+ */
+uint32 SpeedTest_MutexWorker(uint32 worker, uint32 *samples)
+{
+    OS_time_t start_time;
+    uint32    i;
+
+    for (i = 0; i < SpeedTest_Options.op_count; ++i)
     {
-        status = SEMOP(Take)(sem_id_2);
-        if (status != OS_SUCCESS)
+        OS_GetLocalTime(&start_time);
+        if (OS_MutSemTake(SpeedTest_ObjIds[0]) != OS_SUCCESS)
         {
-            OS_printf("TASK 2: Error calling SemTake 2: %d\n", (int)status);
+            OS_printf("Worker %u: mutex error\n", (unsigned int)worker);
             break;
         }
+        ++SpeedTest_Counter;
+        OS_MutSemGive(SpeedTest_ObjIds[0]);
+        samples[i] = SpeedTest_ElapsedNs(start_time);
+    }
+
+    return i;
+}
+
+void SpeedTest_MutexRun(const char *param, uint32 options)
+{
+    OS_mut_sem_prop_t prop;
+
+    SpeedTest_Counter = 0;
+    UtAssert_INT32_EQ(OS_MutSemCreate(&SpeedTest_ObjIds[0], "Mutex", options), OS_SUCCESS);
+
+    SpeedTest_RunWorkers("Mutex", param, SpeedTest_Options.task_count, SpeedTest_MutexWorker);
+
+    UtAssert_INT32_EQ(OS_MutSemGetInfo(SpeedTest_ObjIds[0], &prop), OS_SUCCESS);
+    UtAssert_MIR("Mutex %s: %lu of %lu takes contended", param, (unsigned long)prop.contended_count,
+                 (unsigned long)prop.take_count);
+
+    UtAssert_INT32_EQ(OS_MutSemDelete(SpeedTest_ObjIds[0]), OS_SUCCESS);
+}
+
+void SpeedTest_Mutex(void)
+{
+    SpeedTest_MutexRun("default", 0);
+    SpeedTest_MutexRun("adaptive", OS_MUTEX_FLAG_ADAPTIVE);
+}
+
+/*
+ * Condition variable flip-flop.  Worker 0 measures the round trip.
+ */
+uint32 SpeedTest_CondVarWorker(uint32 worker, uint32 *samples)
+{
+    OS_time_t start_time;
+    uint32    i;
+    int32     status;
+
+    status = OS_SUCCESS;
+    for (i = 0; i < SpeedTest_Options.op_count && status == OS_SUCCESS; ++i)
+    {
+        OS_GetLocalTime(&start_time);
+
+        status = OS_CondVarLock(SpeedTest_ObjIds[0]);
+        if (status == OS_SUCCESS)
+        {
+            /* wait for this worker's turn, then hand the turn to the other worker */
+            while (SpeedTest_Turn != worker && status == OS_SUCCESS)
+            {
+                status = OS_CondVarWait(SpeedTest_ObjIds[0]);
+            }
+            SpeedTest_Turn = 1 - worker;
+            OS_CondVarSignal(SpeedTest_ObjIds[0]);
+            OS_CondVarUnlock(SpeedTest_ObjIds[0]);
+        }
+
+        samples[i] = SpeedTest_ElapsedNs(start_time);
+    }
+
+    if (status != OS_SUCCESS)
+    {
+        OS_printf("Worker %u: condvar error %d\n", (unsigned int)worker, (int)status);
+    }
+
+    return (worker == 0) ? i : 0;
+}
+
+void SpeedTest_CondVar(void)
+{
+    SpeedTest_Turn = 0;
+    UtAssert_INT32_EQ(OS_CondVarCreate(&SpeedTest_ObjIds[0], "CondVar", 0), OS_SUCCESS);
 
-        ++task_2_work;
+    SpeedTest_RunWorkers("CondVar", "flip-flop", 2, SpeedTest_CondVarWorker);
 
-        status = SEMOP(Give)(sem_id_1);
+    UtAssert_INT32_EQ(OS_CondVarDelete(SpeedTest_ObjIds[0]), OS_SUCCESS);
+}
+
+/*
+ * Queue put and get, from a single task
+ */
+void SpeedTest_QueueRun(const char *type, uint32 flags, size_t msg_size)
+{
+    static uint8 msg_buffer[1024];
+    OS_time_t    start_time;
+    OS_time_t    run_start_time;
+    osal_id_t    queue_id;
+    size_t       size_copied;
+    uint32       i;
+    int32        status;
+    char         param[16];
+
+    snprintf(param, sizeof(param), "%s/%lu", type, (unsigned long)msg_size);
+
+    status = OS_QueueCreate(&queue_id, "Queue", OSAL_BLOCKCOUNT_C(4), msg_size, flags);
+    if (status != OS_SUCCESS)
+    {
+        UtAssert_MIR("Queue %s: not measured, OS_QueueCreate Rc=%d", param, (int)status);
+        return;
+    }
+
+    OS_GetLocalTime(&run_start_time);
+    for (i = 0; i < SpeedTest_Options.op_count; ++i)
+    {
+        OS_GetLocalTime(&start_time);
+        status = OS_QueuePut(queue_id, msg_buffer, msg_size, 0);
+        if (status == OS_SUCCESS)
+        {
+            status = OS_QueueGet(queue_id, msg_buffer, msg_size, &size_copied, OS_CHECK);
+        }
         if (status != OS_SUCCESS)
         {
-            OS_printf("TASK 2: Error calling SemGive 1: %d\n", (int)status);
+            UtAssert_Failed("Queue %s: put/get Rc=%d", param, (int)status);
             break;
         }
+        SpeedTest_Samples[i] = SpeedTest_ElapsedNs(start_time);
     }
+
+    SpeedTest_Report("Queue", param, 1, i, SpeedTest_ElapsedNs(run_start_time));
+
+    UtAssert_INT32_EQ(OS_QueueDelete(queue_id), OS_SUCCESS);
 }
 
-void UtTest_Setup(void)
+void SpeedTest_Queue(void)
 {
-    if (OS_API_Init() != OS_SUCCESS)
+    static const size_t MSG_SIZES[] = {8, 64, 1024};
+    uint32              i;
+
+    for (i = 0; i < sizeof(MSG_SIZES) / sizeof(MSG_SIZES[0]); ++i)
     {
-        UtAssert_Abort("OS_API_Init() failed");
+        SpeedTest_QueueRun("default", 0, MSG_SIZES[i]);
+        SpeedTest_QueueRun("ring", OS_QUEUE_FLAG_RING, MSG_SIZES[i]);
     }
+}
 
-    /* the test should call OS_API_Teardown() before exiting */
-    UtTest_AddTeardown(OS_API_Teardown, "Cleanup");
+/*
+ * ID lookup.  Every worker measures each OS_GetResourceName() call.
+ */
+uint32 SpeedTest_IdLookupWorker(uint32 worker, uint32 *samples)
+{
+    OS_time_t start_time;
+    char      name[OS_MAX_API_NAME];
+    uint32    i;
 
-    /*
-     * Register the test setup and check routines in UT assert
-     */
-    UtTest_Add(SemRun, SemSetup, NULL, "SemSpeedTest");
+    for (i = 0; i < SpeedTest_Options.op_count; ++i)
+    {
+        OS_GetLocalTime(&start_time);
+        if (OS_GetResourceName(SpeedTest_ObjIds[0], name, sizeof(name)) != OS_SUCCESS)
+        {
+            OS_printf("Worker %u: lookup error\n", (unsigned int)worker);
+            break;
+        }
+        samples[i] = SpeedTest_ElapsedNs(start_time);
+    }
+
+    return i;
 }
 
-void SemSetup(void)
+void SpeedTest_IdLookup(void)
 {
-    uint32 status;
+    UtAssert_INT32_EQ(OS_BinSemCreate(&SpeedTest_ObjIds[0], "Lookup", 0, 0), OS_SUCCESS);
 
-    task_1_work = 0;
-    task_2_work = 0;
+    SpeedTest_RunWorkers("IdLookup", "GetResourceName", SpeedTest_Options.task_count, SpeedTest_IdLookupWorker);
 
-    /*
-    ** Create the Bin semaphore
-    */
-    status = SEMOP(Create)(&sem_id_1, "Sem1", 0, 0);
-    UtAssert_True(status == OS_SUCCESS, "Sem 1 create Id=%lx Rc=%d", OS_ObjectIdToInteger(sem_id_1), (int)status);
-    status = SEMOP(Create)(&sem_id_2, "Sem2", 0, 0);
-    UtAssert_True(status == OS_SUCCESS, "Sem 2 create Id=%lx Rc=%d", OS_ObjectIdToInteger(sem_id_2), (int)status);
+    UtAssert_INT32_EQ(OS_BinSemDelete(SpeedTest_ObjIds[0]), OS_SUCCESS);
+}
 
-    /*
-    ** Create the tasks
-    */
-    status = OS_TaskCreate(&task_1_id, "Task 1", task_1, OSAL_TASK_STACK_ALLOCATE, OSAL_SIZE_C(4096),
-                           OSAL_PRIORITY_C(SEMTEST_TASK_PRIORITY), 0);
-    UtAssert_True(status == OS_SUCCESS, "Task 1 create Id=%lx Rc=%d", OS_ObjectIdToInteger(task_1_id), (int)status);
+/*
+ * Timer callback jitter.  Each sample is the difference between
+ * the actual and expected time since the previous callback.
+ */
+void SpeedTest_TimerCallback(osal_id_t timer_id)
+{
+    OS_time_t now;
+    int64     interval_ns;
+    int64     jitter_ns;
+
+    OS_GetLocalTime(&now);
+
+    if (SpeedTest_TimerCount > 0 && SpeedTest_TimerCount <= SPEEDTEST_TIMER_SAMPLES)
+    {
+        interval_ns = OS_TimeGetTotalNanoseconds(OS_TimeSubtract(now, SpeedTest_TimerLast));
+        jitter_ns   = interval_ns - (SPEEDTEST_TIMER_INTERVAL * 1000);
+        if (jitter_ns < 0)
+        {
+            jitter_ns = -jitter_ns;
+        }
+
+        SpeedTest_Samples[SpeedTest_TimerCount - 1] = jitter_ns;
+    }
+
+    SpeedTest_TimerLast = now;
+    ++SpeedTest_TimerCount;
+}
+
+void SpeedTest_Timer(void)
+{
+    osal_id_t timer_id;
+    uint32    accuracy;
+    uint32    i;
+    OS_time_t start_time;
+    int64     elapsed_ns;
+
+    SpeedTest_TimerCount = 0;
+    UtAssert_INT32_EQ(OS_TimerCreate(&timer_id, "Timer", &accuracy, SpeedTest_TimerCallback), OS_SUCCESS);
+
+    OS_GetLocalTime(&start_time);
+    UtAssert_INT32_EQ(OS_TimerSet(timer_id, SPEEDTEST_TIMER_INTERVAL, SPEEDTEST_TIMER_INTERVAL), OS_SUCCESS);
+
+    /* wait for all samples, allowing for a slow timer */
+    for (i = 0; i < 20 && SpeedTest_TimerCount <= SPEEDTEST_TIMER_SAMPLES; ++i)
+    {
+        OS_TaskDelay((SPEEDTEST_TIMER_SAMPLES * SPEEDTEST_TIMER_INTERVAL) / 1000);
+    }
+
+    UtAssert_INT32_EQ(OS_TimerDelete(timer_id), OS_SUCCESS);
+    elapsed_ns = SpeedTest_ElapsedNs(start_time);
+
+    if (SpeedTest_TimerCount > SPEEDTEST_TIMER_SAMPLES)
+    {
+        SpeedTest_Report("Timer", "jitter", 1, SPEEDTEST_TIMER_SAMPLES, elapsed_ns);
+    }
+    else
+    {
+        UtAssert_Failed("Timer: only %lu callbacks", (unsigned long)SpeedTest_TimerCount);
+    }
+}
+
+/*
+ * OS_printf of a short line
+ */
+void SpeedTest_Printf(void)
+{
+    OS_time_t start_time;
+    OS_time_t run_start_time;
+    uint32    i;
 
-    status = OS_TaskCreate(&task_2_id, "Task 2", task_2, OSAL_TASK_STACK_ALLOCATE, OSAL_SIZE_C(4096),
-                           OSAL_PRIORITY_C(SEMTEST_TASK_PRIORITY), 0);
-    UtAssert_True(status == OS_SUCCESS, "Task 2 create Id=%lx Rc=%d", OS_ObjectIdToInteger(task_2_id), (int)status);
+    OS_GetLocalTime(&run_start_time);
+    for (i = 0; i < SPEEDTEST_PRINTF_SAMPLES; ++i)
+    {
+        OS_GetLocalTime(&start_time);
+        OS_printf("Speed test line %lu\n", (unsigned long)i);
+        SpeedTest_Samples[i] = SpeedTest_ElapsedNs(start_time);
+    }
 
-    /* A small delay just to allow the tasks
-     * to start and pend on the sem */
-    OS_TaskDelay(10);
+    SpeedTest_Report("OS_printf", "short line", 1, SPEEDTEST_PRINTF_SAMPLES, SpeedTest_ElapsedNs(run_start_time));
 }
 
-void SemRun(void)
+/*
+ * Write all results in the requested format
+ */
+void SpeedTest_Output(void)
 {
-    int32 status;
+    FILE *                    fp;
+    uint32                    i;
+    const SpeedTest_Result_t *result;
+
+    if (SpeedTest_Options.format == SPEEDTEST_FORMAT_NONE)
+    {
+        return;
+    }
+
+    if (SpeedTest_Options.output_file == NULL)
+    {
+        fp = stdout;
+    }
+    else
+    {
+        fp = fopen(SpeedTest_Options.output_file, "w");
+        if (fp == NULL)
+        {
+            UtAssert_Failed("Unable to open %s", SpeedTest_Options.output_file);
+            return;
+        }
+    }
 
-    /* Give the initial sem that starts the loop */
-    SEMOP(Give)(sem_id_1);
+    if (SpeedTest_Options.format == SPEEDTEST_FORMAT_CSV)
+    {
+        fprintf(fp, "name,param,tasks,ops,ops_per_sec,p50_ns,p99_ns,p999_ns,max_ns\n");
+    }
+    else
+    {
+        fprintf(fp, "[\n");
+    }
 
-    /* Time Limited Execution */
-    OS_TaskDelay(5000);
+    for (i = 0; i < SpeedTest_ResultCount; ++i)
+    {
+        result = &SpeedTest_Results[i];
+        if (SpeedTest_Options.format == SPEEDTEST_FORMAT_CSV)
+        {
+            fprintf(fp, "%s,%s,%lu,%lu,%.0f,%lu,%lu,%lu,%lu\n", result->name, result->param,
+                    (unsigned long)result->task_count, (unsigned long)result->op_count, result->ops_per_sec,
+                    (unsigned long)result->p50_ns, (unsigned long)result->p99_ns, (unsigned long)result->p999_ns,
+                    (unsigned long)result->max_ns);
+        }
+        else
+        {
+            fprintf(fp,
+                    "  {\"name\": \"%s\", \"param\": \"%s\", \"tasks\": %lu, \"ops\": %lu, \"ops_per_sec\": %.0f, "
+                    "\"p50_ns\": %lu, \"p99_ns\": %lu, \"p999_ns\": %lu, \"max_ns\": %lu}%s\n",
+                    result->name, result->param, (unsigned long)result->task_count, (unsigned long)result->op_count,
+                    result->ops_per_sec, (unsigned long)result->p50_ns, (unsigned long)result->p99_ns,
+                    (unsigned long)result->p999_ns, (unsigned long)result->max_ns,
+                    (i + 1 < SpeedTest_ResultCount) ? "," : "");
+        }
+    }
+
+    if (SpeedTest_Options.format == SPEEDTEST_FORMAT_JSON)
+    {
+        fprintf(fp, "]\n");
+    }
+
+    if (fp != stdout)
+    {
+        fclose(fp);
+    }
+}
+
+/*
+ * Get the options from the command line.  Options which are
+ * not recognized are ignored, as they may be for UT assert.
+ */
+void SpeedTest_ParseOptions(void)
+{
+    uint32       argc;
+    char *const *argv;
+    uint32       i;
+
+    memset(&SpeedTest_Options, 0, sizeof(SpeedTest_Options));
+    SpeedTest_Options.task_count = 2;
+    SpeedTest_Options.op_count   = SPEEDTEST_MAX_SAMPLES;
+
+    argc = OS_BSP_GetArgC();
+    argv = OS_BSP_GetArgV();
+    for (i = 1; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "-p") == 0)
+        {
+            SpeedTest_Options.pin_cpus = true;
+        }
+        else if (i + 1 < argc)
+        {
+            if (strcmp(argv[i], "-t") == 0)
+            {
+                SpeedTest_Options.task_count = strtoul(argv[++i], NULL, 0);
+            }
+            else if (strcmp(argv[i], "-n") == 0)
+            {
+                SpeedTest_Options.op_count = strtoul(argv[++i], NULL, 0);
+            }
+            else if (strcmp(argv[i], "-f") == 0)
+            {
+                ++i;
+                if (strcmp(argv[i], "csv") == 0)
+                {
+                    SpeedTest_Options.format = SPEEDTEST_FORMAT_CSV;
+                }
+                else if (strcmp(argv[i], "json") == 0)
+                {
+                    SpeedTest_Options.format = SPEEDTEST_FORMAT_JSON;
+                }
+            }
+            else if (strcmp(argv[i], "-o") == 0)
+            {
+                SpeedTest_Options.output_file = argv[++i];
+            }
+        }
+    }
+
+    if (SpeedTest_Options.task_count < 1)
+    {
+        SpeedTest_Options.task_count = 1;
+    }
+    if (SpeedTest_Options.task_count > SPEEDTEST_MAX_TASKS)
+    {
+        SpeedTest_Options.task_count = SPEEDTEST_MAX_TASKS;
+    }
+    if (SpeedTest_Options.op_count < 1)
+    {
+        SpeedTest_Options.op_count = 1;
+    }
+    if (SpeedTest_Options.op_count > SPEEDTEST_MAX_SAMPLES)
+    {
+        SpeedTest_Options.op_count = SPEEDTEST_MAX_SAMPLES;
+    }
+    if (SpeedTest_Options.format == SPEEDTEST_FORMAT_NONE && SpeedTest_Options.output_file != NULL)
+    {
+        SpeedTest_Options.format = SPEEDTEST_FORMAT_CSV;
+    }
+}
+
+void UtTest_Setup(void)
+{
+    if (OS_API_Init() != OS_SUCCESS)
+    {
+        UtAssert_Abort("OS_API_Init() failed");
+    }
+
+    /* the test should call OS_API_Teardown() before exiting */
+    UtTest_AddTeardown(OS_API_Teardown, "Cleanup");
+
+    SpeedTest_ParseOptions();
+    SpeedTest_ResultCount = 0;
 
     /*
-    ** Delete resources
-    **
-    ** NOTE: if the work limit was reached, the
-    ** OS_TaskDelete calls may return non-success.
-    */
-    status = OS_TaskDelete(task_1_id);
-    UtAssert_True(status == OS_SUCCESS, "Task 1 delete Rc=%d", (int)status);
-
-    status = OS_TaskDelete(task_2_id);
-    UtAssert_True(status == OS_SUCCESS, "Task 2 delete Rc=%d", (int)status);
-
-    status = SEMOP(Delete)(sem_id_1);
-    UtAssert_True(status == OS_SUCCESS, "Sem 1 delete Rc=%d", (int)status);
-    status = SEMOP(Delete)(sem_id_2);
-    UtAssert_True(status == OS_SUCCESS, "Sem 2 delete Rc=%d", (int)status);
-
-    /* Task 1 and 2 should have both executed */
-    UtAssert_True(task_1_work != 0, "Task 1 work counter = %u", (unsigned int)task_1_work);
-    UtAssert_True(task_2_work != 0, "Task 2 work counter = %u", (unsigned int)task_2_work);
+     * Register the test routines in UT assert
+     */
+    UtTest_Add(SpeedTest_BinSem, NULL, NULL, "BinSem");
+    UtTest_Add(SpeedTest_CountSem, NULL, NULL, "CountSem");
+    UtTest_Add(SpeedTest_Mutex, NULL, NULL, "Mutex");
+    UtTest_Add(SpeedTest_CondVar, NULL, NULL, "CondVar");
+    UtTest_Add(SpeedTest_Queue, NULL, NULL, "Queue");
+    UtTest_Add(SpeedTest_IdLookup, NULL, NULL, "IdLookup");
+    UtTest_Add(SpeedTest_Timer, NULL, NULL, "Timer");
+    UtTest_Add(SpeedTest_Printf, NULL, NULL, "OS_printf");
+    UtTest_Add(SpeedTest_Output, NULL, NULL, "Output");
 }
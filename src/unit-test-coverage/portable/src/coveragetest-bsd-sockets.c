@@ -353,6 +353,107 @@ void Test_OS_SocketSendTo_Impl(void)
     OSAPI_TEST_FUNCTION_RC(OS_SocketSendTo_Impl, (&token, buffer, sizeof(buffer), &addr), OS_SUCCESS);
 }
 
+void Test_OS_SocketSendToV_Impl(void)
+{
+    OS_object_token_t    token                  = {0};
+    uint8                buffer[UT_BUFFER_SIZE] = {0};
+    OS_iovec_t           iov[2];
+    OS_SockAddr_t        addr = {0};
+    struct OCS_sockaddr *sa   = (struct OCS_sockaddr *)&addr.AddrData;
+
+    /* Set up token and segments */
+    token.obj_idx = UT_INDEX_0;
+    iov[0].Buffer = buffer;
+    iov[0].Length = 4;
+    iov[1].Buffer = &buffer[4];
+    iov[1].Length = sizeof(buffer) - 4;
+
+    /* Bad address length */
+    sa->sa_family     = -1;
+    addr.ActualLength = sizeof(struct OCS_sockaddr_in);
+    OSAPI_TEST_FUNCTION_RC(OS_SocketSendToV_Impl, (&token, iov, 2, &addr), OS_ERR_BAD_ADDRESS);
+    UtAssert_STUB_COUNT(OCS_sendmsg, 0);
+
+    /* AF_INET, failed sendmsg */
+    sa->sa_family = OCS_AF_INET;
+    UT_SetDeferredRetcode(UT_KEY(OCS_sendmsg), 1, -1);
+    OSAPI_TEST_FUNCTION_RC(OS_SocketSendToV_Impl, (&token, iov, 2, &addr), OS_ERROR);
+
+    /* AF_INET6, success */
+    sa->sa_family     = OCS_AF_INET6;
+    addr.ActualLength = sizeof(struct OCS_sockaddr_in6);
+    UT_SetDeferredRetcode(UT_KEY(OCS_sendmsg), 1, sizeof(buffer));
+    OSAPI_TEST_FUNCTION_RC(OS_SocketSendToV_Impl, (&token, iov, 2, &addr), sizeof(buffer));
+}
+
+void Test_OS_SocketRecvFromMulti_Impl(void)
+{
+    OS_object_token_t token = {0};
+    uint8             buffer[UT_BUFFER_SIZE];
+    OS_SockMsg_t      msgs[3];
+    uint32            i;
+
+    /* Set up token and messages */
+    token.obj_idx = UT_INDEX_0;
+    memset(msgs, 0, sizeof(msgs));
+    for (i = 0; i < 3; ++i)
+    {
+        msgs[i].Buffer  = buffer;
+        msgs[i].BufSize = sizeof(buffer);
+    }
+
+    /* Failure on the first message is returned as-is */
+    OS_impl_filehandle_table[0].selectable = true;
+    UT_SetDeferredRetcode(UT_KEY(OS_SelectSingle_Impl), 1, UT_ERR_UNIQUE);
+    OSAPI_TEST_FUNCTION_RC(OS_SocketRecvFromMulti_Impl, (&token, msgs, 3, OS_TIME_MAX), UT_ERR_UNIQUE);
+
+    /* Receives until nothing more is queued, then returns the count */
+    OS_impl_filehandle_table[0].selectable = false;
+    OCS_errno                              = OCS_EAGAIN;
+    UT_SetDefaultReturnValue(UT_KEY(OCS_recvfrom), 4);
+    UT_SetDeferredRetcode(UT_KEY(OCS_recvfrom), 3, -1);
+    OSAPI_TEST_FUNCTION_RC(OS_SocketRecvFromMulti_Impl, (&token, msgs, 3, OS_TIME_MAX), 2);
+    UtAssert_UINT32_EQ(msgs[0].ActualSize, 4);
+    UtAssert_UINT32_EQ(msgs[1].ActualSize, 4);
+    UtAssert_UINT32_EQ(msgs[2].ActualSize, 0);
+
+    /* All messages received */
+    OSAPI_TEST_FUNCTION_RC(OS_SocketRecvFromMulti_Impl, (&token, msgs, 3, OS_TIME_MAX), 3);
+}
+
+void Test_OS_SocketSendToMulti_Impl(void)
+{
+    OS_object_token_t    token                  = {0};
+    uint8                buffer[UT_BUFFER_SIZE] = {0};
+    OS_SockMsg_t         msgs[2];
+    struct OCS_sockaddr *sa;
+
+    /* Set up token and messages */
+    token.obj_idx = UT_INDEX_0;
+    memset(msgs, 0, sizeof(msgs));
+    msgs[0].Buffer            = buffer;
+    msgs[0].BufSize           = sizeof(buffer);
+    msgs[0].Addr.ActualLength = sizeof(struct OCS_sockaddr_in);
+    sa                        = (struct OCS_sockaddr *)&msgs[0].Addr.AddrData;
+    sa->sa_family             = OCS_AF_INET;
+    msgs[1]                   = msgs[0];
+
+    /* Failure on the first message is returned as-is */
+    sa->sa_family = -1;
+    OSAPI_TEST_FUNCTION_RC(OS_SocketSendToMulti_Impl, (&token, msgs, 2), OS_ERR_BAD_ADDRESS);
+
+    /* Failure on a later message stops the batch */
+    sa->sa_family = OCS_AF_INET;
+    UT_SetDefaultReturnValue(UT_KEY(OCS_sendto), sizeof(buffer));
+    UT_SetDeferredRetcode(UT_KEY(OCS_sendto), 2, -1);
+    OSAPI_TEST_FUNCTION_RC(OS_SocketSendToMulti_Impl, (&token, msgs, 2), 1);
+    UtAssert_UINT32_EQ(msgs[0].ActualSize, sizeof(buffer));
+
+    /* All messages sent */
+    OSAPI_TEST_FUNCTION_RC(OS_SocketSendToMulti_Impl, (&token, msgs, 2), 2);
+    UtAssert_UINT32_EQ(msgs[1].ActualSize, sizeof(buffer));
+}
+
 void Test_OS_SocketGetInfo_Impl(void)
 {
     OSAPI_TEST_FUNCTION_RC(OS_SocketGetInfo_Impl, (NULL, NULL), OS_SUCCESS);
@@ -504,6 +605,9 @@ void UtTest_Setup(void)
     ADD_TEST(OS_SocketAccept_Impl);
     ADD_TEST(OS_SocketRecvFrom_Impl);
     ADD_TEST(OS_SocketSendTo_Impl);
+    ADD_TEST(OS_SocketSendToV_Impl);
+    ADD_TEST(OS_SocketRecvFromMulti_Impl);
+    ADD_TEST(OS_SocketSendToMulti_Impl);
     ADD_TEST(OS_SocketGetInfo_Impl);
     ADD_TEST(OS_SocketAddrInit_Impl);
     ADD_TEST(OS_SocketAddrToString_Impl);
@@ -48,16 +48,25 @@ void Test_OS_ConsoleOutput_Impl(void)
     OS_console_table[0].BufBase = TestConsoleBspBuffer;
     OS_console_table[0].BufSize = sizeof(TestConsoleBspBuffer);
 
-    UT_SetDataBuffer(UT_KEY(OCS_OS_BSP_ConsoleOutput_Impl), TestOutputBuffer, sizeof(TestOutputBuffer), false);
+    UT_SetDataBuffer(UT_KEY(OCS_OS_BSP_ConsoleOutputPair_Impl), TestOutputBuffer, sizeof(TestOutputBuffer), false);
 
     OS_console_table[0].WritePos = 4;
     OS_ConsoleOutput_Impl(&token);
     UtAssert_True(strcmp(TestOutputBuffer, "abcd") == 0, "TestOutputBuffer (%s) == abcd", TestOutputBuffer);
+    UtAssert_UINT32_EQ(OS_console_table[0].ReadPos, 4);
 
+    /* the wrapped data is written in a single call */
     OS_console_table[0].WritePos = 2;
     OS_ConsoleOutput_Impl(&token);
     UtAssert_True(strcmp(TestOutputBuffer, "abcdefghijklmnopab") == 0, "TestOutputBuffer (%s) == abcdefghijklmnopab",
                   TestOutputBuffer);
+    UtAssert_STUB_COUNT(OCS_OS_BSP_ConsoleOutputPair_Impl, 2);
+    UtAssert_UINT32_EQ(OS_console_table[0].ReadPos, 2);
+    UtAssert_UINT32_EQ(OS_console_table[0].BytesWritten, 18);
+
+    /* nothing to write */
+    OS_ConsoleOutput_Impl(&token);
+    UtAssert_STUB_COUNT(OCS_OS_BSP_ConsoleOutputPair_Impl, 2);
 }
 
 /* ------------------- End of test cases --------------------------------------*/
@@ -0,0 +1,114 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ * \ingroup  portable
+ *
+ */
+
+#include "os-portable-coveragetest.h"
+#include "os-shared-idmap.h"
+#include "os-shared-select.h"
+
+void Test_OS_SelectGroupCreate_Impl(void)
+{
+    /* Test Case For:
+     * int32 OS_SelectGroupCreate_Impl(const OS_object_token_t *token, uint32 options)
+     */
+    OSAPI_TEST_FUNCTION_RC(OS_SelectGroupCreate_Impl, (UT_INDEX_0, 0), OS_ERR_NOT_IMPLEMENTED);
+}
+
+void Test_OS_SelectGroupDelete_Impl(void)
+{
+    /* Test Case For:
+     * int32 OS_SelectGroupDelete_Impl(const OS_object_token_t *token)
+     */
+    OSAPI_TEST_FUNCTION_RC(OS_SelectGroupDelete_Impl, (UT_INDEX_0), OS_ERR_NOT_IMPLEMENTED);
+}
+
+void Test_OS_SelectGroupAdd_Impl(void)
+{
+    /* Test Case For:
+     * int32 OS_SelectGroupAdd_Impl(const OS_object_token_t *token, const OS_object_token_t *stream_token,
+     *                              uint32 StateFlags)
+     */
+    OS_object_token_t token        = {0};
+    OS_object_token_t stream_token = {0};
+
+    OSAPI_TEST_FUNCTION_RC(OS_SelectGroupAdd_Impl, (&token, &stream_token, OS_STREAM_STATE_READABLE),
+                           OS_ERR_NOT_IMPLEMENTED);
+}
+
+void Test_OS_SelectGroupRemove_Impl(void)
+{
+    /* Test Case For:
+     * int32 OS_SelectGroupRemove_Impl(const OS_object_token_t *token, const OS_object_token_t *stream_token)
+     */
+    OS_object_token_t token        = {0};
+    OS_object_token_t stream_token = {0};
+
+    OSAPI_TEST_FUNCTION_RC(OS_SelectGroupRemove_Impl, (&token, &stream_token), OS_ERR_NOT_IMPLEMENTED);
+}
+
+void Test_OS_SelectGroupWait_Impl(void)
+{
+    /* Test Case For:
+     * int32 OS_SelectGroupWait_Impl(const OS_object_token_t *token, OS_SelectGroupEvent_t *Events, uint32 MaxEvents,
+     *                               uint32 *EventCount, OS_time_t abs_timeout)
+     */
+    OS_SelectGroupEvent_t Events[1];
+    uint32                EventCount;
+
+    OSAPI_TEST_FUNCTION_RC(OS_SelectGroupWait_Impl, (UT_INDEX_0, Events, 1, &EventCount, OS_TIME_MAX),
+                           OS_ERR_NOT_IMPLEMENTED);
+}
+
+/* ------------------- End of test cases --------------------------------------*/
+
+/* Osapi_Test_Setup
+ *
+ * Purpose:
+ *   Called by the unit test tool to set up the app prior to each test
+ */
+void Osapi_Test_Setup(void)
+{
+    UT_ResetState(0);
+}
+
+/*
+ * Osapi_Test_Teardown
+ *
+ * Purpose:
+ *   Called by the unit test tool to tear down the app after each test
+ */
+void Osapi_Test_Teardown(void) {}
+
+/* UtTest_Setup
+ *
+ * Purpose:
+ *   Registers the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    ADD_TEST(OS_SelectGroupCreate_Impl);
+    ADD_TEST(OS_SelectGroupDelete_Impl);
+    ADD_TEST(OS_SelectGroupAdd_Impl);
+    ADD_TEST(OS_SelectGroupRemove_Impl);
+    ADD_TEST(OS_SelectGroupWait_Impl);
+}
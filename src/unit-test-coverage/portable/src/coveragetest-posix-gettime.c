@@ -55,6 +55,53 @@ void Test_OS_SetLocalTime_Impl(void)
     OSAPI_TEST_FUNCTION_RC(OS_SetLocalTime_Impl, (&timeval), OS_ERROR);
 }
 
+void Test_OS_GetMonotonicTime_Impl(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_GetMonotonicTime_Impl(OS_time_t *time_struct)
+     */
+    OS_time_t timeval = {0};
+
+    OSAPI_TEST_FUNCTION_RC(OS_GetMonotonicTime_Impl, (&timeval), OS_SUCCESS);
+
+    UT_SetDefaultReturnValue(UT_KEY(OCS_clock_gettime), -1);
+    OSAPI_TEST_FUNCTION_RC(OS_GetMonotonicTime_Impl, (&timeval), OS_ERROR);
+}
+
+void Test_OS_GetCoarseTime_Impl(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_GetCoarseTime_Impl(OS_time_t *time_struct)
+     */
+    OS_time_t timeval = {0};
+
+    OSAPI_TEST_FUNCTION_RC(OS_GetCoarseTime_Impl, (&timeval), OS_SUCCESS);
+
+    UT_SetDefaultReturnValue(UT_KEY(OCS_clock_gettime), -1);
+    OSAPI_TEST_FUNCTION_RC(OS_GetCoarseTime_Impl, (&timeval), OS_ERROR);
+}
+
+void Test_OS_GetRawCounter_Impl(void)
+{
+    /*
+     * Test Case For:
+     * uint64 OS_GetRawCounter_Impl(void)
+     * uint64 OS_GetRawCounterFreq_Impl(void)
+     *
+     * The counter and its rate depend on the CPU this is built for
+     */
+    uint64 count1;
+    uint64 count2;
+
+    count1 = OS_GetRawCounter_Impl();
+    count2 = OS_GetRawCounter_Impl();
+    UtAssert_True(count2 >= count1, "OS_GetRawCounter_Impl() does not go backwards");
+
+    UtAssert_VOIDCALL(OS_GetRawCounterFreq_Impl());
+}
+
 /* ------------------- End of test cases --------------------------------------*/
 
 /* Osapi_Test_Setup
@@ -86,4 +133,7 @@ void UtTest_Setup(void)
 {
     ADD_TEST(OS_GetLocalTime_Impl);
     ADD_TEST(OS_SetLocalTime_Impl);
+    ADD_TEST(OS_GetMonotonicTime_Impl);
+    ADD_TEST(OS_GetCoarseTime_Impl);
+    ADD_TEST(OS_GetRawCounter_Impl);
 }
@@ -34,6 +34,7 @@
 #include "OCS_unistd.h"
 #include "OCS_fcntl.h"
 #include "OCS_errno.h"
+#include "OCS_sys_uio.h"
 
 /* OS_SelectSingle_Impl hook to clear SelectFlags */
 static int32 UT_Hook_OS_SelectSingle_Impl(void *UserObj, int32 StubRetcode, uint32 CallCount,
@@ -101,6 +102,84 @@ void Test_OS_GenericSeek_Impl(void)
     OSAPI_TEST_FUNCTION_RC(OS_GenericSeek_Impl, (&token, 0, OS_SEEK_END), OS_ERR_OPERATION_NOT_SUPPORTED);
 }
 
+void Test_OS_GenericSeek64_Impl(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_GenericSeek64_Impl(const OS_object_token_t *token, osal_offset_t offset, uint32 whence,
+     *                             osal_offset_t *position)
+     */
+    OS_object_token_t token;
+    osal_offset_t     position;
+
+    memset(&token, 0, sizeof(token));
+
+    position = 0;
+    UT_SetDefaultReturnValue(UT_KEY(OCS_lseek), 444);
+    OSAPI_TEST_FUNCTION_RC(OS_GenericSeek64_Impl, (&token, 0, OS_SEEK_SET, &position), OS_SUCCESS);
+    UtAssert_INT32_EQ(position, 444);
+
+    /* bad whence */
+    OSAPI_TEST_FUNCTION_RC(OS_GenericSeek64_Impl, (&token, 0, 1234, &position), OS_ERROR);
+
+    /* generic failure of lseek() */
+    OCS_errno = 0;
+    UT_SetDefaultReturnValue(UT_KEY(OCS_lseek), -1);
+    OSAPI_TEST_FUNCTION_RC(OS_GenericSeek64_Impl, (&token, 0, OS_SEEK_END, &position), OS_ERROR);
+
+    OCS_errno = OCS_ESPIPE;
+    OSAPI_TEST_FUNCTION_RC(OS_GenericSeek64_Impl, (&token, 0, OS_SEEK_END, &position),
+                           OS_ERR_OPERATION_NOT_SUPPORTED);
+}
+
+void Test_OS_GenericPread_Impl(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_GenericPread_Impl(const OS_object_token_t *token, void *buffer, size_t nbytes, osal_offset_t offset)
+     */
+    OS_object_token_t token;
+    char              DestData[4] = {0};
+
+    memset(&token, 0, sizeof(token));
+
+    OSAPI_TEST_FUNCTION_RC(OS_GenericPread_Impl, (&token, DestData, sizeof(DestData), 0), sizeof(DestData));
+    UtAssert_STUB_COUNT(OCS_pread, 1);
+
+    OCS_errno = 0;
+    UT_SetDefaultReturnValue(UT_KEY(OCS_pread), -1);
+    OSAPI_TEST_FUNCTION_RC(OS_GenericPread_Impl, (&token, DestData, sizeof(DestData), 0), OS_ERROR);
+
+    /* pipes and sockets do not support positional reads */
+    OCS_errno = OCS_ESPIPE;
+    OSAPI_TEST_FUNCTION_RC(OS_GenericPread_Impl, (&token, DestData, sizeof(DestData), 0),
+                           OS_ERR_OPERATION_NOT_SUPPORTED);
+}
+
+void Test_OS_GenericPwrite_Impl(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_GenericPwrite_Impl(const OS_object_token_t *token, const void *buffer, size_t nbytes,
+     *                             osal_offset_t offset)
+     */
+    OS_object_token_t token;
+    char              SrcData[4] = "ABC";
+
+    memset(&token, 0, sizeof(token));
+
+    OSAPI_TEST_FUNCTION_RC(OS_GenericPwrite_Impl, (&token, SrcData, sizeof(SrcData), 0), sizeof(SrcData));
+    UtAssert_STUB_COUNT(OCS_pwrite, 1);
+
+    OCS_errno = 0;
+    UT_SetDefaultReturnValue(UT_KEY(OCS_pwrite), -1);
+    OSAPI_TEST_FUNCTION_RC(OS_GenericPwrite_Impl, (&token, SrcData, sizeof(SrcData), 0), OS_ERROR);
+
+    OCS_errno = OCS_ESPIPE;
+    OSAPI_TEST_FUNCTION_RC(OS_GenericPwrite_Impl, (&token, SrcData, sizeof(SrcData), 0),
+                           OS_ERR_OPERATION_NOT_SUPPORTED);
+}
+
 void Test_OS_GenericRead_Impl(void)
 {
     /*
@@ -183,6 +262,92 @@ void Test_OS_GenericWrite_Impl(void)
     UT_SetHookFunction(UT_KEY(OS_SelectSingle_Impl), NULL, NULL);
 }
 
+void Test_OS_GenericReadv_Impl(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_GenericReadv_Impl(const OS_object_token_t *token, const OS_iovec_t *iov, uint32 iovcnt,
+     *                           OS_time_t abs_timeout)
+     */
+    char              Data[12] = {0};
+    OS_iovec_t        Iov[2];
+    OS_object_token_t token;
+
+    memset(&token, 0, sizeof(token));
+    Iov[0].Buffer = &Data[0];
+    Iov[0].Length = 4;
+    Iov[1].Buffer = &Data[4];
+    Iov[1].Length = sizeof(Data) - 4;
+
+    UT_SetDeferredRetcode(UT_KEY(OCS_readv), 1, sizeof(Data));
+    UT_PortablePosixIOTest_Set_Selectable(UT_INDEX_0, false);
+    OSAPI_TEST_FUNCTION_RC(OS_GenericReadv_Impl, (&token, Iov, 2, OS_TIME_MIN), sizeof(Data));
+    UtAssert_STUB_COUNT(OS_SelectSingle_Impl, 0);
+
+    /* test invocation of select() in nonblocking mode */
+    UT_SetDeferredRetcode(UT_KEY(OCS_readv), 1, sizeof(Data));
+    UT_PortablePosixIOTest_Set_Selectable(UT_INDEX_0, true);
+    OSAPI_TEST_FUNCTION_RC(OS_GenericReadv_Impl, (&token, Iov, 2, OS_TIME_MIN), sizeof(Data));
+    UtAssert_STUB_COUNT(OS_SelectSingle_Impl, 1);
+
+    /* readv() failure */
+    UT_SetDeferredRetcode(UT_KEY(OCS_readv), 1, -1);
+    OSAPI_TEST_FUNCTION_RC(OS_GenericReadv_Impl, (&token, Iov, 2, OS_TIME_MIN), OS_ERROR);
+
+    /* Fail select */
+    UT_SetDeferredRetcode(UT_KEY(OS_SelectSingle_Impl), 1, OS_ERROR_TIMEOUT);
+    OSAPI_TEST_FUNCTION_RC(OS_GenericReadv_Impl, (&token, Iov, 2, OS_TIME_MIN), OS_ERROR_TIMEOUT);
+
+    /* Not readable */
+    UT_SetHookFunction(UT_KEY(OS_SelectSingle_Impl), UT_Hook_OS_SelectSingle_Impl, NULL);
+    OSAPI_TEST_FUNCTION_RC(OS_GenericReadv_Impl, (&token, Iov, 2, OS_TIME_MIN), OS_SUCCESS);
+    UT_SetHookFunction(UT_KEY(OS_SelectSingle_Impl), NULL, NULL);
+    UtAssert_STUB_COUNT(OCS_readv, 3);
+}
+
+void Test_OS_GenericWritev_Impl(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_GenericWritev_Impl(const OS_object_token_t *token, const OS_iovec_t *iov, uint32 iovcnt,
+     *                           OS_time_t abs_timeout)
+     */
+    char              Data[12] = {0};
+    OS_iovec_t        Iov[2];
+    OS_object_token_t token;
+
+    memset(&token, 0, sizeof(token));
+    Iov[0].Buffer = &Data[0];
+    Iov[0].Length = 4;
+    Iov[1].Buffer = &Data[4];
+    Iov[1].Length = sizeof(Data) - 4;
+
+    UT_SetDeferredRetcode(UT_KEY(OCS_writev), 1, sizeof(Data));
+    UT_PortablePosixIOTest_Set_Selectable(UT_INDEX_0, false);
+    OSAPI_TEST_FUNCTION_RC(OS_GenericWritev_Impl, (&token, Iov, 2, OS_TIME_MIN), sizeof(Data));
+    UtAssert_STUB_COUNT(OS_SelectSingle_Impl, 0);
+
+    /* test invocation of select() in nonblocking mode */
+    UT_SetDeferredRetcode(UT_KEY(OCS_writev), 1, sizeof(Data));
+    UT_PortablePosixIOTest_Set_Selectable(UT_INDEX_0, true);
+    OSAPI_TEST_FUNCTION_RC(OS_GenericWritev_Impl, (&token, Iov, 2, OS_TIME_MIN), sizeof(Data));
+    UtAssert_STUB_COUNT(OS_SelectSingle_Impl, 1);
+
+    /* writev() failure */
+    UT_SetDeferredRetcode(UT_KEY(OCS_writev), 1, -1);
+    OSAPI_TEST_FUNCTION_RC(OS_GenericWritev_Impl, (&token, Iov, 2, OS_TIME_MIN), OS_ERROR);
+
+    /* Fail select */
+    UT_SetDeferredRetcode(UT_KEY(OS_SelectSingle_Impl), 1, OS_ERROR_TIMEOUT);
+    OSAPI_TEST_FUNCTION_RC(OS_GenericWritev_Impl, (&token, Iov, 2, OS_TIME_MIN), OS_ERROR_TIMEOUT);
+
+    /* Not writeable */
+    UT_SetHookFunction(UT_KEY(OS_SelectSingle_Impl), UT_Hook_OS_SelectSingle_Impl, NULL);
+    OSAPI_TEST_FUNCTION_RC(OS_GenericWritev_Impl, (&token, Iov, 2, OS_TIME_MIN), OS_SUCCESS);
+    UT_SetHookFunction(UT_KEY(OS_SelectSingle_Impl), NULL, NULL);
+    UtAssert_STUB_COUNT(OCS_writev, 3);
+}
+
 /* ------------------- End of test cases --------------------------------------*/
 
 /* Osapi_Test_Setup
@@ -216,6 +381,11 @@ void UtTest_Setup(void)
 {
     ADD_TEST(OS_GenericClose_Impl);
     ADD_TEST(OS_GenericSeek_Impl);
+    ADD_TEST(OS_GenericSeek64_Impl);
+    ADD_TEST(OS_GenericPread_Impl);
+    ADD_TEST(OS_GenericPwrite_Impl);
     ADD_TEST(OS_GenericRead_Impl);
     ADD_TEST(OS_GenericWrite_Impl);
+    ADD_TEST(OS_GenericReadv_Impl);
+    ADD_TEST(OS_GenericWritev_Impl);
 }
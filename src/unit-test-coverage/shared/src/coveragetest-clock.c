@@ -59,6 +59,95 @@ void Test_OS_SetLocalTime(void)
     UtAssert_True(actual == expected, "OS_SetLocalTime() (%ld) == OS_INVALID_POINTER", (long)actual);
 }
 
+void Test_OS_GetMonotonicTime(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_GetMonotonicTime(OS_time_t *time_struct)
+     */
+    OS_time_t time_struct;
+
+    OSAPI_TEST_FUNCTION_RC(OS_GetMonotonicTime(&time_struct), OS_SUCCESS);
+    OSAPI_TEST_FUNCTION_RC(OS_GetMonotonicTime(NULL), OS_INVALID_POINTER);
+}
+
+void Test_OS_GetCoarseTime(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_GetCoarseTime(OS_time_t *time_struct)
+     */
+    OS_time_t time_struct;
+
+    OSAPI_TEST_FUNCTION_RC(OS_GetCoarseTime(&time_struct), OS_SUCCESS);
+    OSAPI_TEST_FUNCTION_RC(OS_GetCoarseTime(NULL), OS_INVALID_POINTER);
+}
+
+void Test_OS_RawCounter(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_ClockAPI_Init(void)
+     * uint64 OS_GetRawCounter(void)
+     * int32 OS_RawCounterToTime(uint64 count, OS_time_t *time_struct)
+     */
+    OS_time_t time_struct;
+    OS_time_t mono_times[3];
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_GetRawCounter_Impl), 1234);
+    UtAssert_UINT32_EQ(OS_GetRawCounter(), 1234);
+
+    /* The rate is known, so no measurement is needed */
+    UT_SetDefaultReturnValue(UT_KEY(OS_GetRawCounterFreq_Impl), 1000);
+    OSAPI_TEST_FUNCTION_RC(OS_ClockAPI_Init(), OS_SUCCESS);
+    OSAPI_TEST_FUNCTION_RC(OS_RawCounterToTime(2500, &time_struct), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_TimeGetTotalMilliseconds(time_struct), 2500);
+    OSAPI_TEST_FUNCTION_RC(OS_RawCounterToTime(2500, NULL), OS_INVALID_POINTER);
+    UtAssert_STUB_COUNT(OS_GetMonotonicTime_Impl, 1);
+
+    /* The rate is measured, waiting for the minimum interval, and kept once settled */
+    UT_ResetState(UT_KEY(OS_GetRawCounterFreq_Impl));
+    UT_ResetState(UT_KEY(OS_GetMonotonicTime_Impl));
+    mono_times[0] = OS_TimeFromTotalSeconds(10);
+    mono_times[1] = OS_TimeAdd(mono_times[0], OS_TimeFromTotalMicroseconds(500));
+    mono_times[2] = OS_TimeAdd(mono_times[0], OS_TimeFromTotalSeconds(2));
+    UT_SetDataBuffer(UT_KEY(OS_GetMonotonicTime_Impl), mono_times, sizeof(mono_times), false);
+    UT_SetDefaultReturnValue(UT_KEY(OS_GetRawCounter_Impl), 1000);
+    OSAPI_TEST_FUNCTION_RC(OS_ClockAPI_Init(), OS_SUCCESS);
+    UT_SetDefaultReturnValue(UT_KEY(OS_GetRawCounter_Impl), 2001000);
+    OSAPI_TEST_FUNCTION_RC(OS_RawCounterToTime(3000000, &time_struct), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_TimeGetTotalMilliseconds(time_struct), 3000);
+    UtAssert_STUB_COUNT(OS_GetMonotonicTime_Impl, 3);
+    OSAPI_TEST_FUNCTION_RC(OS_RawCounterToTime(500000, &time_struct), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_TimeGetTotalMilliseconds(time_struct), 500);
+    UtAssert_STUB_COUNT(OS_GetMonotonicTime_Impl, 3);
+
+    /* A measurement over less than a second is used, but not kept */
+    UT_ResetState(UT_KEY(OS_GetMonotonicTime_Impl));
+    mono_times[1] = OS_TimeAdd(mono_times[0], OS_TimeFromTotalMilliseconds(500));
+    UT_SetDataBuffer(UT_KEY(OS_GetMonotonicTime_Impl), mono_times, sizeof(mono_times[0]) * 2, false);
+    UT_SetDefaultReturnValue(UT_KEY(OS_GetRawCounter_Impl), 1000);
+    OSAPI_TEST_FUNCTION_RC(OS_ClockAPI_Init(), OS_SUCCESS);
+    UT_SetDefaultReturnValue(UT_KEY(OS_GetRawCounter_Impl), 2001000);
+    OSAPI_TEST_FUNCTION_RC(OS_RawCounterToTime(4000000, &time_struct), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_TimeGetTotalMilliseconds(time_struct), 1000);
+    UT_ResetState(UT_KEY(OS_GetMonotonicTime_Impl));
+    UT_SetDataBuffer(UT_KEY(OS_GetMonotonicTime_Impl), &mono_times[1], sizeof(mono_times[1]), false);
+    OSAPI_TEST_FUNCTION_RC(OS_RawCounterToTime(4000000, &time_struct), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_GetMonotonicTime_Impl, 1);
+
+    /* A counter that does not advance cannot be measured */
+    UT_ResetState(UT_KEY(OS_GetMonotonicTime_Impl));
+    UT_SetDataBuffer(UT_KEY(OS_GetMonotonicTime_Impl), &mono_times[1], sizeof(mono_times[1]), false);
+    UT_SetDefaultReturnValue(UT_KEY(OS_GetRawCounter_Impl), 1000);
+    OSAPI_TEST_FUNCTION_RC(OS_RawCounterToTime(4000000, &time_struct), OS_ERROR);
+
+    /* Failure of the monotonic clock */
+    UT_SetDefaultReturnValue(UT_KEY(OS_GetMonotonicTime_Impl), OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_RawCounterToTime(4000000, &time_struct), OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_ClockAPI_Init(), OS_ERROR);
+}
+
 void Test_OS_TimeAccessConversions(void)
 {
     /*
@@ -221,6 +310,9 @@ void UtTest_Setup(void)
 {
     ADD_TEST(OS_GetLocalTime);
     ADD_TEST(OS_SetLocalTime);
+    ADD_TEST(OS_GetMonotonicTime);
+    ADD_TEST(OS_GetCoarseTime);
+    ADD_TEST(OS_RawCounter);
     ADD_TEST(OS_TimeAccessConversions);
     ADD_TEST(OS_TimeFromRelativeMilliseconds);
     ADD_TEST(OS_TimeToRelativeMilliseconds);
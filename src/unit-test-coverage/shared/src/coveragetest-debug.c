@@ -0,0 +1,131 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ * \ingroup  shared
+ *
+ * Coverage test for the OS_DEBUG() output, which is only compiled
+ * when OSAL_CONFIG_DEBUG_PRINTF is enabled.
+ */
+#include "os-shared-coveragetest.h"
+#include "os-shared-common.h"
+
+#include "OCS_bsp-impl.h"
+#include "OCS_stdio.h"
+
+/*
+**********************************************************************************
+**          PUBLIC API FUNCTIONS
+**********************************************************************************
+*/
+
+void Test_OS_DebugPrintf(void)
+{
+    /*
+     * Test Case For:
+     * void OS_DebugPrintf(uint32 Level, const char *Func, uint32 Line, const char *Format, ...)
+     */
+    char   LongName[OS_DEBUG_MAX_LINE_LEN + 8];
+    char   Output[OS_DEBUG_MAX_LINE_LEN * 2];
+    uint32 seq;
+
+    memset(Output, 0, sizeof(Output));
+    UT_SetDataBuffer(UT_KEY(OCS_OS_BSP_ConsoleOutput_Impl), Output, sizeof(Output), false);
+
+    /* A statement above the run-time level is not output */
+    OS_SharedGlobalVars.DebugLevel = 1;
+    OS_DebugPrintf(2, "Func", 10, "Msg\n");
+    UtAssert_STUB_COUNT(OCS_OS_BSP_ConsoleOutput_Impl, 0);
+    UtAssert_ZERO(OS_debug_trace_count);
+
+    /* Where console writes are atomic, the line is written without the lock */
+    OCS_OS_BSP_Global.ConsoleAtomicWrite = true;
+    OS_DebugPrintf(1, "Func", 10, "Msg\n");
+    UtAssert_STUB_COUNT(OCS_OS_BSP_ConsoleOutput_Impl, 1);
+    UtAssert_STUB_COUNT(OCS_OS_BSP_Lock_Impl, 0);
+    UtAssert_StrCmp(Output, "Func():10:Msg\n", "Output line");
+    UtAssert_UINT32_EQ(OS_debug_trace_count, 1);
+    UtAssert_UINT32_EQ(OS_debug_trace_ring[1].Sequence, 1);
+    UtAssert_StrCmp(OS_debug_trace_ring[1].Text, "Func():10:Msg\n", "Trace line");
+
+    /* Otherwise the line is written under the lock */
+    OCS_OS_BSP_Global.ConsoleAtomicWrite = false;
+    OS_DebugPrintf(1, "Func", 11, "Msg\n");
+    UtAssert_STUB_COUNT(OCS_OS_BSP_ConsoleOutput_Impl, 2);
+    UtAssert_STUB_COUNT(OCS_OS_BSP_Lock_Impl, 1);
+    UtAssert_STUB_COUNT(OCS_OS_BSP_Unlock_Impl, 1);
+    UtAssert_UINT32_EQ(OS_debug_trace_ring[2].Sequence, 2);
+
+    /* A line still held by another writer is left out of the trace, but still output */
+    seq                           = OS_debug_trace_count + 1;
+    OS_debug_trace_ring[seq].Busy = true;
+    OS_DebugPrintf(1, "Func", 12, "Msg\n");
+    UtAssert_STUB_COUNT(OCS_OS_BSP_ConsoleOutput_Impl, 3);
+    UtAssert_UINT32_EQ(OS_debug_trace_ring[seq].Sequence, 0);
+    OS_debug_trace_ring[seq].Busy = false;
+
+    /* The trace wraps around */
+    OS_debug_trace_count = OS_DEBUG_TRACE_DEPTH - 1;
+    OS_DebugPrintf(1, "Func", 13, "Msg\n");
+    UtAssert_UINT32_EQ(OS_debug_trace_ring[0].Sequence, OS_DEBUG_TRACE_DEPTH);
+
+    /* A prefix or message which does not fit is truncated */
+    memset(LongName, 'x', sizeof(LongName) - 1);
+    LongName[sizeof(LongName) - 1] = 0;
+    OS_DebugPrintf(1, LongName, 14, "Msg\n");
+    UtAssert_UINT32_EQ(strlen(OS_debug_trace_ring[1].Text), OS_DEBUG_MAX_LINE_LEN - 1);
+    OS_DebugPrintf(1, "Func", 15, &LongName[10]);
+    UtAssert_UINT32_EQ(strlen(OS_debug_trace_ring[2].Text), OS_DEBUG_MAX_LINE_LEN - 1);
+
+    /* A formatting failure outputs only what was formatted */
+    UT_SetDefaultReturnValue(UT_KEY(OCS_vsnprintf), -1);
+    OS_DebugPrintf(1, "Func", 16, "Msg\n");
+    UtAssert_StrCmp(OS_debug_trace_ring[3].Text, "Func():16:", "Failed message formatting");
+    UT_SetDefaultReturnValue(UT_KEY(OCS_snprintf), -1);
+    OS_DebugPrintf(1, "Func", 17, "Msg\n");
+    UtAssert_StrCmp(OS_debug_trace_ring[4].Text, "", "Failed prefix formatting");
+}
+
+/* Osapi_Test_Setup
+ *
+ * Purpose:
+ *   Called by the unit test tool to set up the app prior to each test
+ */
+void Osapi_Test_Setup(void)
+{
+    UT_ResetState(0);
+    memset(OS_debug_trace_ring, 0, sizeof(OS_debug_trace_ring));
+    OS_debug_trace_count = 0;
+}
+
+/*
+ * Osapi_Test_Teardown
+ *
+ * Purpose:
+ *   Called by the unit test tool to tear down the app after each test
+ */
+void Osapi_Test_Teardown(void) {}
+
+/*
+ * Register the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    ADD_TEST(OS_DebugPrintf);
+}
@@ -28,6 +28,20 @@
 
 #include "OCS_string.h"
 
+/* OS_FileMap_Impl hook to give each mapping a unique address */
+static int32 UT_Hook_OS_FileMap_Impl(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                     const UT_StubContext_t *Context)
+{
+    OS_file_mapping_t *map = UT_Hook_GetArgValueByName(Context, "map", OS_file_mapping_t *);
+
+    if (StubRetcode == OS_SUCCESS)
+    {
+        map->addr = (uint8 *)UserObj + CallCount;
+    }
+
+    return StubRetcode;
+}
+
 /*
 **********************************************************************************
 **          PUBLIC API FUNCTIONS
@@ -144,6 +158,96 @@ void Test_OS_TimedWrite(void)
     OSAPI_TEST_FUNCTION_RC(OS_TimedWrite(UT_OBJID_1, Buf, OSAL_SIZE_C(UINT32_MAX), 10), OS_ERR_INVALID_SIZE);
 }
 
+void Test_OS_IoVecCheck(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_IoVecCheck(const OS_iovec_t *iov, uint32 iovcnt)
+     */
+    char       Buf[4] = "abc";
+    OS_iovec_t Iov[OS_IOV_MAX + 1];
+    uint32     i;
+
+    for (i = 0; i < (OS_IOV_MAX + 1); ++i)
+    {
+        Iov[i].Buffer = Buf;
+        Iov[i].Length = sizeof(Buf);
+    }
+
+    OSAPI_TEST_FUNCTION_RC(OS_IoVecCheck(Iov, 1), OS_SUCCESS);
+    OSAPI_TEST_FUNCTION_RC(OS_IoVecCheck(Iov, OS_IOV_MAX), OS_SUCCESS);
+
+    OSAPI_TEST_FUNCTION_RC(OS_IoVecCheck(NULL, 1), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_IoVecCheck(Iov, 0), OS_ERR_INVALID_SIZE);
+    OSAPI_TEST_FUNCTION_RC(OS_IoVecCheck(Iov, OS_IOV_MAX + 1), OS_ERR_INVALID_SIZE);
+
+    /* A zero length segment does not need a buffer, but the total must be nonzero */
+    Iov[1].Buffer = NULL;
+    Iov[1].Length = 0;
+    OSAPI_TEST_FUNCTION_RC(OS_IoVecCheck(Iov, 2), OS_SUCCESS);
+    OSAPI_TEST_FUNCTION_RC(OS_IoVecCheck(&Iov[1], 1), OS_ERR_INVALID_SIZE);
+    Iov[1].Length = 1;
+    OSAPI_TEST_FUNCTION_RC(OS_IoVecCheck(Iov, 2), OS_INVALID_POINTER);
+
+    /* Total length must not overflow, even if the segments are individually valid */
+    Iov[0].Length = UINT32_MAX / 4;
+    Iov[1].Buffer = Buf;
+    Iov[1].Length = UINT32_MAX / 4;
+    Iov[2].Length = UINT32_MAX / 4;
+    OSAPI_TEST_FUNCTION_RC(OS_IoVecCheck(Iov, 2), OS_SUCCESS);
+    OSAPI_TEST_FUNCTION_RC(OS_IoVecCheck(Iov, 3), OS_ERR_INVALID_SIZE);
+}
+
+void Test_OS_TimedReadv(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_TimedReadv(osal_id_t filedes, const OS_iovec_t *iov, uint32 iovcnt, int32 timeout)
+     */
+    char       Buf[4] = "zzz";
+    OS_iovec_t Iov[1];
+
+    Iov[0].Buffer = Buf;
+    Iov[0].Length = sizeof(Buf);
+
+    UT_SetDeferredRetcode(UT_KEY(OS_GenericReadv_Impl), 1, sizeof(Buf));
+    OSAPI_TEST_FUNCTION_RC(OS_TimedReadv(UT_OBJID_1, Iov, 1, 10), sizeof(Buf));
+    OSAPI_TEST_FUNCTION_RC(OS_readv(UT_OBJID_1, Iov, 1), 0);
+    UtAssert_STUB_COUNT(OS_GenericReadv_Impl, 2);
+
+    OSAPI_TEST_FUNCTION_RC(OS_TimedReadv(UT_OBJID_1, NULL, 1, 10), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_TimedReadv(UT_OBJID_1, Iov, 0, 10), OS_ERR_INVALID_SIZE);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_TimedReadv(UT_OBJID_1, Iov, 1, 10), OS_ERR_INVALID_ID);
+    UtAssert_STUB_COUNT(OS_GenericReadv_Impl, 2);
+}
+
+void Test_OS_TimedWritev(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_TimedWritev(osal_id_t filedes, const OS_iovec_t *iov, uint32 iovcnt, int32 timeout)
+     */
+    char       Buf[4] = "www";
+    OS_iovec_t Iov[1];
+
+    Iov[0].Buffer = Buf;
+    Iov[0].Length = sizeof(Buf);
+
+    UT_SetDeferredRetcode(UT_KEY(OS_GenericWritev_Impl), 1, sizeof(Buf));
+    OSAPI_TEST_FUNCTION_RC(OS_TimedWritev(UT_OBJID_1, Iov, 1, 10), sizeof(Buf));
+    OSAPI_TEST_FUNCTION_RC(OS_writev(UT_OBJID_1, Iov, 1), 0);
+    UtAssert_STUB_COUNT(OS_GenericWritev_Impl, 2);
+
+    OSAPI_TEST_FUNCTION_RC(OS_TimedWritev(UT_OBJID_1, NULL, 1, 10), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_TimedWritev(UT_OBJID_1, Iov, 0, 10), OS_ERR_INVALID_SIZE);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_TimedWritev(UT_OBJID_1, Iov, 1, 10), OS_ERR_INVALID_ID);
+    UtAssert_STUB_COUNT(OS_GenericWritev_Impl, 2);
+}
+
 void Test_OS_read(void)
 {
     /*
@@ -179,6 +283,118 @@ void Test_OS_write(void)
     UtAssert_True(memcmp(Buf, DstBuf, actual) == 0, "buffer content match");
 }
 
+void Test_OS_pread(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_pread(osal_id_t filedes, void *buffer, size_t nbytes, osal_offset_t offset)
+     */
+    char Buf[4];
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_GenericPread_Impl), sizeof(Buf));
+    OSAPI_TEST_FUNCTION_RC(OS_pread(UT_OBJID_1, Buf, sizeof(Buf), 0x100000000), sizeof(Buf));
+    UtAssert_STUB_COUNT(OS_GenericPread_Impl, 1);
+
+    OSAPI_TEST_FUNCTION_RC(OS_pread(UT_OBJID_1, NULL, sizeof(Buf), 0), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_pread(UT_OBJID_1, Buf, OSAL_SIZE_C(0), 0), OS_ERR_INVALID_SIZE);
+    OSAPI_TEST_FUNCTION_RC(OS_pread(UT_OBJID_1, Buf, sizeof(Buf), -1), OS_ERR_INVALID_ARGUMENT);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_pread(UT_OBJID_1, Buf, sizeof(Buf), 0), OS_ERR_INVALID_ID);
+    UtAssert_STUB_COUNT(OS_GenericPread_Impl, 1);
+}
+
+void Test_OS_pwrite(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_pwrite(osal_id_t filedes, const void *buffer, size_t nbytes, osal_offset_t offset)
+     */
+    const char Buf[4] = "WWW";
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_GenericPwrite_Impl), sizeof(Buf));
+    OSAPI_TEST_FUNCTION_RC(OS_pwrite(UT_OBJID_1, Buf, sizeof(Buf), 0x100000000), sizeof(Buf));
+    UtAssert_STUB_COUNT(OS_GenericPwrite_Impl, 1);
+
+    OSAPI_TEST_FUNCTION_RC(OS_pwrite(UT_OBJID_1, NULL, sizeof(Buf), 0), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_pwrite(UT_OBJID_1, Buf, OSAL_SIZE_C(0), 0), OS_ERR_INVALID_SIZE);
+    OSAPI_TEST_FUNCTION_RC(OS_pwrite(UT_OBJID_1, Buf, sizeof(Buf), -1), OS_ERR_INVALID_ARGUMENT);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_pwrite(UT_OBJID_1, Buf, sizeof(Buf), 0), OS_ERR_INVALID_ID);
+    UtAssert_STUB_COUNT(OS_GenericPwrite_Impl, 1);
+}
+
+void Test_OS_FileMap(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_FileMap(osal_id_t filedes, osal_offset_t offset, size_t length, uint32 flags, void **addr)
+     * int32 OS_FileUnmap(osal_id_t filedes, void *addr, uint32 flags)
+     */
+    uint8  MapBase[2 * OS_FILE_MAX_MAPPINGS];
+    void * Addr[OS_FILE_MAX_MAPPINGS + 1];
+    uint32 i;
+
+    memset(&OS_stream_table[UT_INDEX_1], 0, sizeof(OS_stream_table[UT_INDEX_1]));
+    UT_SetHookFunction(UT_KEY(OS_FileMap_Impl), UT_Hook_OS_FileMap_Impl, MapBase);
+
+    /* Argument checks */
+    OSAPI_TEST_FUNCTION_RC(OS_FileMap(UT_OBJID_1, 0, 1, OS_FILE_MAP_READ, NULL), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_FileMap(UT_OBJID_1, 0, 0, OS_FILE_MAP_READ, &Addr[0]), OS_ERR_INVALID_SIZE);
+    OSAPI_TEST_FUNCTION_RC(OS_FileMap(UT_OBJID_1, -1, 1, OS_FILE_MAP_READ, &Addr[0]), OS_ERR_INVALID_ARGUMENT);
+    OSAPI_TEST_FUNCTION_RC(OS_FileMap(UT_OBJID_1, 0, 1, OS_FILE_MAP_WILLNEED, &Addr[0]), OS_ERR_INVALID_ARGUMENT);
+    OSAPI_TEST_FUNCTION_RC(
+        OS_FileMap(UT_OBJID_1, 0, 1, OS_FILE_MAP_READ | OS_FILE_MAP_SEQUENTIAL | OS_FILE_MAP_RANDOM, &Addr[0]),
+        OS_ERR_INVALID_ARGUMENT);
+    OSAPI_TEST_FUNCTION_RC(OS_FileUnmap(UT_OBJID_1, NULL, 0), OS_INVALID_POINTER);
+    UtAssert_STUB_COUNT(OS_FileMap_Impl, 0);
+
+    /* Nominal, up to the limit of mappings per handle */
+    for (i = 0; i < OS_FILE_MAX_MAPPINGS; ++i)
+    {
+        OSAPI_TEST_FUNCTION_RC(OS_FileMap(UT_OBJID_1, i, 1, OS_FILE_MAP_READ, &Addr[i]), OS_SUCCESS);
+    }
+    UtAssert_UINT32_EQ(OS_stream_table[UT_INDEX_1].map_count, OS_FILE_MAX_MAPPINGS);
+    UtAssert_ADDRESS_EQ(Addr[0], &MapBase[0]);
+    OSAPI_TEST_FUNCTION_RC(OS_FileMap(UT_OBJID_1, 0, 1, OS_FILE_MAP_READ, &Addr[i]), OS_ERR_NO_FREE_IDS);
+
+    /* Unmap, which frees the entry for reuse */
+    OSAPI_TEST_FUNCTION_RC(OS_FileUnmap(UT_OBJID_1, Addr[1], OS_FILE_MAP_SYNC), OS_SUCCESS);
+    UtAssert_UINT32_EQ(OS_stream_table[UT_INDEX_1].map_count, OS_FILE_MAX_MAPPINGS - 1);
+    OSAPI_TEST_FUNCTION_RC(OS_FileUnmap(UT_OBJID_1, Addr[1], 0), OS_ERR_INVALID_ARGUMENT);
+
+    /* Failure of the implementation leaves the table unchanged */
+    UT_SetDeferredRetcode(UT_KEY(OS_FileMap_Impl), 1, OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_FileMap(UT_OBJID_1, 0, 1, OS_FILE_MAP_READ, &Addr[1]), OS_ERROR);
+    UtAssert_ZERO(OS_stream_table[UT_INDEX_1].mappings[1].length);
+    UT_SetDeferredRetcode(UT_KEY(OS_FileUnmap_Impl), 1, OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_FileUnmap(UT_OBJID_1, Addr[0], 0), OS_ERROR);
+    UtAssert_ADDRESS_EQ(OS_stream_table[UT_INDEX_1].mappings[0].addr, Addr[0]);
+    UtAssert_UINT32_EQ(OS_stream_table[UT_INDEX_1].map_count, OS_FILE_MAX_MAPPINGS - 1);
+
+    OSAPI_TEST_FUNCTION_RC(OS_FileMap(UT_OBJID_1, 0, 1, OS_FILE_MAP_READ | OS_FILE_MAP_WRITE, &Addr[1]), OS_SUCCESS);
+    UtAssert_UINT32_EQ(OS_stream_table[UT_INDEX_1].map_count, OS_FILE_MAX_MAPPINGS);
+
+    /* The handle cannot be closed while it has active mappings */
+    UT_ResetState(UT_KEY(OS_FileUnmap_Impl));
+    OSAPI_TEST_FUNCTION_RC(OS_close(UT_OBJID_1), OS_ERR_OBJECT_IN_USE);
+    UtAssert_STUB_COUNT(OS_GenericClose_Impl, 0);
+    UtAssert_STUB_COUNT(OS_FileUnmap_Impl, 0);
+
+    for (i = 0; i < OS_FILE_MAX_MAPPINGS; ++i)
+    {
+        OSAPI_TEST_FUNCTION_RC(OS_FileUnmap(UT_OBJID_1, Addr[i], 0), OS_SUCCESS);
+    }
+    UtAssert_UINT32_EQ(OS_stream_table[UT_INDEX_1].map_count, 0);
+    OSAPI_TEST_FUNCTION_RC(OS_close(UT_OBJID_1), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_GenericClose_Impl, 1);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_FileMap(UT_OBJID_1, 0, 1, OS_FILE_MAP_READ, &Addr[0]), OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_FileUnmap(UT_OBJID_1, Addr[0], 0), OS_ERR_INVALID_ID);
+}
+
 void Test_OS_chmod(void)
 {
     /*
@@ -219,6 +435,23 @@ void Test_OS_lseek(void)
     OSAPI_TEST_FUNCTION_RC(OS_lseek(UT_OBJID_1, 0, 0), OS_ERR_INVALID_ID);
 }
 
+void Test_OS_lseek64(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_lseek64(osal_id_t filedes, osal_offset_t offset, uint32 whence, osal_offset_t *position)
+     */
+    osal_offset_t position;
+
+    OSAPI_TEST_FUNCTION_RC(OS_lseek64(UT_OBJID_1, 0x100000000, OS_SEEK_SET, &position), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_GenericSeek64_Impl, 1);
+
+    OSAPI_TEST_FUNCTION_RC(OS_lseek64(UT_OBJID_1, 0, OS_SEEK_SET, NULL), OS_INVALID_POINTER);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_lseek64(UT_OBJID_1, 0, OS_SEEK_SET, &position), OS_ERR_INVALID_ID);
+}
+
 void Test_OS_remove(void)
 {
     /*
@@ -262,7 +495,20 @@ void Test_OS_cp(void)
     OSAPI_TEST_FUNCTION_RC(OS_cp(NULL, "/cf/file2"), OS_INVALID_POINTER);
     OSAPI_TEST_FUNCTION_RC(OS_cp("/cf/file1", NULL), OS_INVALID_POINTER);
 
+    /* copy done entirely by the implementation */
+    OSAPI_TEST_FUNCTION_RC(OS_cp("/cf/file1", "/cf/file2"), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_FileCopy_Impl, 1);
+    UtAssert_STUB_COUNT(OS_GenericRead_Impl, 0);
+
+    /* failure to get either handle */
+    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdGetById), 1, OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_cp("/cf/file1", "/cf/file2"), OS_ERR_INVALID_ID);
+    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdGetById), 2, OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_cp("/cf/file1", "/cf/file2"), OS_ERR_INVALID_ID);
+    UtAssert_STUB_COUNT(OS_FileCopy_Impl, 1);
+
     /* setup to make internal copy loop execute at least once */
+    UT_SetDefaultReturnValue(UT_KEY(OS_FileCopy_Impl), OS_ERR_NOT_IMPLEMENTED);
     UT_SetDataBuffer(UT_KEY(OS_GenericRead_Impl), ReadBuf, sizeof(ReadBuf), false);
     UT_SetDataBuffer(UT_KEY(OS_GenericWrite_Impl), WriteBuf, sizeof(WriteBuf), false);
     OSAPI_TEST_FUNCTION_RC(OS_cp("/cf/file1", "/cf/file2"), OS_SUCCESS);
@@ -379,6 +625,106 @@ void Test_OS_CloseAllFiles(void)
     UtAssert_True(actual == expected, "OS_FileIteratorClose() (%ld) == OS_SUCCESS", (long)actual);
 }
 
+static uint32 UT_FileAsyncCallbackCount;
+
+static void UT_FileAsyncCallback(OS_FileAsyncReq_t *Req)
+{
+    ++UT_FileAsyncCallbackCount;
+}
+
+void Test_OS_FileAsyncSubmit(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_FileAsyncSubmit(OS_FileAsyncReq_t *Req)
+     */
+    OS_FileAsyncReq_t Req;
+    char              Buf[4];
+
+    memset(&Req, 0, sizeof(Req));
+    Req.FileId    = UT_OBJID_1;
+    Req.Operation = OS_FILE_ASYNC_READ;
+    Req.Buffer    = Buf;
+    Req.Length    = sizeof(Buf);
+    Req.Offset    = 0x100000000;
+
+    OSAPI_TEST_FUNCTION_RC(OS_FileAsyncSubmit(&Req), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_FileAsyncSubmit_Impl, 1);
+
+    /* sync does not use the buffer */
+    Req.Operation = OS_FILE_ASYNC_SYNC;
+    Req.Buffer    = NULL;
+    Req.Length    = 0;
+    OSAPI_TEST_FUNCTION_RC(OS_FileAsyncSubmit(&Req), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_FileAsyncSubmit_Impl, 2);
+
+    Req.Operation = OS_FILE_ASYNC_WRITE;
+    OSAPI_TEST_FUNCTION_RC(OS_FileAsyncSubmit(&Req), OS_INVALID_POINTER);
+    Req.Buffer = Buf;
+    OSAPI_TEST_FUNCTION_RC(OS_FileAsyncSubmit(&Req), OS_ERR_INVALID_SIZE);
+    Req.Length    = sizeof(Buf);
+    Req.Operation = 0;
+    OSAPI_TEST_FUNCTION_RC(OS_FileAsyncSubmit(&Req), OS_ERR_INVALID_ARGUMENT);
+    Req.Operation = OS_FILE_ASYNC_WRITE;
+    Req.Offset    = -1;
+    OSAPI_TEST_FUNCTION_RC(OS_FileAsyncSubmit(&Req), OS_ERR_INVALID_ARGUMENT);
+    Req.Offset = 0;
+    OSAPI_TEST_FUNCTION_RC(OS_FileAsyncSubmit(NULL), OS_INVALID_POINTER);
+
+    UT_SetDeferredRetcode(UT_KEY(OS_FileAsyncSubmit_Impl), 1, OS_ERR_NO_FREE_IDS);
+    OSAPI_TEST_FUNCTION_RC(OS_FileAsyncSubmit(&Req), OS_ERR_NO_FREE_IDS);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_FileAsyncSubmit(&Req), OS_ERR_INVALID_ID);
+    UtAssert_STUB_COUNT(OS_FileAsyncSubmit_Impl, 3);
+}
+
+void Test_OS_FileAsyncWait(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_FileAsyncWait(int32 msecs)
+     * int32 OS_FileAsyncWaitAbs(OS_time_t abstime)
+     */
+    UT_SetDefaultReturnValue(UT_KEY(OS_FileAsyncWait_Impl), 2);
+    OSAPI_TEST_FUNCTION_RC(OS_FileAsyncWait(OS_PEND), 2);
+    OSAPI_TEST_FUNCTION_RC(OS_FileAsyncWaitAbs(OS_TIME_ZERO), 2);
+    UtAssert_STUB_COUNT(OS_FileAsyncWait_Impl, 2);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_FileAsyncWait_Impl), OS_ERROR_TIMEOUT);
+    OSAPI_TEST_FUNCTION_RC(OS_FileAsyncWait(OS_CHECK), OS_ERROR_TIMEOUT);
+}
+
+void Test_OS_FileAsyncComplete(void)
+{
+    /*
+     * Test Case For:
+     * void OS_FileAsyncComplete(OS_FileAsyncReq_t *req, int32 result)
+     */
+    OS_FileAsyncReq_t Req;
+
+    /* neither callback nor queue */
+    memset(&Req, 0, sizeof(Req));
+    OS_FileAsyncComplete(&Req, 10);
+    UtAssert_INT32_EQ(Req.Result, 10);
+    UtAssert_STUB_COUNT(OS_QueuePut, 0);
+
+    /* both callback and queue */
+    UT_FileAsyncCallbackCount = 0;
+    Req.Callback              = UT_FileAsyncCallback;
+    Req.CompletionQueue       = UT_OBJID_2;
+    OS_FileAsyncComplete(&Req, OS_ERROR);
+    UtAssert_INT32_EQ(Req.Result, OS_ERROR);
+    UtAssert_UINT32_EQ(UT_FileAsyncCallbackCount, 1);
+    UtAssert_STUB_COUNT(OS_QueuePut, 1);
+
+    /* failure to put on the queue is only reported as debug output */
+    UT_SetDefaultReturnValue(UT_KEY(OS_QueuePut), OS_QUEUE_FULL);
+    OS_FileAsyncComplete(&Req, OS_SUCCESS);
+    UtAssert_UINT32_EQ(UT_FileAsyncCallbackCount, 2);
+    UtAssert_STUB_COUNT(OS_QueuePut, 2);
+}
+
 /* Osapi_Test_Setup
  *
  * Purpose:
@@ -409,11 +755,18 @@ void UtTest_Setup(void)
     ADD_TEST(OS_close);
     ADD_TEST(OS_TimedRead);
     ADD_TEST(OS_TimedWrite);
+    ADD_TEST(OS_IoVecCheck);
+    ADD_TEST(OS_TimedReadv);
+    ADD_TEST(OS_TimedWritev);
     ADD_TEST(OS_read);
     ADD_TEST(OS_write);
+    ADD_TEST(OS_pread);
+    ADD_TEST(OS_pwrite);
+    ADD_TEST(OS_FileMap);
     ADD_TEST(OS_chmod);
     ADD_TEST(OS_stat);
     ADD_TEST(OS_lseek);
+    ADD_TEST(OS_lseek64);
     ADD_TEST(OS_remove);
     ADD_TEST(OS_rename);
     ADD_TEST(OS_cp);
@@ -422,4 +775,7 @@ void UtTest_Setup(void)
     ADD_TEST(OS_FileOpenCheck);
     ADD_TEST(OS_CloseFileByName);
     ADD_TEST(OS_CloseAllFiles);
+    ADD_TEST(OS_FileAsyncSubmit);
+    ADD_TEST(OS_FileAsyncWait);
+    ADD_TEST(OS_FileAsyncComplete);
 }
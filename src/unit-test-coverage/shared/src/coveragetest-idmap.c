@@ -349,6 +349,11 @@ void Test_OS_ObjectIdGetBySearch(void)
     UtAssert_UINT32_EQ(token.obj_idx, 0);
 
     OS_global_task_table[0].active_id = OS_OBJECT_ID_UNDEFINED;
+
+    /* With no active records, nothing should match */
+    OSAPI_TEST_FUNCTION_RC(
+        OS_ObjectIdGetBySearch(OS_LOCK_MODE_NONE, OS_OBJECT_TYPE_OS_TASK, TestAlwaysMatch, NULL, &token),
+        OS_ERR_NAME_NOT_FOUND);
 }
 
 void Test_OS_GetMaxForObjectType(void)
@@ -459,10 +464,11 @@ void Test_OS_ObjectIdFindByName(void)
      * Nominal case (with no additional setup) should return OS_ERR_NAME_NOT_FOUND
      * Setting up a special matching entry should yield OS_SUCCESS
      */
-    char      TaskName[] = "UT_find";
-    osal_id_t objid;
-    int32     expected = OS_ERR_NAME_NOT_FOUND;
-    int32     actual   = OS_ObjectIdFindByName(OS_OBJECT_TYPE_UNDEFINED, NULL, &objid);
+    char              TaskName[] = "UT_find";
+    osal_id_t         objid;
+    OS_object_token_t token;
+    int32             expected = OS_ERR_NAME_NOT_FOUND;
+    int32             actual   = OS_ObjectIdFindByName(OS_OBJECT_TYPE_UNDEFINED, NULL, &objid);
     UtAssert_True(actual == expected, "OS_ObjectFindIdByName(%s) (%ld) == OS_ERR_NAME_NOT_FOUND", "NULL", (long)actual);
 
     /*
@@ -488,16 +494,123 @@ void Test_OS_ObjectIdFindByName(void)
     /*
      * Set up for the ObjectIdSearch function to return success
      */
+    memset(&token, 0, sizeof(token));
+    token.obj_type                     = OS_OBJECT_TYPE_OS_TASK;
     OS_global_task_table[0].active_id  = UT_OBJID_OTHER;
     OS_global_task_table[0].name_entry = TaskName;
+    OS_ObjectIdNameIndexInsert(&token, TaskName);
     actual                             = OS_ObjectIdFindByName(OS_OBJECT_TYPE_OS_TASK, TaskName, &objid);
     expected                           = OS_SUCCESS;
     OS_global_task_table[0].active_id  = OS_OBJECT_ID_UNDEFINED;
     OS_global_task_table[0].name_entry = NULL;
+    OS_ObjectIdNameIndexRemove(&token);
 
     UtAssert_True(actual == expected, "OS_ObjectFindIdByName(%s) (%ld) == OS_SUCCESS", TaskName, (long)actual);
 }
 
+#ifdef OSAL_CONFIG_NAME_INDEX
+void Test_OS_ObjectIdNameIndex(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_ObjectIdFindNameMatch(const char *name, OS_object_token_t *token);
+     * void OS_ObjectIdNameIndexInsert(const OS_object_token_t *token, const char *name);
+     * void OS_ObjectIdNameIndexRemove(const OS_object_token_t *token);
+     */
+    static char       TaskNames[OS_MAX_TASKS][OS_MAX_API_NAME];
+    OS_object_token_t token;
+    OS_object_token_t search;
+    uint32            i;
+
+    memset(&token, 0, sizeof(token));
+    token.obj_type = OS_OBJECT_TYPE_OS_TASK;
+
+    /* Fill the entire table, which will also produce some hash collisions */
+    for (i = 0; i < OS_MAX_TASKS; ++i)
+    {
+        snprintf(TaskNames[i], sizeof(TaskNames[i]), "UT%u", (unsigned int)i);
+        token.obj_idx = OSAL_INDEX_C(i);
+        OS_ObjectIdCompose_Impl(OS_OBJECT_TYPE_OS_TASK, i, &OS_global_task_table[i].active_id);
+        OS_global_task_table[i].name_entry = TaskNames[i];
+        OS_ObjectIdNameIndexInsert(&token, TaskNames[i]);
+    }
+
+    /* Inserting a record again should not make a duplicate entry, and a NULL name is ignored */
+    token.obj_idx = OSAL_INDEX_C(0);
+    OS_ObjectIdNameIndexInsert(&token, TaskNames[0]);
+    OS_ObjectIdNameIndexInsert(&token, NULL);
+
+    for (i = 0; i < OS_MAX_TASKS; ++i)
+    {
+        memset(&search, 0, sizeof(search));
+        search.obj_type = OS_OBJECT_TYPE_OS_TASK;
+        UtAssert_INT32_EQ(OS_ObjectIdFindNameMatch(TaskNames[i], &search), OS_SUCCESS);
+        UtAssert_UINT32_EQ(search.obj_idx, i);
+        OSAPI_TEST_OBJID(search.obj_id, ==, OS_global_task_table[i].active_id);
+    }
+
+    /* Remove every other entry, which requires moving back some of the remaining entries */
+    for (i = 0; i < OS_MAX_TASKS; i += 2)
+    {
+        token.obj_idx = OSAL_INDEX_C(i);
+        OS_ObjectIdNameIndexRemove(&token);
+    }
+
+    /* Removing an entry which is not in the index has no effect */
+    token.obj_idx = OSAL_INDEX_C(0);
+    OS_ObjectIdNameIndexRemove(&token);
+
+    /* Only the remaining entries should be found, even though the records all still have names */
+    for (i = 0; i < OS_MAX_TASKS; ++i)
+    {
+        memset(&search, 0, sizeof(search));
+        search.obj_type = OS_OBJECT_TYPE_OS_TASK;
+        if ((i & 1) == 0)
+        {
+            UtAssert_INT32_EQ(OS_ObjectIdFindNameMatch(TaskNames[i], &search), OS_ERR_NAME_NOT_FOUND);
+            OSAPI_TEST_OBJID(search.obj_id, ==, OS_OBJECT_ID_UNDEFINED);
+        }
+        else
+        {
+            UtAssert_INT32_EQ(OS_ObjectIdFindNameMatch(TaskNames[i], &search), OS_SUCCESS);
+            UtAssert_UINT32_EQ(search.obj_idx, i);
+        }
+    }
+
+    /* An indexed record that is not active should not match */
+    OS_global_task_table[1].active_id = OS_OBJECT_ID_UNDEFINED;
+    memset(&search, 0, sizeof(search));
+    search.obj_type = OS_OBJECT_TYPE_OS_TASK;
+    UtAssert_INT32_EQ(OS_ObjectIdFindNameMatch(TaskNames[1], &search), OS_ERR_NAME_NOT_FOUND);
+
+    /* Clean up the remaining entries */
+    for (i = 1; i < OS_MAX_TASKS; i += 2)
+    {
+        token.obj_idx = OSAL_INDEX_C(i);
+        OS_ObjectIdNameIndexRemove(&token);
+    }
+
+    /* Types which are not indexed use a linear search, and insert/remove have no effect */
+    memset(&token, 0, sizeof(token));
+    token.obj_type                       = OS_OBJECT_TYPE_OS_STREAM;
+    OS_global_stream_table[0].active_id  = UT_OBJID_OTHER;
+    OS_global_stream_table[0].name_entry = TaskNames[0];
+    OS_ObjectIdNameIndexInsert(&token, TaskNames[0]);
+    memset(&search, 0, sizeof(search));
+    search.obj_type = OS_OBJECT_TYPE_OS_STREAM;
+    search.obj_idx  = OSAL_INDEX_C(-1);
+    UtAssert_INT32_EQ(OS_ObjectIdFindNameMatch(TaskNames[0], &search), OS_SUCCESS);
+    UtAssert_UINT32_EQ(search.obj_idx, 0);
+    OS_ObjectIdNameIndexRemove(&token);
+    memset(&OS_global_stream_table[0], 0, sizeof(OS_global_stream_table[0]));
+    token.obj_type = OS_OBJECT_TYPE_OS_DIR;
+    OS_ObjectIdNameIndexInsert(&token, TaskNames[0]);
+    search.obj_type = OS_OBJECT_TYPE_OS_DIR;
+    search.obj_idx  = OSAL_INDEX_C(-1);
+    UtAssert_INT32_EQ(OS_ObjectIdFindNameMatch(TaskNames[0], &search), OS_ERR_NAME_NOT_FOUND);
+}
+#endif /* OSAL_CONFIG_NAME_INDEX */
+
 void Test_OS_ObjectIdGetById(void)
 {
     /*
@@ -529,6 +642,13 @@ void Test_OS_ObjectIdGetById(void)
     OSAPI_TEST_FUNCTION_RC(
         OS_ObjectIdGetById(OS_LOCK_MODE_NONE, OS_OBJECT_TYPE_OS_TASK, OS_OBJECT_ID_UNDEFINED, &token1),
         OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(
+        OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, OS_OBJECT_TYPE_OS_TASK, OS_OBJECT_ID_UNDEFINED, &token1),
+        OS_ERR_INVALID_ID);
+    OS_SharedGlobalVars.GlobalState = 0;
+    OSAPI_TEST_FUNCTION_RC(
+        OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, OS_OBJECT_TYPE_OS_TASK, OS_OBJECT_ID_UNDEFINED, &token1), OS_ERROR);
+    OS_SharedGlobalVars.GlobalState = OS_INIT_MAGIC_NUMBER;
 
     OS_ObjectIdCompose_Impl(OS_OBJECT_TYPE_OS_TASK, 1000, &refobjid);
     OS_ObjectIdToArrayIndex(OS_OBJECT_TYPE_OS_TASK, refobjid, &local_idx);
@@ -542,6 +662,9 @@ void Test_OS_ObjectIdGetById(void)
     UtAssert_UINT32_EQ(token1.obj_idx, local_idx);
     UtAssert_True(rptr->refcount == 1, "refcount (%u) == 1", (unsigned int)rptr->refcount);
 
+    /* a refcount lock on a record in steady state should not need the global lock */
+    UtAssert_STUB_COUNT(OS_Lock_Global_Impl, 0);
+
     /* attempting to get an exclusive lock should return IN_USE error */
     expected = OS_ERR_OBJECT_IN_USE;
     actual   = OS_ObjectIdGetById(OS_LOCK_MODE_EXCLUSIVE, OS_OBJECT_TYPE_OS_TASK, refobjid, &token2);
@@ -555,6 +678,13 @@ void Test_OS_ObjectIdGetById(void)
     OS_ObjectIdRelease(&token1);
     UtAssert_True(rptr->refcount == 0, "refcount (%u) == 0", (unsigned int)rptr->refcount);
 
+    /* refcount lock on a record which is not in steady state should use the locked path */
+    rptr->active_id = OS_OBJECT_ID_RESERVED;
+    OSAPI_TEST_FUNCTION_RC(OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, OS_OBJECT_TYPE_OS_TASK, refobjid, &token1),
+                           OS_ERR_OBJECT_IN_USE);
+    UtAssert_True(rptr->refcount == 0, "refcount (%u) == 0", (unsigned int)rptr->refcount);
+    rptr->active_id = refobjid;
+
     /* attempt to get non-exclusive lock during shutdown should fail */
     OS_SharedGlobalVars.GlobalState = OS_SHUTDOWN_MAGIC_NUMBER;
     expected                        = OS_ERR_INCORRECT_OBJ_STATE;
@@ -916,6 +1046,25 @@ void Test_OS_ObjectIdTransaction(void)
     OSAPI_TEST_OBJID(record->active_id, ==, UT_OBJID_1);
     UtAssert_UINT32_EQ(record->refcount, 0);
 
+    /* refcount finish in steady state does not need the global lock */
+    token.lock_mode   = OS_LOCK_MODE_REFCOUNT;
+    record->refcount  = 1;
+    record->active_id = token.obj_id;
+    OS_ObjectIdTransactionFinish(&token, NULL);
+    UtAssert_STUB_COUNT(OS_Lock_Global_Impl, 4);
+    UtAssert_STUB_COUNT(OS_Unlock_Global_Impl, 5);
+    UtAssert_UINT32_EQ(token.lock_mode, OS_LOCK_MODE_NONE);
+    UtAssert_UINT32_EQ(record->refcount, 0);
+
+    /* refcount finish with ID update uses the global lock */
+    token.lock_mode  = OS_LOCK_MODE_REFCOUNT;
+    record->refcount = 1;
+    OS_ObjectIdTransactionFinish(&token, &objid);
+    UtAssert_STUB_COUNT(OS_Lock_Global_Impl, 5);
+    UtAssert_STUB_COUNT(OS_Unlock_Global_Impl, 6);
+    OSAPI_TEST_OBJID(record->active_id, ==, objid);
+    UtAssert_UINT32_EQ(record->refcount, 0);
+
     /* test transferring a refcount token */
     memset(&token2, 0xBB, sizeof(token2));
     token.obj_id    = UT_OBJID_2;
@@ -935,6 +1084,45 @@ void Test_OS_ObjectIdTransaction(void)
     OSAPI_TEST_OBJID(token.obj_id, ==, token2.obj_id);
 }
 
+void Test_OS_ObjectIdRefcount(void)
+{
+    /*
+     * Test Case For:
+     * bool OS_ObjectIdRefcountTryAcquire(OS_object_token_t *token);
+     * void OS_ObjectIdRefcountRelease(OS_object_token_t *token);
+     */
+    OS_object_token_t   token;
+    OS_common_record_t *record;
+
+    memset(&token, 0, sizeof(token));
+
+    token.obj_id    = UT_OBJID_2;
+    token.obj_idx   = UT_INDEX_2;
+    token.obj_type  = OS_OBJECT_TYPE_OS_TASK;
+    token.lock_mode = OS_LOCK_MODE_REFCOUNT;
+
+    record            = OS_ObjectIdGlobalFromToken(&token);
+    record->active_id = UT_OBJID_2;
+    record->refcount  = 0;
+
+    /* steady state - acquire and release without global lock */
+    UtAssert_BOOL_TRUE(OS_ObjectIdRefcountTryAcquire(&token));
+    UtAssert_UINT32_EQ(record->refcount, 1);
+    OS_ObjectIdRefcountRelease(&token);
+    UtAssert_UINT32_EQ(record->refcount, 0);
+    UtAssert_STUB_COUNT(OS_Lock_Global_Impl, 0);
+    UtAssert_STUB_COUNT(OS_Unlock_Global_Impl, 0);
+
+    /* ID does not match - refcount is backed out, and waiters are notified */
+    record->active_id = OS_OBJECT_ID_RESERVED;
+    UtAssert_BOOL_FALSE(OS_ObjectIdRefcountTryAcquire(&token));
+    UtAssert_UINT32_EQ(record->refcount, 0);
+    UtAssert_STUB_COUNT(OS_Lock_Global_Impl, 1);
+    UtAssert_STUB_COUNT(OS_Unlock_Global_Impl, 1);
+
+    memset(record, 0, sizeof(*record));
+}
+
 void Test_OS_ObjectIdFinalize(void)
 {
     /*
@@ -1041,7 +1229,7 @@ void Test_OS_ForEachObject(void)
     UtAssert_True(Count.TaskCount == 1, "OS_ForEachObject() TaskCount (%lu) == 1", (unsigned long)Count.TaskCount);
     UtAssert_True(Count.QueueCount == 1, "OS_ForEachObject() QueueCount (%lu) == 1", (unsigned long)Count.QueueCount);
     UtAssert_True(Count.MutexCount == 1, "OS_ForEachObject() MutexCount (%lu) == 1", (unsigned long)Count.MutexCount);
-    UtAssert_True(Count.OtherCount == 10, "OS_ForEachObject() OtherCount (%lu) == 9", (unsigned long)Count.OtherCount);
+    UtAssert_True(Count.OtherCount == 11, "OS_ForEachObject() OtherCount (%lu) == 11", (unsigned long)Count.OtherCount);
 
     OS_ForEachObjectOfType(OS_OBJECT_TYPE_OS_QUEUE, self_id.id, ObjTypeCounter, &Count);
     UtAssert_True(Count.TaskCount == 1, "OS_ForEachObjectOfType(), creator %08lx TaskCount (%lu) == 1",
@@ -1255,8 +1443,12 @@ void UtTest_Setup(void)
     ADD_TEST(OS_ObjectIdFindNextFree);
     ADD_TEST(OS_ObjectIdToArrayIndex);
     ADD_TEST(OS_ObjectIdFindByName);
+#ifdef OSAL_CONFIG_NAME_INDEX
+    ADD_TEST(OS_ObjectIdNameIndex);
+#endif
     ADD_TEST(OS_ObjectIdGetById);
     ADD_TEST(OS_ObjectIdTransaction);
+    ADD_TEST(OS_ObjectIdRefcount);
     ADD_TEST(OS_ObjectIdAllocateNew);
     ADD_TEST(OS_ObjectIdFinalize);
     ADD_TEST(OS_ObjectIdConvertToken);
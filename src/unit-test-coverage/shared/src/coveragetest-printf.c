@@ -24,6 +24,7 @@
  */
 #include "os-shared-coveragetest.h"
 #include "os-shared-printf.h"
+#include "os-shared-clock.h"
 #include "os-shared-common.h"
 
 #include "OCS_stdio.h"
@@ -89,15 +90,6 @@ void Test_OS_printf(void)
     UtAssert_True(OS_console_table[0].WritePos >= 10, "WritePos (%lu) >= 10",
                   (unsigned long)OS_console_table[0].WritePos);
 
-    /* normal case - async mode */
-    OS_console_table[0].IsAsync  = true;
-    OS_console_table[0].WritePos = 0;
-    OS_printf("UnitTest3a");
-    UtAssert_STUB_COUNT(OS_ConsoleWakeup_Impl, 1);
-    UtAssert_STUB_COUNT(OS_ConsoleOutput_Impl, 1);
-    UtAssert_True(OS_console_table[0].WritePos >= 10, "WritePos (%lu) >= 10",
-                  (unsigned long)OS_console_table[0].WritePos);
-
     /* print a long string that does not fit in the 16-char buffer */
     OS_printf_enable();
     OS_printf("UnitTest4BufferLengthExceeded");
@@ -122,6 +114,29 @@ void Test_OS_printf(void)
     UT_SetDefaultReturnValue(UT_KEY(OCS_vsnprintf), OS_BUFFER_SIZE + 10);
     OS_printf("UnitTest7");
 
+    /* normal case - async mode, staged in the ring of the calling task */
+    OS_console_table[0].IsAsync  = true;
+    OS_console_table[0].WritePos = 0;
+    OS_console_table[0].ReadPos  = 0;
+    UT_ResetState(UT_KEY(OCS_vsnprintf));
+    UT_ResetState(UT_KEY(OS_ConsoleOutput_Impl));
+    OS_printf("UnitTest3a");
+    UtAssert_STUB_COUNT(OS_ConsoleWakeup_Impl, 1);
+    UtAssert_STUB_COUNT(OS_ConsoleOutput_Impl, 0);
+    UtAssert_ZERO(OS_console_table[0].WritePos);
+    UtAssert_NONZERO(OS_console_staging_table[0].WritePos);
+
+    /* async mode from a thread that is not an OSAL task, staged in the shared ring */
+    OS_console_table[0].WakeupPending = false;
+    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdToArrayIndex), 1, OS_ERR_INVALID_ID);
+    OS_printf("UnitTest3b");
+    UtAssert_STUB_COUNT(OS_ConsoleWakeup_Impl, 2);
+    UtAssert_NONZERO(OS_console_staging_table[OS_CONSOLE_STAGING_COUNT - 1].WritePos);
+
+    /* the utility task has not drained yet, so the wakeup is not repeated */
+    OS_printf("UnitTest3c");
+    UtAssert_STUB_COUNT(OS_ConsoleWakeup_Impl, 2);
+
     /* Null case */
     OS_printf(NULL);
 
@@ -132,6 +147,254 @@ void Test_OS_printf(void)
     UtAssert_STUB_COUNT(OS_ConsoleWakeup_Impl, 0);
 }
 
+void Test_OS_ConsoleDrainStaging(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_ConsoleDrainStaging(const OS_object_token_t *token)
+     */
+    OS_object_token_t token;
+    OS_time_t         stamps[3];
+
+    memset(&token, 0, sizeof(token));
+
+    OS_SharedGlobalVars.GlobalState   = OS_INIT_MAGIC_NUMBER;
+    OS_SharedGlobalVars.PrintfEnabled = true;
+    OS_console_table[0].IsAsync       = true;
+
+    /* nothing staged, which still clears the pending wakeup but is not counted as a drain */
+    OS_console_table[0].WakeupPending = true;
+    OSAPI_TEST_FUNCTION_RC(OS_ConsoleDrainStaging(&token), OS_SUCCESS);
+    UtAssert_ZERO(OS_console_table[0].WritePos);
+    UtAssert_BOOL_FALSE(OS_console_table[0].WakeupPending);
+    UtAssert_ZERO(OS_console_table[0].DrainCount);
+
+    /* records from different rings are moved in timestamp order, not ring order */
+    stamps[0] = OS_TimeFromTotalSeconds(2);
+    stamps[1] = OS_TimeFromTotalSeconds(1);
+    stamps[2] = OS_TimeFromTotalSeconds(5);
+    UT_SetDataBuffer(UT_KEY(OS_GetLocalTime_Impl), stamps, sizeof(stamps), false);
+    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdToArrayIndex), 1, OS_ERR_INVALID_ID);
+    OS_printf("A");
+    OS_printf("B");
+    UtAssert_STUB_COUNT(OS_ConsoleWakeup_Impl, 1);
+    OSAPI_TEST_FUNCTION_RC(OS_ConsoleDrainStaging(&token), OS_SUCCESS);
+    UtAssert_UINT32_EQ(OS_console_table[0].WritePos, 2);
+    UtAssert_StrnCmp(TestConsoleBuffer, "BA", 2, "Console buffer in timestamp order");
+
+    /* the latency is the age of the oldest record */
+    UtAssert_UINT32_EQ(OS_console_table[0].DrainCount, 1);
+    UtAssert_INT32_EQ(OS_TimeGetTotalSeconds(OS_console_table[0].LastDrainLatency), 4);
+    UtAssert_INT32_EQ(OS_TimeGetTotalSeconds(OS_console_table[0].MaxDrainLatency), 4);
+
+    /* a record that does not fit yet stays staged until the console buffer is written out */
+    OS_console_table[0].ReadPos = OS_console_table[0].WritePos;
+    OS_printf("0123456789");
+    OS_printf("0123456789");
+    OSAPI_TEST_FUNCTION_RC(OS_ConsoleDrainStaging(&token), OS_QUEUE_FULL);
+    UtAssert_UINT32_EQ(OS_console_table[0].WritePos, 12);
+    OS_console_table[0].ReadPos = OS_console_table[0].WritePos;
+    OSAPI_TEST_FUNCTION_RC(OS_ConsoleDrainStaging(&token), OS_SUCCESS);
+    UtAssert_UINT32_EQ(OS_console_table[0].WritePos, 6);
+    UtAssert_StrnCmp(TestConsoleBuffer, "456789", 6, "Console buffer wrapped");
+    UtAssert_ZERO(OS_console_table[0].OverflowEvents);
+
+    UtAssert_UINT32_EQ(OS_console_table[0].DrainCount, 3);
+    UtAssert_INT32_EQ(OS_TimeGetTotalSeconds(OS_console_table[0].MaxDrainLatency), 4);
+
+    /* a record that can never fit is discarded, and a clock set back gives no latency */
+    stamps[0] = OS_TimeFromTotalSeconds(3);
+    UT_SetDataBuffer(UT_KEY(OS_GetLocalTime_Impl), stamps, sizeof(stamps[0]), false);
+    OS_console_table[0].ReadPos = OS_console_table[0].WritePos;
+    OS_printf("UnitTestTooLongForConsole");
+    OSAPI_TEST_FUNCTION_RC(OS_ConsoleDrainStaging(&token), OS_SUCCESS);
+    UtAssert_UINT32_EQ(OS_console_table[0].OverflowEvents, 1);
+    UtAssert_UINT32_EQ(OS_console_table[0].WritePos, 6);
+    UtAssert_INT32_EQ(OS_TimeGetTotalNanoseconds(OS_console_table[0].LastDrainLatency), 0);
+
+    /* records wrap around the end of the staging ring */
+    OS_console_staging_table[0].ReadPos  = OS_PRINTF_STAGING_SIZE - 4;
+    OS_console_staging_table[0].WritePos = OS_PRINTF_STAGING_SIZE - 4;
+    OS_printf("C");
+    OSAPI_TEST_FUNCTION_RC(OS_ConsoleDrainStaging(&token), OS_SUCCESS);
+    UtAssert_UINT32_EQ(OS_console_table[0].WritePos, 7);
+    UtAssert_StrnCmp(&TestConsoleBuffer[6], "C", 1, "Staged record wrapped");
+
+    /* a full staging ring drops the message */
+    OS_console_staging_table[0].WritePos = OS_console_staging_table[0].ReadPos + OS_PRINTF_STAGING_SIZE;
+    OS_printf("D");
+    UtAssert_UINT32_EQ(OS_console_table[0].OverflowEvents, 2);
+}
+
+void Test_OS_printf_Deferred(void)
+{
+    /*
+     * Test Case For:
+     * void OS_printf( const char *String, ...);
+     * (with OSAL_CONFIG_PRINTF_DEFERRED)
+     */
+    OS_object_token_t token;
+    static char       LongFormat[OS_BUFFER_SIZE + 16];
+    char              Expected[OS_BUFFER_SIZE];
+    char              LargeBuffer[256];
+    uint32            idx;
+    uint32            n;
+
+    memset(&token, 0, sizeof(token));
+    memset(LargeBuffer, 0, sizeof(LargeBuffer));
+
+    OS_SharedGlobalVars.GlobalState    = OS_INIT_MAGIC_NUMBER;
+    OS_SharedGlobalVars.PrintfEnabled  = true;
+    OS_SharedGlobalVars.PrintfDeferred = true;
+    OS_console_table[0].IsAsync        = true;
+    OS_console_table[0].BufBase        = LargeBuffer;
+    OS_console_table[0].BufSize        = sizeof(LargeBuffer);
+
+    /*
+     * The caller only captures the arguments, and formatting is done when drained.
+     * Note the coverage stubs cannot retrieve variable arguments, so all values are zero.
+     */
+    strcpy(LongFormat, "%d|%ld|%lld|%jd|%zu|%td|%hhd|%5.1f|%.2Lf|%s|%-3s|%*d|%.*d|%n|%ls|%%|%y|%");
+    OS_printf(LongFormat, 1, 2L, 3LL, (intmax_t)4, (size_t)5, (ptrdiff_t)6, 7, 8.0, (long double)9.0, "a", "b", 2, 10,
+              2, 11, (int *)NULL, L"c");
+    UtAssert_STUB_COUNT(OCS_vsnprintf, 0);
+    UtAssert_ZERO(OS_console_table[0].WritePos);
+    OSAPI_TEST_FUNCTION_RC(OS_ConsoleDrainStaging(&token), OS_SUCCESS);
+    UtAssert_StrCmp(LargeBuffer, "0|0|0|0|0|0|0|  0.0|0.00|(null)|(null)|0||||%|%y|%", "Deferred output");
+
+    /* A specification that is too long is not output */
+    OS_console_table[0].WritePos = 0;
+    OS_console_table[0].ReadPos  = 0;
+    memset(LargeBuffer, 0, sizeof(LargeBuffer));
+    memset(LongFormat, 0, sizeof(LongFormat));
+    strcpy(LongFormat, "[%");
+    memset(&LongFormat[2], '0', 40);
+    strcat(LongFormat, "1d]");
+    OS_printf(LongFormat, 1);
+    OSAPI_TEST_FUNCTION_RC(OS_ConsoleDrainStaging(&token), OS_SUCCESS);
+    UtAssert_StrCmp(LargeBuffer, "[]", "Long specification");
+
+    /* No more of a string than its precision is captured */
+    OS_console_table[0].WritePos = 0;
+    OS_console_table[0].ReadPos  = 0;
+    memset(LargeBuffer, 0, sizeof(LargeBuffer));
+    OS_printf("[%.3s|%.*s|%.99999s]", "abcd", 0, "efgh", "ijkl");
+    OSAPI_TEST_FUNCTION_RC(OS_ConsoleDrainStaging(&token), OS_SUCCESS);
+    UtAssert_StrCmp(LargeBuffer, "[(nu||(null)]", "String precision");
+
+    /*
+     * Output stops at the first argument that could not be captured.  Each NULL
+     * string is captured as "(null)" plus a terminator, so 24 of these fill
+     * all but 4 bytes of the capture buffer.
+     */
+    memset(Expected, 0, sizeof(Expected));
+    for (idx = 0; idx < 24; ++idx)
+    {
+        strcat(Expected, "(null)");
+    }
+
+    for (idx = 0; idx < 4; ++idx)
+    {
+        memset(LongFormat, 0, sizeof(LongFormat));
+        for (n = 0; n < 24; ++n)
+        {
+            strcat(LongFormat, "%s");
+        }
+        switch (idx)
+        {
+            case 0:
+                /* the final string is truncated, and the one after is not captured */
+                strcat(LongFormat, "%s%s");
+                break;
+            case 1:
+                /* the '*' argument is captured but not the value */
+                strcat(LongFormat, "%*d");
+                break;
+            case 2:
+                /* the '*' argument is not captured */
+                strcat(LongFormat, "%d%*d");
+                break;
+            default:
+                /* the value is not captured */
+                strcat(LongFormat, "%d%d");
+                break;
+        }
+
+        OS_console_table[0].WritePos = 0;
+        OS_console_table[0].ReadPos  = 0;
+        memset(LargeBuffer, 0, sizeof(LargeBuffer));
+        OS_printf(LongFormat, "x");
+        OSAPI_TEST_FUNCTION_RC(OS_ConsoleDrainStaging(&token), OS_SUCCESS);
+        UtAssert_True(strncmp(LargeBuffer, Expected, strlen(Expected)) == 0, "Captured arguments output (%u)",
+                      (unsigned int)idx);
+    }
+
+    UtAssert_StrCmp(&LargeBuffer[strlen(Expected)], "0", "Output after last captured argument");
+
+    /* Output longer than the buffer is truncated */
+    OS_console_table[0].WritePos = 0;
+    OS_console_table[0].ReadPos  = 0;
+    memset(LargeBuffer, 0, sizeof(LargeBuffer));
+    memset(LongFormat, 'x', OS_BUFFER_SIZE + 10);
+    LongFormat[OS_BUFFER_SIZE + 10] = 0;
+    OS_printf(LongFormat, "x");
+    OSAPI_TEST_FUNCTION_RC(OS_ConsoleDrainStaging(&token), OS_SUCCESS);
+    UtAssert_UINT32_EQ(strlen(LargeBuffer), OS_BUFFER_SIZE - 1);
+
+    OS_console_table[0].WritePos = 0;
+    OS_console_table[0].ReadPos  = 0;
+    memset(LargeBuffer, 0, sizeof(LargeBuffer));
+    LongFormat[OS_BUFFER_SIZE - 2] = '%';
+    LongFormat[OS_BUFFER_SIZE - 1] = 'y';
+    OS_printf(LongFormat, "x");
+    OSAPI_TEST_FUNCTION_RC(OS_ConsoleDrainStaging(&token), OS_SUCCESS);
+    UtAssert_UINT32_EQ(strlen(LargeBuffer), OS_BUFFER_SIZE - 1);
+
+    OS_console_table[0].WritePos = 0;
+    OS_console_table[0].ReadPos  = 0;
+    memset(LargeBuffer, 0, sizeof(LargeBuffer));
+    LongFormat[OS_BUFFER_SIZE - 3] = '%';
+    LongFormat[OS_BUFFER_SIZE - 2] = 'd';
+    OS_printf(LongFormat, 1);
+    OSAPI_TEST_FUNCTION_RC(OS_ConsoleDrainStaging(&token), OS_SUCCESS);
+    UtAssert_UINT32_EQ(strlen(LargeBuffer), OS_BUFFER_SIZE - 1);
+
+    /* Without the utility task, the format is applied in the caller */
+    OS_console_table[0].IsAsync  = false;
+    OS_console_table[0].WritePos = 0;
+    OS_console_table[0].ReadPos  = 0;
+    memset(LargeBuffer, 0, sizeof(LargeBuffer));
+    OS_printf("sync %d", 1);
+    UtAssert_StrCmp(LargeBuffer, "sync 0", "Deferred output on sync console");
+}
+
+void Test_OS_ConsoleGetStats(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_ConsoleGetStats(OS_console_stats_t *stats)
+     */
+    OS_console_stats_t stats;
+
+    OS_console_table[0].OverflowEvents   = 1;
+    OS_console_table[0].DrainCount       = 2;
+    OS_console_table[0].BytesWritten     = 3;
+    OS_console_table[0].LastDrainLatency = OS_TimeFromTotalSeconds(4);
+    OS_console_table[0].MaxDrainLatency  = OS_TimeFromTotalSeconds(5);
+
+    OSAPI_TEST_FUNCTION_RC(OS_ConsoleGetStats(&stats), OS_SUCCESS);
+    UtAssert_UINT32_EQ(stats.OverflowEvents, 1);
+    UtAssert_UINT32_EQ(stats.DrainCount, 2);
+    UtAssert_UINT32_EQ(stats.BytesWritten, 3);
+    UtAssert_INT32_EQ(OS_TimeGetTotalSeconds(stats.LastDrainLatency), 4);
+    UtAssert_INT32_EQ(OS_TimeGetTotalSeconds(stats.MaxDrainLatency), 5);
+
+    /* error cases */
+    OSAPI_TEST_FUNCTION_RC(OS_ConsoleGetStats(NULL), OS_INVALID_POINTER);
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_ConsoleGetStats(&stats), OS_ERR_INVALID_ID);
+}
+
 /* Osapi_Test_Setup
  *
  * Purpose:
@@ -142,6 +405,7 @@ void Osapi_Test_Setup(void)
     UT_ResetState(0);
     memset(OS_console_table, 0, sizeof(OS_console_table));
     memset(&OS_SharedGlobalVars, 0, sizeof(OS_SharedGlobalVars));
+    memset(OS_console_staging_table, 0, sizeof(OS_console_staging_table));
     OS_console_table[0].BufBase = TestConsoleBuffer;
     OS_console_table[0].BufSize = sizeof(TestConsoleBuffer);
 }
@@ -161,4 +425,7 @@ void UtTest_Setup(void)
 {
     ADD_TEST(OS_ConsoleAPI_Init);
     ADD_TEST(OS_printf);
+    ADD_TEST(OS_ConsoleDrainStaging);
+    ADD_TEST(OS_printf_Deferred);
+    ADD_TEST(OS_ConsoleGetStats);
 }
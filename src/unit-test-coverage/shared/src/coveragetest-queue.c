@@ -27,6 +27,17 @@
 
 #include "OCS_string.h"
 
+/* OS_QueueGetInfo_Impl hook to report the depth passed as the user object */
+static int32 UT_Hook_OS_QueueGetInfo_Impl(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                          const UT_StubContext_t *Context)
+{
+    OS_queue_prop_t *queue_prop = UT_Hook_GetArgValueByName(Context, "queue_prop", OS_queue_prop_t *);
+
+    queue_prop->depth = *((osal_blockcount_t *)UserObj);
+
+    return StubRetcode;
+}
+
 /*
 **********************************************************************************
 **          PUBLIC API FUNCTIONS
@@ -134,6 +145,296 @@ void Test_OS_QueuePut(void)
     OSAPI_TEST_FUNCTION_RC(OS_QueuePut(UT_OBJID_1, Data, sizeof(Data), 0), OS_ERROR);
 }
 
+void Test_OS_QueueReserve(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_QueueReserve(osal_id_t queue_id, void **buffer)
+     */
+    void *            buffer;
+    osal_blockcount_t depth;
+    uint32            i;
+
+    memset(&OS_queue_table[1], 0, sizeof(OS_queue_table[1]));
+    OS_queue_table[1].max_size  = 4;
+    OS_queue_table[1].max_depth = OS_QUEUE_ZEROCOPY_SLOTS + 1;
+
+    OSAPI_TEST_FUNCTION_RC(OS_QueueReserve(UT_OBJID_1, &buffer), OS_SUCCESS);
+
+    /* Implementation does not allow direct access, so the buffers of the queue are used */
+    UT_SetDefaultReturnValue(UT_KEY(OS_QueueReserve_Impl), OS_ERR_NOT_IMPLEMENTED);
+    for (i = 0; i < OS_QUEUE_ZEROCOPY_SLOTS; ++i)
+    {
+        buffer = NULL;
+        OSAPI_TEST_FUNCTION_RC(OS_QueueReserve(UT_OBJID_1, &buffer), OS_SUCCESS);
+        UtAssert_ADDRESS_EQ(buffer, OS_queue_table[1].slots[i].u.data);
+        UtAssert_UINT32_EQ(OS_queue_table[1].slots[i].state, OS_QUEUE_SLOT_RESERVED);
+    }
+
+    /* All buffers in use */
+    OSAPI_TEST_FUNCTION_RC(OS_QueueReserve(UT_OBJID_1, &buffer), OS_QUEUE_FULL);
+
+    /* The messages already in the queue and those reserved fill it, borrowed buffers do not count */
+    OS_queue_table[1].slots[0].state = OS_QUEUE_SLOT_FREE;
+    OS_queue_table[1].slots[1].state = OS_QUEUE_SLOT_BORROWED;
+    depth                            = OS_QUEUE_ZEROCOPY_SLOTS;
+    UT_SetHookFunction(UT_KEY(OS_QueueGetInfo_Impl), UT_Hook_OS_QueueGetInfo_Impl, &depth);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueReserve(UT_OBJID_1, &buffer), OS_SUCCESS);
+    UtAssert_UINT32_EQ(OS_queue_table[1].slots[0].state, OS_QUEUE_SLOT_RESERVED);
+
+    OS_queue_table[1].slots[1].state = OS_QUEUE_SLOT_FREE;
+    OSAPI_TEST_FUNCTION_RC(OS_QueueReserve(UT_OBJID_1, &buffer), OS_QUEUE_FULL);
+    UtAssert_UINT32_EQ(OS_queue_table[1].slots[1].state, OS_QUEUE_SLOT_FREE);
+    UT_ResetState(UT_KEY(OS_QueueGetInfo_Impl));
+
+    /* The data size of the queue is too large for the buffers */
+    OS_queue_table[1].max_size = OS_QUEUE_ZEROCOPY_SLOT_SIZE + 1;
+    OSAPI_TEST_FUNCTION_RC(OS_QueueReserve(UT_OBJID_1, &buffer), OS_QUEUE_INVALID_SIZE);
+
+    /* test error cases */
+    OSAPI_TEST_FUNCTION_RC(OS_QueueReserve(UT_OBJID_1, NULL), OS_INVALID_POINTER);
+
+    OS_queue_table[1].max_size = 4;
+    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdGetById), 2, OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueReserve(UT_OBJID_1, &buffer), OS_ERROR);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueReserve(UT_OBJID_1, &buffer), OS_ERROR);
+}
+
+void Test_OS_QueueCommit(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_QueueCommit(osal_id_t queue_id, void *buffer, size_t size)
+     */
+    char  Data[4] = "xyz";
+    void *buffer;
+
+    memset(&OS_queue_table[1], 0, sizeof(OS_queue_table[1]));
+    OS_queue_table[1].max_size = sizeof(Data);
+
+    OSAPI_TEST_FUNCTION_RC(OS_QueueCommit(UT_OBJID_1, Data, sizeof(Data)), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_QueuePut_Impl, 0);
+
+    /* Buffer of the queue is copied into the queue and then freed, even if that fails */
+    UT_SetDefaultReturnValue(UT_KEY(OS_QueueCommit_Impl), OS_ERR_NOT_IMPLEMENTED);
+    buffer                           = OS_queue_table[1].slots[0].u.data;
+    OS_queue_table[1].slots[0].state = OS_QUEUE_SLOT_RESERVED;
+    UT_SetDefaultReturnValue(UT_KEY(OS_QueuePut_Impl), OS_QUEUE_FULL);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueCommit(UT_OBJID_1, buffer, sizeof(Data)), OS_QUEUE_FULL);
+    UtAssert_STUB_COUNT(OS_QueuePut_Impl, 1);
+    UtAssert_UINT32_EQ(OS_queue_table[1].slots[0].state, OS_QUEUE_SLOT_FREE);
+
+    /* A buffer which is not reserved from this queue, or already committed, is rejected */
+    OSAPI_TEST_FUNCTION_RC(OS_QueueCommit(UT_OBJID_1, buffer, sizeof(Data)), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueCommit(UT_OBJID_1, Data, sizeof(Data)), OS_INVALID_POINTER);
+    OS_queue_table[1].slots[0].state = OS_QUEUE_SLOT_BORROWED;
+    OSAPI_TEST_FUNCTION_RC(OS_QueueCommit(UT_OBJID_1, buffer, sizeof(Data)), OS_INVALID_POINTER);
+    UtAssert_STUB_COUNT(OS_QueuePut_Impl, 1);
+
+    /* test error cases */
+    OSAPI_TEST_FUNCTION_RC(OS_QueueCommit(UT_OBJID_1, NULL, sizeof(Data)), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueCommit(UT_OBJID_1, Data, OSAL_SIZE_C(0)), OS_ERR_INVALID_SIZE);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueCommit(UT_OBJID_1, Data, OSAL_SIZE_C(UINT32_MAX)), OS_ERR_INVALID_SIZE);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueCommit(UT_OBJID_1, Data, 1 + sizeof(Data)), OS_QUEUE_INVALID_SIZE);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueCommit(UT_OBJID_1, Data, sizeof(Data)), OS_ERROR);
+}
+
+void Test_OS_QueueBorrow(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_QueueBorrow(osal_id_t queue_id, const void **buffer, size_t *size_copied, int32 timeout)
+     */
+    const void *buffer;
+    size_t      actual_size;
+    uint32      i;
+
+    memset(&OS_queue_table[1], 0, sizeof(OS_queue_table[1]));
+    OS_queue_table[1].max_size = 4;
+
+    OSAPI_TEST_FUNCTION_RC(OS_QueueBorrow(UT_OBJID_1, &buffer, &actual_size, OS_CHECK), OS_SUCCESS);
+
+    /* Implementation does not allow direct access, so the message is copied into a buffer of the queue */
+    UT_SetDefaultReturnValue(UT_KEY(OS_QueueBorrow_Impl), OS_ERR_NOT_IMPLEMENTED);
+    buffer = NULL;
+    OSAPI_TEST_FUNCTION_RC(OS_QueueBorrow(UT_OBJID_1, &buffer, &actual_size, OS_CHECK), OS_SUCCESS);
+    UtAssert_ADDRESS_EQ(buffer, OS_queue_table[1].slots[0].u.data);
+    UtAssert_UINT32_EQ(OS_queue_table[1].slots[0].state, OS_QUEUE_SLOT_BORROWED);
+    UtAssert_STUB_COUNT(OS_QueueGet_Impl, 1);
+
+    /* Buffer is freed again if no message was received */
+    UT_SetDeferredRetcode(UT_KEY(OS_QueueGet_Impl), 1, OS_QUEUE_EMPTY);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueBorrow(UT_OBJID_1, &buffer, &actual_size, OS_CHECK), OS_QUEUE_EMPTY);
+    UtAssert_UINT32_EQ(OS_queue_table[1].slots[1].state, OS_QUEUE_SLOT_FREE);
+
+    /* All buffers in use */
+    for (i = 0; i < OS_QUEUE_ZEROCOPY_SLOTS; ++i)
+    {
+        OS_queue_table[1].slots[i].state = OS_QUEUE_SLOT_BORROWED;
+    }
+    OSAPI_TEST_FUNCTION_RC(OS_QueueBorrow(UT_OBJID_1, &buffer, &actual_size, OS_CHECK), OS_ERROR);
+    UtAssert_ZERO(actual_size);
+
+    /* The data size of the queue is too large for the buffers */
+    OS_queue_table[1].max_size = OS_QUEUE_ZEROCOPY_SLOT_SIZE + 1;
+    OSAPI_TEST_FUNCTION_RC(OS_QueueBorrow(UT_OBJID_1, &buffer, &actual_size, OS_CHECK), OS_QUEUE_INVALID_SIZE);
+
+    /* test error cases */
+    OSAPI_TEST_FUNCTION_RC(OS_QueueBorrow(UT_OBJID_1, NULL, &actual_size, OS_CHECK), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueBorrow(UT_OBJID_1, &buffer, NULL, OS_CHECK), OS_INVALID_POINTER);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueBorrow(UT_OBJID_1, &buffer, &actual_size, OS_CHECK), OS_ERROR);
+}
+
+void Test_OS_QueueRelease(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_QueueRelease(osal_id_t queue_id, const void *buffer)
+     */
+    char        Data[4] = "xyz";
+    const void *buffer;
+
+    memset(&OS_queue_table[1], 0, sizeof(OS_queue_table[1]));
+
+    OSAPI_TEST_FUNCTION_RC(OS_QueueRelease(UT_OBJID_1, Data), OS_SUCCESS);
+
+    /* Buffer of the queue is freed */
+    UT_SetDefaultReturnValue(UT_KEY(OS_QueueRelease_Impl), OS_ERR_NOT_IMPLEMENTED);
+    buffer                           = OS_queue_table[1].slots[1].u.data;
+    OS_queue_table[1].slots[1].state = OS_QUEUE_SLOT_BORROWED;
+    OSAPI_TEST_FUNCTION_RC(OS_QueueRelease(UT_OBJID_1, buffer), OS_SUCCESS);
+    UtAssert_UINT32_EQ(OS_queue_table[1].slots[1].state, OS_QUEUE_SLOT_FREE);
+
+    /* A buffer which is not borrowed from this queue, or already released, is rejected */
+    OSAPI_TEST_FUNCTION_RC(OS_QueueRelease(UT_OBJID_1, buffer), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueRelease(UT_OBJID_1, Data), OS_INVALID_POINTER);
+
+    /* test error cases */
+    OSAPI_TEST_FUNCTION_RC(OS_QueueRelease(UT_OBJID_1, NULL), OS_INVALID_POINTER);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueRelease(UT_OBJID_1, Data), OS_ERROR);
+}
+
+void Test_OS_QueueGetMulti(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_QueueGetMulti(osal_id_t queue_id, void *const *data, size_t size, size_t *size_copied, uint32 count,
+     *                        uint32 *count_copied, int32 timeout)
+     */
+    char   Buf[3][4];
+    void * Data[3] = {Buf[0], Buf[1], Buf[2]};
+    void * BadData[3] = {Buf[0], NULL, Buf[2]};
+    size_t actual_size[3];
+    uint32 count;
+
+    OS_queue_table[1].max_size = sizeof(Buf[0]);
+
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetMulti(UT_OBJID_1, Data, sizeof(Buf[0]), actual_size, 3, &count, 0), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_QueueGetMulti_Impl, 1);
+    UtAssert_STUB_COUNT(OS_QueueGet_Impl, 0);
+
+    /* Messages received one at a time, stopping when the queue is empty */
+    UT_SetDefaultReturnValue(UT_KEY(OS_QueueGetMulti_Impl), OS_ERR_NOT_IMPLEMENTED);
+    UT_SetDeferredRetcode(UT_KEY(OS_QueueGet_Impl), 3, OS_QUEUE_EMPTY);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetMulti(UT_OBJID_1, Data, sizeof(Buf[0]), actual_size, 3, &count, 0), OS_SUCCESS);
+    UtAssert_UINT32_EQ(count, 2);
+    UtAssert_STUB_COUNT(OS_QueueGet_Impl, 3);
+
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetMulti(UT_OBJID_1, Data, sizeof(Buf[0]), actual_size, 3, &count, 0), OS_SUCCESS);
+    UtAssert_UINT32_EQ(count, 3);
+
+    UT_SetDeferredRetcode(UT_KEY(OS_QueueGet_Impl), 1, OS_QUEUE_TIMEOUT);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetMulti(UT_OBJID_1, Data, sizeof(Buf[0]), actual_size, 3, &count, 0),
+                           OS_QUEUE_TIMEOUT);
+    UtAssert_UINT32_EQ(count, 0);
+
+    /* test error cases */
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetMulti(UT_OBJID_1, NULL, sizeof(Buf[0]), actual_size, 3, &count, 0),
+                           OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetMulti(UT_OBJID_1, Data, sizeof(Buf[0]), NULL, 3, &count, 0), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetMulti(UT_OBJID_1, Data, sizeof(Buf[0]), actual_size, 3, NULL, 0),
+                           OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetMulti(UT_OBJID_1, BadData, sizeof(Buf[0]), actual_size, 3, &count, 0),
+                           OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetMulti(UT_OBJID_1, Data, OSAL_SIZE_C(0), actual_size, 3, &count, 0),
+                           OS_ERR_INVALID_SIZE);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetMulti(UT_OBJID_1, Data, sizeof(Buf[0]), actual_size, 0, &count, 0),
+                           OS_ERR_INVALID_SIZE);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetMulti(UT_OBJID_1, Data, OSAL_SIZE_C(UINT32_MAX), actual_size, 3, &count, 0),
+                           OS_ERR_INVALID_SIZE);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetMulti(UT_OBJID_1, Data, sizeof(Buf[0]), actual_size, UINT32_MAX, &count, 0),
+                           OS_ERR_INVALID_SIZE);
+
+    OS_queue_table[1].max_size = sizeof(Buf[0]) + 10;
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetMulti(UT_OBJID_1, Data, sizeof(Buf[0]), actual_size, 3, &count, 0),
+                           OS_QUEUE_INVALID_SIZE);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetMulti(UT_OBJID_1, Data, sizeof(Buf[0]), actual_size, 3, &count, 0), OS_ERROR);
+}
+
+void Test_OS_QueuePutMulti(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_QueuePutMulti(osal_id_t queue_id, const void *const *data, const size_t *size, uint32 count,
+     *                        uint32 *count_put, uint32 flags)
+     */
+    const char   Buf[3][4]  = {"abc", "def", "ghi"};
+    const void * Data[3]    = {Buf[0], Buf[1], Buf[2]};
+    const void * BadData[3] = {Buf[0], NULL, Buf[2]};
+    size_t       Size[3]    = {4, 4, 4};
+    size_t       BadSize[3] = {4, 0, 4};
+    uint32       count;
+
+    OS_queue_table[1].max_depth = 10;
+    OS_queue_table[1].max_size  = sizeof(Buf[0]);
+
+    OSAPI_TEST_FUNCTION_RC(OS_QueuePutMulti(UT_OBJID_1, Data, Size, 3, &count, 0), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_QueuePutMulti_Impl, 1);
+    UtAssert_STUB_COUNT(OS_QueuePut_Impl, 0);
+
+    /* Messages put one at a time, stopping when the queue is full */
+    UT_SetDefaultReturnValue(UT_KEY(OS_QueuePutMulti_Impl), OS_ERR_NOT_IMPLEMENTED);
+    UT_SetDeferredRetcode(UT_KEY(OS_QueuePut_Impl), 2, OS_QUEUE_FULL);
+    OSAPI_TEST_FUNCTION_RC(OS_QueuePutMulti(UT_OBJID_1, Data, Size, 3, &count, 0), OS_SUCCESS);
+    UtAssert_UINT32_EQ(count, 1);
+    UtAssert_STUB_COUNT(OS_QueuePut_Impl, 2);
+
+    OSAPI_TEST_FUNCTION_RC(OS_QueuePutMulti(UT_OBJID_1, Data, Size, 3, &count, 0), OS_SUCCESS);
+    UtAssert_UINT32_EQ(count, 3);
+
+    UT_SetDeferredRetcode(UT_KEY(OS_QueuePut_Impl), 1, OS_QUEUE_FULL);
+    OSAPI_TEST_FUNCTION_RC(OS_QueuePutMulti(UT_OBJID_1, Data, Size, 3, &count, 0), OS_QUEUE_FULL);
+    UtAssert_UINT32_EQ(count, 0);
+
+    /* test error cases */
+    OSAPI_TEST_FUNCTION_RC(OS_QueuePutMulti(UT_OBJID_1, NULL, Size, 3, &count, 0), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_QueuePutMulti(UT_OBJID_1, Data, NULL, 3, &count, 0), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_QueuePutMulti(UT_OBJID_1, Data, Size, 3, NULL, 0), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_QueuePutMulti(UT_OBJID_1, BadData, Size, 3, &count, 0), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_QueuePutMulti(UT_OBJID_1, Data, BadSize, 3, &count, 0), OS_ERR_INVALID_SIZE);
+    OSAPI_TEST_FUNCTION_RC(OS_QueuePutMulti(UT_OBJID_1, Data, Size, 0, &count, 0), OS_ERR_INVALID_SIZE);
+    OSAPI_TEST_FUNCTION_RC(OS_QueuePutMulti(UT_OBJID_1, Data, Size, UINT32_MAX, &count, 0), OS_ERR_INVALID_SIZE);
+    BadSize[1] = UINT32_MAX;
+    OSAPI_TEST_FUNCTION_RC(OS_QueuePutMulti(UT_OBJID_1, Data, BadSize, 3, &count, 0), OS_ERR_INVALID_SIZE);
+
+    OS_queue_table[1].max_size = sizeof(Buf[0]) - 1;
+    OSAPI_TEST_FUNCTION_RC(OS_QueuePutMulti(UT_OBJID_1, Data, Size, 3, &count, 0), OS_QUEUE_INVALID_SIZE);
+    UtAssert_UINT32_EQ(count, 0);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_QueuePutMulti(UT_OBJID_1, Data, Size, 3, &count, 0), OS_ERROR);
+}
+
 void Test_OS_QueueGetIdByName(void)
 {
     /*
@@ -164,13 +465,22 @@ void Test_OS_QueueGetInfo(void)
     memset(&queue_prop, 0, sizeof(queue_prop));
 
     OS_UT_SetupBasicInfoTest(OS_OBJECT_TYPE_OS_QUEUE, UT_INDEX_1, "ABC", UT_OBJID_OTHER);
+    OS_queue_table[1].max_depth = 10;
+    OS_queue_table[1].max_size  = 4;
 
     OSAPI_TEST_FUNCTION_RC(OS_QueueGetInfo(UT_OBJID_1, &queue_prop), OS_SUCCESS);
     UtAssert_MemCmp(&queue_prop.creator, &id, sizeof(osal_id_t), "queue_prop.creator == UT_OBJID_OTHER");
     UtAssert_True(strcmp(queue_prop.name, "ABC") == 0, "queue_prop.name (%s) == ABC", queue_prop.name);
+    UtAssert_UINT32_EQ(queue_prop.max_depth, 10);
+    UtAssert_UINT32_EQ(queue_prop.max_size, 4);
+    UtAssert_STUB_COUNT(OS_QueueGetInfo_Impl, 1);
 
     OSAPI_TEST_FUNCTION_RC(OS_QueueGetInfo(UT_OBJID_1, NULL), OS_INVALID_POINTER);
 
+    UT_SetDefaultReturnValue(UT_KEY(OS_QueueGetInfo_Impl), OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetInfo(UT_OBJID_1, &queue_prop), OS_ERROR);
+    UT_ClearDefaultReturnValue(UT_KEY(OS_QueueGetInfo_Impl));
+
     UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERROR);
     OSAPI_TEST_FUNCTION_RC(OS_QueueGetInfo(UT_OBJID_1, &queue_prop), OS_ERROR);
 }
@@ -203,6 +513,12 @@ void UtTest_Setup(void)
     ADD_TEST(OS_QueueDelete);
     ADD_TEST(OS_QueueGet);
     ADD_TEST(OS_QueuePut);
+    ADD_TEST(OS_QueueReserve);
+    ADD_TEST(OS_QueueCommit);
+    ADD_TEST(OS_QueueBorrow);
+    ADD_TEST(OS_QueueRelease);
+    ADD_TEST(OS_QueueGetMulti);
+    ADD_TEST(OS_QueuePutMulti);
     ADD_TEST(OS_QueueGetIdByName);
     ADD_TEST(OS_QueueGetInfo);
 }
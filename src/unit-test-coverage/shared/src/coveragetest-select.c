@@ -111,6 +111,127 @@ void Test_OS_SelectFdAddClearOps(void)
     UtAssert_True(!OS_SelectFdIsSet(&UtSet, UT_OBJID_2), "OS_SelectFdIsSet(2) == false");
 }
 
+void Test_OS_SelectGroupAPI_Init(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_SelectGroupAPI_Init(void)
+     */
+    OSAPI_TEST_FUNCTION_RC(OS_SelectGroupAPI_Init(), OS_SUCCESS);
+}
+
+void Test_OS_SelectGroupCreate(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_SelectGroupCreate(osal_id_t *group_id, const char *group_name, uint32 options)
+     */
+    osal_id_t objid = OS_OBJECT_ID_UNDEFINED;
+
+    OSAPI_TEST_FUNCTION_RC(OS_SelectGroupCreate(&objid, "UT", 0), OS_SUCCESS);
+    OSAPI_TEST_OBJID(objid, !=, OS_OBJECT_ID_UNDEFINED);
+
+    OSAPI_TEST_FUNCTION_RC(OS_SelectGroupCreate(NULL, "UT", 0), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_SelectGroupCreate(&objid, NULL, 0), OS_INVALID_POINTER);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdAllocateNew), OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_SelectGroupCreate(&objid, "UT", 0), OS_ERROR);
+
+    UT_SetDefaultReturnValue(UT_KEY(OCS_memchr), OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_SelectGroupCreate(&objid, "UT", 0), OS_ERR_NAME_TOO_LONG);
+}
+
+void Test_OS_SelectGroupDelete(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_SelectGroupDelete(osal_id_t group_id)
+     */
+    OSAPI_TEST_FUNCTION_RC(OS_SelectGroupDelete(UT_OBJID_1), OS_SUCCESS);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_SelectGroupDelete(UT_OBJID_1), OS_ERROR);
+}
+
+void Test_OS_SelectGroupAdd(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_SelectGroupAdd(osal_id_t group_id, osal_id_t objid, uint32 StateFlags)
+     */
+    OSAPI_TEST_FUNCTION_RC(OS_SelectGroupAdd(UT_OBJID_1, UT_OBJID_2, OS_STREAM_STATE_READABLE), OS_SUCCESS);
+    OSAPI_TEST_FUNCTION_RC(OS_SelectGroupAdd(UT_OBJID_1, UT_OBJID_2, OS_STREAM_STATE_BOUND), OS_ERR_INVALID_ARGUMENT);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_SelectGroupAdd_Impl), OS_ERR_OPERATION_NOT_SUPPORTED);
+    OSAPI_TEST_FUNCTION_RC(OS_SelectGroupAdd(UT_OBJID_1, UT_OBJID_2, OS_STREAM_STATE_WRITABLE),
+                           OS_ERR_OPERATION_NOT_SUPPORTED);
+
+    /* Failure to get the stream must release the group */
+    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdGetById), 2, OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_SelectGroupAdd(UT_OBJID_1, UT_OBJID_2, OS_STREAM_STATE_READABLE), OS_ERR_INVALID_ID);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_SelectGroupAdd(UT_OBJID_1, UT_OBJID_2, OS_STREAM_STATE_READABLE), OS_ERR_INVALID_ID);
+}
+
+void Test_OS_SelectGroupRemove(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_SelectGroupRemove(osal_id_t group_id, osal_id_t objid)
+     */
+    OSAPI_TEST_FUNCTION_RC(OS_SelectGroupRemove(UT_OBJID_1, UT_OBJID_2), OS_SUCCESS);
+
+    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdGetById), 2, OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_SelectGroupRemove(UT_OBJID_1, UT_OBJID_2), OS_ERR_INVALID_ID);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_SelectGroupRemove(UT_OBJID_1, UT_OBJID_2), OS_ERR_INVALID_ID);
+}
+
+void Test_OS_SelectGroupWait(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_SelectGroupWait(osal_id_t group_id, OS_SelectGroupEvent_t *Events, uint32 MaxEvents,
+     *                          uint32 *EventCount, int32 msecs)
+     */
+    OS_SelectGroupEvent_t Events[2];
+    uint32                EventCount;
+
+    OSAPI_TEST_FUNCTION_RC(OS_SelectGroupWait(UT_OBJID_1, Events, 2, &EventCount, 0), OS_SUCCESS);
+
+    OSAPI_TEST_FUNCTION_RC(OS_SelectGroupWait(UT_OBJID_1, NULL, 2, &EventCount, 0), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_SelectGroupWait(UT_OBJID_1, Events, 2, NULL, 0), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_SelectGroupWait(UT_OBJID_1, Events, 0, &EventCount, 0), OS_ERR_INVALID_SIZE);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_SelectGroupWait_Impl), OS_ERROR_TIMEOUT);
+    OSAPI_TEST_FUNCTION_RC(OS_SelectGroupWait(UT_OBJID_1, Events, 2, &EventCount, 10), OS_ERROR_TIMEOUT);
+    UtAssert_UINT32_EQ(EventCount, 0);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_SelectGroupWait(UT_OBJID_1, Events, 2, &EventCount, 0), OS_ERR_INVALID_ID);
+}
+
+void Test_OS_SelectGroupGetIdByName(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_SelectGroupGetIdByName(osal_id_t *group_id, const char *group_name)
+     */
+    osal_id_t objid = OS_OBJECT_ID_UNDEFINED;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdFindByName), OS_SUCCESS);
+    OSAPI_TEST_FUNCTION_RC(OS_SelectGroupGetIdByName(&objid, "UT"), OS_SUCCESS);
+    OSAPI_TEST_OBJID(objid, !=, OS_OBJECT_ID_UNDEFINED);
+    UT_ClearDefaultReturnValue(UT_KEY(OS_ObjectIdFindByName));
+
+    OSAPI_TEST_FUNCTION_RC(OS_SelectGroupGetIdByName(&objid, "NF"), OS_ERR_NAME_NOT_FOUND);
+
+    OSAPI_TEST_FUNCTION_RC(OS_SelectGroupGetIdByName(NULL, "UT"), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_SelectGroupGetIdByName(&objid, NULL), OS_INVALID_POINTER);
+}
+
 /* Osapi_Test_Setup
  *
  * Purpose:
@@ -137,4 +258,11 @@ void UtTest_Setup(void)
     ADD_TEST(OS_SelectFdAddClearOps);
     ADD_TEST(OS_SelectSingle);
     ADD_TEST(OS_SelectMultiple);
+    ADD_TEST(OS_SelectGroupAPI_Init);
+    ADD_TEST(OS_SelectGroupCreate);
+    ADD_TEST(OS_SelectGroupDelete);
+    ADD_TEST(OS_SelectGroupAdd);
+    ADD_TEST(OS_SelectGroupRemove);
+    ADD_TEST(OS_SelectGroupWait);
+    ADD_TEST(OS_SelectGroupGetIdByName);
 }
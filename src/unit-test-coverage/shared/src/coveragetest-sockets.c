@@ -498,6 +498,152 @@ void Test_OS_SocketSendTo(void)
     OSAPI_TEST_FUNCTION_RC(OS_SocketSendTo(UT_OBJID_1, &Buf, sizeof(Buf), &Addr), OS_ERR_INVALID_ID);
 }
 
+/*****************************************************************************
+ *
+ * Test case for OS_SocketSendToV()
+ *
+ *****************************************************************************/
+void Test_OS_SocketSendToV(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_SocketSendToV(osal_id_t sock_id, const OS_iovec_t *iov, uint32 iovcnt, const OS_SockAddr_t *RemoteAddr)
+     */
+    char          Buf[2] = "A";
+    OS_iovec_t    Iov[2];
+    OS_SockAddr_t Addr;
+    osal_index_t  idbuf;
+
+    memset(&Addr, 0, sizeof(Addr));
+    Iov[0].Buffer = &Buf[0];
+    Iov[0].Length = 1;
+    Iov[1].Buffer = &Buf[1];
+    Iov[1].Length = 1;
+    idbuf         = UT_INDEX_1;
+    OS_UT_SetupTestTargetIndex(OS_OBJECT_TYPE_OS_STREAM, idbuf);
+    OS_stream_table[idbuf].socket_type  = OS_SocketType_DATAGRAM;
+    OS_stream_table[idbuf].stream_state = OS_STREAM_STATE_BOUND;
+
+    OSAPI_TEST_FUNCTION_RC(OS_SocketSendToV(UT_OBJID_1, Iov, 2, &Addr), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_SocketSendToV_Impl, 1);
+
+    OSAPI_TEST_FUNCTION_RC(OS_SocketSendToV(UT_OBJID_1, Iov, 2, NULL), OS_INVALID_POINTER);
+
+    /* Failures in the segment list are reported by the common check */
+    UT_SetDeferredRetcode(UT_KEY(OS_IoVecCheck), 1, OS_ERR_INVALID_SIZE);
+    OSAPI_TEST_FUNCTION_RC(OS_SocketSendToV(UT_OBJID_1, Iov, 2, &Addr), OS_ERR_INVALID_SIZE);
+
+    /*
+     * Should fail if not a datagram socket
+     */
+    OS_stream_table[1].socket_type = OS_SocketType_INVALID;
+    OSAPI_TEST_FUNCTION_RC(OS_SocketSendToV(UT_OBJID_1, Iov, 2, &Addr), OS_ERR_INCORRECT_OBJ_TYPE);
+
+    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdGetById), 1, OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_SocketSendToV(UT_OBJID_1, Iov, 2, &Addr), OS_ERR_INVALID_ID);
+}
+
+/*****************************************************************************
+ *
+ * Test case for OS_SocketRecvFromMulti()
+ *
+ *****************************************************************************/
+void Test_OS_SocketRecvFromMulti(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_SocketRecvFromMulti(osal_id_t sock_id, OS_SockMsg_t *Msgs, uint32 MsgCount, int32 timeout)
+     */
+    char         Buf[2];
+    OS_SockMsg_t Msgs[OS_SOCKET_MSG_MAX + 1];
+    osal_index_t idbuf;
+    uint32       i;
+
+    memset(Msgs, 0, sizeof(Msgs));
+    for (i = 0; i < OS_SOCKET_MSG_MAX + 1; ++i)
+    {
+        Msgs[i].Buffer  = Buf;
+        Msgs[i].BufSize = sizeof(Buf);
+    }
+    idbuf = UT_INDEX_1;
+    OS_UT_SetupTestTargetIndex(OS_OBJECT_TYPE_OS_STREAM, idbuf);
+    OS_stream_table[idbuf].socket_type  = OS_SocketType_DATAGRAM;
+    OS_stream_table[idbuf].stream_state = OS_STREAM_STATE_BOUND;
+
+    OSAPI_TEST_FUNCTION_RC(OS_SocketRecvFromMulti(UT_OBJID_1, Msgs, 2, 0), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_SocketRecvFromMulti_Impl, 1);
+
+    /* A larger request is limited to the batch size, and the extra entries are not checked */
+    Msgs[OS_SOCKET_MSG_MAX].Buffer = NULL;
+    OSAPI_TEST_FUNCTION_RC(OS_SocketRecvFromMulti(UT_OBJID_1, Msgs, OS_SOCKET_MSG_MAX + 1, 0), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_SocketRecvFromMulti_Impl, 2);
+
+    OSAPI_TEST_FUNCTION_RC(OS_SocketRecvFromMulti(UT_OBJID_1, NULL, 2, 0), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_SocketRecvFromMulti(UT_OBJID_1, Msgs, 0, 0), OS_ERR_INVALID_SIZE);
+    Msgs[1].Buffer = NULL;
+    OSAPI_TEST_FUNCTION_RC(OS_SocketRecvFromMulti(UT_OBJID_1, Msgs, 2, 0), OS_INVALID_POINTER);
+    Msgs[1].Buffer  = Buf;
+    Msgs[1].BufSize = 0;
+    OSAPI_TEST_FUNCTION_RC(OS_SocketRecvFromMulti(UT_OBJID_1, Msgs, 2, 0), OS_ERR_INVALID_SIZE);
+    Msgs[1].BufSize = sizeof(Buf);
+
+    /*
+     * Should fail if not bound
+     */
+    OS_stream_table[1].stream_state = 0;
+    OSAPI_TEST_FUNCTION_RC(OS_SocketRecvFromMulti(UT_OBJID_1, Msgs, 2, 0), OS_ERR_INCORRECT_OBJ_STATE);
+
+    /*
+     * Should fail if not a datagram socket
+     */
+    OS_stream_table[1].socket_type = OS_SocketType_INVALID;
+    OSAPI_TEST_FUNCTION_RC(OS_SocketRecvFromMulti(UT_OBJID_1, Msgs, 2, 0), OS_ERR_INCORRECT_OBJ_TYPE);
+
+    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdGetById), 1, OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_SocketRecvFromMulti(UT_OBJID_1, Msgs, 2, 0), OS_ERR_INVALID_ID);
+}
+
+/*****************************************************************************
+ *
+ * Test case for OS_SocketSendToMulti()
+ *
+ *****************************************************************************/
+void Test_OS_SocketSendToMulti(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_SocketSendToMulti(osal_id_t sock_id, OS_SockMsg_t *Msgs, uint32 MsgCount)
+     */
+    char         Buf[2] = "A";
+    OS_SockMsg_t Msgs[2];
+    osal_index_t idbuf;
+
+    memset(Msgs, 0, sizeof(Msgs));
+    Msgs[0].Buffer  = &Buf[0];
+    Msgs[0].BufSize = 1;
+    Msgs[1].Buffer  = &Buf[1];
+    Msgs[1].BufSize = 1;
+    idbuf           = UT_INDEX_1;
+    OS_UT_SetupTestTargetIndex(OS_OBJECT_TYPE_OS_STREAM, idbuf);
+    OS_stream_table[idbuf].socket_type  = OS_SocketType_DATAGRAM;
+    OS_stream_table[idbuf].stream_state = OS_STREAM_STATE_BOUND;
+
+    OSAPI_TEST_FUNCTION_RC(OS_SocketSendToMulti(UT_OBJID_1, Msgs, 2), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_SocketSendToMulti_Impl, 1);
+
+    OSAPI_TEST_FUNCTION_RC(OS_SocketSendToMulti(UT_OBJID_1, NULL, 2), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_SocketSendToMulti(UT_OBJID_1, Msgs, 0), OS_ERR_INVALID_SIZE);
+
+    /*
+     * Should fail if not a datagram socket
+     */
+    OS_stream_table[1].socket_type = OS_SocketType_INVALID;
+    OSAPI_TEST_FUNCTION_RC(OS_SocketSendToMulti(UT_OBJID_1, Msgs, 2), OS_ERR_INCORRECT_OBJ_TYPE);
+
+    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdGetById), 1, OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_SocketSendToMulti(UT_OBJID_1, Msgs, 2), OS_ERR_INVALID_ID);
+}
+
 /*****************************************************************************
  *
  * Test case for OS_SocketGetIdByName()
@@ -618,6 +764,9 @@ void UtTest_Setup(void)
     ADD_TEST(OS_SocketConnect);
     ADD_TEST(OS_SocketRecvFrom);
     ADD_TEST(OS_SocketSendTo);
+    ADD_TEST(OS_SocketSendToV);
+    ADD_TEST(OS_SocketRecvFromMulti);
+    ADD_TEST(OS_SocketSendToMulti);
     ADD_TEST(OS_SocketShutdown);
     ADD_TEST(OS_SocketGetIdByName);
     ADD_TEST(OS_SocketGetInfo);
@@ -88,11 +88,8 @@ void Test_OS_TimerAdd(void)
     UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdAllocateNew), 1, OS_ERR_NO_FREE_IDS);
     OSAPI_TEST_FUNCTION_RC(OS_TimerAdd(&objid, "UT", UT_OBJID_1, UT_TimerArgCallback, &arg), OS_ERR_NO_FREE_IDS);
 
-    /* Callback ring paths (still success) */
-    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdGetById), 2, OS_ERR_INVALID_ID);
-    OSAPI_TEST_FUNCTION_RC(OS_TimerAdd(&objid, "UT", UT_OBJID_1, UT_TimerArgCallback, &arg), OS_SUCCESS);
-    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdGetById), 3, OS_ERR_INVALID_ID);
-    OSAPI_TEST_FUNCTION_RC(OS_TimerAdd(&objid, "UT", UT_OBJID_1, UT_TimerArgCallback, &arg), OS_SUCCESS);
+    /* Adding a timer does not arm it */
+    UtAssert_STUB_COUNT(OS_TimeBaseScheduleCallback, 0);
 }
 
 void Test_OS_TimerCreate(void)
@@ -141,8 +138,16 @@ void Test_OS_TimerSet(void)
      */
     OSAPI_TEST_FUNCTION_RC(OS_TimerSet(UT_OBJID_1, 0, 0), OS_TIMER_ERR_INVALID_ARGS);
 
+    /* The expiry is relative to the current timebase free run count */
+    OS_timecb_table[1].timebase_token.obj_idx = UT_INDEX_0;
+    OS_timebase_table[0].freerun_time         = 5000;
+    OS_UT_SetupTestTargetIndex(OS_OBJECT_TYPE_OS_TIMECB, UT_INDEX_1);
     OSAPI_TEST_FUNCTION_RC(OS_TimerSet(UT_OBJID_1, 0, 1), OS_SUCCESS);
+    UtAssert_UINT32_EQ(OS_timecb_table[1].expire_time, 5000);
+    OS_UT_SetupTestTargetIndex(OS_OBJECT_TYPE_OS_TIMECB, UT_INDEX_1);
     OSAPI_TEST_FUNCTION_RC(OS_TimerSet(UT_OBJID_1, 1, 0), OS_SUCCESS);
+    UtAssert_UINT32_EQ(OS_timecb_table[1].expire_time, 5001);
+    UtAssert_STUB_COUNT(OS_TimeBaseScheduleCallback, 2);
 
     OS_timecb_table[2].timebase_token.obj_type = OS_OBJECT_TYPE_OS_TIMEBASE;
     OS_timecb_table[2].timebase_token.obj_id   = UT_OBJID_2;
@@ -171,49 +176,24 @@ void Test_OS_TimerDelete(void)
      * Test Case For:
      * int32 OS_TimerDelete(uint32 timer_id)
      */
-    osal_id_t                      timebase_id   = OS_OBJECT_ID_UNDEFINED;
-    osal_id_t                      timer_objid_1 = OS_OBJECT_ID_UNDEFINED;
-    osal_id_t                      timer_objid_2 = OS_OBJECT_ID_UNDEFINED;
-    OS_timebase_internal_record_t *timebase;
-    OS_object_token_t              timebase_token;
-    uint32                         accuracy;
+    osal_id_t timebase_id   = OS_OBJECT_ID_UNDEFINED;
+    osal_id_t timer_objid_1 = OS_OBJECT_ID_UNDEFINED;
+    osal_id_t timer_objid_2 = OS_OBJECT_ID_UNDEFINED;
+    uint32    accuracy;
 
-    memset(&timebase_token, 0, sizeof(timebase_token));
-
-    /* The ObjIds in the ring need to match what will be in the token */
     /* Get a "timebase" from the stub so the objid will validate */
     OS_TimeBaseCreate(&timebase_id, "ut", NULL);
-    OS_ObjectIdGetById(OS_LOCK_MODE_NONE, OS_OBJECT_TYPE_OS_TIMEBASE, timebase_id, &timebase_token);
-    timebase = OS_OBJECT_TABLE_GET(OS_timebase_table, timebase_token);
 
-    /* Add and confirm timebase and cb references */
+    /* Add, arm and delete timers, which must be removed from the timebase schedule */
     OS_TimerAdd(&timer_objid_1, "UT1", timebase_id, UT_TimerArgCallback, NULL);
-    UtAssert_True(OS_ObjectIdEqual(timebase->first_cb, timer_objid_1), "1st timer add - First CB at timer 1");
-
     OS_TimerAdd(&timer_objid_2, "UT2", timebase_id, UT_TimerArgCallback, NULL);
-    UtAssert_True(OS_ObjectIdEqual(timebase->first_cb, timer_objid_2), "2nd timer add - First CB at timer 2");
+    OS_TimerSet(timer_objid_1, 1000, 1000);
 
     OSAPI_TEST_FUNCTION_RC(OS_TimerDelete(timer_objid_2), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_TimeBaseCancelCallback, 1);
 
-    /* After deleting timer 2 the "first_cb" should be pointing at timer 1 */
-    UtAssert_True(OS_ObjectIdEqual(timebase->first_cb, timer_objid_1), "First CB at timer 1");
-
-    /* Re-add timer 2 again */
-    OS_TimerAdd(&timer_objid_2, "UT2", timebase_id, UT_TimerArgCallback, NULL);
-
-    /* Sanity check: the "first_cb" should be pointing at timer 2 again */
-    UtAssert_True(OS_ObjectIdEqual(timebase->first_cb, timer_objid_2), "First CB at timer 2");
-
-    /* delete timer 1 */
     OSAPI_TEST_FUNCTION_RC(OS_TimerDelete(timer_objid_1), OS_SUCCESS);
-
-    /* The "first_cb" should be still pointing at timer 2 */
-    UtAssert_True(OS_ObjectIdEqual(timebase->first_cb, timer_objid_2), "First CB at timer 2");
-
-    OSAPI_TEST_FUNCTION_RC(OS_TimerDelete(timer_objid_2), OS_SUCCESS);
-
-    /* The "first_cb" should be undefined */
-    UtAssert_True(!OS_ObjectIdDefined(timebase->first_cb), "First CB at OS_OBJECT_ID_UNDEFINED");
+    UtAssert_STUB_COUNT(OS_TimeBaseCancelCallback, 2);
 
     /* verify deletion of the dedicated timebase objects
      * these are implicitly created as part of timer creation for API compatibility */
@@ -221,12 +201,6 @@ void Test_OS_TimerDelete(void)
     OSAPI_TEST_FUNCTION_RC(OS_TimerDelete(timer_objid_1), OS_SUCCESS);
     UtAssert_STUB_COUNT(OS_TimeBaseDelete, 1);
 
-    /* Cover OS_ObjectIdGetById failure cases for callback ring which can't occur nominally */
-    OS_TimerAdd(&timer_objid_1, "UT1", timebase_id, UT_TimerArgCallback, NULL);
-    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdGetById), 2, OS_ERR_INVALID_ID);
-    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdGetById), 1, OS_ERR_INVALID_ID);
-    OSAPI_TEST_FUNCTION_RC(OS_TimerDelete(UT_OBJID_1), OS_SUCCESS);
-
     memset(OS_timecb_table, 0, sizeof(OS_timecb_table));
     memset(OS_timebase_table, 0, sizeof(OS_timebase_table));
 
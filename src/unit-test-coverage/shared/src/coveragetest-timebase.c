@@ -223,63 +223,190 @@ void Test_OS_TimeBase_CallbackThread(void)
      * void OS_TimeBase_CallbackThread(uint32 timebase_id)
      */
     OS_common_record_t *recptr;
-    OS_object_token_t   timecb_token;
-    OS_object_token_t   timecb_token2;
+    osal_id_t           timebase_id;
 
-    memset(&timecb_token, 0, sizeof(timecb_token));
-    memset(&timecb_token2, 0, sizeof(timecb_token2));
+    /* This matches the ID in the token from OS_UT_SetupTestTargetIndex() */
+    timebase_id = OS_ObjectIdFromInteger((OS_OBJECT_TYPE_OS_TIMEBASE << OS_OBJECT_TYPE_SHIFT) | UT_INDEX_2);
 
     recptr = &OS_global_timebase_table[2];
     memset(recptr, 0, sizeof(*recptr));
-    recptr->active_id = UT_OBJID_2;
-
-    OS_ObjectIdGetById(OS_LOCK_MODE_NONE, OS_OBJECT_TYPE_OS_TIMECB, UT_OBJID_1, &timecb_token);
-    OS_timebase_table[2].external_sync = UT_TimerSync;
-    OS_timebase_table[2].first_cb      = timecb_token.obj_id;
-    OS_timecb_table[1].prev_cb         = timecb_token.obj_id;
-    OS_timecb_table[1].next_cb         = timecb_token.obj_id;
-    OS_timecb_table[1].wait_time       = 2000;
-    OS_timecb_table[1].callback_ptr    = UT_TimeCB;
-    TimerSyncCount                     = 0;
-    TimerSyncRetVal                    = 0;
-    TimeCB                             = 0;
+    recptr->active_id = timebase_id;
+
+    OS_global_timecb_table[1].active_id = UT_OBJID_1;
+    OS_timebase_table[2].external_sync  = UT_TimerSync;
+    OS_timecb_table[1].expire_time      = 2000;
+    OS_timecb_table[1].callback_ptr     = UT_TimeCB;
+    OS_TimeBaseScheduleCallback(&OS_timebase_table[2], UT_INDEX_1);
+    TimerSyncCount  = 0;
+    TimerSyncRetVal = 0;
+    TimeCB          = 0;
     OS_UT_SetupTestTargetIndex(OS_OBJECT_TYPE_OS_TIMEBASE, UT_INDEX_2);
     UT_SetHookFunction(UT_KEY(OS_TimeBaseLock_Impl), ClearObjectsHook, recptr);
-    OS_TimeBase_CallbackThread(UT_OBJID_2);
+    OS_TimeBase_CallbackThread(timebase_id);
 
     UtAssert_True(TimerSyncCount == 11, "TimerSyncCount (%lu) == 11", (unsigned long)TimerSyncCount);
 
-    /* No spin path, first timebase->first_cb token get will error */
+    /* No spin path, the one-shot callback becomes due on the second tick */
     UT_ResetState(UT_KEY(OS_TimeBaseLock_Impl));
     TimerSyncCount    = 0;
     TimerSyncRetVal   = 1000;
-    recptr->active_id = UT_OBJID_2;
+    recptr->active_id = timebase_id;
     OS_UT_SetupTestTargetIndex(OS_OBJECT_TYPE_OS_TIMEBASE, UT_INDEX_2);
     UT_SetHookFunction(UT_KEY(OS_TimeBaseLock_Impl), ClearObjectsHook, recptr);
-    OS_TimeBase_CallbackThread(UT_OBJID_2);
+    OS_TimeBase_CallbackThread(timebase_id);
 
-    /* Check that the TimeCB function was called */
-    UtAssert_True(TimeCB > 0, "TimeCB (%lu) > 0", (unsigned long)TimeCB);
+    /* Check that the TimeCB function was called exactly once, and the one-shot is no longer armed */
+    UtAssert_UINT32_EQ(TimeCB, 1);
+    UtAssert_UINT32_EQ(OS_timebase_table[2].sched_count, 0);
+    UtAssert_ZERO(OS_timecb_table[1].sched_pos);
 
     /* Error on call to get timebase token */
     UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdGetById), 1, OS_ERROR);
-    OS_TimeBase_CallbackThread(UT_OBJID_2);
+    OS_TimeBase_CallbackThread(timebase_id);
 
-    /* Other paths for cb logic */
-    OS_ObjectIdGetById(OS_LOCK_MODE_NONE, OS_OBJECT_TYPE_OS_TIMECB, UT_OBJID_2, &timecb_token2);
-    OS_timecb_table[1].next_cb = timecb_token2.obj_id;
-    OS_timecb_table[2].next_cb = timecb_token.obj_id;
+    /*
+     * Other paths for cb logic - a periodic callback shorter than the tick, which
+     * hits the backlog limit, and a second callback which is never due.
+     */
+    OS_timebase_table[2].freerun_time = 0;
+    OS_timecb_table[1].expire_time    = 1;
+    OS_timecb_table[1].interval_time  = 1;
+    OS_timecb_table[1].callback_ptr   = NULL;
+    OS_timecb_table[1].backlog_resets = 0;
+    OS_TimeBaseScheduleCallback(&OS_timebase_table[2], UT_INDEX_1);
+    OS_timecb_table[2].expire_time   = 0x40000000;
+    OS_timecb_table[2].interval_time = 0;
+    OS_timecb_table[2].callback_ptr  = UT_TimeCB;
+    OS_TimeBaseScheduleCallback(&OS_timebase_table[2], UT_INDEX_2);
+    UT_ResetState(UT_KEY(OS_TimeBaseLock_Impl));
+    recptr->active_id = timebase_id;
+    OS_UT_SetupTestTargetIndex(OS_OBJECT_TYPE_OS_TIMEBASE, UT_INDEX_2);
+    UT_SetHookFunction(UT_KEY(OS_TimeBaseLock_Impl), ClearObjectsHook, recptr);
+    OS_TimeBase_CallbackThread(timebase_id);
+
+    UtAssert_UINT32_EQ(TimeCB, 1);
+    UtAssert_NONZERO(OS_timecb_table[1].backlog_resets);
+    UtAssert_UINT32_EQ(OS_timebase_table[2].sched_count, 2);
+    UtAssert_UINT32_EQ(OS_timebase_table[2].sched[0], UT_INDEX_1);
+    UtAssert_UINT32_EQ(OS_timecb_table[1].expire_time, OS_timebase_table[2].freerun_time + 1);
+
+    /* A timer set with a start time of zero gets no callback on its first expiry */
+    OS_TimeBaseCancelCallback(&OS_timebase_table[2], UT_INDEX_1);
+    OS_TimeBaseCancelCallback(&OS_timebase_table[2], UT_INDEX_2);
+    OS_timecb_table[1].expire_time   = OS_timebase_table[2].freerun_time;
+    OS_timecb_table[1].interval_time = 1500;
+    OS_timecb_table[1].callback_ptr  = UT_TimeCB;
+    OS_TimeBaseScheduleCallback(&OS_timebase_table[2], UT_INDEX_1);
+    TimeCB = 0;
     UT_ResetState(UT_KEY(OS_TimeBaseLock_Impl));
-    recptr->active_id = UT_OBJID_2;
+    recptr->active_id = timebase_id;
     OS_UT_SetupTestTargetIndex(OS_OBJECT_TYPE_OS_TIMEBASE, UT_INDEX_2);
     UT_SetHookFunction(UT_KEY(OS_TimeBaseLock_Impl), ClearObjectsHook, recptr);
-    OS_timecb_table[1].interval_time = 1;
-    OS_timecb_table[1].callback_ptr  = NULL;
+    OS_TimeBase_CallbackThread(timebase_id);
 
-    /* OS_UT_SetupTestTargetIndex sets the first OS_ObjectIdGetById return, so this sets the second and fourth */
-    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdGetById), 1, OS_ERROR);
-    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdGetById), 2, OS_ERROR);
-    OS_TimeBase_CallbackThread(UT_OBJID_2);
+    /*
+     * 10 ticks of 1000 are processed, so it is due at 0, 1500, 3000, 4500, 6000, 7500 and 9000
+     * relative to the start, but the first expiry is at the start time and gives no callback
+     */
+    UtAssert_UINT32_EQ(TimeCB, 6);
+}
+
+void Test_OS_TimeBase_ProcessTick(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_TimeBase_ProcessTick(const OS_object_token_t *token, uint32 tick_time)
+     */
+    OS_object_token_t token;
+
+    OS_UT_SetupTestTargetIndex(OS_OBJECT_TYPE_OS_TIMEBASE, UT_INDEX_2);
+    OS_ObjectIdGetById(OS_LOCK_MODE_NONE, OS_OBJECT_TYPE_OS_TIMEBASE, UT_OBJID_2, &token);
+
+    memset(&OS_timebase_table[2], 0, sizeof(OS_timebase_table[2]));
+    OS_global_timebase_table[2].active_id = token.obj_id;
+    UtAssert_INT32_EQ(OS_TimeBase_ProcessTick(&token, 1000), OS_SUCCESS);
+    UtAssert_UINT32_EQ(OS_timebase_table[2].freerun_time, 1000);
+    UtAssert_STUB_COUNT(OS_TimeBaseLock_Impl, 1);
+    UtAssert_STUB_COUNT(OS_TimeBaseUnlock_Impl, 1);
+
+    /* Time base deleted */
+    OS_global_timebase_table[2].active_id = OS_OBJECT_ID_UNDEFINED;
+    UtAssert_INT32_EQ(OS_TimeBase_ProcessTick(&token, 1000), OS_ERR_INVALID_ID);
+    UtAssert_UINT32_EQ(OS_timebase_table[2].freerun_time, 1000);
+    UtAssert_STUB_COUNT(OS_TimeBaseUnlock_Impl, 2);
+}
+
+void Test_OS_TimeBaseScheduleCallback(void)
+{
+    /*
+     * Test Case For:
+     * void OS_TimeBaseScheduleCallback(OS_timebase_internal_record_t *timebase, osal_index_t timecb_idx)
+     * void OS_TimeBaseCancelCallback(OS_timebase_internal_record_t *timebase, osal_index_t timecb_idx)
+     */
+    static const uint32            UT_EXPIRE_LIST[] = {500, 300, 700, 100, 600, 200, 400};
+    static const uint32            UT_HEAP_LIST[]   = {10, 50, 20, 60, 70, 30, 40};
+    OS_timebase_internal_record_t *timebase;
+    osal_index_t                   idx;
+    uint32                         prev;
+
+    timebase = &OS_timebase_table[0];
+    memset(timebase, 0, sizeof(*timebase));
+    memset(OS_timecb_table, 0, sizeof(OS_timecb_table));
+
+    for (idx = 0; idx < (sizeof(UT_EXPIRE_LIST) / sizeof(UT_EXPIRE_LIST[0])); ++idx)
+    {
+        OS_timecb_table[idx].expire_time = UT_EXPIRE_LIST[idx];
+        OS_TimeBaseScheduleCallback(timebase, idx);
+    }
+
+    UtAssert_UINT32_EQ(timebase->sched_count, 7);
+    UtAssert_UINT32_EQ(timebase->sched[0], 3);
+
+    /* Moving an armed entry later does not add another entry */
+    OS_timecb_table[3].expire_time = 800;
+    OS_TimeBaseScheduleCallback(timebase, 3);
+    UtAssert_UINT32_EQ(timebase->sched_count, 7);
+    UtAssert_UINT32_EQ(timebase->sched[0], 5);
+
+    /* Cancel an entry, a second cancel is a no-op */
+    OS_TimeBaseCancelCallback(timebase, 1);
+    UtAssert_ZERO(OS_timecb_table[1].sched_pos);
+    UtAssert_UINT32_EQ(timebase->sched_count, 6);
+    OS_TimeBaseCancelCallback(timebase, 1);
+    UtAssert_UINT32_EQ(timebase->sched_count, 6);
+
+    /* Removing the first entry each time must yield increasing expiry times */
+    prev = 0;
+    while (timebase->sched_count > 0)
+    {
+        idx = timebase->sched[0];
+        UtAssert_True(OS_timecb_table[idx].expire_time > prev, "expire_time (%lu) > prev (%lu)",
+                      (unsigned long)OS_timecb_table[idx].expire_time, (unsigned long)prev);
+        prev = OS_timecb_table[idx].expire_time;
+        OS_TimeBaseCancelCallback(timebase, idx);
+    }
+    UtAssert_UINT32_EQ(prev, 800);
+
+    /* Expiry times are compared so they stay ordered across free run counter wrap */
+    OS_timecb_table[0].expire_time = 0x100;
+    OS_TimeBaseScheduleCallback(timebase, 0);
+    OS_timecb_table[1].expire_time = 0xFFFFFF00;
+    OS_TimeBaseScheduleCallback(timebase, 1);
+    UtAssert_UINT32_EQ(timebase->sched[0], 1);
+
+    /* Cancelling an entry in the middle may need to move the last entry up */
+    memset(timebase, 0, sizeof(*timebase));
+    memset(OS_timecb_table, 0, sizeof(OS_timecb_table));
+    for (idx = 0; idx < (sizeof(UT_HEAP_LIST) / sizeof(UT_HEAP_LIST[0])); ++idx)
+    {
+        OS_timecb_table[idx].expire_time = UT_HEAP_LIST[idx];
+        OS_TimeBaseScheduleCallback(timebase, idx);
+        UtAssert_UINT32_EQ(timebase->sched[idx], idx);
+    }
+    OS_TimeBaseCancelCallback(timebase, 3);
+    UtAssert_UINT32_EQ(timebase->sched[1], 6);
+    UtAssert_UINT32_EQ(timebase->sched[3], 1);
+    UtAssert_UINT32_EQ(OS_timecb_table[6].sched_pos, 2);
 }
 
 void Test_OS_Milli2Ticks(void)
@@ -345,5 +472,7 @@ void UtTest_Setup(void)
     ADD_TEST(OS_TimeBaseGetInfo);
     ADD_TEST(OS_TimeBaseGetFreeRun);
     ADD_TEST(OS_TimeBase_CallbackThread);
+    ADD_TEST(OS_TimeBase_ProcessTick);
+    ADD_TEST(OS_TimeBaseScheduleCallback);
     ADD_TEST(OS_Milli2Ticks);
 }
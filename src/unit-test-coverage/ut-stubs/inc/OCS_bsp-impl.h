@@ -49,6 +49,16 @@
 #define OCS_OS_BSP_CONSOLEMODE_BLUE      0x2108
 #define OCS_OS_BSP_CONSOLEMODE_HIGHLIGHT 0x2110
 
+/*
+ * The parts of the BSP global state used by the OSAL
+ */
+typedef struct
+{
+    bool ConsoleAtomicWrite;
+} OCS_OS_BSP_GlobalData_t;
+
+extern OCS_OS_BSP_GlobalData_t OCS_OS_BSP_Global;
+
 /********************************************************************/
 /* INTERNAL BSP IMPLEMENTATION FUNCTIONS                            */
 /********************************************************************/
@@ -73,6 +83,15 @@ void OCS_OS_BSP_Unlock_Impl(void);
  ------------------------------------------------------------------*/
 extern void OCS_OS_BSP_ConsoleOutput_Impl(const char *Str, size_t DataLen);
 
+/*----------------------------------------------------------------
+
+    Purpose: Low level raw console data output of two segments.
+
+             Writes Str1 followed by Str2, as OS_BSP_ConsoleOutput_Impl()
+             would if called for each of them.
+ ------------------------------------------------------------------*/
+extern void OCS_OS_BSP_ConsoleOutputPair_Impl(const char *Str1, size_t DataLen1, const char *Str2, size_t DataLen2);
+
 /*----------------------------------------------------------------
 
     Purpose: Set the console output mode, if supported by the BSP.
@@ -28,6 +28,7 @@
 
 #include "OCS_basetypes.h"
 #include "OCS_sys_types.h"
+#include "OCS_sys_uio.h"
 
 /* ----------------------------------------- */
 /* constants normally defined in sys/socket.h */
@@ -58,6 +59,17 @@ struct OCS_sockaddr_in6
     uint32_t        sin6_addr[4];
 };
 
+struct OCS_msghdr
+{
+    void *            msg_name;
+    OCS_socklen_t     msg_namelen;
+    struct OCS_iovec *msg_iov;
+    size_t            msg_iovlen;
+    void *            msg_control;
+    size_t            msg_controllen;
+    int               msg_flags;
+};
+
 enum
 {
     OCS_EINPROGRESS = -2,
@@ -88,6 +100,7 @@ extern int         OCS_getsockopt(int fd, int level, int optname, void *optval,
 extern int         OCS_listen(int fd, int n);
 extern OCS_ssize_t OCS_recvfrom(int fd, void *buf, size_t n, int flags, struct OCS_sockaddr *addr,
                                 OCS_socklen_t *addr_len);
+extern OCS_ssize_t OCS_sendmsg(int fd, const struct OCS_msghdr *msg, int flags);
 extern OCS_ssize_t OCS_sendto(int fd, const void *buf, size_t n, int flags, const struct OCS_sockaddr *addr,
                               OCS_socklen_t addr_len);
 extern int         OCS_setsockopt(int fd, int level, int optname, const void *optval, OCS_socklen_t optlen);
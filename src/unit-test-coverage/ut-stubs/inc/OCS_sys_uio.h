@@ -0,0 +1,52 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ * \ingroup ut-stubs
+ *
+ * OSAL coverage stub replacement for sys/uio.h
+ */
+
+#ifndef OCS_SYS_UIO_H
+#define OCS_SYS_UIO_H
+
+#include "OCS_basetypes.h"
+#include "OCS_sys_types.h"
+
+/* ----------------------------------------- */
+/* constants normally defined in sys/uio.h */
+/* ----------------------------------------- */
+
+/* ----------------------------------------- */
+/* types normally defined in sys/uio.h */
+/* ----------------------------------------- */
+struct OCS_iovec
+{
+    void * iov_base;
+    size_t iov_len;
+};
+
+/* ----------------------------------------- */
+/* prototypes normally declared in sys/uio.h */
+/* ----------------------------------------- */
+
+extern OCS_ssize_t OCS_readv(int fd, const struct OCS_iovec *iov, int iovcnt);
+extern OCS_ssize_t OCS_writev(int fd, const struct OCS_iovec *iov, int iovcnt);
+
+#endif /* OCS_SYS_UIO_H */
@@ -55,6 +55,8 @@ extern long int    OCS_gethostid(void);
 extern int         OCS_gethostname(char *name, size_t len);
 extern OCS_pid_t   OCS_getpid(void);
 extern OCS_off_t   OCS_lseek(int fd, OCS_off_t offset, int whence);
+extern OCS_ssize_t OCS_pread(int fd, void *buf, size_t nbytes, OCS_off_t offset);
+extern OCS_ssize_t OCS_pwrite(int fd, const void *buf, size_t n, OCS_off_t offset);
 extern OCS_ssize_t OCS_read(int fd, void *buf, size_t nbytes);
 extern int         OCS_rmdir(const char *path);
 extern long int    OCS_sysconf(int name);
@@ -36,12 +36,14 @@
 #define sockaddr_in  OCS_sockaddr_in
 #define sockaddr_in6 OCS_sockaddr_in6
 #define sa_family_t  OCS_sa_family_t
+#define msghdr       OCS_msghdr
 #define accept       OCS_accept
 #define bind         OCS_bind
 #define connect      OCS_connect
 #define getsockopt   OCS_getsockopt
 #define listen       OCS_listen
 #define recvfrom     OCS_recvfrom
+#define sendmsg      OCS_sendmsg
 #define sendto       OCS_sendto
 #define setsockopt   OCS_setsockopt
 #define shutdown     OCS_shutdown
@@ -0,0 +1,38 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ * \ingroup ut-stubs
+ *
+ * OSAL coverage stub replacement for sys/uio.h
+ */
+
+#ifndef OVERRIDE_SYS_UIO_H
+#define OVERRIDE_SYS_UIO_H
+
+#include "OCS_sys_uio.h"
+
+/* ----------------------------------------- */
+/* mappings for declarations in sys/uio.h */
+/* ----------------------------------------- */
+#define iovec  OCS_iovec
+#define readv  OCS_readv
+#define writev OCS_writev
+
+#endif /* OVERRIDE_SYS_UIO_H */
@@ -46,6 +46,8 @@
 #define gethostname OCS_gethostname
 #define getpid      OCS_getpid
 #define lseek       OCS_lseek
+#define pread       OCS_pread
+#define pwrite      OCS_pwrite
 #define read        OCS_read
 #define rmdir       OCS_rmdir
 #define sysconf     OCS_sysconf
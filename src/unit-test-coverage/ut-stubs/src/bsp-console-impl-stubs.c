@@ -28,6 +28,8 @@
 
 #include "OCS_bsp-impl.h"
 
+OCS_OS_BSP_GlobalData_t OCS_OS_BSP_Global;
+
 /*----------------------------------------------------------------
    Stub for OS_BSP_Lock_Impl
  ------------------------------------------------------------------*/
@@ -66,6 +68,24 @@ void OCS_OS_BSP_ConsoleOutput_Impl(const char *Str, size_t DataLen)
     }
 }
 
+/*----------------------------------------------------------------
+
+    Purpose: Low level raw console data output of two segments.
+
+             Writes Str1 followed by Str2, as OS_BSP_ConsoleOutput_Impl()
+             would if called for each of them.
+ ------------------------------------------------------------------*/
+void OCS_OS_BSP_ConsoleOutputPair_Impl(const char *Str1, size_t DataLen1, const char *Str2, size_t DataLen2)
+{
+    int32_t retcode = UT_DEFAULT_IMPL(OCS_OS_BSP_ConsoleOutputPair_Impl);
+
+    if (retcode == 0)
+    {
+        UT_Stub_CopyFromLocal(UT_KEY(OCS_OS_BSP_ConsoleOutputPair_Impl), Str1, DataLen1);
+        UT_Stub_CopyFromLocal(UT_KEY(OCS_OS_BSP_ConsoleOutputPair_Impl), Str2, DataLen2);
+    }
+}
+
 /*----------------------------------------------------------------
 
     Purpose: Set the console output mode, if supported by the BSP.
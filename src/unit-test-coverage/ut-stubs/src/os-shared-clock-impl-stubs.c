@@ -25,7 +25,9 @@
 #include "os-shared-clock.h"
 #include "utgenstub.h"
 
+void UT_DefaultHandler_OS_GetCoarseTime_Impl(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_GetLocalTime_Impl(void *, UT_EntryKey_t, const UT_StubContext_t *);
+void UT_DefaultHandler_OS_GetMonotonicTime_Impl(void *, UT_EntryKey_t, const UT_StubContext_t *);
 
 /*
  * ----------------------------------------------------
@@ -58,3 +60,63 @@ int32 OS_SetLocalTime_Impl(const OS_time_t *time_struct)
 
     return UT_GenStub_GetReturnValue(OS_SetLocalTime_Impl, int32);
 }
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_GetMonotonicTime_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_GetMonotonicTime_Impl(OS_time_t *time_struct)
+{
+    UT_GenStub_SetupReturnBuffer(OS_GetMonotonicTime_Impl, int32);
+
+    UT_GenStub_AddParam(OS_GetMonotonicTime_Impl, OS_time_t *, time_struct);
+
+    UT_GenStub_Execute(OS_GetMonotonicTime_Impl, Basic, UT_DefaultHandler_OS_GetMonotonicTime_Impl);
+
+    return UT_GenStub_GetReturnValue(OS_GetMonotonicTime_Impl, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_GetCoarseTime_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_GetCoarseTime_Impl(OS_time_t *time_struct)
+{
+    UT_GenStub_SetupReturnBuffer(OS_GetCoarseTime_Impl, int32);
+
+    UT_GenStub_AddParam(OS_GetCoarseTime_Impl, OS_time_t *, time_struct);
+
+    UT_GenStub_Execute(OS_GetCoarseTime_Impl, Basic, UT_DefaultHandler_OS_GetCoarseTime_Impl);
+
+    return UT_GenStub_GetReturnValue(OS_GetCoarseTime_Impl, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_GetRawCounter_Impl()
+ * ----------------------------------------------------
+ */
+uint64 OS_GetRawCounter_Impl(void)
+{
+    UT_GenStub_SetupReturnBuffer(OS_GetRawCounter_Impl, uint64);
+
+    UT_GenStub_Execute(OS_GetRawCounter_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_GetRawCounter_Impl, uint64);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_GetRawCounterFreq_Impl()
+ * ----------------------------------------------------
+ */
+uint64 OS_GetRawCounterFreq_Impl(void)
+{
+    UT_GenStub_SetupReturnBuffer(OS_GetRawCounterFreq_Impl, uint64);
+
+    UT_GenStub_Execute(OS_GetRawCounterFreq_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_GetRawCounterFreq_Impl, uint64);
+}
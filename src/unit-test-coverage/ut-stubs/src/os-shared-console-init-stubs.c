@@ -38,3 +38,19 @@ int32 OS_ConsoleAPI_Init(void)
 
     return UT_GenStub_GetReturnValue(OS_ConsoleAPI_Init, int32);
 }
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_ConsoleDrainStaging()
+ * ----------------------------------------------------
+ */
+int32 OS_ConsoleDrainStaging(const OS_object_token_t *token)
+{
+    UT_GenStub_SetupReturnBuffer(OS_ConsoleDrainStaging, int32);
+
+    UT_GenStub_AddParam(OS_ConsoleDrainStaging, const OS_object_token_t *, token);
+
+    UT_GenStub_Execute(OS_ConsoleDrainStaging, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_ConsoleDrainStaging, int32);
+}
@@ -28,6 +28,39 @@
 void UT_DefaultHandler_OS_GenericRead_Impl(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_GenericWrite_Impl(void *, UT_EntryKey_t, const UT_StubContext_t *);
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_FileAsyncSubmit_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_FileAsyncSubmit_Impl(const OS_object_token_t *token, OS_FileAsyncReq_t *req)
+{
+    UT_GenStub_SetupReturnBuffer(OS_FileAsyncSubmit_Impl, int32);
+
+    UT_GenStub_AddParam(OS_FileAsyncSubmit_Impl, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_FileAsyncSubmit_Impl, OS_FileAsyncReq_t *, req);
+
+    UT_GenStub_Execute(OS_FileAsyncSubmit_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_FileAsyncSubmit_Impl, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_FileAsyncWait_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_FileAsyncWait_Impl(OS_time_t abs_timeout)
+{
+    UT_GenStub_SetupReturnBuffer(OS_FileAsyncWait_Impl, int32);
+
+    UT_GenStub_AddParam(OS_FileAsyncWait_Impl, OS_time_t, abs_timeout);
+
+    UT_GenStub_Execute(OS_FileAsyncWait_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_FileAsyncWait_Impl, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_FileChmod_Impl()
@@ -45,6 +78,41 @@ int32 OS_FileChmod_Impl(const char *local_path, uint32 access_mode)
     return UT_GenStub_GetReturnValue(OS_FileChmod_Impl, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_FileCopy_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_FileCopy_Impl(const OS_object_token_t *src_token, const OS_object_token_t *dest_token)
+{
+    UT_GenStub_SetupReturnBuffer(OS_FileCopy_Impl, int32);
+
+    UT_GenStub_AddParam(OS_FileCopy_Impl, const OS_object_token_t *, src_token);
+    UT_GenStub_AddParam(OS_FileCopy_Impl, const OS_object_token_t *, dest_token);
+
+    UT_GenStub_Execute(OS_FileCopy_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_FileCopy_Impl, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_FileMap_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_FileMap_Impl(const OS_object_token_t *token, OS_file_mapping_t *map, uint32 flags)
+{
+    UT_GenStub_SetupReturnBuffer(OS_FileMap_Impl, int32);
+
+    UT_GenStub_AddParam(OS_FileMap_Impl, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_FileMap_Impl, OS_file_mapping_t *, map);
+    UT_GenStub_AddParam(OS_FileMap_Impl, uint32, flags);
+
+    UT_GenStub_Execute(OS_FileMap_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_FileMap_Impl, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_FileOpen_Impl()
@@ -114,6 +182,24 @@ int32 OS_FileStat_Impl(const char *local_path, os_fstat_t *filestat)
     return UT_GenStub_GetReturnValue(OS_FileStat_Impl, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_FileUnmap_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_FileUnmap_Impl(const OS_object_token_t *token, const OS_file_mapping_t *map, uint32 flags)
+{
+    UT_GenStub_SetupReturnBuffer(OS_FileUnmap_Impl, int32);
+
+    UT_GenStub_AddParam(OS_FileUnmap_Impl, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_FileUnmap_Impl, const OS_file_mapping_t *, map);
+    UT_GenStub_AddParam(OS_FileUnmap_Impl, uint32, flags);
+
+    UT_GenStub_Execute(OS_FileUnmap_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_FileUnmap_Impl, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_GenericClose_Impl()
@@ -130,6 +216,44 @@ int32 OS_GenericClose_Impl(const OS_object_token_t *token)
     return UT_GenStub_GetReturnValue(OS_GenericClose_Impl, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_GenericPread_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_GenericPread_Impl(const OS_object_token_t *token, void *buffer, size_t nbytes, osal_offset_t offset)
+{
+    UT_GenStub_SetupReturnBuffer(OS_GenericPread_Impl, int32);
+
+    UT_GenStub_AddParam(OS_GenericPread_Impl, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_GenericPread_Impl, void *, buffer);
+    UT_GenStub_AddParam(OS_GenericPread_Impl, size_t, nbytes);
+    UT_GenStub_AddParam(OS_GenericPread_Impl, osal_offset_t, offset);
+
+    UT_GenStub_Execute(OS_GenericPread_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_GenericPread_Impl, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_GenericPwrite_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_GenericPwrite_Impl(const OS_object_token_t *token, const void *buffer, size_t nbytes, osal_offset_t offset)
+{
+    UT_GenStub_SetupReturnBuffer(OS_GenericPwrite_Impl, int32);
+
+    UT_GenStub_AddParam(OS_GenericPwrite_Impl, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_GenericPwrite_Impl, const void *, buffer);
+    UT_GenStub_AddParam(OS_GenericPwrite_Impl, size_t, nbytes);
+    UT_GenStub_AddParam(OS_GenericPwrite_Impl, osal_offset_t, offset);
+
+    UT_GenStub_Execute(OS_GenericPwrite_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_GenericPwrite_Impl, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_GenericRead_Impl()
@@ -149,6 +273,25 @@ int32 OS_GenericRead_Impl(const OS_object_token_t *token, void *buffer, size_t n
     return UT_GenStub_GetReturnValue(OS_GenericRead_Impl, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_GenericReadv_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_GenericReadv_Impl(const OS_object_token_t *token, const OS_iovec_t *iov, uint32 iovcnt, OS_time_t abs_timeout)
+{
+    UT_GenStub_SetupReturnBuffer(OS_GenericReadv_Impl, int32);
+
+    UT_GenStub_AddParam(OS_GenericReadv_Impl, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_GenericReadv_Impl, const OS_iovec_t *, iov);
+    UT_GenStub_AddParam(OS_GenericReadv_Impl, uint32, iovcnt);
+    UT_GenStub_AddParam(OS_GenericReadv_Impl, OS_time_t, abs_timeout);
+
+    UT_GenStub_Execute(OS_GenericReadv_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_GenericReadv_Impl, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_GenericSeek_Impl()
@@ -167,6 +310,26 @@ int32 OS_GenericSeek_Impl(const OS_object_token_t *token, int32 offset, uint32 w
     return UT_GenStub_GetReturnValue(OS_GenericSeek_Impl, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_GenericSeek64_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_GenericSeek64_Impl(const OS_object_token_t *token, osal_offset_t offset, uint32 whence,
+                            osal_offset_t *position)
+{
+    UT_GenStub_SetupReturnBuffer(OS_GenericSeek64_Impl, int32);
+
+    UT_GenStub_AddParam(OS_GenericSeek64_Impl, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_GenericSeek64_Impl, osal_offset_t, offset);
+    UT_GenStub_AddParam(OS_GenericSeek64_Impl, uint32, whence);
+    UT_GenStub_AddParam(OS_GenericSeek64_Impl, osal_offset_t *, position);
+
+    UT_GenStub_Execute(OS_GenericSeek64_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_GenericSeek64_Impl, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_GenericWrite_Impl()
@@ -186,6 +349,25 @@ int32 OS_GenericWrite_Impl(const OS_object_token_t *token, const void *buffer, s
     return UT_GenStub_GetReturnValue(OS_GenericWrite_Impl, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_GenericWritev_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_GenericWritev_Impl(const OS_object_token_t *token, const OS_iovec_t *iov, uint32 iovcnt, OS_time_t abs_timeout)
+{
+    UT_GenStub_SetupReturnBuffer(OS_GenericWritev_Impl, int32);
+
+    UT_GenStub_AddParam(OS_GenericWritev_Impl, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_GenericWritev_Impl, const OS_iovec_t *, iov);
+    UT_GenStub_AddParam(OS_GenericWritev_Impl, uint32, iovcnt);
+    UT_GenStub_AddParam(OS_GenericWritev_Impl, OS_time_t, abs_timeout);
+
+    UT_GenStub_Execute(OS_GenericWritev_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_GenericWritev_Impl, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_ShellOutputToFile_Impl()
@@ -25,6 +25,19 @@
 #include "os-shared-file.h"
 #include "utgenstub.h"
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_FileAsyncComplete()
+ * ----------------------------------------------------
+ */
+void OS_FileAsyncComplete(OS_FileAsyncReq_t *req, int32 result)
+{
+    UT_GenStub_AddParam(OS_FileAsyncComplete, OS_FileAsyncReq_t *, req);
+    UT_GenStub_AddParam(OS_FileAsyncComplete, int32, result);
+
+    UT_GenStub_Execute(OS_FileAsyncComplete, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_FileIteratorClose()
@@ -41,3 +54,20 @@ int32 OS_FileIteratorClose(osal_id_t filedes, void *arg)
 
     return UT_GenStub_GetReturnValue(OS_FileIteratorClose, int32);
 }
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_IoVecCheck()
+ * ----------------------------------------------------
+ */
+int32 OS_IoVecCheck(const OS_iovec_t *iov, uint32 iovcnt)
+{
+    UT_GenStub_SetupReturnBuffer(OS_IoVecCheck, int32);
+
+    UT_GenStub_AddParam(OS_IoVecCheck, const OS_iovec_t *, iov);
+    UT_GenStub_AddParam(OS_IoVecCheck, uint32, iovcnt);
+
+    UT_GenStub_Execute(OS_IoVecCheck, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_IoVecCheck, int32);
+}
@@ -190,6 +190,23 @@ int32 OS_ObjectIdFindByName(osal_objtype_t idtype, const char *name, osal_id_t *
     return UT_GenStub_GetReturnValue(OS_ObjectIdFindByName, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_ObjectIdFindNameMatch()
+ * ----------------------------------------------------
+ */
+int32 OS_ObjectIdFindNameMatch(const char *name, OS_object_token_t *token)
+{
+    UT_GenStub_SetupReturnBuffer(OS_ObjectIdFindNameMatch, int32);
+
+    UT_GenStub_AddParam(OS_ObjectIdFindNameMatch, const char *, name);
+    UT_GenStub_AddParam(OS_ObjectIdFindNameMatch, OS_object_token_t *, token);
+
+    UT_GenStub_Execute(OS_ObjectIdFindNameMatch, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_ObjectIdFindNameMatch, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_ObjectIdFindNextFree()
@@ -395,6 +412,59 @@ int32 OS_ObjectIdIteratorProcessEntry(OS_object_iter_t *iter, OS_ObjectIdIterato
     return UT_GenStub_GetReturnValue(OS_ObjectIdIteratorProcessEntry, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_ObjectIdNameIndexInsert()
+ * ----------------------------------------------------
+ */
+void OS_ObjectIdNameIndexInsert(const OS_object_token_t *token, const char *name)
+{
+    UT_GenStub_AddParam(OS_ObjectIdNameIndexInsert, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_ObjectIdNameIndexInsert, const char *, name);
+
+    UT_GenStub_Execute(OS_ObjectIdNameIndexInsert, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_ObjectIdNameIndexRemove()
+ * ----------------------------------------------------
+ */
+void OS_ObjectIdNameIndexRemove(const OS_object_token_t *token)
+{
+    UT_GenStub_AddParam(OS_ObjectIdNameIndexRemove, const OS_object_token_t *, token);
+
+    UT_GenStub_Execute(OS_ObjectIdNameIndexRemove, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_ObjectIdRefcountRelease()
+ * ----------------------------------------------------
+ */
+void OS_ObjectIdRefcountRelease(OS_object_token_t *token)
+{
+    UT_GenStub_AddParam(OS_ObjectIdRefcountRelease, OS_object_token_t *, token);
+
+    UT_GenStub_Execute(OS_ObjectIdRefcountRelease, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_ObjectIdRefcountTryAcquire()
+ * ----------------------------------------------------
+ */
+bool OS_ObjectIdRefcountTryAcquire(OS_object_token_t *token)
+{
+    UT_GenStub_SetupReturnBuffer(OS_ObjectIdRefcountTryAcquire, bool);
+
+    UT_GenStub_AddParam(OS_ObjectIdRefcountTryAcquire, OS_object_token_t *, token);
+
+    UT_GenStub_Execute(OS_ObjectIdRefcountTryAcquire, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_ObjectIdRefcountTryAcquire, bool);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_ObjectIdRelease()
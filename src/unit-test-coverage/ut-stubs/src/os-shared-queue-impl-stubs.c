@@ -25,6 +25,43 @@
 #include "os-shared-queue.h"
 #include "utgenstub.h"
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_QueueBorrow_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_QueueBorrow_Impl(const OS_object_token_t *token, const void **buffer, size_t *size_copied, int32 timeout)
+{
+    UT_GenStub_SetupReturnBuffer(OS_QueueBorrow_Impl, int32);
+
+    UT_GenStub_AddParam(OS_QueueBorrow_Impl, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_QueueBorrow_Impl, const void **, buffer);
+    UT_GenStub_AddParam(OS_QueueBorrow_Impl, size_t *, size_copied);
+    UT_GenStub_AddParam(OS_QueueBorrow_Impl, int32, timeout);
+
+    UT_GenStub_Execute(OS_QueueBorrow_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_QueueBorrow_Impl, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_QueueCommit_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_QueueCommit_Impl(const OS_object_token_t *token, void *buffer, size_t size)
+{
+    UT_GenStub_SetupReturnBuffer(OS_QueueCommit_Impl, int32);
+
+    UT_GenStub_AddParam(OS_QueueCommit_Impl, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_QueueCommit_Impl, void *, buffer);
+    UT_GenStub_AddParam(OS_QueueCommit_Impl, size_t, size);
+
+    UT_GenStub_Execute(OS_QueueCommit_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_QueueCommit_Impl, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_QueueCreate_Impl()
@@ -75,6 +112,29 @@ int32 OS_QueueGetInfo_Impl(const OS_object_token_t *token, OS_queue_prop_t *queu
     return UT_GenStub_GetReturnValue(OS_QueueGetInfo_Impl, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_QueueGetMulti_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_QueueGetMulti_Impl(const OS_object_token_t *token, void *const *data, size_t size, size_t *size_copied,
+                            uint32 count, uint32 *count_copied, int32 timeout)
+{
+    UT_GenStub_SetupReturnBuffer(OS_QueueGetMulti_Impl, int32);
+
+    UT_GenStub_AddParam(OS_QueueGetMulti_Impl, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_QueueGetMulti_Impl, void *const *, data);
+    UT_GenStub_AddParam(OS_QueueGetMulti_Impl, size_t, size);
+    UT_GenStub_AddParam(OS_QueueGetMulti_Impl, size_t *, size_copied);
+    UT_GenStub_AddParam(OS_QueueGetMulti_Impl, uint32, count);
+    UT_GenStub_AddParam(OS_QueueGetMulti_Impl, uint32 *, count_copied);
+    UT_GenStub_AddParam(OS_QueueGetMulti_Impl, int32, timeout);
+
+    UT_GenStub_Execute(OS_QueueGetMulti_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_QueueGetMulti_Impl, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_QueueGet_Impl()
@@ -95,6 +155,28 @@ int32 OS_QueueGet_Impl(const OS_object_token_t *token, void *data, size_t size,
     return UT_GenStub_GetReturnValue(OS_QueueGet_Impl, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_QueuePutMulti_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_QueuePutMulti_Impl(const OS_object_token_t *token, const void *const *data, const size_t *size, uint32 count,
+                            uint32 *count_put, uint32 flags)
+{
+    UT_GenStub_SetupReturnBuffer(OS_QueuePutMulti_Impl, int32);
+
+    UT_GenStub_AddParam(OS_QueuePutMulti_Impl, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_QueuePutMulti_Impl, const void *const *, data);
+    UT_GenStub_AddParam(OS_QueuePutMulti_Impl, const size_t *, size);
+    UT_GenStub_AddParam(OS_QueuePutMulti_Impl, uint32, count);
+    UT_GenStub_AddParam(OS_QueuePutMulti_Impl, uint32 *, count_put);
+    UT_GenStub_AddParam(OS_QueuePutMulti_Impl, uint32, flags);
+
+    UT_GenStub_Execute(OS_QueuePutMulti_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_QueuePutMulti_Impl, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_QueuePut_Impl()
@@ -113,3 +195,37 @@ int32 OS_QueuePut_Impl(const OS_object_token_t *token, const void *data, size_t
 
     return UT_GenStub_GetReturnValue(OS_QueuePut_Impl, int32);
 }
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_QueueRelease_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_QueueRelease_Impl(const OS_object_token_t *token, const void *buffer)
+{
+    UT_GenStub_SetupReturnBuffer(OS_QueueRelease_Impl, int32);
+
+    UT_GenStub_AddParam(OS_QueueRelease_Impl, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_QueueRelease_Impl, const void *, buffer);
+
+    UT_GenStub_Execute(OS_QueueRelease_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_QueueRelease_Impl, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_QueueReserve_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_QueueReserve_Impl(const OS_object_token_t *token, void **buffer)
+{
+    UT_GenStub_SetupReturnBuffer(OS_QueueReserve_Impl, int32);
+
+    UT_GenStub_AddParam(OS_QueueReserve_Impl, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_QueueReserve_Impl, void **, buffer);
+
+    UT_GenStub_Execute(OS_QueueReserve_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_QueueReserve_Impl, int32);
+}
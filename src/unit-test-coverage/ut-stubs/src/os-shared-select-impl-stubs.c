@@ -60,3 +60,93 @@ int32 OS_SelectSingle_Impl(const OS_object_token_t *token, uint32 *SelectFlags,
 
     return UT_GenStub_GetReturnValue(OS_SelectSingle_Impl, int32);
 }
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_SelectGroupAdd_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_SelectGroupAdd_Impl(const OS_object_token_t *token, const OS_object_token_t *stream_token,
+                             uint32 StateFlags)
+{
+    UT_GenStub_SetupReturnBuffer(OS_SelectGroupAdd_Impl, int32);
+
+    UT_GenStub_AddParam(OS_SelectGroupAdd_Impl, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_SelectGroupAdd_Impl, const OS_object_token_t *, stream_token);
+    UT_GenStub_AddParam(OS_SelectGroupAdd_Impl, uint32, StateFlags);
+
+    UT_GenStub_Execute(OS_SelectGroupAdd_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_SelectGroupAdd_Impl, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_SelectGroupCreate_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_SelectGroupCreate_Impl(const OS_object_token_t *token, uint32 options)
+{
+    UT_GenStub_SetupReturnBuffer(OS_SelectGroupCreate_Impl, int32);
+
+    UT_GenStub_AddParam(OS_SelectGroupCreate_Impl, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_SelectGroupCreate_Impl, uint32, options);
+
+    UT_GenStub_Execute(OS_SelectGroupCreate_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_SelectGroupCreate_Impl, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_SelectGroupDelete_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_SelectGroupDelete_Impl(const OS_object_token_t *token)
+{
+    UT_GenStub_SetupReturnBuffer(OS_SelectGroupDelete_Impl, int32);
+
+    UT_GenStub_AddParam(OS_SelectGroupDelete_Impl, const OS_object_token_t *, token);
+
+    UT_GenStub_Execute(OS_SelectGroupDelete_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_SelectGroupDelete_Impl, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_SelectGroupRemove_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_SelectGroupRemove_Impl(const OS_object_token_t *token, const OS_object_token_t *stream_token)
+{
+    UT_GenStub_SetupReturnBuffer(OS_SelectGroupRemove_Impl, int32);
+
+    UT_GenStub_AddParam(OS_SelectGroupRemove_Impl, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_SelectGroupRemove_Impl, const OS_object_token_t *, stream_token);
+
+    UT_GenStub_Execute(OS_SelectGroupRemove_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_SelectGroupRemove_Impl, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_SelectGroupWait_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_SelectGroupWait_Impl(const OS_object_token_t *token, OS_SelectGroupEvent_t *Events, uint32 MaxEvents,
+                              uint32 *EventCount, OS_time_t abs_timeout)
+{
+    UT_GenStub_SetupReturnBuffer(OS_SelectGroupWait_Impl, int32);
+
+    UT_GenStub_AddParam(OS_SelectGroupWait_Impl, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_SelectGroupWait_Impl, OS_SelectGroupEvent_t *, Events);
+    UT_GenStub_AddParam(OS_SelectGroupWait_Impl, uint32, MaxEvents);
+    UT_GenStub_AddParam(OS_SelectGroupWait_Impl, uint32 *, EventCount);
+    UT_GenStub_AddParam(OS_SelectGroupWait_Impl, OS_time_t, abs_timeout);
+
+    UT_GenStub_Execute(OS_SelectGroupWait_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_SelectGroupWait_Impl, int32);
+}
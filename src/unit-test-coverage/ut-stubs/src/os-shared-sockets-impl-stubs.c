@@ -250,6 +250,26 @@ int32 OS_SocketRecvFrom_Impl(const OS_object_token_t *token, void *buffer, size_
     return UT_GenStub_GetReturnValue(OS_SocketRecvFrom_Impl, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_SocketRecvFromMulti_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_SocketRecvFromMulti_Impl(const OS_object_token_t *token, OS_SockMsg_t *Msgs, uint32 MsgCount,
+                                  OS_time_t abs_timeout)
+{
+    UT_GenStub_SetupReturnBuffer(OS_SocketRecvFromMulti_Impl, int32);
+
+    UT_GenStub_AddParam(OS_SocketRecvFromMulti_Impl, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_SocketRecvFromMulti_Impl, OS_SockMsg_t *, Msgs);
+    UT_GenStub_AddParam(OS_SocketRecvFromMulti_Impl, uint32, MsgCount);
+    UT_GenStub_AddParam(OS_SocketRecvFromMulti_Impl, OS_time_t, abs_timeout);
+
+    UT_GenStub_Execute(OS_SocketRecvFromMulti_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_SocketRecvFromMulti_Impl, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_SocketSendTo_Impl()
@@ -270,6 +290,44 @@ int32 OS_SocketSendTo_Impl(const OS_object_token_t *token, const void *buffer, s
     return UT_GenStub_GetReturnValue(OS_SocketSendTo_Impl, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_SocketSendToMulti_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_SocketSendToMulti_Impl(const OS_object_token_t *token, OS_SockMsg_t *Msgs, uint32 MsgCount)
+{
+    UT_GenStub_SetupReturnBuffer(OS_SocketSendToMulti_Impl, int32);
+
+    UT_GenStub_AddParam(OS_SocketSendToMulti_Impl, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_SocketSendToMulti_Impl, OS_SockMsg_t *, Msgs);
+    UT_GenStub_AddParam(OS_SocketSendToMulti_Impl, uint32, MsgCount);
+
+    UT_GenStub_Execute(OS_SocketSendToMulti_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_SocketSendToMulti_Impl, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_SocketSendToV_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_SocketSendToV_Impl(const OS_object_token_t *token, const OS_iovec_t *iov, uint32 iovcnt,
+                            const OS_SockAddr_t *RemoteAddr)
+{
+    UT_GenStub_SetupReturnBuffer(OS_SocketSendToV_Impl, int32);
+
+    UT_GenStub_AddParam(OS_SocketSendToV_Impl, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_SocketSendToV_Impl, const OS_iovec_t *, iov);
+    UT_GenStub_AddParam(OS_SocketSendToV_Impl, uint32, iovcnt);
+    UT_GenStub_AddParam(OS_SocketSendToV_Impl, const OS_SockAddr_t *, RemoteAddr);
+
+    UT_GenStub_Execute(OS_SocketSendToV_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_SocketSendToV_Impl, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_SocketShutdown_Impl()
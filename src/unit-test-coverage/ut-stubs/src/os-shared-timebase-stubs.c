@@ -42,6 +42,32 @@ int32 OS_Milli2Ticks(uint32 milli_seconds, int *ticks)
     return UT_GenStub_GetReturnValue(OS_Milli2Ticks, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_TimeBaseCancelCallback()
+ * ----------------------------------------------------
+ */
+void OS_TimeBaseCancelCallback(OS_timebase_internal_record_t *timebase, osal_index_t timecb_idx)
+{
+    UT_GenStub_AddParam(OS_TimeBaseCancelCallback, OS_timebase_internal_record_t *, timebase);
+    UT_GenStub_AddParam(OS_TimeBaseCancelCallback, osal_index_t, timecb_idx);
+
+    UT_GenStub_Execute(OS_TimeBaseCancelCallback, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_TimeBaseScheduleCallback()
+ * ----------------------------------------------------
+ */
+void OS_TimeBaseScheduleCallback(OS_timebase_internal_record_t *timebase, osal_index_t timecb_idx)
+{
+    UT_GenStub_AddParam(OS_TimeBaseScheduleCallback, OS_timebase_internal_record_t *, timebase);
+    UT_GenStub_AddParam(OS_TimeBaseScheduleCallback, osal_index_t, timecb_idx);
+
+    UT_GenStub_Execute(OS_TimeBaseScheduleCallback, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_TimeBase_CallbackThread()
@@ -53,3 +79,20 @@ void OS_TimeBase_CallbackThread(osal_id_t timebase_id)
 
     UT_GenStub_Execute(OS_TimeBase_CallbackThread, Basic, NULL);
 }
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_TimeBase_ProcessTick()
+ * ----------------------------------------------------
+ */
+int32 OS_TimeBase_ProcessTick(const OS_object_token_t *token, uint32 tick_time)
+{
+    UT_GenStub_SetupReturnBuffer(OS_TimeBase_ProcessTick, int32);
+
+    UT_GenStub_AddParam(OS_TimeBase_ProcessTick, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_TimeBase_ProcessTick, uint32, tick_time);
+
+    UT_GenStub_Execute(OS_TimeBase_ProcessTick, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_TimeBase_ProcessTick, int32);
+}
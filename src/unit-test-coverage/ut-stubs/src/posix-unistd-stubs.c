@@ -94,6 +94,24 @@ OCS_off_t OCS_lseek(int fd, OCS_off_t offset, int whence)
     return Status;
 }
 
+OCS_ssize_t OCS_pread(int fd, void *buf, size_t n, OCS_off_t offset)
+{
+    int32 Status;
+
+    Status = UT_DEFAULT_IMPL_RC(OCS_pread, n);
+
+    return Status;
+}
+
+OCS_ssize_t OCS_pwrite(int fd, const void *buf, size_t n, OCS_off_t offset)
+{
+    int32 Status;
+
+    Status = UT_DEFAULT_IMPL_RC(OCS_pwrite, n);
+
+    return Status;
+}
+
 OCS_ssize_t OCS_read(int fd, void *buf, size_t n)
 {
     int32  Status;
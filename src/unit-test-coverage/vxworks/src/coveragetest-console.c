@@ -85,6 +85,13 @@ void Test_OS_VxWorks_ConsoleTask_Entry(void)
     UT_SetDeferredRetcode(UT_KEY(OCS_semTake), 2, OCS_ERROR);
     OSAPI_TEST_FUNCTION_RC(UT_ConsoleTest_TaskEntry(0), OCS_OK);
 
+    /* Output is repeated while staged records remain */
+    UT_ResetState(UT_KEY(OS_ConsoleOutput_Impl));
+    UT_SetDeferredRetcode(UT_KEY(OCS_semTake), 1, OCS_ERROR);
+    UT_SetDeferredRetcode(UT_KEY(OS_ConsoleDrainStaging), 1, OS_QUEUE_FULL);
+    OSAPI_TEST_FUNCTION_RC(UT_ConsoleTest_TaskEntry(0), OCS_OK);
+    UtAssert_STUB_COUNT(OS_ConsoleOutput_Impl, 2);
+
     UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdGetById), 1, OCS_ERROR);
     OSAPI_TEST_FUNCTION_RC(UT_ConsoleTest_TaskEntry(0), OCS_OK);
 
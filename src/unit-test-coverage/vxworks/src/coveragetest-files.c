@@ -42,6 +42,37 @@ void Test_OS_VxWorks_StreamAPI_Impl_Init(void)
     OSAPI_TEST_FUNCTION_RC(UT_Call_OS_VxWorks_StreamAPI_Impl_Init(), OS_SUCCESS);
 }
 
+void Test_OS_FileCopy_Impl(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_FileCopy_Impl(const OS_object_token_t *src_token, const OS_object_token_t *dest_token)
+     */
+    OSAPI_TEST_FUNCTION_RC(OS_FileCopy_Impl(NULL, NULL), OS_ERR_NOT_IMPLEMENTED);
+}
+
+void Test_OS_FileMap_Impl(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_FileMap_Impl(const OS_object_token_t *token, OS_file_mapping_t *map, uint32 flags)
+     * int32 OS_FileUnmap_Impl(const OS_object_token_t *token, const OS_file_mapping_t *map, uint32 flags)
+     */
+    OSAPI_TEST_FUNCTION_RC(OS_FileMap_Impl(NULL, NULL, 0), OS_ERR_NOT_IMPLEMENTED);
+    OSAPI_TEST_FUNCTION_RC(OS_FileUnmap_Impl(NULL, NULL, 0), OS_ERR_NOT_IMPLEMENTED);
+}
+
+void Test_OS_FileAsync_Impl(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_FileAsyncSubmit_Impl(const OS_object_token_t *token, OS_FileAsyncReq_t *req)
+     * int32 OS_FileAsyncWait_Impl(OS_time_t abs_timeout)
+     */
+    OSAPI_TEST_FUNCTION_RC(OS_FileAsyncSubmit_Impl(NULL, NULL), OS_ERR_NOT_IMPLEMENTED);
+    OSAPI_TEST_FUNCTION_RC(OS_FileAsyncWait_Impl(OS_TIME_ZERO), OS_ERR_NOT_IMPLEMENTED);
+}
+
 /* ------------------- End of test cases --------------------------------------*/
 
 /* Osapi_Test_Setup
@@ -70,4 +101,7 @@ void Osapi_Test_Teardown(void) {}
 void UtTest_Setup(void)
 {
     ADD_TEST(OS_VxWorks_StreamAPI_Impl_Init);
+    ADD_TEST(OS_FileCopy_Impl);
+    ADD_TEST(OS_FileMap_Impl);
+    ADD_TEST(OS_FileAsync_Impl);
 }
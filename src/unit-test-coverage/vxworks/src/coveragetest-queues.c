@@ -111,6 +111,59 @@ void Test_OS_QueuePut_Impl(void)
     OSAPI_TEST_FUNCTION_RC(OS_QueuePut_Impl(&token, Data, sizeof(Data), 0), OS_ERROR);
 }
 
+void Test_OS_QueueReserve_Impl(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_QueueReserve_Impl(const OS_object_token_t *token, void **buffer)
+     * int32 OS_QueueCommit_Impl(const OS_object_token_t *token, void *buffer, size_t size)
+     */
+    char              Data[16];
+    void *            buffer = NULL;
+    OS_object_token_t token  = UT_TOKEN_0;
+
+    OSAPI_TEST_FUNCTION_RC(OS_QueueReserve_Impl(&token, &buffer), OS_ERR_NOT_IMPLEMENTED);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueCommit_Impl(&token, Data, sizeof(Data)), OS_ERR_NOT_IMPLEMENTED);
+}
+
+void Test_OS_QueueBorrow_Impl(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_QueueBorrow_Impl(const OS_object_token_t *token, const void **buffer, size_t *size_copied,
+     *                           int32 timeout)
+     * int32 OS_QueueRelease_Impl(const OS_object_token_t *token, const void *buffer)
+     */
+    char              Data[16];
+    const void *      buffer = NULL;
+    size_t            ActSz;
+    OS_object_token_t token = UT_TOKEN_0;
+
+    OSAPI_TEST_FUNCTION_RC(OS_QueueBorrow_Impl(&token, &buffer, &ActSz, OS_CHECK), OS_ERR_NOT_IMPLEMENTED);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueRelease_Impl(&token, Data), OS_ERR_NOT_IMPLEMENTED);
+}
+
+void Test_OS_QueueGetMulti_Impl(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_QueueGetMulti_Impl(const OS_object_token_t *token, void *const *data, size_t size,
+     *                             size_t *size_copied, uint32 count, uint32 *count_copied, int32 timeout)
+     * int32 OS_QueuePutMulti_Impl(const OS_object_token_t *token, const void *const *data, const size_t *size,
+     *                             uint32 count, uint32 *count_put, uint32 flags)
+     */
+    char              Data[16];
+    void *            DataList[1] = {Data};
+    size_t            SizeList[1] = {sizeof(Data)};
+    uint32            Count;
+    OS_object_token_t token = UT_TOKEN_0;
+
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetMulti_Impl(&token, DataList, sizeof(Data), SizeList, 1, &Count, OS_CHECK),
+                           OS_ERR_NOT_IMPLEMENTED);
+    OSAPI_TEST_FUNCTION_RC(OS_QueuePutMulti_Impl(&token, (const void *const *)DataList, SizeList, 1, &Count, 0),
+                           OS_ERR_NOT_IMPLEMENTED);
+}
+
 void Test_OS_QueueGetInfo_Impl(void)
 {
     /*
@@ -161,5 +214,8 @@ void UtTest_Setup(void)
     ADD_TEST(OS_QueueDelete_Impl);
     ADD_TEST(OS_QueueGet_Impl);
     ADD_TEST(OS_QueuePut_Impl);
+    ADD_TEST(OS_QueueReserve_Impl);
+    ADD_TEST(OS_QueueBorrow_Impl);
+    ADD_TEST(OS_QueueGetMulti_Impl);
     ADD_TEST(OS_QueueGetInfo_Impl);
 }
@@ -210,6 +210,41 @@ void UT_os_printfdisable_test()
     UT_MIR_VOID(OS_printf("OS_printf_disable() - #1 Nominal [This is the expected stdout output after test reset]\n"));
 }
 
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_ConsoleGetStats(OS_console_stats_t *stats)
+** Purpose: Returns the statistics of the console used by OS_printf
+** Parameters: *stats - a pointer that will store the statistics
+** Returns: OS_INVALID_POINTER if the pointer passed in is null
+**          OS_SUCCESS if succeeded
+** -----------------------------------------------------
+** Test #1: Null-pointer-argument condition
+**   1) Call this routine with a null-pointer argument
+**   2) Expect the returned value to be
+**        (a) OS_INVALID_POINTER
+** -----------------------------------------------------
+** Test #2: Nominal condition
+**   1) Call OS_printf to print a text string
+**   2) Call this routine with valid argument
+**   3) Expect the returned value to be
+**        (a) OS_SUCCESS
+**--------------------------------------------------------------------------------*/
+void UT_os_consolegetstats_test(void)
+{
+    OS_console_stats_t stats;
+
+    /*-----------------------------------------------------*/
+    /* #1 Null-pointer-arg */
+
+    UT_RETVAL(OS_ConsoleGetStats(NULL), OS_INVALID_POINTER);
+
+    /*-----------------------------------------------------*/
+    /* #2 Nominal */
+
+    OS_printf_enable();
+    UT_MIR_VOID(OS_printf("OS_ConsoleGetStats() - #2 Nominal [This is the expected stdout output]\n"));
+    UT_NOMINAL(OS_ConsoleGetStats(&stats));
+}
+
 /*--------------------------------------------------------------------------------*
 ** Syntax: int32 OS_GetLocalTime(OS_time_t *time_struct)
 ** Purpose: Returns the local time of the machine it is on
@@ -363,6 +398,67 @@ void UT_os_setlocaltime_test()
     }
 }
 
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_GetMonotonicTime(OS_time_t *time_struct)
+**         int32 OS_GetCoarseTime(OS_time_t *time_struct)
+**         uint64 OS_GetRawCounter(void)
+**         int32 OS_RawCounterToTime(uint64 count, OS_time_t *time_struct)
+** Purpose: Returns the time since an unspecified starting point, which is not
+**          affected by changes to the local time
+** Parameters: *time_struct - a pointer to an OS_time_t structure that will hold
+**                            the time
+** Returns: OS_INVALID_POINTER if the pointer passed in is null
+**          OS_ERROR if the OS call failed
+**          OS_SUCCESS if succeeded
+** -----------------------------------------------------
+** Test #1: Null-pointer-argument condition
+**   1) Call these routines with a null-pointer argument
+**   2) Expect the returned value to be
+**        (a) OS_INVALID_POINTER
+** -----------------------------------------------------
+** Test #2: Nominal condition
+**   1) Read each clock before and after a delay
+**   2) Expect the returned values to be
+**        (a) OS_SUCCESS
+**   3) Expect the monotonic time and the converted raw counter difference
+**      to have advanced by at least most of the delay
+**--------------------------------------------------------------------------------*/
+void UT_os_getmonotonictime_test(void)
+{
+    OS_time_t start_time;
+    OS_time_t end_time;
+    OS_time_t coarse_time;
+    OS_time_t counter_time;
+    uint64    start_count;
+    uint64    end_count;
+
+    /*-----------------------------------------------------*/
+    /* #1 Null-pointer-arg */
+
+    UT_RETVAL(OS_GetMonotonicTime(NULL), OS_INVALID_POINTER);
+    UT_RETVAL(OS_GetCoarseTime(NULL), OS_INVALID_POINTER);
+    UT_RETVAL(OS_RawCounterToTime(0, NULL), OS_INVALID_POINTER);
+
+    /*-----------------------------------------------------*/
+    /* #2 Nominal */
+
+    UT_NOMINAL(OS_GetMonotonicTime(&start_time));
+    start_count = OS_GetRawCounter();
+
+    OS_TaskDelay(50);
+
+    end_count = OS_GetRawCounter();
+    UT_NOMINAL(OS_GetMonotonicTime(&end_time));
+    UT_NOMINAL(OS_GetCoarseTime(&coarse_time));
+    UT_NOMINAL(OS_RawCounterToTime(end_count - start_count, &counter_time));
+
+    UtAssert_True(OS_TimeGetTotalMilliseconds(OS_TimeSubtract(end_time, start_time)) >= 40,
+                  "Monotonic time advanced by %ld ms",
+                  (long)OS_TimeGetTotalMilliseconds(OS_TimeSubtract(end_time, start_time)));
+    UtAssert_True(OS_TimeGetTotalMilliseconds(counter_time) >= 40, "Raw counter advanced by %ld ms",
+                  (long)OS_TimeGetTotalMilliseconds(counter_time));
+}
+
 /*--------------------------------------------------------------------------------*
 ** Syntax: void OS_GetErrorName(int32 error_num, os_err_name_t * err_name)
 ** Purpose: Returns the string name of the error value
@@ -58,9 +58,11 @@ void UT_os_registereventhandler_test(void);
 void UT_os_printf_test(void);
 void UT_os_printfenable_test(void);
 void UT_os_printfdisable_test(void);
+void UT_os_consolegetstats_test(void);
 
 void UT_os_getlocaltime_test(void);
 void UT_os_setlocaltime_test(void);
+void UT_os_getmonotonictime_test(void);
 
 void UT_os_geterrorname_test(void);
 void UT_os_statustostring_test(void);
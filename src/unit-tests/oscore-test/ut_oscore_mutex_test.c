@@ -203,6 +203,7 @@ void UT_os_mut_sem_give_test()
 void UT_os_mut_sem_take_test()
 {
     osal_id_t mut_sem_id = OS_OBJECT_ID_UNDEFINED;
+    int32     status;
 
     /*-----------------------------------------------------*/
     /* #1 Invalid-ID-arg */
@@ -220,6 +221,58 @@ void UT_os_mut_sem_take_test()
         UT_TEARDOWN(OS_MutSemGive(mut_sem_id));
         UT_TEARDOWN(OS_MutSemDelete(mut_sem_id));
     }
+
+    /*-----------------------------------------------------*/
+    /* #4 Nominal-adaptive */
+
+    if (UT_SETUP(OS_MutSemCreate(&mut_sem_id, "TakeTest", OS_MUTEX_FLAG_ADAPTIVE | OS_MUTEX_FLAG_NONRECURSIVE)))
+    {
+        UT_NOMINAL(OS_MutSemTake(mut_sem_id));
+
+        /* A non-recursive mutex cannot be taken again by its owner */
+        status = OS_MutSemTake(mut_sem_id);
+        if (status == OS_SUCCESS)
+        {
+            UtAssert_MIR("Non-recursive mutexes are not supported by this implementation");
+            UT_TEARDOWN(OS_MutSemGive(mut_sem_id));
+        }
+        else
+        {
+            UtAssert_INT32_EQ(status, OS_SEM_FAILURE);
+        }
+
+        UT_TEARDOWN(OS_MutSemGive(mut_sem_id));
+        UT_TEARDOWN(OS_MutSemDelete(mut_sem_id));
+    }
+
+    if (UT_SETUP(OS_MutSemCreate(&mut_sem_id, "TakeTest", OS_MUTEX_FLAG_NONRECURSIVE)))
+    {
+        UT_NOMINAL(OS_MutSemTake(mut_sem_id));
+
+        status = OS_MutSemTake(mut_sem_id);
+        if (status == OS_SUCCESS)
+        {
+            UtAssert_MIR("Non-recursive mutexes are not supported by this implementation");
+            UT_TEARDOWN(OS_MutSemGive(mut_sem_id));
+        }
+        else
+        {
+            UtAssert_INT32_EQ(status, OS_SEM_FAILURE);
+        }
+
+        UT_TEARDOWN(OS_MutSemGive(mut_sem_id));
+        UT_TEARDOWN(OS_MutSemDelete(mut_sem_id));
+    }
+
+    if (UT_SETUP(OS_MutSemCreate(&mut_sem_id, "TakeTest", OS_MUTEX_FLAG_ADAPTIVE | OS_MUTEX_FLAG_PRIO_INHERIT)))
+    {
+        UT_NOMINAL(OS_MutSemTake(mut_sem_id));
+        UT_NOMINAL(OS_MutSemTake(mut_sem_id));
+
+        UT_TEARDOWN(OS_MutSemGive(mut_sem_id));
+        UT_TEARDOWN(OS_MutSemGive(mut_sem_id));
+        UT_TEARDOWN(OS_MutSemDelete(mut_sem_id));
+    }
 }
 
 /*--------------------------------------------------------------------------------*
@@ -280,6 +333,7 @@ void UT_os_mut_sem_get_info_test()
 {
     osal_id_t         mut_sem_id = OS_OBJECT_ID_UNDEFINED;
     OS_mut_sem_prop_t mut_sem_prop;
+    uint32            i;
 
     /*-----------------------------------------------------*/
     /* #1 Invalid-ID-arg */
@@ -306,6 +360,33 @@ void UT_os_mut_sem_get_info_test()
 
         UT_TEARDOWN(OS_MutSemDelete(mut_sem_id));
     }
+
+    /*-----------------------------------------------------*/
+    /* #4 Statistics */
+
+    if (UT_SETUP(OS_MutSemCreate(&mut_sem_id, "GetInfo", OS_MUTEX_FLAG_ADAPTIVE)))
+    {
+        for (i = 0; i < 3; i++)
+        {
+            UT_NOMINAL(OS_MutSemTake(mut_sem_id));
+            UT_NOMINAL(OS_MutSemGive(mut_sem_id));
+        }
+
+        UT_NOMINAL(OS_MutSemGetInfo(mut_sem_id, &mut_sem_prop));
+        if (mut_sem_prop.take_count == 0)
+        {
+            UtAssert_MIR("Mutex statistics are not supported by this implementation");
+        }
+        else
+        {
+            /* nothing else uses the mutex, so none of these were contended */
+            UtAssert_UINT32_EQ(mut_sem_prop.take_count, 3);
+            UtAssert_UINT32_EQ(mut_sem_prop.contended_count, 0);
+            UtAssert_True(OS_TimeGetTotalNanoseconds(mut_sem_prop.wait_time) == 0, "wait_time == 0");
+        }
+
+        UT_TEARDOWN(OS_MutSemDelete(mut_sem_id));
+    }
 }
 
 /*================================================================================*
@@ -32,6 +32,8 @@
 ** Macros
 **--------------------------------------------------------------------------------*/
 
+#define UT_QUEUE_READER_STACK_SIZE 0x2000
+
 /*--------------------------------------------------------------------------------*
 ** Data types
 **--------------------------------------------------------------------------------*/
@@ -44,6 +46,11 @@
 ** Global variables
 **--------------------------------------------------------------------------------*/
 
+/* queue and result of the reader task which pends on a queue while it is deleted */
+static osal_id_t g_queue_reader_queue_id;
+static int32     g_queue_reader_status;
+static uint32    g_queue_reader_stack[UT_QUEUE_READER_STACK_SIZE];
+
 /*--------------------------------------------------------------------------------*
 ** External function prototypes
 **--------------------------------------------------------------------------------*/
@@ -56,6 +63,14 @@
 ** Local function definitions
 **--------------------------------------------------------------------------------*/
 
+static void UT_os_queue_reader_task(void)
+{
+    uint32 queue_data_in;
+    size_t data_size;
+
+    g_queue_reader_status = OS_QueueGet(g_queue_reader_queue_id, &queue_data_in, sizeof(uint32), &data_size, OS_PEND);
+}
+
 /*--------------------------------------------------------------------------------*
 ** Syntax: OS_QueueCreate
 ** Purpose: Creates a queue in the OS
@@ -410,8 +425,14 @@ void UT_os_queue_get_id_by_name_test()
 **--------------------------------------------------------------------------------*/
 void UT_os_queue_get_info_test()
 {
+    static const uint32 flags_list[] = {0, OS_QUEUE_FLAG_RING};
+
     osal_id_t       queue_id = OS_OBJECT_ID_UNDEFINED;
     OS_queue_prop_t queue_prop;
+    uint32          queue_data;
+    size_t          data_size;
+    uint32          i;
+    uint32          j;
 
     /*-----------------------------------------------------*/
     /* #1 Invalid-ID-arg */
@@ -434,6 +455,376 @@ void UT_os_queue_get_info_test()
     if (UT_SETUP(OS_QueueCreate(&queue_id, "GetInfo", OSAL_BLOCKCOUNT_C(10), sizeof(uint32), 0)))
     {
         UT_NOMINAL(OS_QueueGetInfo(queue_id, &queue_prop));
+        UtAssert_UINT32_EQ(queue_prop.max_depth, 10);
+        UtAssert_UINT32_EQ(queue_prop.max_size, sizeof(uint32));
+
+        UT_TEARDOWN(OS_QueueDelete(queue_id));
+    }
+
+    /*-----------------------------------------------------*/
+    /* #4 Statistics */
+
+    for (j = 0; j < sizeof(flags_list) / sizeof(flags_list[0]); ++j)
+    {
+        if (!UT_SETUP(OS_QueueCreate(&queue_id, "GetInfo", OSAL_BLOCKCOUNT_C(10), sizeof(uint32), flags_list[j])))
+        {
+            continue;
+        }
+
+        for (i = 0; i < 12; i++)
+        {
+            OS_QueuePut(queue_id, &i, sizeof(i), 0);
+        }
+
+        UT_NOMINAL(OS_QueueGetInfo(queue_id, &queue_prop));
+        if (queue_prop.put_count == 0)
+        {
+            UtAssert_MIR("Queue statistics are not supported by this implementation");
+        }
+        else
+        {
+            UtAssert_UINT32_EQ(queue_prop.depth, 10);
+            UtAssert_UINT32_EQ(queue_prop.put_count, 10);
+            UtAssert_UINT32_EQ(queue_prop.full_count, 2);
+
+            for (i = 0; i < 10; i++)
+            {
+                UT_NOMINAL(OS_QueueGet(queue_id, &queue_data, sizeof(queue_data), &data_size, OS_CHECK));
+            }
+
+            UT_RETVAL(OS_QueueGet(queue_id, &queue_data, sizeof(queue_data), &data_size, 2), OS_QUEUE_TIMEOUT);
+
+            UT_NOMINAL(OS_QueueGetInfo(queue_id, &queue_prop));
+            UtAssert_UINT32_EQ(queue_prop.depth, 0);
+            UtAssert_UINT32_EQ(queue_prop.high_water, 10);
+            UtAssert_UINT32_EQ(queue_prop.get_count, 10);
+            UtAssert_UINT32_EQ(queue_prop.timeout_count, 1);
+        }
+
+        UT_TEARDOWN(OS_QueueDelete(queue_id));
+    }
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: OS_QueueCreate with OS_QUEUE_FLAG_RING
+** Purpose: Checks that a queue created with the ring buffer flag behaves the same
+**          as a regular queue (the flag may be ignored by the implementation)
+** Parameters: To-be-filled-in
+** Returns: Same as OS_QueuePut and OS_QueueGet on a regular queue
+**--------------------------------------------------------------------------------*/
+void UT_os_queue_ring_test()
+{
+    osal_id_t queue_id = OS_OBJECT_ID_UNDEFINED;
+    osal_id_t task_id;
+    uint32    queue_data_out;
+    uint32    queue_data_in;
+    size_t    data_size;
+    uint32    i;
+
+    /*-----------------------------------------------------*/
+    /* #1 Queue-empty and Queue-timed-out */
+
+    if (UT_SETUP(
+            OS_QueueCreate(&queue_id, "RingQueue", OSAL_BLOCKCOUNT_C(10), sizeof(uint32), OS_QUEUE_FLAG_RING)))
+    {
+        UT_RETVAL(OS_QueueGet(queue_id, &queue_data_in, sizeof(uint32), &data_size, OS_CHECK), OS_QUEUE_EMPTY);
+        UT_RETVAL(OS_QueueGet(queue_id, &queue_data_in, sizeof(uint32), &data_size, 2), OS_QUEUE_TIMEOUT);
+
+        UT_TEARDOWN(OS_QueueDelete(queue_id));
+    }
+
+    /*-----------------------------------------------------*/
+    /* #2 Queue-full (depth which is not a power of two) */
+
+    if (UT_SETUP(
+            OS_QueueCreate(&queue_id, "RingQueue", OSAL_BLOCKCOUNT_C(10), sizeof(uint32), OS_QUEUE_FLAG_RING)))
+    {
+        queue_data_out = 0x11223344;
+        for (i = 0; i < 10; i++)
+        {
+            if (!UT_SETUP(OS_QueuePut(queue_id, &queue_data_out, sizeof(uint32), 0)))
+            {
+                break;
+            }
+        }
+
+        UT_RETVAL(OS_QueuePut(queue_id, &queue_data_out, sizeof(uint32), 0), OS_QUEUE_FULL);
+
+        UT_TEARDOWN(OS_QueueDelete(queue_id));
+    }
+
+    /*-----------------------------------------------------*/
+    /* #3 Nominal - messages are received in order, including after the queue wraps around */
+
+    if (UT_SETUP(
+            OS_QueueCreate(&queue_id, "RingQueue", OSAL_BLOCKCOUNT_C(3), sizeof(uint32), OS_QUEUE_FLAG_RING)))
+    {
+        for (i = 0; i < 20; i++)
+        {
+            queue_data_out = i;
+            UT_NOMINAL(OS_QueuePut(queue_id, &queue_data_out, sizeof(uint32), 0));
+            queue_data_out = i + 100;
+            UT_NOMINAL(OS_QueuePut(queue_id, &queue_data_out, OSAL_SIZE_C(2), 0));
+
+            queue_data_in = 0xFFFFFFFF;
+            UT_NOMINAL(OS_QueueGet(queue_id, &queue_data_in, sizeof(uint32), &data_size, OS_PEND));
+            UtAssert_UINT32_EQ(queue_data_in, i);
+            UtAssert_UINT32_EQ(data_size, sizeof(uint32));
+
+            UT_NOMINAL(OS_QueueGet(queue_id, &queue_data_in, sizeof(uint32), &data_size, 20));
+            UtAssert_UINT32_EQ(data_size, 2);
+        }
+
+        UT_RETVAL(OS_QueueGet(queue_id, &queue_data_in, sizeof(uint32), &data_size, OS_CHECK), OS_QUEUE_EMPTY);
+
+        UT_TEARDOWN(OS_QueueDelete(queue_id));
+    }
+
+    /*-----------------------------------------------------*/
+    /* #4 Queue deleted while a reader is pending on it */
+
+    if (UT_SETUP(
+            OS_QueueCreate(&queue_id, "RingQueue", OSAL_BLOCKCOUNT_C(3), sizeof(uint32), OS_QUEUE_FLAG_RING)))
+    {
+        g_queue_reader_queue_id = queue_id;
+        g_queue_reader_status   = OS_SUCCESS;
+
+        if (UT_SETUP(OS_TaskCreate(&task_id, "QueueReader", UT_os_queue_reader_task,
+                                   OSAL_STACKPTR_C(g_queue_reader_stack), sizeof(g_queue_reader_stack),
+                                   OSAL_PRIORITY_C(100), 0)))
+        {
+            /* give the reader time to block */
+            OS_TaskDelay(50);
+
+            UT_NOMINAL(OS_QueueDelete(queue_id));
+
+            /* the reader must be woken, and not touch the deleted queue */
+            for (i = 0; i < 100 && g_queue_reader_status == OS_SUCCESS; i++)
+            {
+                OS_TaskDelay(10);
+            }
+
+            UtAssert_INT32_EQ(g_queue_reader_status, OS_ERR_INVALID_ID);
+        }
+        else
+        {
+            UT_TEARDOWN(OS_QueueDelete(queue_id));
+        }
+    }
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: OS_QueueReserve, OS_QueueCommit, OS_QueueBorrow, OS_QueueRelease
+** Purpose: Puts and gets messages without copying them, where supported
+** Parameters: To-be-filled-in
+** Returns: OS_INVALID_POINTER if a pointer passed in is null
+**          OS_ERR_INVALID_ID if the id passed in does not exist
+**          OS_QUEUE_FULL if the queue could not accept another message
+**          OS_QUEUE_EMPTY if there is no message to get
+**          OS_SUCCESS if succeeded
+**--------------------------------------------------------------------------------*/
+void UT_os_queue_zero_copy_test()
+{
+    static const uint32 flags_list[] = {0, OS_QUEUE_FLAG_RING};
+
+    osal_id_t   queue_id = OS_OBJECT_ID_UNDEFINED;
+    void *      put_buffer;
+    void *      reserved[3];
+    const void *get_buffer;
+    size_t      data_size;
+    uint32      queue_data;
+    uint32      count;
+    uint32      i;
+    uint32      j;
+
+    /*-----------------------------------------------------*/
+    /* #1 Invalid-ID-arg */
+
+    UT_RETVAL(OS_QueueReserve(UT_OBJID_INCORRECT, &put_buffer), OS_ERR_INVALID_ID);
+    UT_RETVAL(OS_QueueCommit(UT_OBJID_INCORRECT, &queue_data, sizeof(uint32)), OS_ERR_INVALID_ID);
+    UT_RETVAL(OS_QueueBorrow(UT_OBJID_INCORRECT, &get_buffer, &data_size, OS_CHECK), OS_ERR_INVALID_ID);
+    UT_RETVAL(OS_QueueRelease(UT_OBJID_INCORRECT, &queue_data), OS_ERR_INVALID_ID);
+
+    /*-----------------------------------------------------*/
+    /* #2 Invalid-pointer-arg */
+
+    UT_RETVAL(OS_QueueReserve(UT_OBJID_INCORRECT, NULL), OS_INVALID_POINTER);
+    UT_RETVAL(OS_QueueCommit(UT_OBJID_INCORRECT, NULL, sizeof(uint32)), OS_INVALID_POINTER);
+    UT_RETVAL(OS_QueueBorrow(UT_OBJID_INCORRECT, NULL, &data_size, OS_CHECK), OS_INVALID_POINTER);
+    UT_RETVAL(OS_QueueBorrow(UT_OBJID_INCORRECT, &get_buffer, NULL, OS_CHECK), OS_INVALID_POINTER);
+    UT_RETVAL(OS_QueueRelease(UT_OBJID_INCORRECT, NULL), OS_INVALID_POINTER);
+
+    for (j = 0; j < sizeof(flags_list) / sizeof(flags_list[0]); ++j)
+    {
+        if (!UT_SETUP(OS_QueueCreate(&queue_id, "ZeroCopy", OSAL_BLOCKCOUNT_C(3), sizeof(uint32), flags_list[j])))
+        {
+            continue;
+        }
+
+        /*-----------------------------------------------------*/
+        /* #3 Queue-empty */
+
+        UT_RETVAL(OS_QueueBorrow(queue_id, &get_buffer, &data_size, OS_CHECK), OS_QUEUE_EMPTY);
+        UT_RETVAL(OS_QueueBorrow(queue_id, &get_buffer, &data_size, 2), OS_QUEUE_TIMEOUT);
+
+        /*-----------------------------------------------------*/
+        /* #4 Nominal - messages are received in order, and mix with copied messages */
+
+        for (i = 0; i < 10; i++)
+        {
+            if (UT_SETUP(OS_QueueReserve(queue_id, &put_buffer)))
+            {
+                queue_data = i;
+                memcpy(put_buffer, &queue_data, sizeof(queue_data));
+                UT_RETVAL(OS_QueueCommit(queue_id, put_buffer, sizeof(uint32) + 1), OS_QUEUE_INVALID_SIZE);
+                UT_NOMINAL(OS_QueueCommit(queue_id, put_buffer, sizeof(uint32)));
+                UT_RETVAL(OS_QueueCommit(queue_id, put_buffer, sizeof(uint32)), OS_INVALID_POINTER);
+            }
+
+            queue_data = i + 100;
+            UT_NOMINAL(OS_QueuePut(queue_id, &queue_data, sizeof(uint32), 0));
+
+            if (UT_SETUP(OS_QueueBorrow(queue_id, &get_buffer, &data_size, OS_PEND)))
+            {
+                memcpy(&queue_data, get_buffer, sizeof(queue_data));
+                UtAssert_UINT32_EQ(queue_data, i);
+                UtAssert_UINT32_EQ(data_size, sizeof(uint32));
+                UT_RETVAL(OS_QueueRelease(queue_id, &queue_data), OS_INVALID_POINTER);
+                UT_NOMINAL(OS_QueueRelease(queue_id, get_buffer));
+                UT_RETVAL(OS_QueueRelease(queue_id, get_buffer), OS_INVALID_POINTER);
+            }
+
+            if (UT_SETUP(OS_QueueBorrow(queue_id, &get_buffer, &data_size, 20)))
+            {
+                memcpy(&queue_data, get_buffer, sizeof(queue_data));
+                UtAssert_UINT32_EQ(queue_data, i + 100);
+                UT_NOMINAL(OS_QueueRelease(queue_id, get_buffer));
+            }
+        }
+
+        /*-----------------------------------------------------*/
+        /* #5 Queue-full - outstanding reservations take space in the queue */
+
+        count = 0;
+        while (count < 3 && OS_QueueReserve(queue_id, &reserved[count]) == OS_SUCCESS)
+        {
+            ++count;
+        }
+        UtAssert_True(count > 0, "OS_QueueReserve() reserved %u messages", (unsigned int)count);
+        UT_RETVAL(OS_QueueReserve(queue_id, &put_buffer), OS_QUEUE_FULL);
+
+        for (i = 0; i < count; i++)
+        {
+            memcpy(reserved[i], &i, sizeof(i));
+            UT_NOMINAL(OS_QueueCommit(queue_id, reserved[i], sizeof(uint32)));
+        }
+
+        UT_TEARDOWN(OS_QueueDelete(queue_id));
+    }
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_QueueGetMulti(osal_id_t queue_id, void *const *data, size_t size, size_t *size_copied,
+**                                uint32 count, uint32 *count_copied, int32 timeout)
+**         int32 OS_QueuePutMulti(osal_id_t queue_id, const void *const *data, const size_t *size, uint32 count,
+**                                uint32 *count_put, uint32 flags)
+** Purpose: Sends and receives several messages per call
+** Parameters: To-be-filled-in
+** Returns: OS_INVALID_POINTER if a pointer passed in is NULL
+**          OS_ERR_INVALID_ID if the id passed in is not a valid queue
+**          OS_ERR_INVALID_SIZE if the size or count is not valid
+**          OS_QUEUE_INVALID_SIZE if a message does not fit the queue
+**          OS_QUEUE_FULL if the queue cannot accept another message
+**          OS_QUEUE_EMPTY if the queue has no messages to be received
+**          OS_QUEUE_TIMEOUT if the timeout expired with no messages
+**          OS_SUCCESS if at least one message was transferred
+**--------------------------------------------------------------------------------*/
+void UT_os_queue_multi_test()
+{
+    static const uint32 flags_list[] = {0, OS_QUEUE_FLAG_RING};
+
+    osal_id_t   queue_id = OS_OBJECT_ID_UNDEFINED;
+    uint32      put_data[5];
+    uint32      get_data[5];
+    const void *put_list[5];
+    void *      get_list[5];
+    size_t      put_size[5];
+    size_t      get_size[5];
+    uint32      count;
+    uint32      i;
+    uint32      j;
+
+    for (i = 0; i < 5; i++)
+    {
+        put_data[i]  = i;
+        put_list[i]  = &put_data[i];
+        get_list[i]  = &get_data[i];
+        put_size[i]  = sizeof(uint32);
+    }
+
+    /*-----------------------------------------------------*/
+    /* #1 Invalid-ID-arg */
+
+    UT_RETVAL(OS_QueuePutMulti(UT_OBJID_INCORRECT, put_list, put_size, 5, &count, 0), OS_ERR_INVALID_ID);
+    UT_RETVAL(OS_QueueGetMulti(UT_OBJID_INCORRECT, get_list, sizeof(uint32), get_size, 5, &count, OS_CHECK),
+              OS_ERR_INVALID_ID);
+
+    /*-----------------------------------------------------*/
+    /* #2 Invalid-pointer-arg */
+
+    UT_RETVAL(OS_QueuePutMulti(UT_OBJID_INCORRECT, NULL, put_size, 5, &count, 0), OS_INVALID_POINTER);
+    UT_RETVAL(OS_QueuePutMulti(UT_OBJID_INCORRECT, put_list, NULL, 5, &count, 0), OS_INVALID_POINTER);
+    UT_RETVAL(OS_QueuePutMulti(UT_OBJID_INCORRECT, put_list, put_size, 5, NULL, 0), OS_INVALID_POINTER);
+    UT_RETVAL(OS_QueueGetMulti(UT_OBJID_INCORRECT, NULL, sizeof(uint32), get_size, 5, &count, OS_CHECK),
+              OS_INVALID_POINTER);
+    UT_RETVAL(OS_QueueGetMulti(UT_OBJID_INCORRECT, get_list, sizeof(uint32), NULL, 5, &count, OS_CHECK),
+              OS_INVALID_POINTER);
+    UT_RETVAL(OS_QueueGetMulti(UT_OBJID_INCORRECT, get_list, sizeof(uint32), get_size, 5, NULL, OS_CHECK),
+              OS_INVALID_POINTER);
+
+    /*-----------------------------------------------------*/
+    /* #3 Invalid-count-arg */
+
+    UT_RETVAL(OS_QueuePutMulti(UT_OBJID_INCORRECT, put_list, put_size, 0, &count, 0), OS_ERR_INVALID_SIZE);
+    UT_RETVAL(OS_QueueGetMulti(UT_OBJID_INCORRECT, get_list, sizeof(uint32), get_size, 0, &count, OS_CHECK),
+              OS_ERR_INVALID_SIZE);
+
+    for (j = 0; j < sizeof(flags_list) / sizeof(flags_list[0]); ++j)
+    {
+        if (!UT_SETUP(OS_QueueCreate(&queue_id, "Multi", OSAL_BLOCKCOUNT_C(3), sizeof(uint32), flags_list[j])))
+        {
+            continue;
+        }
+
+        /*-----------------------------------------------------*/
+        /* #4 Queue-empty */
+
+        UT_RETVAL(OS_QueueGetMulti(queue_id, get_list, sizeof(uint32), get_size, 5, &count, OS_CHECK),
+                  OS_QUEUE_EMPTY);
+        UtAssert_UINT32_EQ(count, 0);
+        UT_RETVAL(OS_QueueGetMulti(queue_id, get_list, sizeof(uint32), get_size, 5, &count, 2), OS_QUEUE_TIMEOUT);
+
+        /*-----------------------------------------------------*/
+        /* #5 Nominal - a partial put when the queue fills up, then a partial get */
+
+        UT_NOMINAL(OS_QueuePutMulti(queue_id, put_list, put_size, 5, &count, 0));
+        UtAssert_UINT32_EQ(count, 3);
+        UT_RETVAL(OS_QueuePutMulti(queue_id, put_list, put_size, 5, &count, 0), OS_QUEUE_FULL);
+        UtAssert_UINT32_EQ(count, 0);
+
+        memset(get_data, 0xFF, sizeof(get_data));
+        memset(get_size, 0, sizeof(get_size));
+        UT_NOMINAL(OS_QueueGetMulti(queue_id, get_list, sizeof(uint32), get_size, 2, &count, OS_PEND));
+        UtAssert_UINT32_EQ(count, 2);
+        UtAssert_UINT32_EQ(get_data[0], 0);
+        UtAssert_UINT32_EQ(get_data[1], 1);
+        UtAssert_UINT32_EQ(get_data[2], 0xFFFFFFFF);
+        UtAssert_UINT32_EQ(get_size[0], sizeof(uint32));
+        UtAssert_UINT32_EQ(get_size[1], sizeof(uint32));
+
+        UT_NOMINAL(OS_QueueGetMulti(queue_id, get_list, sizeof(uint32), get_size, 5, &count, 20));
+        UtAssert_UINT32_EQ(count, 1);
+        UtAssert_UINT32_EQ(get_data[0], 2);
 
         UT_TEARDOWN(OS_QueueDelete(queue_id));
     }
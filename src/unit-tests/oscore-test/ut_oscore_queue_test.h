@@ -58,6 +58,9 @@ void UT_os_queue_put_test(void);
 void UT_os_queue_get_test(void);
 void UT_os_queue_get_id_by_name_test(void);
 void UT_os_queue_get_info_test(void);
+void UT_os_queue_ring_test(void);
+void UT_os_queue_zero_copy_test(void);
+void UT_os_queue_multi_test(void);
 
 /*--------------------------------------------------------------------------------*/
 
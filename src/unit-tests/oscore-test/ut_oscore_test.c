@@ -195,6 +195,7 @@ void UtTest_Setup(void)
     UtTest_Add(UT_os_printf_test, NULL, NULL, "OS_printf");
     UtTest_Add(UT_os_printfenable_test, NULL, NULL, "OS_printf_enable");
     UtTest_Add(UT_os_printfdisable_test, NULL, NULL, "OS_printf_disable");
+    UtTest_Add(UT_os_consolegetstats_test, NULL, NULL, "OS_ConsoleGetStats");
 
     UtTest_Add(UT_os_bin_sem_create_test, NULL, NULL, "OS_BinSemCreate");
     UtTest_Add(UT_os_bin_sem_delete_test, NULL, NULL, "OS_BinSemDelete");
@@ -224,6 +225,9 @@ void UtTest_Setup(void)
     UtTest_Add(UT_os_queue_get_test, NULL, NULL, "OS_QueueGet");
     UtTest_Add(UT_os_queue_get_id_by_name_test, NULL, NULL, "OS_QueueGetIdByName");
     UtTest_Add(UT_os_queue_get_info_test, NULL, NULL, "OS_QueueGetInfo");
+    UtTest_Add(UT_os_queue_ring_test, NULL, NULL, "OS_QueueCreate (ring)");
+    UtTest_Add(UT_os_queue_zero_copy_test, NULL, NULL, "OS_QueueReserve/OS_QueueBorrow");
+    UtTest_Add(UT_os_queue_multi_test, NULL, NULL, "OS_QueuePutMulti/OS_QueueGetMulti");
 
     UtTest_Add(UT_os_select_fd_test, UT_os_select_setup_file, UT_os_select_teardown_file, "OS_SelectFd");
     UtTest_Add(UT_os_select_single_test, UT_os_select_setup_file, UT_os_select_teardown_file, "OS_SelectSingle");
@@ -247,6 +251,7 @@ void UtTest_Setup(void)
 
     UtTest_Add(UT_os_getlocaltime_test, NULL, NULL, "OS_GetLocalTime");
     UtTest_Add(UT_os_setlocaltime_test, NULL, NULL, "OS_SetLocalTime");
+    UtTest_Add(UT_os_getmonotonictime_test, NULL, NULL, "OS_GetMonotonicTime");
 
     UtTest_Add(UT_os_heapgetinfo_test, NULL, NULL, "OS_HeapGetInfo");
 }
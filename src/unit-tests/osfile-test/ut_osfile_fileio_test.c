@@ -689,6 +689,426 @@ void UT_os_writefile_test()
     }
 }
 
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_writev(osal_id_t filedes, const OS_iovec_t *iov, uint32 iovcnt)
+**         int32 OS_readv(osal_id_t filedes, const OS_iovec_t *iov, uint32 iovcnt)
+** Purpose: Writes/reads a list of separate buffers to/from the given file descriptor
+** Parameters: filedes - a file descriptor
+**             iov - list of segments
+**             iovcnt - number of entries in the list
+** Returns: OS_INVALID_POINTER if the segment list is null
+**          OS_ERR_INVALID_SIZE if the segment count or total size is invalid
+**          OS_ERR_INVALID_ID if the file descriptor passed in is invalid
+**          The number of bytes written/read if succeeded
+** -----------------------------------------------------
+** Test #1: Null-pointer-arg and invalid-size conditions
+** -----------------------------------------------------
+** Test #2: Invalid-file-desc-arg condition
+** -----------------------------------------------------
+** Test #3: Nominal condition
+**   1) Write a header and a payload from separate buffers with OS_writev()
+**   2) Read the file back with OS_read(), expect the concatenation of both buffers
+**   3) Read the file again with OS_readv() into two buffers split at a different
+**      point, expect each buffer to be filled in order
+**--------------------------------------------------------------------------------*/
+void UT_os_vectoredfile_test()
+{
+    static const char Header[]  = "HDR:";
+    static const char Payload[] = "TO BE OR NOT TO BE";
+    char              Part1[8];
+    char              Part2[sizeof(g_readBuff)];
+    OS_iovec_t        Iov[2];
+    size_t            expected_len;
+
+    Iov[0].Buffer = (void *)Header;
+    Iov[0].Length = strlen(Header);
+    Iov[1].Buffer = (void *)Payload;
+    Iov[1].Length = strlen(Payload);
+    expected_len  = Iov[0].Length + Iov[1].Length;
+
+    /*-----------------------------------------------------*/
+    /* #1 Null-pointer-arg and invalid-size */
+
+    memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
+    UT_os_sprintf(g_fNames[0], "%s/Writev_NullPtr.txt", g_mntName);
+    if (UT_SETUP(OS_OpenCreate(&g_fDescs[0], g_fNames[0], OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_READ_WRITE)))
+    {
+        UT_RETVAL(OS_writev(g_fDescs[0], NULL, 2), OS_INVALID_POINTER);
+        UT_RETVAL(OS_readv(g_fDescs[0], NULL, 2), OS_INVALID_POINTER);
+        UT_RETVAL(OS_writev(g_fDescs[0], Iov, 0), OS_ERR_INVALID_SIZE);
+        UT_RETVAL(OS_readv(g_fDescs[0], Iov, OS_IOV_MAX + 1), OS_ERR_INVALID_SIZE);
+
+        /* Reset test environment */
+        UT_TEARDOWN(OS_close(g_fDescs[0]));
+        UT_TEARDOWN(OS_remove(g_fNames[0]));
+    }
+
+    /*-----------------------------------------------------*/
+    /* #2 Invalid-file-desc-arg */
+
+    UT_RETVAL(OS_writev(UT_OBJID_INCORRECT, Iov, 2), OS_ERR_INVALID_ID);
+    UT_RETVAL(OS_writev(OS_OBJECT_ID_UNDEFINED, Iov, 2), OS_ERR_INVALID_ID);
+
+    /*-----------------------------------------------------*/
+    /* #3 Nominal */
+
+    memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
+    UT_os_sprintf(g_fNames[0], "%s/Writev_Nominal.txt", g_mntName);
+    if (UT_SETUP(OS_OpenCreate(&g_fDescs[0], g_fNames[0], OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_READ_WRITE)))
+    {
+        UT_RETVAL(OS_writev(g_fDescs[0], Iov, 2), expected_len);
+
+        UT_SETUP(OS_lseek(g_fDescs[0], 0, OS_SEEK_SET));
+        memset(g_readBuff, '\0', sizeof(g_readBuff));
+        UT_RETVAL(OS_read(g_fDescs[0], g_readBuff, sizeof(g_readBuff)), expected_len);
+        UtAssert_StrCmp(g_readBuff, "HDR:TO BE OR NOT TO BE", "%s == HDR:TO BE OR NOT TO BE", g_readBuff);
+
+        UT_SETUP(OS_lseek(g_fDescs[0], 0, OS_SEEK_SET));
+        memset(Part1, '\0', sizeof(Part1));
+        memset(Part2, '\0', sizeof(Part2));
+        Iov[0].Buffer = Part1;
+        Iov[0].Length = sizeof(Part1) - 1;
+        Iov[1].Buffer = Part2;
+        Iov[1].Length = sizeof(Part2) - 1;
+        UT_RETVAL(OS_readv(g_fDescs[0], Iov, 2), expected_len);
+        UtAssert_StrCmp(Part1, "HDR:TO ", "%s == HDR:TO ", Part1);
+        UtAssert_StrCmp(Part2, "BE OR NOT TO BE", "%s == BE OR NOT TO BE", Part2);
+
+        /* confirm that readv returns 0 at end of file */
+        UT_RETVAL(OS_readv(g_fDescs[0], Iov, 2), 0);
+
+        /* Reset test environment */
+        UT_TEARDOWN(OS_close(g_fDescs[0]));
+        UT_TEARDOWN(OS_remove(g_fNames[0]));
+    }
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_pwrite(osal_id_t filedes, const void *buffer, size_t nbytes, osal_offset_t offset)
+**         int32 OS_pread(osal_id_t filedes, void *buffer, size_t nbytes, osal_offset_t offset)
+**         int32 OS_lseek64(osal_id_t filedes, osal_offset_t offset, uint32 whence, osal_offset_t *position)
+** Purpose: Writes/reads at a given file offset, and moves the file position using 64-bit offsets
+** Returns: OS_INVALID_POINTER if a pointer argument is null
+**          OS_ERR_INVALID_SIZE if the size is zero
+**          OS_ERR_INVALID_ARGUMENT if the offset is negative
+**          OS_ERR_INVALID_ID if the file descriptor passed in is invalid
+**          The number of bytes written/read, or OS_SUCCESS for OS_lseek64, if succeeded
+** -----------------------------------------------------
+** Test #1: Invalid-argument conditions
+** -----------------------------------------------------
+** Test #2: Invalid-file-desc-arg condition
+** -----------------------------------------------------
+** Test #3: Nominal condition
+**   1) Write known data to a file with OS_write()
+**   2) Overwrite part of it with OS_pwrite(), expect the file position to be unchanged
+**   3) Read part of it back with OS_pread(), expect the overwritten data
+**   4) Expect OS_pread() at the end of file to return 0
+**   5) Seek beyond 4GB with OS_lseek64(), expect the full position to be returned
+**--------------------------------------------------------------------------------*/
+void UT_os_positionalfile_test()
+{
+    const char    WriteData[] = "0123456789";
+    osal_offset_t position;
+
+    /*-----------------------------------------------------*/
+    /* #1 Invalid-argument */
+
+    memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
+    UT_os_sprintf(g_fNames[0], "%s/Pwrite_InvArg.txt", g_mntName);
+    if (UT_SETUP(OS_OpenCreate(&g_fDescs[0], g_fNames[0], OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_READ_WRITE)))
+    {
+        UT_RETVAL(OS_pwrite(g_fDescs[0], NULL, 1, 0), OS_INVALID_POINTER);
+        UT_RETVAL(OS_pread(g_fDescs[0], NULL, 1, 0), OS_INVALID_POINTER);
+        UT_RETVAL(OS_pwrite(g_fDescs[0], WriteData, 0, 0), OS_ERR_INVALID_SIZE);
+        UT_RETVAL(OS_pread(g_fDescs[0], g_readBuff, 0, 0), OS_ERR_INVALID_SIZE);
+        UT_RETVAL(OS_pwrite(g_fDescs[0], WriteData, 1, -1), OS_ERR_INVALID_ARGUMENT);
+        UT_RETVAL(OS_pread(g_fDescs[0], g_readBuff, 1, -1), OS_ERR_INVALID_ARGUMENT);
+        UT_RETVAL(OS_lseek64(g_fDescs[0], 0, OS_SEEK_SET, NULL), OS_INVALID_POINTER);
+
+        /* Reset test environment */
+        UT_TEARDOWN(OS_close(g_fDescs[0]));
+        UT_TEARDOWN(OS_remove(g_fNames[0]));
+    }
+
+    /*-----------------------------------------------------*/
+    /* #2 Invalid-file-desc-arg */
+
+    UT_RETVAL(OS_pwrite(UT_OBJID_INCORRECT, WriteData, 1, 0), OS_ERR_INVALID_ID);
+    UT_RETVAL(OS_pread(OS_OBJECT_ID_UNDEFINED, g_readBuff, 1, 0), OS_ERR_INVALID_ID);
+    UT_RETVAL(OS_lseek64(UT_OBJID_INCORRECT, 0, OS_SEEK_SET, &position), OS_ERR_INVALID_ID);
+
+    /*-----------------------------------------------------*/
+    /* #3 Nominal */
+
+    memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
+    UT_os_sprintf(g_fNames[0], "%s/Pwrite_Nominal.txt", g_mntName);
+    if (UT_SETUP(OS_OpenCreate(&g_fDescs[0], g_fNames[0], OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_READ_WRITE)))
+    {
+        UT_SETUP(OS_write(g_fDescs[0], WriteData, strlen(WriteData)));
+
+        UT_RETVAL(OS_pwrite(g_fDescs[0], "AB", 2, 4), 2);
+        UT_NOMINAL(OS_lseek64(g_fDescs[0], 0, OS_SEEK_CUR, &position));
+        UtAssert_INT32_EQ(position, strlen(WriteData));
+
+        memset(g_readBuff, '\0', sizeof(g_readBuff));
+        UT_RETVAL(OS_pread(g_fDescs[0], g_readBuff, 4, 3), 4);
+        UtAssert_StrCmp(g_readBuff, "3AB6", "%s == 3AB6", g_readBuff);
+
+        UT_RETVAL(OS_pread(g_fDescs[0], g_readBuff, 4, strlen(WriteData)), 0);
+
+        /* seeking past the end of file is allowed, and does not write anything */
+        UT_NOMINAL(OS_lseek64(g_fDescs[0], 0x100000000, OS_SEEK_SET, &position));
+        UtAssert_True(position == 0x100000000, "position (%lld) == 0x100000000", (long long)position);
+
+        /* Reset test environment */
+        UT_TEARDOWN(OS_close(g_fDescs[0]));
+        UT_TEARDOWN(OS_remove(g_fNames[0]));
+    }
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_FileMap(osal_id_t filedes, osal_offset_t offset, size_t length, uint32 flags, void **addr)
+**         int32 OS_FileUnmap(osal_id_t filedes, void *addr, uint32 flags)
+** Purpose: Maps part of a file into memory, and removes the mapping
+** Returns: OS_INVALID_POINTER if the address pointer is null
+**          OS_ERR_INVALID_SIZE if the length is zero
+**          OS_ERR_INVALID_ARGUMENT if the flags or the address to unmap are not valid
+**          OS_ERR_INVALID_ID if the file descriptor passed in is invalid
+**          OS_ERR_NO_FREE_IDS if the file has too many mappings
+**          OS_ERR_OBJECT_IN_USE if the file is closed while it has mappings
+**          OS_ERR_NOT_IMPLEMENTED if not implemented
+**          OS_SUCCESS if succeeded
+** -----------------------------------------------------
+** Test #0: Not-implemented condition
+**   1) If OS_FileMap returns OS_ERR_NOT_IMPLEMENTED, then exit test
+** -----------------------------------------------------
+** Test #1: Invalid-argument conditions
+** -----------------------------------------------------
+** Test #2: Nominal condition
+**   1) Write known data to a file
+**   2) Map part of the file, starting at an offset which is not page aligned
+**   3) Expect the mapped data to match the file content at that offset
+**   4) Change the data through the mapping, and unmap with OS_FILE_MAP_SYNC
+**   5) Expect OS_read() to return the changed data
+** -----------------------------------------------------
+** Test #3: Mapping-limit and close conditions
+**   1) Map the file until the limit is reached, expect OS_ERR_NO_FREE_IDS
+**   2) Close the file without unmapping, expect OS_ERR_OBJECT_IN_USE
+**   3) Unmap all of the mappings, then expect close to succeed
+**--------------------------------------------------------------------------------*/
+void UT_os_mapfile_test()
+{
+    static const char Content[] = "0123456789ABCDEFGHIJ";
+    char *            MapAddr;
+    void *            Addr;
+    void *            AddrList[OS_FILE_MAX_MAPPINGS];
+    uint32            i;
+
+    memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
+    UT_os_sprintf(g_fNames[0], "%s/Map_File.txt", g_mntName);
+    if (!UT_SETUP(OS_OpenCreate(&g_fDescs[0], g_fNames[0], OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_READ_WRITE)))
+    {
+        return;
+    }
+
+    UT_SETUP(OS_write(g_fDescs[0], Content, strlen(Content)));
+
+    /*-----------------------------------------------------*/
+    /* #0 Not-implemented */
+
+    if (UT_IMPL(OS_FileMap(g_fDescs[0], 0, 1, OS_FILE_MAP_READ, &Addr)))
+    {
+        UT_NOMINAL(OS_FileUnmap(g_fDescs[0], Addr, 0));
+
+        /*-----------------------------------------------------*/
+        /* #1 Invalid-argument */
+
+        UT_RETVAL(OS_FileMap(g_fDescs[0], 0, 1, OS_FILE_MAP_READ, NULL), OS_INVALID_POINTER);
+        UT_RETVAL(OS_FileMap(g_fDescs[0], 0, 0, OS_FILE_MAP_READ, &Addr), OS_ERR_INVALID_SIZE);
+        UT_RETVAL(OS_FileMap(g_fDescs[0], 0, 1, 0, &Addr), OS_ERR_INVALID_ARGUMENT);
+        UT_RETVAL(OS_FileMap(UT_OBJID_INCORRECT, 0, 1, OS_FILE_MAP_READ, &Addr), OS_ERR_INVALID_ID);
+        UT_RETVAL(OS_FileUnmap(g_fDescs[0], NULL, 0), OS_INVALID_POINTER);
+        UT_RETVAL(OS_FileUnmap(g_fDescs[0], g_readBuff, 0), OS_ERR_INVALID_ARGUMENT);
+
+        /*-----------------------------------------------------*/
+        /* #2 Nominal */
+
+        if (UT_SETUP(OS_FileMap(g_fDescs[0], 5, 10, OS_FILE_MAP_READ | OS_FILE_MAP_WRITE | OS_FILE_MAP_RANDOM,
+                                &Addr)))
+        {
+            MapAddr = Addr;
+            UtAssert_True(memcmp(MapAddr, &Content[5], 10) == 0, "Mapped data matches file content");
+
+            MapAddr[0] = 'x';
+            UT_NOMINAL(OS_FileUnmap(g_fDescs[0], Addr, OS_FILE_MAP_SYNC));
+
+            UT_SETUP(OS_lseek(g_fDescs[0], 0, OS_SEEK_SET));
+            memset(g_readBuff, '\0', sizeof(g_readBuff));
+            UT_RETVAL(OS_read(g_fDescs[0], g_readBuff, sizeof(g_readBuff)), (int32)strlen(Content));
+            UtAssert_StrCmp(g_readBuff, "01234x6789ABCDEFGHIJ", "%s == 01234x6789ABCDEFGHIJ", g_readBuff);
+        }
+
+        /*-----------------------------------------------------*/
+        /* #3 Mapping-limit and close */
+
+        for (i = 0; i < OS_FILE_MAX_MAPPINGS; ++i)
+        {
+            UT_SETUP(OS_FileMap(g_fDescs[0], i, 1, OS_FILE_MAP_READ | OS_FILE_MAP_SEQUENTIAL, &AddrList[i]));
+        }
+        UT_RETVAL(OS_FileMap(g_fDescs[0], 0, 1, OS_FILE_MAP_READ, &Addr), OS_ERR_NO_FREE_IDS);
+
+        UT_RETVAL(OS_close(g_fDescs[0]), OS_ERR_OBJECT_IN_USE);
+        for (i = 0; i < OS_FILE_MAX_MAPPINGS; ++i)
+        {
+            UT_NOMINAL(OS_FileUnmap(g_fDescs[0], AddrList[i], 0));
+        }
+    }
+
+    /* Reset test environment */
+    UT_NOMINAL(OS_close(g_fDescs[0]));
+    UT_TEARDOWN(OS_remove(g_fNames[0]));
+}
+
+static uint32 UT_os_asyncfile_callbacks;
+
+static void UT_os_asyncfile_callback(OS_FileAsyncReq_t *Req)
+{
+    ++UT_os_asyncfile_callbacks;
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_FileAsyncSubmit(OS_FileAsyncReq_t *Req)
+**         int32 OS_FileAsyncWait(int32 msecs)
+** Purpose: Starts file operations in the background, and waits for them to complete
+** Returns: OS_INVALID_POINTER if the request or a read/write buffer is null
+**          OS_ERR_INVALID_SIZE if the read/write length is zero
+**          OS_ERR_INVALID_ARGUMENT if the operation or offset is not valid
+**          OS_ERR_INVALID_ID if the file descriptor passed in is invalid
+**          OS_ERROR_TIMEOUT if nothing completes before the timeout
+**          OS_ERR_NOT_IMPLEMENTED if not implemented
+**          OS_SUCCESS/the number of completed requests if succeeded
+** -----------------------------------------------------
+** Test #0: Not-implemented condition
+**   1) If OS_FileAsyncSubmit returns OS_ERR_NOT_IMPLEMENTED, then exit test
+** -----------------------------------------------------
+** Test #1: Invalid-argument conditions
+** -----------------------------------------------------
+** Test #2: Nominal condition
+**   1) Submit several writes at different offsets at once, each with a callback
+**   2) Wait until all of them have completed, expect each callback to be called
+**   3) Submit a read of the whole file with a completion queue
+**   4) Wait, and expect the request pointer on the queue, and the written data
+**   5) Expect OS_FileAsyncWait to time out when nothing is in progress
+**--------------------------------------------------------------------------------*/
+void UT_os_asyncfile_test()
+{
+    static const char *Parts[] = {"AAAA", "BBBB", "CCCC", "DDDD"};
+    OS_FileAsyncReq_t  Reqs[4];
+    OS_FileAsyncReq_t *DoneReq;
+    osal_id_t          QueueId;
+    size_t             DoneSize;
+    int32              Status;
+    uint32             Done;
+    uint32             i;
+
+    memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
+    UT_os_sprintf(g_fNames[0], "%s/Async_File.txt", g_mntName);
+    if (!UT_SETUP(OS_OpenCreate(&g_fDescs[0], g_fNames[0], OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_READ_WRITE)))
+    {
+        return;
+    }
+
+    /*-----------------------------------------------------*/
+    /* #0 Not-implemented */
+
+    memset(Reqs, 0, sizeof(Reqs));
+    Reqs[0].FileId    = g_fDescs[0];
+    Reqs[0].Operation = OS_FILE_ASYNC_SYNC;
+    if (UT_IMPL(OS_FileAsyncSubmit(&Reqs[0])))
+    {
+        UT_RETVAL(OS_FileAsyncWait(1000), 1);
+        UtAssert_INT32_EQ(Reqs[0].Result, OS_SUCCESS);
+
+        /*-----------------------------------------------------*/
+        /* #1 Invalid-argument */
+
+        UT_RETVAL(OS_FileAsyncSubmit(NULL), OS_INVALID_POINTER);
+        Reqs[0].Operation = OS_FILE_ASYNC_READ;
+        UT_RETVAL(OS_FileAsyncSubmit(&Reqs[0]), OS_INVALID_POINTER);
+        Reqs[0].Buffer = g_readBuff;
+        UT_RETVAL(OS_FileAsyncSubmit(&Reqs[0]), OS_ERR_INVALID_SIZE);
+        Reqs[0].Length = 1;
+        Reqs[0].Offset = -1;
+        UT_RETVAL(OS_FileAsyncSubmit(&Reqs[0]), OS_ERR_INVALID_ARGUMENT);
+        Reqs[0].Offset    = 0;
+        Reqs[0].Operation = 0;
+        UT_RETVAL(OS_FileAsyncSubmit(&Reqs[0]), OS_ERR_INVALID_ARGUMENT);
+        Reqs[0].Operation = OS_FILE_ASYNC_READ;
+        Reqs[0].FileId    = UT_OBJID_INCORRECT;
+        UT_RETVAL(OS_FileAsyncSubmit(&Reqs[0]), OS_ERR_INVALID_ID);
+
+        /*-----------------------------------------------------*/
+        /* #2 Nominal */
+
+        UT_os_asyncfile_callbacks = 0;
+        memset(Reqs, 0, sizeof(Reqs));
+        for (i = 0; i < 4; ++i)
+        {
+            Reqs[i].FileId    = g_fDescs[0];
+            Reqs[i].Operation = OS_FILE_ASYNC_WRITE;
+            Reqs[i].Buffer    = (void *)Parts[i];
+            Reqs[i].Length    = strlen(Parts[i]);
+            Reqs[i].Offset    = i * strlen(Parts[i]);
+            Reqs[i].Callback  = UT_os_asyncfile_callback;
+            UT_NOMINAL(OS_FileAsyncSubmit(&Reqs[i]));
+        }
+
+        Done = 0;
+        while (Done < 4)
+        {
+            Status = OS_FileAsyncWait(1000);
+            if (Status <= 0)
+            {
+                UtAssert_Failed("OS_FileAsyncWait() returned %d", (int)Status);
+                break;
+            }
+            Done += Status;
+        }
+        UtAssert_UINT32_EQ(UT_os_asyncfile_callbacks, 4);
+        for (i = 0; i < 4; ++i)
+        {
+            UtAssert_INT32_EQ(Reqs[i].Result, strlen(Parts[i]));
+        }
+
+        if (UT_SETUP(OS_QueueCreate(&QueueId, "AsyncDone", 4, sizeof(DoneReq), 0)))
+        {
+            memset(g_readBuff, '\0', sizeof(g_readBuff));
+            memset(&Reqs[0], 0, sizeof(Reqs[0]));
+            Reqs[0].FileId          = g_fDescs[0];
+            Reqs[0].Operation       = OS_FILE_ASYNC_READ;
+            Reqs[0].Buffer          = g_readBuff;
+            Reqs[0].Length          = sizeof(g_readBuff) - 1;
+            Reqs[0].CompletionQueue = QueueId;
+            UT_NOMINAL(OS_FileAsyncSubmit(&Reqs[0]));
+            UT_RETVAL(OS_FileAsyncWait(1000), 1);
+
+            DoneReq = NULL;
+            UT_NOMINAL(OS_QueueGet(QueueId, &DoneReq, sizeof(DoneReq), &DoneSize, OS_CHECK));
+            UtAssert_ADDRESS_EQ(DoneReq, &Reqs[0]);
+            UtAssert_INT32_EQ(Reqs[0].Result, 16);
+            UtAssert_StrCmp(g_readBuff, "AAAABBBBCCCCDDDD", "%s == AAAABBBBCCCCDDDD", g_readBuff);
+
+            UT_TEARDOWN(OS_QueueDelete(QueueId));
+        }
+
+        UT_RETVAL(OS_FileAsyncWait(OS_CHECK), OS_ERROR_TIMEOUT);
+    }
+
+    /* Reset test environment */
+    UT_TEARDOWN(OS_close(g_fDescs[0]));
+    UT_TEARDOWN(OS_remove(g_fNames[0]));
+}
+
 /*--------------------------------------------------------------------------------*
 ** Syntax: int32 OS_lseek(int32 filedes, int32 offset, uint32 whence)
 ** Purpose: Moves the read/write pointer of a given file descriptor to the given offset
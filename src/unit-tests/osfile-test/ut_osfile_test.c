@@ -152,6 +152,10 @@ void UtTest_Setup(void)
 
         UtTest_Add(UT_os_readfile_test, NULL, NULL, "OS_read");
         UtTest_Add(UT_os_writefile_test, NULL, NULL, "OS_write");
+        UtTest_Add(UT_os_vectoredfile_test, NULL, NULL, "OS_writev/OS_readv");
+        UtTest_Add(UT_os_positionalfile_test, NULL, NULL, "OS_pwrite/OS_pread/OS_lseek64");
+        UtTest_Add(UT_os_mapfile_test, NULL, NULL, "OS_FileMap/OS_FileUnmap");
+        UtTest_Add(UT_os_asyncfile_test, NULL, NULL, "OS_FileAsyncSubmit/OS_FileAsyncWait");
         UtTest_Add(UT_os_lseekfile_test, NULL, NULL, "OS_lseek");
 
         UtTest_Add(UT_os_chmodfile_test, NULL, NULL, "OS_chmod");
@@ -51,6 +51,67 @@ void UT_DefaultHandler_OS_GetLocalTime(void *UserObj, UT_EntryKey_t FuncKey, con
     }
 }
 
+/*
+ * -----------------------------------------------------------------
+ * Default handler implementation for 'OS_GetMonotonicTime' stub
+ * -----------------------------------------------------------------
+ */
+void UT_DefaultHandler_OS_GetMonotonicTime(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    OS_time_t *time_struct = UT_Hook_GetArgValueByName(Context, "time_struct", OS_time_t *);
+    uint32     count       = UT_GetStubCount(FuncKey);
+    int32      status;
+
+    UT_Stub_GetInt32StatusCode(Context, &status);
+
+    if (status == OS_SUCCESS &&
+        UT_Stub_CopyToLocal(UT_KEY(OS_GetMonotonicTime), time_struct, sizeof(*time_struct)) < sizeof(*time_struct))
+    {
+        *time_struct = OS_TimeAssembleFromNanoseconds(1 + (count / 100), 10000000 * (count % 100));
+    }
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Default handler implementation for 'OS_GetCoarseTime' stub
+ * -----------------------------------------------------------------
+ */
+void UT_DefaultHandler_OS_GetCoarseTime(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    OS_time_t *time_struct = UT_Hook_GetArgValueByName(Context, "time_struct", OS_time_t *);
+    uint32     count       = UT_GetStubCount(FuncKey);
+    int32      status;
+
+    UT_Stub_GetInt32StatusCode(Context, &status);
+
+    if (status == OS_SUCCESS &&
+        UT_Stub_CopyToLocal(UT_KEY(OS_GetCoarseTime), time_struct, sizeof(*time_struct)) < sizeof(*time_struct))
+    {
+        *time_struct = OS_TimeAssembleFromNanoseconds(1 + (count / 100), 10000000 * (count % 100));
+    }
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Default handler implementation for 'OS_RawCounterToTime' stub
+ * -----------------------------------------------------------------
+ */
+void UT_DefaultHandler_OS_RawCounterToTime(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    uint64     count       = UT_Hook_GetArgValueByName(Context, "count", uint64);
+    OS_time_t *time_struct = UT_Hook_GetArgValueByName(Context, "time_struct", OS_time_t *);
+    int32      status;
+
+    UT_Stub_GetInt32StatusCode(Context, &status);
+
+    if (status == OS_SUCCESS &&
+        UT_Stub_CopyToLocal(UT_KEY(OS_RawCounterToTime), time_struct, sizeof(*time_struct)) < sizeof(*time_struct))
+    {
+        /* treat the count as nanoseconds */
+        *time_struct = OS_TimeFromTotalNanoseconds(count);
+    }
+}
+
 /*
  * -----------------------------------------------------------------
  * Default handler implementation for 'OS_SetLocalTime' stub
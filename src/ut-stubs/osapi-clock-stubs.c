@@ -25,7 +25,10 @@
 #include "osapi-clock.h"
 #include "utgenstub.h"
 
+void UT_DefaultHandler_OS_GetCoarseTime(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_GetLocalTime(void *, UT_EntryKey_t, const UT_StubContext_t *);
+void UT_DefaultHandler_OS_GetMonotonicTime(void *, UT_EntryKey_t, const UT_StubContext_t *);
+void UT_DefaultHandler_OS_RawCounterToTime(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_SetLocalTime(void *, UT_EntryKey_t, const UT_StubContext_t *);
 
 /*
@@ -60,6 +63,69 @@ int32 OS_SetLocalTime(const OS_time_t *time_struct)
     return UT_GenStub_GetReturnValue(OS_SetLocalTime, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_GetMonotonicTime()
+ * ----------------------------------------------------
+ */
+int32 OS_GetMonotonicTime(OS_time_t *time_struct)
+{
+    UT_GenStub_SetupReturnBuffer(OS_GetMonotonicTime, int32);
+
+    UT_GenStub_AddParam(OS_GetMonotonicTime, OS_time_t *, time_struct);
+
+    UT_GenStub_Execute(OS_GetMonotonicTime, Basic, UT_DefaultHandler_OS_GetMonotonicTime);
+
+    return UT_GenStub_GetReturnValue(OS_GetMonotonicTime, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_GetCoarseTime()
+ * ----------------------------------------------------
+ */
+int32 OS_GetCoarseTime(OS_time_t *time_struct)
+{
+    UT_GenStub_SetupReturnBuffer(OS_GetCoarseTime, int32);
+
+    UT_GenStub_AddParam(OS_GetCoarseTime, OS_time_t *, time_struct);
+
+    UT_GenStub_Execute(OS_GetCoarseTime, Basic, UT_DefaultHandler_OS_GetCoarseTime);
+
+    return UT_GenStub_GetReturnValue(OS_GetCoarseTime, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_GetRawCounter()
+ * ----------------------------------------------------
+ */
+uint64 OS_GetRawCounter(void)
+{
+    UT_GenStub_SetupReturnBuffer(OS_GetRawCounter, uint64);
+
+    UT_GenStub_Execute(OS_GetRawCounter, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_GetRawCounter, uint64);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_RawCounterToTime()
+ * ----------------------------------------------------
+ */
+int32 OS_RawCounterToTime(uint64 count, OS_time_t *time_struct)
+{
+    UT_GenStub_SetupReturnBuffer(OS_RawCounterToTime, int32);
+
+    UT_GenStub_AddParam(OS_RawCounterToTime, uint64, count);
+    UT_GenStub_AddParam(OS_RawCounterToTime, OS_time_t *, time_struct);
+
+    UT_GenStub_Execute(OS_RawCounterToTime, Basic, UT_DefaultHandler_OS_RawCounterToTime);
+
+    return UT_GenStub_GetReturnValue(OS_RawCounterToTime, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_TimeFromRelativeMilliseconds()
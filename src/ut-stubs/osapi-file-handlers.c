@@ -226,6 +226,45 @@ void UT_DefaultHandler_OS_lseek(void *UserObj, UT_EntryKey_t FuncKey, const UT_S
     UT_Stub_SetReturnValue(FuncKey, offset);
 }
 
+/*
+ * -----------------------------------------------------------------
+ * Default handler implementation for 'OS_lseek64' stub
+ * -----------------------------------------------------------------
+ */
+void UT_DefaultHandler_OS_lseek64(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    osal_offset_t  offset   = UT_Hook_GetArgValueByName(Context, "offset", osal_offset_t);
+    osal_offset_t *position = UT_Hook_GetArgValueByName(Context, "position", osal_offset_t *);
+    int32          Status;
+
+    UT_Stub_GetInt32StatusCode(Context, &Status);
+
+    if (Status == OS_SUCCESS)
+    {
+        *position = offset;
+    }
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Default handler implementation for 'OS_pread' stub
+ * -----------------------------------------------------------------
+ */
+void UT_DefaultHandler_OS_pread(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    UT_GenericReadStub(FuncKey, Context);
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Default handler implementation for 'OS_pwrite' stub
+ * -----------------------------------------------------------------
+ */
+void UT_DefaultHandler_OS_pwrite(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    UT_GenericWriteStub(FuncKey, Context);
+}
+
 /*
  * -----------------------------------------------------------------
  * Default handler implementation for 'OS_FDGetInfo' stub
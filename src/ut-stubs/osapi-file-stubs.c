@@ -31,6 +31,9 @@ void UT_DefaultHandler_OS_TimedRead(void *, UT_EntryKey_t, const UT_StubContext_
 void UT_DefaultHandler_OS_TimedWrite(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_close(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_lseek(void *, UT_EntryKey_t, const UT_StubContext_t *);
+void UT_DefaultHandler_OS_lseek64(void *, UT_EntryKey_t, const UT_StubContext_t *);
+void UT_DefaultHandler_OS_pread(void *, UT_EntryKey_t, const UT_StubContext_t *);
+void UT_DefaultHandler_OS_pwrite(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_read(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_stat(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_write(void *, UT_EntryKey_t, const UT_StubContext_t *);
@@ -54,6 +57,25 @@ int32 OS_TimedReadAbs(osal_id_t filedes, void *buffer, size_t nbytes, OS_time_t
     return UT_GenStub_GetReturnValue(OS_TimedReadAbs, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_TimedReadvAbs()
+ * ----------------------------------------------------
+ */
+int32 OS_TimedReadvAbs(osal_id_t filedes, const OS_iovec_t *iov, uint32 iovcnt, OS_time_t abstime)
+{
+    UT_GenStub_SetupReturnBuffer(OS_TimedReadvAbs, int32);
+
+    UT_GenStub_AddParam(OS_TimedReadvAbs, osal_id_t, filedes);
+    UT_GenStub_AddParam(OS_TimedReadvAbs, const OS_iovec_t *, iov);
+    UT_GenStub_AddParam(OS_TimedReadvAbs, uint32, iovcnt);
+    UT_GenStub_AddParam(OS_TimedReadvAbs, OS_time_t, abstime);
+
+    UT_GenStub_Execute(OS_TimedReadvAbs, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_TimedReadvAbs, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_TimedWriteAbs()
@@ -73,6 +95,25 @@ int32 OS_TimedWriteAbs(osal_id_t filedes, const void *buffer, size_t nbytes, OS_
     return UT_GenStub_GetReturnValue(OS_TimedWriteAbs, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_TimedWritevAbs()
+ * ----------------------------------------------------
+ */
+int32 OS_TimedWritevAbs(osal_id_t filedes, const OS_iovec_t *iov, uint32 iovcnt, OS_time_t abstime)
+{
+    UT_GenStub_SetupReturnBuffer(OS_TimedWritevAbs, int32);
+
+    UT_GenStub_AddParam(OS_TimedWritevAbs, osal_id_t, filedes);
+    UT_GenStub_AddParam(OS_TimedWritevAbs, const OS_iovec_t *, iov);
+    UT_GenStub_AddParam(OS_TimedWritevAbs, uint32, iovcnt);
+    UT_GenStub_AddParam(OS_TimedWritevAbs, OS_time_t, abstime);
+
+    UT_GenStub_Execute(OS_TimedWritevAbs, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_TimedWritevAbs, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_CloseAllFiles()
@@ -120,6 +161,74 @@ int32 OS_FDGetInfo(osal_id_t filedes, OS_file_prop_t *fd_prop)
     return UT_GenStub_GetReturnValue(OS_FDGetInfo, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_FileAsyncSubmit()
+ * ----------------------------------------------------
+ */
+int32 OS_FileAsyncSubmit(OS_FileAsyncReq_t *Req)
+{
+    UT_GenStub_SetupReturnBuffer(OS_FileAsyncSubmit, int32);
+
+    UT_GenStub_AddParam(OS_FileAsyncSubmit, OS_FileAsyncReq_t *, Req);
+
+    UT_GenStub_Execute(OS_FileAsyncSubmit, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_FileAsyncSubmit, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_FileAsyncWait()
+ * ----------------------------------------------------
+ */
+int32 OS_FileAsyncWait(int32 msecs)
+{
+    UT_GenStub_SetupReturnBuffer(OS_FileAsyncWait, int32);
+
+    UT_GenStub_AddParam(OS_FileAsyncWait, int32, msecs);
+
+    UT_GenStub_Execute(OS_FileAsyncWait, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_FileAsyncWait, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_FileAsyncWaitAbs()
+ * ----------------------------------------------------
+ */
+int32 OS_FileAsyncWaitAbs(OS_time_t abstime)
+{
+    UT_GenStub_SetupReturnBuffer(OS_FileAsyncWaitAbs, int32);
+
+    UT_GenStub_AddParam(OS_FileAsyncWaitAbs, OS_time_t, abstime);
+
+    UT_GenStub_Execute(OS_FileAsyncWaitAbs, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_FileAsyncWaitAbs, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_FileMap()
+ * ----------------------------------------------------
+ */
+int32 OS_FileMap(osal_id_t filedes, osal_offset_t offset, size_t length, uint32 flags, void **addr)
+{
+    UT_GenStub_SetupReturnBuffer(OS_FileMap, int32);
+
+    UT_GenStub_AddParam(OS_FileMap, osal_id_t, filedes);
+    UT_GenStub_AddParam(OS_FileMap, osal_offset_t, offset);
+    UT_GenStub_AddParam(OS_FileMap, size_t, length);
+    UT_GenStub_AddParam(OS_FileMap, uint32, flags);
+    UT_GenStub_AddParam(OS_FileMap, void **, addr);
+
+    UT_GenStub_Execute(OS_FileMap, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_FileMap, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_FileOpenCheck()
@@ -136,6 +245,24 @@ int32 OS_FileOpenCheck(const char *Filename)
     return UT_GenStub_GetReturnValue(OS_FileOpenCheck, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_FileUnmap()
+ * ----------------------------------------------------
+ */
+int32 OS_FileUnmap(osal_id_t filedes, void *addr, uint32 flags)
+{
+    UT_GenStub_SetupReturnBuffer(OS_FileUnmap, int32);
+
+    UT_GenStub_AddParam(OS_FileUnmap, osal_id_t, filedes);
+    UT_GenStub_AddParam(OS_FileUnmap, void *, addr);
+    UT_GenStub_AddParam(OS_FileUnmap, uint32, flags);
+
+    UT_GenStub_Execute(OS_FileUnmap, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_FileUnmap, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_OpenCreate()
@@ -174,6 +301,25 @@ int32 OS_TimedRead(osal_id_t filedes, void *buffer, size_t nbytes, int32 timeout
     return UT_GenStub_GetReturnValue(OS_TimedRead, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_TimedReadv()
+ * ----------------------------------------------------
+ */
+int32 OS_TimedReadv(osal_id_t filedes, const OS_iovec_t *iov, uint32 iovcnt, int32 timeout)
+{
+    UT_GenStub_SetupReturnBuffer(OS_TimedReadv, int32);
+
+    UT_GenStub_AddParam(OS_TimedReadv, osal_id_t, filedes);
+    UT_GenStub_AddParam(OS_TimedReadv, const OS_iovec_t *, iov);
+    UT_GenStub_AddParam(OS_TimedReadv, uint32, iovcnt);
+    UT_GenStub_AddParam(OS_TimedReadv, int32, timeout);
+
+    UT_GenStub_Execute(OS_TimedReadv, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_TimedReadv, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_TimedWrite()
@@ -193,6 +339,25 @@ int32 OS_TimedWrite(osal_id_t filedes, const void *buffer, size_t nbytes, int32
     return UT_GenStub_GetReturnValue(OS_TimedWrite, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_TimedWritev()
+ * ----------------------------------------------------
+ */
+int32 OS_TimedWritev(osal_id_t filedes, const OS_iovec_t *iov, uint32 iovcnt, int32 timeout)
+{
+    UT_GenStub_SetupReturnBuffer(OS_TimedWritev, int32);
+
+    UT_GenStub_AddParam(OS_TimedWritev, osal_id_t, filedes);
+    UT_GenStub_AddParam(OS_TimedWritev, const OS_iovec_t *, iov);
+    UT_GenStub_AddParam(OS_TimedWritev, uint32, iovcnt);
+    UT_GenStub_AddParam(OS_TimedWritev, int32, timeout);
+
+    UT_GenStub_Execute(OS_TimedWritev, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_TimedWritev, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_chmod()
@@ -261,6 +426,25 @@ int32 OS_lseek(osal_id_t filedes, int32 offset, uint32 whence)
     return UT_GenStub_GetReturnValue(OS_lseek, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_lseek64()
+ * ----------------------------------------------------
+ */
+int32 OS_lseek64(osal_id_t filedes, osal_offset_t offset, uint32 whence, osal_offset_t *position)
+{
+    UT_GenStub_SetupReturnBuffer(OS_lseek64, int32);
+
+    UT_GenStub_AddParam(OS_lseek64, osal_id_t, filedes);
+    UT_GenStub_AddParam(OS_lseek64, osal_offset_t, offset);
+    UT_GenStub_AddParam(OS_lseek64, uint32, whence);
+    UT_GenStub_AddParam(OS_lseek64, osal_offset_t *, position);
+
+    UT_GenStub_Execute(OS_lseek64, Basic, UT_DefaultHandler_OS_lseek64);
+
+    return UT_GenStub_GetReturnValue(OS_lseek64, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_mv()
@@ -278,6 +462,44 @@ int32 OS_mv(const char *src, const char *dest)
     return UT_GenStub_GetReturnValue(OS_mv, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_pread()
+ * ----------------------------------------------------
+ */
+int32 OS_pread(osal_id_t filedes, void *buffer, size_t nbytes, osal_offset_t offset)
+{
+    UT_GenStub_SetupReturnBuffer(OS_pread, int32);
+
+    UT_GenStub_AddParam(OS_pread, osal_id_t, filedes);
+    UT_GenStub_AddParam(OS_pread, void *, buffer);
+    UT_GenStub_AddParam(OS_pread, size_t, nbytes);
+    UT_GenStub_AddParam(OS_pread, osal_offset_t, offset);
+
+    UT_GenStub_Execute(OS_pread, Basic, UT_DefaultHandler_OS_pread);
+
+    return UT_GenStub_GetReturnValue(OS_pread, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_pwrite()
+ * ----------------------------------------------------
+ */
+int32 OS_pwrite(osal_id_t filedes, const void *buffer, size_t nbytes, osal_offset_t offset)
+{
+    UT_GenStub_SetupReturnBuffer(OS_pwrite, int32);
+
+    UT_GenStub_AddParam(OS_pwrite, osal_id_t, filedes);
+    UT_GenStub_AddParam(OS_pwrite, const void *, buffer);
+    UT_GenStub_AddParam(OS_pwrite, size_t, nbytes);
+    UT_GenStub_AddParam(OS_pwrite, osal_offset_t, offset);
+
+    UT_GenStub_Execute(OS_pwrite, Basic, UT_DefaultHandler_OS_pwrite);
+
+    return UT_GenStub_GetReturnValue(OS_pwrite, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_read()
@@ -296,6 +518,24 @@ int32 OS_read(osal_id_t filedes, void *buffer, size_t nbytes)
     return UT_GenStub_GetReturnValue(OS_read, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_readv()
+ * ----------------------------------------------------
+ */
+int32 OS_readv(osal_id_t filedes, const OS_iovec_t *iov, uint32 iovcnt)
+{
+    UT_GenStub_SetupReturnBuffer(OS_readv, int32);
+
+    UT_GenStub_AddParam(OS_readv, osal_id_t, filedes);
+    UT_GenStub_AddParam(OS_readv, const OS_iovec_t *, iov);
+    UT_GenStub_AddParam(OS_readv, uint32, iovcnt);
+
+    UT_GenStub_Execute(OS_readv, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_readv, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_remove()
@@ -363,3 +603,21 @@ int32 OS_write(osal_id_t filedes, const void *buffer, size_t nbytes)
 
     return UT_GenStub_GetReturnValue(OS_write, int32);
 }
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_writev()
+ * ----------------------------------------------------
+ */
+int32 OS_writev(osal_id_t filedes, const OS_iovec_t *iov, uint32 iovcnt)
+{
+    UT_GenStub_SetupReturnBuffer(OS_writev, int32);
+
+    UT_GenStub_AddParam(OS_writev, osal_id_t, filedes);
+    UT_GenStub_AddParam(OS_writev, const OS_iovec_t *, iov);
+    UT_GenStub_AddParam(OS_writev, uint32, iovcnt);
+
+    UT_GenStub_Execute(OS_writev, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_writev, int32);
+}
@@ -81,3 +81,21 @@ void UT_DefaultHandler_OS_printf(void *UserObj, UT_EntryKey_t FuncKey, const UT_
         }
     }
 }
+
+/*
+ * -----------------------------------------------------------------
+ * Default handler implementation for 'OS_ConsoleGetStats' stub
+ * -----------------------------------------------------------------
+ */
+void UT_DefaultHandler_OS_ConsoleGetStats(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    OS_console_stats_t *stats = UT_Hook_GetArgValueByName(Context, "stats", OS_console_stats_t *);
+    int32               status;
+
+    UT_Stub_GetInt32StatusCode(Context, &status);
+
+    if (status == OS_SUCCESS && UT_Stub_CopyToLocal(UT_KEY(OS_ConsoleGetStats), stats, sizeof(*stats)) < sizeof(*stats))
+    {
+        memset(stats, 0, sizeof(*stats));
+    }
+}
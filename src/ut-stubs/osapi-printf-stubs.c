@@ -27,6 +27,7 @@
 #include "osapi-printf.h"
 #include "utgenstub.h"
 
+void UT_DefaultHandler_OS_ConsoleGetStats(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_printf(void *, UT_EntryKey_t, const UT_StubContext_t *, va_list);
 
 /*
@@ -66,3 +67,19 @@ void OS_printf_enable(void)
 
     UT_GenStub_Execute(OS_printf_enable, Basic, NULL);
 }
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_ConsoleGetStats()
+ * ----------------------------------------------------
+ */
+int32 OS_ConsoleGetStats(OS_console_stats_t *stats)
+{
+    UT_GenStub_SetupReturnBuffer(OS_ConsoleGetStats, int32);
+
+    UT_GenStub_AddParam(OS_ConsoleGetStats, OS_console_stats_t *, stats);
+
+    UT_GenStub_Execute(OS_ConsoleGetStats, Basic, UT_DefaultHandler_OS_ConsoleGetStats);
+
+    return UT_GenStub_GetReturnValue(OS_ConsoleGetStats, int32);
+}
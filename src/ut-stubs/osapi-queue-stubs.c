@@ -32,6 +32,43 @@ void UT_DefaultHandler_OS_QueueGetIdByName(void *, UT_EntryKey_t, const UT_StubC
 void UT_DefaultHandler_OS_QueueGetInfo(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_QueuePut(void *, UT_EntryKey_t, const UT_StubContext_t *);
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_QueueBorrow()
+ * ----------------------------------------------------
+ */
+int32 OS_QueueBorrow(osal_id_t queue_id, const void **buffer, size_t *size_copied, int32 timeout)
+{
+    UT_GenStub_SetupReturnBuffer(OS_QueueBorrow, int32);
+
+    UT_GenStub_AddParam(OS_QueueBorrow, osal_id_t, queue_id);
+    UT_GenStub_AddParam(OS_QueueBorrow, const void **, buffer);
+    UT_GenStub_AddParam(OS_QueueBorrow, size_t *, size_copied);
+    UT_GenStub_AddParam(OS_QueueBorrow, int32, timeout);
+
+    UT_GenStub_Execute(OS_QueueBorrow, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_QueueBorrow, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_QueueCommit()
+ * ----------------------------------------------------
+ */
+int32 OS_QueueCommit(osal_id_t queue_id, void *buffer, size_t size)
+{
+    UT_GenStub_SetupReturnBuffer(OS_QueueCommit, int32);
+
+    UT_GenStub_AddParam(OS_QueueCommit, osal_id_t, queue_id);
+    UT_GenStub_AddParam(OS_QueueCommit, void *, buffer);
+    UT_GenStub_AddParam(OS_QueueCommit, size_t, size);
+
+    UT_GenStub_Execute(OS_QueueCommit, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_QueueCommit, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_QueueCreate()
@@ -123,6 +160,29 @@ int32 OS_QueueGetInfo(osal_id_t queue_id, OS_queue_prop_t *queue_prop)
     return UT_GenStub_GetReturnValue(OS_QueueGetInfo, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_QueueGetMulti()
+ * ----------------------------------------------------
+ */
+int32 OS_QueueGetMulti(osal_id_t queue_id, void *const *data, size_t size, size_t *size_copied, uint32 count,
+                       uint32 *count_copied, int32 timeout)
+{
+    UT_GenStub_SetupReturnBuffer(OS_QueueGetMulti, int32);
+
+    UT_GenStub_AddParam(OS_QueueGetMulti, osal_id_t, queue_id);
+    UT_GenStub_AddParam(OS_QueueGetMulti, void *const *, data);
+    UT_GenStub_AddParam(OS_QueueGetMulti, size_t, size);
+    UT_GenStub_AddParam(OS_QueueGetMulti, size_t *, size_copied);
+    UT_GenStub_AddParam(OS_QueueGetMulti, uint32, count);
+    UT_GenStub_AddParam(OS_QueueGetMulti, uint32 *, count_copied);
+    UT_GenStub_AddParam(OS_QueueGetMulti, int32, timeout);
+
+    UT_GenStub_Execute(OS_QueueGetMulti, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_QueueGetMulti, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_QueuePut()
@@ -141,3 +201,59 @@ int32 OS_QueuePut(osal_id_t queue_id, const void *data, size_t size, uint32 flag
 
     return UT_GenStub_GetReturnValue(OS_QueuePut, int32);
 }
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_QueuePutMulti()
+ * ----------------------------------------------------
+ */
+int32 OS_QueuePutMulti(osal_id_t queue_id, const void *const *data, const size_t *size, uint32 count, uint32 *count_put,
+                       uint32 flags)
+{
+    UT_GenStub_SetupReturnBuffer(OS_QueuePutMulti, int32);
+
+    UT_GenStub_AddParam(OS_QueuePutMulti, osal_id_t, queue_id);
+    UT_GenStub_AddParam(OS_QueuePutMulti, const void *const *, data);
+    UT_GenStub_AddParam(OS_QueuePutMulti, const size_t *, size);
+    UT_GenStub_AddParam(OS_QueuePutMulti, uint32, count);
+    UT_GenStub_AddParam(OS_QueuePutMulti, uint32 *, count_put);
+    UT_GenStub_AddParam(OS_QueuePutMulti, uint32, flags);
+
+    UT_GenStub_Execute(OS_QueuePutMulti, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_QueuePutMulti, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_QueueRelease()
+ * ----------------------------------------------------
+ */
+int32 OS_QueueRelease(osal_id_t queue_id, const void *buffer)
+{
+    UT_GenStub_SetupReturnBuffer(OS_QueueRelease, int32);
+
+    UT_GenStub_AddParam(OS_QueueRelease, osal_id_t, queue_id);
+    UT_GenStub_AddParam(OS_QueueRelease, const void *, buffer);
+
+    UT_GenStub_Execute(OS_QueueRelease, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_QueueRelease, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_QueueReserve()
+ * ----------------------------------------------------
+ */
+int32 OS_QueueReserve(osal_id_t queue_id, void **buffer)
+{
+    UT_GenStub_SetupReturnBuffer(OS_QueueReserve, int32);
+
+    UT_GenStub_AddParam(OS_QueueReserve, osal_id_t, queue_id);
+    UT_GenStub_AddParam(OS_QueueReserve, void **, buffer);
+
+    UT_GenStub_Execute(OS_QueueReserve, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_QueueReserve, int32);
+}
@@ -92,6 +92,113 @@ int32 OS_SelectFdZero(OS_FdSet *Set)
     return UT_GenStub_GetReturnValue(OS_SelectFdZero, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_SelectGroupAdd()
+ * ----------------------------------------------------
+ */
+int32 OS_SelectGroupAdd(osal_id_t group_id, osal_id_t objid, uint32 StateFlags)
+{
+    UT_GenStub_SetupReturnBuffer(OS_SelectGroupAdd, int32);
+
+    UT_GenStub_AddParam(OS_SelectGroupAdd, osal_id_t, group_id);
+    UT_GenStub_AddParam(OS_SelectGroupAdd, osal_id_t, objid);
+    UT_GenStub_AddParam(OS_SelectGroupAdd, uint32, StateFlags);
+
+    UT_GenStub_Execute(OS_SelectGroupAdd, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_SelectGroupAdd, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_SelectGroupCreate()
+ * ----------------------------------------------------
+ */
+int32 OS_SelectGroupCreate(osal_id_t *group_id, const char *group_name, uint32 options)
+{
+    UT_GenStub_SetupReturnBuffer(OS_SelectGroupCreate, int32);
+
+    UT_GenStub_AddParam(OS_SelectGroupCreate, osal_id_t *, group_id);
+    UT_GenStub_AddParam(OS_SelectGroupCreate, const char *, group_name);
+    UT_GenStub_AddParam(OS_SelectGroupCreate, uint32, options);
+
+    UT_GenStub_Execute(OS_SelectGroupCreate, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_SelectGroupCreate, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_SelectGroupDelete()
+ * ----------------------------------------------------
+ */
+int32 OS_SelectGroupDelete(osal_id_t group_id)
+{
+    UT_GenStub_SetupReturnBuffer(OS_SelectGroupDelete, int32);
+
+    UT_GenStub_AddParam(OS_SelectGroupDelete, osal_id_t, group_id);
+
+    UT_GenStub_Execute(OS_SelectGroupDelete, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_SelectGroupDelete, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_SelectGroupGetIdByName()
+ * ----------------------------------------------------
+ */
+int32 OS_SelectGroupGetIdByName(osal_id_t *group_id, const char *group_name)
+{
+    UT_GenStub_SetupReturnBuffer(OS_SelectGroupGetIdByName, int32);
+
+    UT_GenStub_AddParam(OS_SelectGroupGetIdByName, osal_id_t *, group_id);
+    UT_GenStub_AddParam(OS_SelectGroupGetIdByName, const char *, group_name);
+
+    UT_GenStub_Execute(OS_SelectGroupGetIdByName, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_SelectGroupGetIdByName, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_SelectGroupRemove()
+ * ----------------------------------------------------
+ */
+int32 OS_SelectGroupRemove(osal_id_t group_id, osal_id_t objid)
+{
+    UT_GenStub_SetupReturnBuffer(OS_SelectGroupRemove, int32);
+
+    UT_GenStub_AddParam(OS_SelectGroupRemove, osal_id_t, group_id);
+    UT_GenStub_AddParam(OS_SelectGroupRemove, osal_id_t, objid);
+
+    UT_GenStub_Execute(OS_SelectGroupRemove, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_SelectGroupRemove, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_SelectGroupWait()
+ * ----------------------------------------------------
+ */
+int32 OS_SelectGroupWait(osal_id_t group_id, OS_SelectGroupEvent_t *Events, uint32 MaxEvents, uint32 *EventCount,
+                         int32 msecs)
+{
+    UT_GenStub_SetupReturnBuffer(OS_SelectGroupWait, int32);
+
+    UT_GenStub_AddParam(OS_SelectGroupWait, osal_id_t, group_id);
+    UT_GenStub_AddParam(OS_SelectGroupWait, OS_SelectGroupEvent_t *, Events);
+    UT_GenStub_AddParam(OS_SelectGroupWait, uint32, MaxEvents);
+    UT_GenStub_AddParam(OS_SelectGroupWait, uint32 *, EventCount);
+    UT_GenStub_AddParam(OS_SelectGroupWait, int32, msecs);
+
+    UT_GenStub_Execute(OS_SelectGroupWait, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_SelectGroupWait, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_SelectMultiple()
@@ -301,6 +301,44 @@ int32 OS_SocketRecvFromAbs(osal_id_t sock_id, void *buffer, size_t buflen, OS_So
     return UT_GenStub_GetReturnValue(OS_SocketRecvFromAbs, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_SocketRecvFromMulti()
+ * ----------------------------------------------------
+ */
+int32 OS_SocketRecvFromMulti(osal_id_t sock_id, OS_SockMsg_t *Msgs, uint32 MsgCount, int32 timeout)
+{
+    UT_GenStub_SetupReturnBuffer(OS_SocketRecvFromMulti, int32);
+
+    UT_GenStub_AddParam(OS_SocketRecvFromMulti, osal_id_t, sock_id);
+    UT_GenStub_AddParam(OS_SocketRecvFromMulti, OS_SockMsg_t *, Msgs);
+    UT_GenStub_AddParam(OS_SocketRecvFromMulti, uint32, MsgCount);
+    UT_GenStub_AddParam(OS_SocketRecvFromMulti, int32, timeout);
+
+    UT_GenStub_Execute(OS_SocketRecvFromMulti, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_SocketRecvFromMulti, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_SocketRecvFromMultiAbs()
+ * ----------------------------------------------------
+ */
+int32 OS_SocketRecvFromMultiAbs(osal_id_t sock_id, OS_SockMsg_t *Msgs, uint32 MsgCount, OS_time_t abs_timeout)
+{
+    UT_GenStub_SetupReturnBuffer(OS_SocketRecvFromMultiAbs, int32);
+
+    UT_GenStub_AddParam(OS_SocketRecvFromMultiAbs, osal_id_t, sock_id);
+    UT_GenStub_AddParam(OS_SocketRecvFromMultiAbs, OS_SockMsg_t *, Msgs);
+    UT_GenStub_AddParam(OS_SocketRecvFromMultiAbs, uint32, MsgCount);
+    UT_GenStub_AddParam(OS_SocketRecvFromMultiAbs, OS_time_t, abs_timeout);
+
+    UT_GenStub_Execute(OS_SocketRecvFromMultiAbs, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_SocketRecvFromMultiAbs, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_SocketSendTo()
@@ -320,6 +358,43 @@ int32 OS_SocketSendTo(osal_id_t sock_id, const void *buffer, size_t buflen, cons
     return UT_GenStub_GetReturnValue(OS_SocketSendTo, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_SocketSendToMulti()
+ * ----------------------------------------------------
+ */
+int32 OS_SocketSendToMulti(osal_id_t sock_id, OS_SockMsg_t *Msgs, uint32 MsgCount)
+{
+    UT_GenStub_SetupReturnBuffer(OS_SocketSendToMulti, int32);
+
+    UT_GenStub_AddParam(OS_SocketSendToMulti, osal_id_t, sock_id);
+    UT_GenStub_AddParam(OS_SocketSendToMulti, OS_SockMsg_t *, Msgs);
+    UT_GenStub_AddParam(OS_SocketSendToMulti, uint32, MsgCount);
+
+    UT_GenStub_Execute(OS_SocketSendToMulti, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_SocketSendToMulti, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_SocketSendToV()
+ * ----------------------------------------------------
+ */
+int32 OS_SocketSendToV(osal_id_t sock_id, const OS_iovec_t *iov, uint32 iovcnt, const OS_SockAddr_t *RemoteAddr)
+{
+    UT_GenStub_SetupReturnBuffer(OS_SocketSendToV, int32);
+
+    UT_GenStub_AddParam(OS_SocketSendToV, osal_id_t, sock_id);
+    UT_GenStub_AddParam(OS_SocketSendToV, const OS_iovec_t *, iov);
+    UT_GenStub_AddParam(OS_SocketSendToV, uint32, iovcnt);
+    UT_GenStub_AddParam(OS_SocketSendToV, const OS_SockAddr_t *, RemoteAddr);
+
+    UT_GenStub_Execute(OS_SocketSendToV, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_SocketSendToV, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_SocketShutdown()